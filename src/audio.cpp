@@ -1239,7 +1239,9 @@ void update_audio (void)
     /* Test if new sample needs to be outputted */
   	if ((rounded == best_evtime) && (currprefs.produce_sound > 1)) {
   		next_sample_evtime += scaled_sample_evtime;
-      (*sample_handler) ();
+      /* frames run ahead are heard again when they run for real */
+      if (!runahead_phase)
+        (*sample_handler) ();
   	}
 
   	for (i = 0; i < 4; i++) {
@@ -1472,3 +1474,30 @@ uae_u8 *save_audio (int nr, int *len, uae_u8 *dstptr)
   *len = dst - dstbak;
   return dstbak;
 }
+
+/* the channels as they are, save_audio leaves out the samples in flight */
+uae_u8 *restore_audio_runahead (uae_u8 *src)
+{
+  restore_raw (audio_channel);
+  restore_raw (audio_work_to_do);
+  restore_raw (last_cycles);
+  restore_raw (next_sample_evtime);
+  return src;
+}
+
+uae_u8 *save_audio_runahead (int *len, uae_u8 *dstptr)
+{
+  uae_u8 *dstbak, *dst;
+
+  if (dstptr)
+    dstbak = dst = dstptr;
+  else
+    dstbak = dst = xmalloc (uae_u8, sizeof audio_channel + sizeof audio_work_to_do
+      + sizeof last_cycles + sizeof next_sample_evtime);
+  save_raw (audio_channel);
+  save_raw (audio_work_to_do);
+  save_raw (last_cycles);
+  save_raw (next_sample_evtime);
+  *len = dst - dstbak;
+  return dstbak;
+}
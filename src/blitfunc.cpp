@@ -15,7 +15,7 @@
 	notaz: too :)
 */
 
-void blitdofast_0 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_0 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 unsigned int i,j,hblitsize,bltdmod;
 if (!ptd || !b->hblitsize) return;
@@ -31,7 +31,7 @@ do {
 	ptd += bltdmod;
 } while (--j);
 }
-void blitdofast_desc_0 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_0 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 unsigned int i,j,hblitsize,bltdmod;
 if (!ptd || !b->hblitsize) return;
@@ -47,14 +47,14 @@ do {
 	ptd -= bltdmod;
 } while (--j);
 }
-void blitdofast_a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 unsigned int i,j;
 uae_u32 totald = 0;
 uae_u32 preva = 0;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 hblitsize = b->hblitsize;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - hblitsize;
 if (!hblitsize) return;
@@ -82,14 +82,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 preva = 0;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 hblitsize = b->hblitsize;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - hblitsize;
 for (j = b->vblitsize; j--;) {
@@ -115,7 +115,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_2a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_2a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -123,7 +123,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -156,7 +156,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_2a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_2a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -164,7 +164,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -196,14 +196,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_30 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_30 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
 uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -233,14 +233,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_30 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_30 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -269,7 +269,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_3a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_3a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -277,7 +277,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -310,7 +310,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_3a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_3a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -318,7 +318,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -350,14 +350,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_3c (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_3c (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
 uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -387,14 +387,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_3c (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_3c (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -423,7 +423,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_4a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_4a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -431,7 +431,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -464,7 +464,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_4a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_4a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -472,7 +472,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -504,7 +504,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_6a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_6a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -512,7 +512,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -545,7 +545,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_6a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_6a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -553,7 +553,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -585,7 +585,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_8a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_8a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -593,7 +593,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -626,7 +626,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_8a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_8a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -634,7 +634,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -666,7 +666,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_8c (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_8c (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -674,7 +674,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -707,7 +707,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_8c (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_8c (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -715,7 +715,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -747,7 +747,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_9a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_9a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -755,7 +755,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -788,7 +788,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_9a (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_9a (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -796,7 +796,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -828,7 +828,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_a8 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_a8 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -836,7 +836,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -869,7 +869,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_a8 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_a8 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -877,7 +877,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -909,13 +909,13 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_aa (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_aa (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 totald = 0;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
 		uae_u32 bltadat, srca;
@@ -935,13 +935,13 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_aa (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_aa (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
 		uae_u32 bltadat, srca;
@@ -960,7 +960,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_b1 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_b1 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -968,7 +968,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1001,7 +1001,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_b1 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_b1 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -1009,7 +1009,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1041,7 +1041,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_ca (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_ca (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -1049,7 +1049,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1082,7 +1082,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_ca (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_ca (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -1090,7 +1090,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1122,14 +1122,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_cc (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_cc (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 prevb = 0;
 uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
 		uae_u32 bltadat, srca;
@@ -1153,14 +1153,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_cc (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_cc (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
 		uae_u32 bltadat, srca;
@@ -1183,7 +1183,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_d8 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_d8 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -1191,7 +1191,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1224,7 +1224,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_d8 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_d8 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -1232,7 +1232,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1264,7 +1264,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_e2 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_e2 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -1272,7 +1272,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1305,7 +1305,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_e2 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_e2 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -1313,7 +1313,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1345,7 +1345,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_ea (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_ea (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
@@ -1353,7 +1353,7 @@ uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1386,7 +1386,7 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_ea (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_ea (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
@@ -1394,7 +1394,7 @@ uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1426,13 +1426,13 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_f0 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_f0 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0;
 uae_u32 totald = 0;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1455,13 +1455,13 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_f0 (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_f0 (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 preva = 0;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1483,14 +1483,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_fa (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_fa (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0;
 uae_u32 totald = 0;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1516,14 +1516,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_fa (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_fa (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 preva = 0;
 uae_u32 srcc = b->bltcdat;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1548,14 +1548,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_fc (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_fc (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 int i,j;
 uae_u32 preva = 0, prevb = 0;
 uae_u32 totald = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
@@ -1585,14 +1585,14 @@ if (dstp)
   do_put_mem_word ((uae_u16 *)dstp, dstd);
 if ((totald<<16) != 0) b->blitzero = 0;
 }
-void blitdofast_desc_fc (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *_GCCRES_ b)
+void blitdofast_desc_fc (uae_u8 *pta, uae_u8 *ptb, uae_u8 *ptc, uae_u8 *ptd, struct bltinfo *_GCCRES_ b)
 {
 uae_u32 totald = 0;
 int i,j;
 uae_u32 preva = 0, prevb = 0;
 uae_u32 srcb = b->bltbhold;
 uae_u32 dstd=0;
-uaecptr dstp = 0;
+uae_u8 *dstp = 0;
 uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - b->hblitsize;
 for (j = b->vblitsize; j--;) {
 	for (i = b->hblitsize; i--;) {
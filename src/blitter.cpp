@@ -226,26 +226,26 @@ STATIC_INLINE void blitter_done (void)
 static void blitter_dofast(void)
 {
   int i,j;
-  uaecptr bltadatptr = 0, bltbdatptr = 0, bltcdatptr = 0, bltddatptr = 0;
+  uae_u8 *bltadatptr = 0, *bltbdatptr = 0, *bltcdatptr = 0, *bltddatptr = 0;
   uae_u8 mt = bltcon0 & 0xFF;
 
   blit_masktable[BLITTER_MAX_WORDS - 1] = blt_info.bltafwm;
   blit_masktable[BLITTER_MAX_WORDS - blt_info.hblitsize] &= blt_info.bltalwm;
 
   if (bltcon0 & 0x800) {
-	  bltadatptr = (uaecptr)get_real_address(bltapt);
+	  bltadatptr = get_real_address(bltapt);
 	  bltapt += (blt_info.hblitsize * 2 + blt_info.bltamod) * blt_info.vblitsize;
   }
   if (bltcon0 & 0x400) {
-	  bltbdatptr = (uaecptr)get_real_address(bltbpt);
+	  bltbdatptr = get_real_address(bltbpt);
 	  bltbpt += (blt_info.hblitsize * 2 + blt_info.bltbmod) * blt_info.vblitsize;
   }
   if (bltcon0 & 0x200) {
-	  bltcdatptr = (uaecptr)get_real_address(bltcpt);
+	  bltcdatptr = get_real_address(bltcpt);
 	  bltcpt += (blt_info.hblitsize * 2 + blt_info.bltcmod) * blt_info.vblitsize;
   }
   if (bltcon0 & 0x100) {
-    bltddatptr = (uaecptr)get_real_address(bltdpt);
+    bltddatptr = get_real_address(bltdpt);
     bltdpt += (blt_info.hblitsize * 2 + blt_info.bltdmod) * blt_info.vblitsize;
   }
 
@@ -255,7 +255,7 @@ static void blitter_dofast(void)
   {
 	  uae_u32 blitbhold = blt_info.bltbhold;
     uae_u32 preva = 0, prevb = 0;
-	  uaecptr dstp = 0;
+	  uae_u8 *dstp = 0;
 	  uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - blt_info.hblitsize;
 
   	for (j = blt_info.vblitsize; j--;) {
@@ -322,26 +322,26 @@ static void blitter_dofast(void)
 static void blitter_dofast_desc(void)
 {
   int i,j;
-  uaecptr bltadatptr = 0, bltbdatptr = 0, bltcdatptr = 0, bltddatptr = 0;
+  uae_u8 *bltadatptr = 0, *bltbdatptr = 0, *bltcdatptr = 0, *bltddatptr = 0;
   uae_u8 mt = bltcon0 & 0xFF;
 
   blit_masktable[BLITTER_MAX_WORDS - 1] = blt_info.bltafwm;
   blit_masktable[BLITTER_MAX_WORDS - blt_info.hblitsize] &= blt_info.bltalwm;
 
   if (bltcon0 & 0x800) {
-	  bltadatptr = (uaecptr)get_real_address(bltapt);
+	  bltadatptr = get_real_address(bltapt);
 	  bltapt -= (blt_info.hblitsize * 2 + blt_info.bltamod) * blt_info.vblitsize;
   }
   if (bltcon0 & 0x400) {
-	  bltbdatptr = (uaecptr)get_real_address(bltbpt);
+	  bltbdatptr = get_real_address(bltbpt);
 	  bltbpt -= (blt_info.hblitsize * 2 + blt_info.bltbmod) * blt_info.vblitsize;
   }
   if (bltcon0 & 0x200) {
-	  bltcdatptr = (uaecptr)get_real_address(bltcpt);
+	  bltcdatptr = get_real_address(bltcpt);
 	  bltcpt -= (blt_info.hblitsize * 2 + blt_info.bltcmod) * blt_info.vblitsize;
   }
   if (bltcon0 & 0x100) {
-    bltddatptr = (uaecptr)get_real_address(bltdpt);
+    bltddatptr = get_real_address(bltdpt);
     bltdpt -= (blt_info.hblitsize * 2 + blt_info.bltdmod) * blt_info.vblitsize;
   }
   if (blitfunc_dofast_desc[mt] && !blitfill) {
@@ -350,7 +350,7 @@ static void blitter_dofast_desc(void)
   {
 	  uae_u32 blitbhold = blt_info.bltbhold;
     uae_u32 preva = 0, prevb = 0;
-	  uaecptr dstp = 0;
+	  uae_u8 *dstp = 0;
 	  uae_u32 *blit_masktable_p = blit_masktable + BLITTER_MAX_WORDS - blt_info.hblitsize;
 
 	  for (j = blt_info.vblitsize; j--;) {
@@ -379,6 +379,7 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
   cfgfile_write_str (f, _T("sound_filter_type"), soundfiltermode2[p->sound_filter_type]);
 
   cfgfile_write (f, _T("cachesize"), _T("%d"), p->cachesize);
+  cfgfile_write_bool (f, _T("compfpu"), p->compfpu);
 
 	cfgfile_write_bool (f, _T("bsdsocket_emu"), p->socket_emu);
 
@@ -438,6 +439,8 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
   cfgfile_write_bool (f, _T("cpu_compatible"), p->cpu_compatible);
   cfgfile_write_bool (f, _T("cpu_24bit_addressing"), p->address_space_24);
   /* do not reorder end */
+  cfgfile_write_bool (f, _T("cpu_pairs"), p->cpu_pairs);
+  cfgfile_write_bool (f, _T("cpu_predecode"), p->cpu_predecode);
   cfgfile_write (f, _T("rtg_modes"), _T("0x%x"), p->picasso96_modeflags);
 
 #ifdef FILESYS
@@ -1080,7 +1083,10 @@ static int cfgfile_parse_hardware (struct uae_prefs *p, const TCHAR *option, TCH
 	  || cfgfile_yesno (option, value, _T("fast_copper"), &p->fast_copper)
 	  || cfgfile_yesno (option, value, _T("ntsc"), &p->ntscmode)
 	  || cfgfile_yesno (option, value, _T("cpu_compatible"), &p->cpu_compatible)
-	  || cfgfile_yesno (option, value, _T("cpu_24bit_addressing"), &p->address_space_24))
+	  || cfgfile_yesno (option, value, _T("cpu_24bit_addressing"), &p->address_space_24)
+	  || cfgfile_yesno (option, value, _T("cpu_pairs"), &p->cpu_pairs)
+	  || cfgfile_yesno (option, value, _T("cpu_predecode"), &p->cpu_predecode)
+	  || cfgfile_yesno (option, value, _T("compfpu"), &p->compfpu))
 	  return 1;
   if (cfgfile_intval (option, value, _T("cachesize"), &p->cachesize, 1)
 	  || cfgfile_intval (option, value, _T("chipset_refreshrate"), &p->chipset_refreshrate, 1)
@@ -1736,6 +1742,7 @@ void default_prefs (struct uae_prefs *p, int type)
   p->sound_filter_type = 0;
 
   p->cachesize = DEFAULT_JIT_CACHE_SIZE;
+  p->compfpu = true;
 
   for (i = 0;i < 10; i++)
 	  p->optcount[i] = -1;
@@ -1795,6 +1802,8 @@ void default_prefs (struct uae_prefs *p, int type)
   p->m68k_speed = 0;
   p->cpu_compatible = 0;
   p->address_space_24 = 1;
+  p->cpu_pairs = 0;
+  p->cpu_predecode = 0;
   p->chipset_mask = CSMASK_ECS_AGNUS;
   p->ntscmode = 0;
 
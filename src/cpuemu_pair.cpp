@@ -0,0 +1,4084 @@
+#include "sysconfig.h"
+#include "sysdeps.h"
+#include "options.h"
+#include "memory.h"
+#include "newcpu.h"
+#include "custom.h"
+#include "cpu_prefetch.h"
+#include "cputbl.h"
+#define CPUFUNC(x) x##_ff
+#define SET_CFLG_ALWAYS(x) SET_CFLG(x)
+#define SET_NFLG_ALWAYS(x) SET_NFLG(x)
+#ifdef NOFLAGS
+#include "noflags.h"
+#endif
+
+extern cpuop_func CPUFUNC(op_pair_7000_1);
+extern cpuop_func CPUFUNC(op_pair_b080_1);
+extern cpuop_func CPUFUNC(op_pair_b068_1);
+extern cpuop_func CPUFUNC(op_pair_9040_1);
+extern cpuop_func CPUFUNC(op_pair_3008_1);
+extern cpuop_func CPUFUNC(op_pair_c080_1);
+extern cpuop_func CPUFUNC(op_pair_6d01_1);
+extern cpuop_func CPUFUNC(op_pair_1018_1);
+extern cpuop_func CPUFUNC(op_pair_6701_1);
+extern cpuop_func CPUFUNC(op_pair_1000_1);
+extern cpuop_func CPUFUNC(op_pair_4600_1);
+extern cpuop_func CPUFUNC(op_pair_c110_1);
+extern cpuop_func CPUFUNC(op_pair_6601_1);
+extern cpuop_func CPUFUNC(op_pair_e088_1);
+extern cpuop_func CPUFUNC(op_pair_0c50_1);
+extern cpuop_func CPUFUNC(op_pair_5088_1);
+extern cpuop_func CPUFUNC(op_pair_b088_1);
+extern cpuop_func CPUFUNC(op_pair_6200_1);
+extern cpuop_func CPUFUNC(op_pair_6600_1);
+extern cpuop_func CPUFUNC(op_pair_5188_1);
+extern cpuop_func CPUFUNC(op_pair_20c0_1);
+extern cpuop_func CPUFUNC(op_pair_6501_1);
+extern cpuop_func CPUFUNC(op_pair_5180_1);
+extern cpuop_func CPUFUNC(op_pair_d098_1);
+extern cpuop_func CPUFUNC(op_pair_4a00_1);
+extern cpuop_func CPUFUNC(op_pair_6401_1);
+extern cpuop_func CPUFUNC(op_pair_4a80_1);
+extern cpuop_func CPUFUNC(op_pair_6c01_1);
+extern cpuop_func CPUFUNC(op_pair_5100_1);
+extern cpuop_func CPUFUNC(op_pair_6f01_1);
+extern cpuop_func CPUFUNC(op_pair_10c0_1);
+extern cpuop_func CPUFUNC(op_pair_4ea8_1);
+extern cpuop_func CPUFUNC(op_pair_6001_1);
+extern cpuop_func CPUFUNC(op_pair_2068_1);
+extern cpuop_func CPUFUNC(op_pair_4cd8_1);
+extern cpuop_func CPUFUNC(op_pair_2058_1);
+extern cpuop_func CPUFUNC(op_pair_4e75_1);
+extern cpuop_func CPUFUNC(op_pair_5080_1);
+
+/* MOVEQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_7000_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_7000_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L Dn,Dn */
+	if (f == CPUFUNC(op_b080_0) || f == CPUFUNC(op_pair_b080_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b080_0)(next, regs);
+	}
+	/* MOVE.B (An)+,Dn */
+	if (f == CPUFUNC(op_1018_0) || f == CPUFUNC(op_pair_1018_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1018_0)(next, regs);
+	}
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_0) || f == CPUFUNC(op_pair_b088_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_0)(next, regs);
+	}
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_0) || f == CPUFUNC(op_pair_4600_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b080_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_0) || f == CPUFUNC(op_pair_6601_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W (d16,An),Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b068_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b068_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LT) */
+	if (f == CPUFUNC(op_6d01_0) || f == CPUFUNC(op_pair_6d01_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6d01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUB.W Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_9040_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_9040_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W (d16,An),Dn */
+	if (f == CPUFUNC(op_b068_0) || f == CPUFUNC(op_pair_b068_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b068_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.W An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_3008_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_3008_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUB.W Dn,Dn */
+	if (f == CPUFUNC(op_9040_0) || f == CPUFUNC(op_pair_9040_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_9040_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c080_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (EQ) */
+	if (f == CPUFUNC(op_6701_0) || f == CPUFUNC(op_pair_6701_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6701_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LT) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6d01_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6d01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1018_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1018_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.L Dn,Dn */
+	if (f == CPUFUNC(op_c080_0) || f == CPUFUNC(op_pair_c080_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c080_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (EQ) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6701_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6701_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,Dn */
+	if (f == CPUFUNC(op_1000_0) || f == CPUFUNC(op_pair_1000_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1000_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1000_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_0) || f == CPUFUNC(op_pair_4600_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* NOT.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4600_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4600_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.B Dn,(An) */
+	if (f == CPUFUNC(op_c110_0) || f == CPUFUNC(op_pair_c110_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c110_0)(next, regs);
+	}
+	/* BccQ.B #<data> (T) */
+	if (f == CPUFUNC(op_6001_0) || f == CPUFUNC(op_pair_6001_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6001_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.B Dn,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c110_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c110_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6601_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6601_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* LSRQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_e088_0) || f == CPUFUNC(op_pair_e088_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_e088_0)(next, regs);
+	}
+	/* ADD.L (An)+,Dn */
+	if (f == CPUFUNC(op_d098_0) || f == CPUFUNC(op_pair_d098_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_d098_0)(next, regs);
+	}
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* LSRQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_e088_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_e088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_0) || f == CPUFUNC(op_pair_3008_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W #<data>.W,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_0c50_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_0c50_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (NE) */
+	if (f == CPUFUNC(op_6600_0) || f == CPUFUNC(op_pair_6600_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5088_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_0) || f == CPUFUNC(op_pair_b088_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_0)(next, regs);
+	}
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b088_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (HI) */
+	if (f == CPUFUNC(op_6200_0) || f == CPUFUNC(op_pair_6200_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6200_0)(next, regs);
+	}
+	/* BccQ.B #<data> (CS) */
+	if (f == CPUFUNC(op_6501_0) || f == CPUFUNC(op_pair_6501_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6501_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (HI) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6200_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6200_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W #<data>.W,(An) */
+	if (f == CPUFUNC(op_0c50_0) || f == CPUFUNC(op_pair_0c50_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_0c50_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6600_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6600_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5188_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5188_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.L Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_20c0_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_20c0_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5188_0) || f == CPUFUNC(op_pair_5188_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5188_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CS) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6501_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6501_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.L Dn,(An)+ */
+	if (f == CPUFUNC(op_20c0_0) || f == CPUFUNC(op_pair_20c0_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_20c0_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5180_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5180_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_0) || f == CPUFUNC(op_pair_6601_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_0)(next, regs);
+	}
+	/* SUBQ.B #<data>,Dn */
+	if (f == CPUFUNC(op_5100_0) || f == CPUFUNC(op_pair_5100_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5100_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADD.L (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_d098_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_d098_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (CC) */
+	if (f == CPUFUNC(op_6401_0) || f == CPUFUNC(op_pair_6401_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6401_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a00_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a00_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (GE) */
+	if (f == CPUFUNC(op_6c01_0) || f == CPUFUNC(op_pair_6c01_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6c01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CC) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6401_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6401_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	/* ADDQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5080_0) || f == CPUFUNC(op_pair_5080_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5080_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.L Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a80_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a80_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LE) */
+	if (f == CPUFUNC(op_6f01_0) || f == CPUFUNC(op_pair_6f01_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6f01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (GE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6c01_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6c01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,(An)+ */
+	if (f == CPUFUNC(op_10c0_0) || f == CPUFUNC(op_pair_10c0_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_10c0_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.B #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5100_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5100_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.L Dn */
+	if (f == CPUFUNC(op_4a80_0) || f == CPUFUNC(op_pair_4a80_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a80_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6f01_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6f01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.B Dn */
+	if (f == CPUFUNC(op_4a00_0) || f == CPUFUNC(op_pair_4a00_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a00_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_10c0_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_10c0_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* JSR.L (d16,An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4ea8_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4ea8_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* JMP.L (xxx).L */
+	if (f == CPUFUNC(op_4ef9_0)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4ef9_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (T) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6001_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6001_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_0) || f == CPUFUNC(op_pair_3008_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (d16,An),An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2068_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2068_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEA.L (d16,An),An */
+	if (f == CPUFUNC(op_2068_0) || f == CPUFUNC(op_pair_2068_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_2068_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MVMEL.L #<data>.W,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4cd8_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4cd8_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_0) || f == CPUFUNC(op_pair_4e75_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (An)+,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2058_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2058_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_0) || f == CPUFUNC(op_pair_4e75_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* RTS.L  */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4e75_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4e75_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5080_1)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_1)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	return cycles;
+}
+
+const struct cputbl CPUFUNC(op_pairtbl_1)[] = {
+{ CPUFUNC(op_pair_7000_1), 28672 },
+{ CPUFUNC(op_pair_b080_1), 45184 },
+{ CPUFUNC(op_pair_b068_1), 45160 },
+{ CPUFUNC(op_pair_9040_1), 36928 },
+{ CPUFUNC(op_pair_3008_1), 12296 },
+{ CPUFUNC(op_pair_c080_1), 49280 },
+{ CPUFUNC(op_pair_6d01_1), 27905 },
+{ CPUFUNC(op_pair_1018_1), 4120 },
+{ CPUFUNC(op_pair_6701_1), 26369 },
+{ CPUFUNC(op_pair_1000_1), 4096 },
+{ CPUFUNC(op_pair_4600_1), 17920 },
+{ CPUFUNC(op_pair_c110_1), 49424 },
+{ CPUFUNC(op_pair_6601_1), 26113 },
+{ CPUFUNC(op_pair_e088_1), 57480 },
+{ CPUFUNC(op_pair_0c50_1), 3152 },
+{ CPUFUNC(op_pair_5088_1), 20616 },
+{ CPUFUNC(op_pair_b088_1), 45192 },
+{ CPUFUNC(op_pair_6200_1), 25088 },
+{ CPUFUNC(op_pair_6600_1), 26112 },
+{ CPUFUNC(op_pair_5188_1), 20872 },
+{ CPUFUNC(op_pair_20c0_1), 8384 },
+{ CPUFUNC(op_pair_6501_1), 25857 },
+{ CPUFUNC(op_pair_5180_1), 20864 },
+{ CPUFUNC(op_pair_d098_1), 53400 },
+{ CPUFUNC(op_pair_4a00_1), 18944 },
+{ CPUFUNC(op_pair_6401_1), 25601 },
+{ CPUFUNC(op_pair_4a80_1), 19072 },
+{ CPUFUNC(op_pair_6c01_1), 27649 },
+{ CPUFUNC(op_pair_5100_1), 20736 },
+{ CPUFUNC(op_pair_6f01_1), 28417 },
+{ CPUFUNC(op_pair_10c0_1), 4288 },
+{ CPUFUNC(op_pair_4ea8_1), 20136 },
+{ CPUFUNC(op_pair_6001_1), 24577 },
+{ CPUFUNC(op_pair_2068_1), 8296 },
+{ CPUFUNC(op_pair_4cd8_1), 19672 },
+{ CPUFUNC(op_pair_2058_1), 8280 },
+{ CPUFUNC(op_pair_4e75_1), 20085 },
+{ CPUFUNC(op_pair_5080_1), 20608 },
+{ 0, 0 }};
+
+extern cpuop_func CPUFUNC(op_pair_7000_2);
+extern cpuop_func CPUFUNC(op_pair_b080_2);
+extern cpuop_func CPUFUNC(op_pair_b068_2);
+extern cpuop_func CPUFUNC(op_pair_9040_2);
+extern cpuop_func CPUFUNC(op_pair_3008_2);
+extern cpuop_func CPUFUNC(op_pair_c080_2);
+extern cpuop_func CPUFUNC(op_pair_6d01_2);
+extern cpuop_func CPUFUNC(op_pair_1018_2);
+extern cpuop_func CPUFUNC(op_pair_6701_2);
+extern cpuop_func CPUFUNC(op_pair_1000_2);
+extern cpuop_func CPUFUNC(op_pair_4600_2);
+extern cpuop_func CPUFUNC(op_pair_c110_2);
+extern cpuop_func CPUFUNC(op_pair_6601_2);
+extern cpuop_func CPUFUNC(op_pair_e088_2);
+extern cpuop_func CPUFUNC(op_pair_0c50_2);
+extern cpuop_func CPUFUNC(op_pair_5088_2);
+extern cpuop_func CPUFUNC(op_pair_b088_2);
+extern cpuop_func CPUFUNC(op_pair_6200_2);
+extern cpuop_func CPUFUNC(op_pair_6600_2);
+extern cpuop_func CPUFUNC(op_pair_5188_2);
+extern cpuop_func CPUFUNC(op_pair_20c0_2);
+extern cpuop_func CPUFUNC(op_pair_6501_2);
+extern cpuop_func CPUFUNC(op_pair_5180_2);
+extern cpuop_func CPUFUNC(op_pair_d098_2);
+extern cpuop_func CPUFUNC(op_pair_4a00_2);
+extern cpuop_func CPUFUNC(op_pair_6401_2);
+extern cpuop_func CPUFUNC(op_pair_4a80_2);
+extern cpuop_func CPUFUNC(op_pair_6c01_2);
+extern cpuop_func CPUFUNC(op_pair_5100_2);
+extern cpuop_func CPUFUNC(op_pair_6f01_2);
+extern cpuop_func CPUFUNC(op_pair_10c0_2);
+extern cpuop_func CPUFUNC(op_pair_4ea8_2);
+extern cpuop_func CPUFUNC(op_pair_6001_2);
+extern cpuop_func CPUFUNC(op_pair_2068_2);
+extern cpuop_func CPUFUNC(op_pair_4cd8_2);
+extern cpuop_func CPUFUNC(op_pair_2058_2);
+extern cpuop_func CPUFUNC(op_pair_4e75_2);
+extern cpuop_func CPUFUNC(op_pair_5080_2);
+
+/* MOVEQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_7000_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_7000_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L Dn,Dn */
+	if (f == CPUFUNC(op_b080_0) || f == CPUFUNC(op_pair_b080_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b080_0)(next, regs);
+	}
+	/* MOVE.B (An)+,Dn */
+	if (f == CPUFUNC(op_1018_0) || f == CPUFUNC(op_pair_1018_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1018_0)(next, regs);
+	}
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_0) || f == CPUFUNC(op_pair_b088_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_0)(next, regs);
+	}
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_0) || f == CPUFUNC(op_pair_4600_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b080_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_0) || f == CPUFUNC(op_pair_6601_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W (d16,An),Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b068_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b068_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LT) */
+	if (f == CPUFUNC(op_6d01_0) || f == CPUFUNC(op_pair_6d01_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6d01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUB.W Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_9040_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_9040_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W (d16,An),Dn */
+	if (f == CPUFUNC(op_b068_0) || f == CPUFUNC(op_pair_b068_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b068_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.W An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_3008_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_3008_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUB.W Dn,Dn */
+	if (f == CPUFUNC(op_9040_0) || f == CPUFUNC(op_pair_9040_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_9040_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c080_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (EQ) */
+	if (f == CPUFUNC(op_6701_0) || f == CPUFUNC(op_pair_6701_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6701_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LT) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6d01_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6d01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1018_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1018_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.L Dn,Dn */
+	if (f == CPUFUNC(op_c080_0) || f == CPUFUNC(op_pair_c080_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c080_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (EQ) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6701_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6701_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,Dn */
+	if (f == CPUFUNC(op_1000_0) || f == CPUFUNC(op_pair_1000_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1000_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1000_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_0) || f == CPUFUNC(op_pair_4600_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* NOT.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4600_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4600_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.B Dn,(An) */
+	if (f == CPUFUNC(op_c110_0) || f == CPUFUNC(op_pair_c110_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c110_0)(next, regs);
+	}
+	/* BccQ.B #<data> (T) */
+	if (f == CPUFUNC(op_6001_0) || f == CPUFUNC(op_pair_6001_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6001_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.B Dn,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c110_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c110_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6601_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6601_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* LSRQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_e088_0) || f == CPUFUNC(op_pair_e088_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_e088_0)(next, regs);
+	}
+	/* ADD.L (An)+,Dn */
+	if (f == CPUFUNC(op_d098_0) || f == CPUFUNC(op_pair_d098_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_d098_0)(next, regs);
+	}
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* LSRQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_e088_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_e088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_0) || f == CPUFUNC(op_pair_3008_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W #<data>.W,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_0c50_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_0c50_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (NE) */
+	if (f == CPUFUNC(op_6600_0) || f == CPUFUNC(op_pair_6600_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5088_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_0) || f == CPUFUNC(op_pair_b088_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_0)(next, regs);
+	}
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b088_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (HI) */
+	if (f == CPUFUNC(op_6200_0) || f == CPUFUNC(op_pair_6200_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6200_0)(next, regs);
+	}
+	/* BccQ.B #<data> (CS) */
+	if (f == CPUFUNC(op_6501_0) || f == CPUFUNC(op_pair_6501_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6501_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (HI) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6200_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6200_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W #<data>.W,(An) */
+	if (f == CPUFUNC(op_0c50_0) || f == CPUFUNC(op_pair_0c50_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_0c50_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6600_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6600_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5188_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5188_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.L Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_20c0_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_20c0_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5188_0) || f == CPUFUNC(op_pair_5188_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5188_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CS) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6501_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6501_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.L Dn,(An)+ */
+	if (f == CPUFUNC(op_20c0_0) || f == CPUFUNC(op_pair_20c0_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_20c0_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5180_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5180_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_0) || f == CPUFUNC(op_pair_6601_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_0)(next, regs);
+	}
+	/* SUBQ.B #<data>,Dn */
+	if (f == CPUFUNC(op_5100_0) || f == CPUFUNC(op_pair_5100_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5100_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADD.L (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_d098_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_d098_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (CC) */
+	if (f == CPUFUNC(op_6401_0) || f == CPUFUNC(op_pair_6401_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6401_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a00_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a00_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (GE) */
+	if (f == CPUFUNC(op_6c01_0) || f == CPUFUNC(op_pair_6c01_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6c01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CC) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6401_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6401_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	/* ADDQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5080_0) || f == CPUFUNC(op_pair_5080_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5080_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.L Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a80_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a80_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LE) */
+	if (f == CPUFUNC(op_6f01_0) || f == CPUFUNC(op_pair_6f01_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6f01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (GE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6c01_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6c01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,(An)+ */
+	if (f == CPUFUNC(op_10c0_0) || f == CPUFUNC(op_pair_10c0_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_10c0_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.B #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5100_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5100_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.L Dn */
+	if (f == CPUFUNC(op_4a80_0) || f == CPUFUNC(op_pair_4a80_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a80_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6f01_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6f01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.B Dn */
+	if (f == CPUFUNC(op_4a00_0) || f == CPUFUNC(op_pair_4a00_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a00_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_10c0_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_10c0_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* JSR.L (d16,An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4ea8_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4ea8_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* JMP.L (xxx).L */
+	if (f == CPUFUNC(op_4ef9_0)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4ef9_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (T) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6001_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6001_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_0) || f == CPUFUNC(op_pair_3008_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (d16,An),An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2068_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2068_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEA.L (d16,An),An */
+	if (f == CPUFUNC(op_2068_0) || f == CPUFUNC(op_pair_2068_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_2068_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MVMEL.L #<data>.W,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4cd8_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4cd8_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_0) || f == CPUFUNC(op_pair_4e75_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (An)+,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2058_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2058_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_0) || f == CPUFUNC(op_pair_4e75_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* RTS.L  */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4e75_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4e75_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5080_2)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_2)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	return cycles;
+}
+
+const struct cputbl CPUFUNC(op_pairtbl_2)[] = {
+{ CPUFUNC(op_pair_7000_2), 28672 },
+{ CPUFUNC(op_pair_b080_2), 45184 },
+{ CPUFUNC(op_pair_b068_2), 45160 },
+{ CPUFUNC(op_pair_9040_2), 36928 },
+{ CPUFUNC(op_pair_3008_2), 12296 },
+{ CPUFUNC(op_pair_c080_2), 49280 },
+{ CPUFUNC(op_pair_6d01_2), 27905 },
+{ CPUFUNC(op_pair_1018_2), 4120 },
+{ CPUFUNC(op_pair_6701_2), 26369 },
+{ CPUFUNC(op_pair_1000_2), 4096 },
+{ CPUFUNC(op_pair_4600_2), 17920 },
+{ CPUFUNC(op_pair_c110_2), 49424 },
+{ CPUFUNC(op_pair_6601_2), 26113 },
+{ CPUFUNC(op_pair_e088_2), 57480 },
+{ CPUFUNC(op_pair_0c50_2), 3152 },
+{ CPUFUNC(op_pair_5088_2), 20616 },
+{ CPUFUNC(op_pair_b088_2), 45192 },
+{ CPUFUNC(op_pair_6200_2), 25088 },
+{ CPUFUNC(op_pair_6600_2), 26112 },
+{ CPUFUNC(op_pair_5188_2), 20872 },
+{ CPUFUNC(op_pair_20c0_2), 8384 },
+{ CPUFUNC(op_pair_6501_2), 25857 },
+{ CPUFUNC(op_pair_5180_2), 20864 },
+{ CPUFUNC(op_pair_d098_2), 53400 },
+{ CPUFUNC(op_pair_4a00_2), 18944 },
+{ CPUFUNC(op_pair_6401_2), 25601 },
+{ CPUFUNC(op_pair_4a80_2), 19072 },
+{ CPUFUNC(op_pair_6c01_2), 27649 },
+{ CPUFUNC(op_pair_5100_2), 20736 },
+{ CPUFUNC(op_pair_6f01_2), 28417 },
+{ CPUFUNC(op_pair_10c0_2), 4288 },
+{ CPUFUNC(op_pair_4ea8_2), 20136 },
+{ CPUFUNC(op_pair_6001_2), 24577 },
+{ CPUFUNC(op_pair_2068_2), 8296 },
+{ CPUFUNC(op_pair_4cd8_2), 19672 },
+{ CPUFUNC(op_pair_2058_2), 8280 },
+{ CPUFUNC(op_pair_4e75_2), 20085 },
+{ CPUFUNC(op_pair_5080_2), 20608 },
+{ 0, 0 }};
+
+extern cpuop_func CPUFUNC(op_pair_7000_3);
+extern cpuop_func CPUFUNC(op_pair_b080_3);
+extern cpuop_func CPUFUNC(op_pair_b068_3);
+extern cpuop_func CPUFUNC(op_pair_9040_3);
+extern cpuop_func CPUFUNC(op_pair_3008_3);
+extern cpuop_func CPUFUNC(op_pair_c080_3);
+extern cpuop_func CPUFUNC(op_pair_6d01_3);
+extern cpuop_func CPUFUNC(op_pair_1018_3);
+extern cpuop_func CPUFUNC(op_pair_6701_3);
+extern cpuop_func CPUFUNC(op_pair_1000_3);
+extern cpuop_func CPUFUNC(op_pair_4600_3);
+extern cpuop_func CPUFUNC(op_pair_c110_3);
+extern cpuop_func CPUFUNC(op_pair_6601_3);
+extern cpuop_func CPUFUNC(op_pair_e088_3);
+extern cpuop_func CPUFUNC(op_pair_0c50_3);
+extern cpuop_func CPUFUNC(op_pair_5088_3);
+extern cpuop_func CPUFUNC(op_pair_b088_3);
+extern cpuop_func CPUFUNC(op_pair_6200_3);
+extern cpuop_func CPUFUNC(op_pair_6600_3);
+extern cpuop_func CPUFUNC(op_pair_5188_3);
+extern cpuop_func CPUFUNC(op_pair_20c0_3);
+extern cpuop_func CPUFUNC(op_pair_6501_3);
+extern cpuop_func CPUFUNC(op_pair_5180_3);
+extern cpuop_func CPUFUNC(op_pair_d098_3);
+extern cpuop_func CPUFUNC(op_pair_4a00_3);
+extern cpuop_func CPUFUNC(op_pair_6401_3);
+extern cpuop_func CPUFUNC(op_pair_4a80_3);
+extern cpuop_func CPUFUNC(op_pair_6c01_3);
+extern cpuop_func CPUFUNC(op_pair_5100_3);
+extern cpuop_func CPUFUNC(op_pair_6f01_3);
+extern cpuop_func CPUFUNC(op_pair_10c0_3);
+extern cpuop_func CPUFUNC(op_pair_4ea8_3);
+extern cpuop_func CPUFUNC(op_pair_6001_3);
+extern cpuop_func CPUFUNC(op_pair_2068_3);
+extern cpuop_func CPUFUNC(op_pair_4cd8_3);
+extern cpuop_func CPUFUNC(op_pair_2058_3);
+extern cpuop_func CPUFUNC(op_pair_4e75_3);
+extern cpuop_func CPUFUNC(op_pair_5080_3);
+
+/* MOVEQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_7000_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_7000_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L Dn,Dn */
+	if (f == CPUFUNC(op_b080_0) || f == CPUFUNC(op_pair_b080_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b080_0)(next, regs);
+	}
+	/* MOVE.B (An)+,Dn */
+	if (f == CPUFUNC(op_1018_0) || f == CPUFUNC(op_pair_1018_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1018_0)(next, regs);
+	}
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_0) || f == CPUFUNC(op_pair_b088_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_0)(next, regs);
+	}
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_0) || f == CPUFUNC(op_pair_4600_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b080_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_0) || f == CPUFUNC(op_pair_6601_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W (d16,An),Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b068_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b068_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LT) */
+	if (f == CPUFUNC(op_6d01_0) || f == CPUFUNC(op_pair_6d01_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6d01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUB.W Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_9040_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_9040_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W (d16,An),Dn */
+	if (f == CPUFUNC(op_b068_0) || f == CPUFUNC(op_pair_b068_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b068_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.W An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_3008_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_3008_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUB.W Dn,Dn */
+	if (f == CPUFUNC(op_9040_0) || f == CPUFUNC(op_pair_9040_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_9040_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c080_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (EQ) */
+	if (f == CPUFUNC(op_6701_0) || f == CPUFUNC(op_pair_6701_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6701_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LT) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6d01_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6d01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1018_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1018_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.L Dn,Dn */
+	if (f == CPUFUNC(op_c080_0) || f == CPUFUNC(op_pair_c080_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c080_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (EQ) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6701_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6701_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,Dn */
+	if (f == CPUFUNC(op_1000_0) || f == CPUFUNC(op_pair_1000_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1000_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1000_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_0) || f == CPUFUNC(op_pair_4600_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* NOT.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4600_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4600_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.B Dn,(An) */
+	if (f == CPUFUNC(op_c110_0) || f == CPUFUNC(op_pair_c110_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c110_0)(next, regs);
+	}
+	/* BccQ.B #<data> (T) */
+	if (f == CPUFUNC(op_6001_0) || f == CPUFUNC(op_pair_6001_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6001_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.B Dn,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c110_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c110_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6601_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6601_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* LSRQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_e088_0) || f == CPUFUNC(op_pair_e088_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_e088_0)(next, regs);
+	}
+	/* ADD.L (An)+,Dn */
+	if (f == CPUFUNC(op_d098_0) || f == CPUFUNC(op_pair_d098_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_d098_0)(next, regs);
+	}
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* LSRQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_e088_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_e088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_0) || f == CPUFUNC(op_pair_3008_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W #<data>.W,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_0c50_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_0c50_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (NE) */
+	if (f == CPUFUNC(op_6600_0) || f == CPUFUNC(op_pair_6600_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6600_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5088_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_0) || f == CPUFUNC(op_pair_b088_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_0)(next, regs);
+	}
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b088_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b088_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (HI) */
+	if (f == CPUFUNC(op_6200_0) || f == CPUFUNC(op_pair_6200_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6200_0)(next, regs);
+	}
+	/* BccQ.B #<data> (CS) */
+	if (f == CPUFUNC(op_6501_0) || f == CPUFUNC(op_pair_6501_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6501_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (HI) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6200_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6200_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W #<data>.W,(An) */
+	if (f == CPUFUNC(op_0c50_0) || f == CPUFUNC(op_pair_0c50_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_0c50_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6600_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6600_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5188_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5188_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_0) || f == CPUFUNC(op_pair_7000_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.L Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_20c0_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_20c0_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5188_0) || f == CPUFUNC(op_pair_5188_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5188_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CS) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6501_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6501_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.L Dn,(An)+ */
+	if (f == CPUFUNC(op_20c0_0) || f == CPUFUNC(op_pair_20c0_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_20c0_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5180_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5180_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_0) || f == CPUFUNC(op_pair_6601_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_0)(next, regs);
+	}
+	/* SUBQ.B #<data>,Dn */
+	if (f == CPUFUNC(op_5100_0) || f == CPUFUNC(op_pair_5100_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5100_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADD.L (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_d098_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_d098_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (CC) */
+	if (f == CPUFUNC(op_6401_0) || f == CPUFUNC(op_pair_6401_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6401_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a00_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a00_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (GE) */
+	if (f == CPUFUNC(op_6c01_0) || f == CPUFUNC(op_pair_6c01_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6c01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CC) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6401_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6401_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	/* ADDQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5080_0) || f == CPUFUNC(op_pair_5080_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5080_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.L Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a80_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a80_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LE) */
+	if (f == CPUFUNC(op_6f01_0) || f == CPUFUNC(op_pair_6f01_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6f01_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (GE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6c01_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6c01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,(An)+ */
+	if (f == CPUFUNC(op_10c0_0) || f == CPUFUNC(op_pair_10c0_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_10c0_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.B #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5100_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5100_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.L Dn */
+	if (f == CPUFUNC(op_4a80_0) || f == CPUFUNC(op_pair_4a80_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a80_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6f01_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6f01_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.B Dn */
+	if (f == CPUFUNC(op_4a00_0) || f == CPUFUNC(op_pair_4a00_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a00_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_10c0_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_10c0_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* JSR.L (d16,An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4ea8_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4ea8_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* JMP.L (xxx).L */
+	if (f == CPUFUNC(op_4ef9_0)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4ef9_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (T) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6001_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6001_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_0) || f == CPUFUNC(op_pair_3008_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (d16,An),An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2068_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2068_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEA.L (d16,An),An */
+	if (f == CPUFUNC(op_2068_0) || f == CPUFUNC(op_pair_2068_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_2068_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MVMEL.L #<data>.W,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4cd8_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4cd8_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_0) || f == CPUFUNC(op_pair_4e75_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (An)+,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2058_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2058_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_0) || f == CPUFUNC(op_pair_4e75_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* RTS.L  */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4e75_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4e75_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_0) || f == CPUFUNC(op_pair_5088_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_0)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5080_3)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5080_0)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_0) || f == CPUFUNC(op_pair_5180_3)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_0)(next, regs);
+	}
+	return cycles;
+}
+
+const struct cputbl CPUFUNC(op_pairtbl_3)[] = {
+{ CPUFUNC(op_pair_7000_3), 28672 },
+{ CPUFUNC(op_pair_b080_3), 45184 },
+{ CPUFUNC(op_pair_b068_3), 45160 },
+{ CPUFUNC(op_pair_9040_3), 36928 },
+{ CPUFUNC(op_pair_3008_3), 12296 },
+{ CPUFUNC(op_pair_c080_3), 49280 },
+{ CPUFUNC(op_pair_6d01_3), 27905 },
+{ CPUFUNC(op_pair_1018_3), 4120 },
+{ CPUFUNC(op_pair_6701_3), 26369 },
+{ CPUFUNC(op_pair_1000_3), 4096 },
+{ CPUFUNC(op_pair_4600_3), 17920 },
+{ CPUFUNC(op_pair_c110_3), 49424 },
+{ CPUFUNC(op_pair_6601_3), 26113 },
+{ CPUFUNC(op_pair_e088_3), 57480 },
+{ CPUFUNC(op_pair_0c50_3), 3152 },
+{ CPUFUNC(op_pair_5088_3), 20616 },
+{ CPUFUNC(op_pair_b088_3), 45192 },
+{ CPUFUNC(op_pair_6200_3), 25088 },
+{ CPUFUNC(op_pair_6600_3), 26112 },
+{ CPUFUNC(op_pair_5188_3), 20872 },
+{ CPUFUNC(op_pair_20c0_3), 8384 },
+{ CPUFUNC(op_pair_6501_3), 25857 },
+{ CPUFUNC(op_pair_5180_3), 20864 },
+{ CPUFUNC(op_pair_d098_3), 53400 },
+{ CPUFUNC(op_pair_4a00_3), 18944 },
+{ CPUFUNC(op_pair_6401_3), 25601 },
+{ CPUFUNC(op_pair_4a80_3), 19072 },
+{ CPUFUNC(op_pair_6c01_3), 27649 },
+{ CPUFUNC(op_pair_5100_3), 20736 },
+{ CPUFUNC(op_pair_6f01_3), 28417 },
+{ CPUFUNC(op_pair_10c0_3), 4288 },
+{ CPUFUNC(op_pair_4ea8_3), 20136 },
+{ CPUFUNC(op_pair_6001_3), 24577 },
+{ CPUFUNC(op_pair_2068_3), 8296 },
+{ CPUFUNC(op_pair_4cd8_3), 19672 },
+{ CPUFUNC(op_pair_2058_3), 8280 },
+{ CPUFUNC(op_pair_4e75_3), 20085 },
+{ CPUFUNC(op_pair_5080_3), 20608 },
+{ 0, 0 }};
+
+extern cpuop_func CPUFUNC(op_pair_7000_4);
+extern cpuop_func CPUFUNC(op_pair_b080_4);
+extern cpuop_func CPUFUNC(op_pair_b068_4);
+extern cpuop_func CPUFUNC(op_pair_9040_4);
+extern cpuop_func CPUFUNC(op_pair_3008_4);
+extern cpuop_func CPUFUNC(op_pair_c080_4);
+extern cpuop_func CPUFUNC(op_pair_6d01_4);
+extern cpuop_func CPUFUNC(op_pair_1018_4);
+extern cpuop_func CPUFUNC(op_pair_6701_4);
+extern cpuop_func CPUFUNC(op_pair_1000_4);
+extern cpuop_func CPUFUNC(op_pair_4600_4);
+extern cpuop_func CPUFUNC(op_pair_c110_4);
+extern cpuop_func CPUFUNC(op_pair_6601_4);
+extern cpuop_func CPUFUNC(op_pair_e088_4);
+extern cpuop_func CPUFUNC(op_pair_0c50_4);
+extern cpuop_func CPUFUNC(op_pair_5088_4);
+extern cpuop_func CPUFUNC(op_pair_b088_4);
+extern cpuop_func CPUFUNC(op_pair_6200_4);
+extern cpuop_func CPUFUNC(op_pair_6600_4);
+extern cpuop_func CPUFUNC(op_pair_5188_4);
+extern cpuop_func CPUFUNC(op_pair_20c0_4);
+extern cpuop_func CPUFUNC(op_pair_6501_4);
+extern cpuop_func CPUFUNC(op_pair_5180_4);
+extern cpuop_func CPUFUNC(op_pair_d098_4);
+extern cpuop_func CPUFUNC(op_pair_4a00_4);
+extern cpuop_func CPUFUNC(op_pair_6401_4);
+extern cpuop_func CPUFUNC(op_pair_4a80_4);
+extern cpuop_func CPUFUNC(op_pair_6c01_4);
+extern cpuop_func CPUFUNC(op_pair_5100_4);
+extern cpuop_func CPUFUNC(op_pair_6f01_4);
+extern cpuop_func CPUFUNC(op_pair_10c0_4);
+extern cpuop_func CPUFUNC(op_pair_4ea8_4);
+extern cpuop_func CPUFUNC(op_pair_6001_4);
+extern cpuop_func CPUFUNC(op_pair_2068_4);
+extern cpuop_func CPUFUNC(op_pair_4cd8_4);
+extern cpuop_func CPUFUNC(op_pair_2058_4);
+extern cpuop_func CPUFUNC(op_pair_4e75_4);
+extern cpuop_func CPUFUNC(op_pair_5080_4);
+
+/* MOVEQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_7000_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_7000_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L Dn,Dn */
+	if (f == CPUFUNC(op_b080_4) || f == CPUFUNC(op_pair_b080_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b080_4)(next, regs);
+	}
+	/* MOVE.B (An)+,Dn */
+	if (f == CPUFUNC(op_1018_4) || f == CPUFUNC(op_pair_1018_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1018_4)(next, regs);
+	}
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_4) || f == CPUFUNC(op_pair_b088_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_4)(next, regs);
+	}
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_4) || f == CPUFUNC(op_pair_4600_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b080_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b080_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_4) || f == CPUFUNC(op_pair_6601_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W (d16,An),Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b068_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b068_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LT) */
+	if (f == CPUFUNC(op_6d01_4) || f == CPUFUNC(op_pair_6d01_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6d01_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUB.W Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_9040_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_9040_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W (d16,An),Dn */
+	if (f == CPUFUNC(op_b068_4) || f == CPUFUNC(op_pair_b068_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b068_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.W An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_3008_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_3008_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUB.W Dn,Dn */
+	if (f == CPUFUNC(op_9040_4) || f == CPUFUNC(op_pair_9040_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_9040_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c080_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c080_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (EQ) */
+	if (f == CPUFUNC(op_6701_4) || f == CPUFUNC(op_pair_6701_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6701_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LT) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6d01_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6d01_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1018_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1018_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.L Dn,Dn */
+	if (f == CPUFUNC(op_c080_4) || f == CPUFUNC(op_pair_c080_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c080_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (EQ) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6701_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6701_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,Dn */
+	if (f == CPUFUNC(op_1000_4) || f == CPUFUNC(op_pair_1000_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1000_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1000_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_4) || f == CPUFUNC(op_pair_4600_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* NOT.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4600_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4600_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.B Dn,(An) */
+	if (f == CPUFUNC(op_c110_4) || f == CPUFUNC(op_pair_c110_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c110_4)(next, regs);
+	}
+	/* BccQ.B #<data> (T) */
+	if (f == CPUFUNC(op_6001_4) || f == CPUFUNC(op_pair_6001_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6001_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.B Dn,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c110_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c110_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6601_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6601_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* LSRQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_e088_4) || f == CPUFUNC(op_pair_e088_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_e088_4)(next, regs);
+	}
+	/* ADD.L (An)+,Dn */
+	if (f == CPUFUNC(op_d098_4) || f == CPUFUNC(op_pair_d098_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_d098_4)(next, regs);
+	}
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_4) || f == CPUFUNC(op_pair_5088_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* LSRQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_e088_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_e088_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_4) || f == CPUFUNC(op_pair_3008_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W #<data>.W,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_0c50_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_0c50_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (NE) */
+	if (f == CPUFUNC(op_6600_4) || f == CPUFUNC(op_pair_6600_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6600_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5088_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5088_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_4) || f == CPUFUNC(op_pair_b088_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_4)(next, regs);
+	}
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b088_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b088_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (HI) */
+	if (f == CPUFUNC(op_6200_4) || f == CPUFUNC(op_pair_6200_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6200_4)(next, regs);
+	}
+	/* BccQ.B #<data> (CS) */
+	if (f == CPUFUNC(op_6501_4) || f == CPUFUNC(op_pair_6501_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6501_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (HI) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6200_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6200_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W #<data>.W,(An) */
+	if (f == CPUFUNC(op_0c50_4) || f == CPUFUNC(op_pair_0c50_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_0c50_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6600_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6600_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_4) || f == CPUFUNC(op_pair_5088_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5188_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5188_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.L Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_20c0_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_20c0_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5188_4) || f == CPUFUNC(op_pair_5188_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5188_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CS) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6501_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6501_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.L Dn,(An)+ */
+	if (f == CPUFUNC(op_20c0_4) || f == CPUFUNC(op_pair_20c0_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_20c0_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5180_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5180_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_4) || f == CPUFUNC(op_pair_6601_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_4)(next, regs);
+	}
+	/* SUBQ.B #<data>,Dn */
+	if (f == CPUFUNC(op_5100_4) || f == CPUFUNC(op_pair_5100_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5100_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADD.L (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_d098_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_d098_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (CC) */
+	if (f == CPUFUNC(op_6401_4) || f == CPUFUNC(op_pair_6401_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6401_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a00_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a00_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (GE) */
+	if (f == CPUFUNC(op_6c01_4) || f == CPUFUNC(op_pair_6c01_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6c01_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CC) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6401_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6401_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_4) || f == CPUFUNC(op_pair_5180_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_4)(next, regs);
+	}
+	/* ADDQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5080_4) || f == CPUFUNC(op_pair_5080_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5080_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.L Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a80_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a80_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LE) */
+	if (f == CPUFUNC(op_6f01_4) || f == CPUFUNC(op_pair_6f01_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6f01_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (GE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6c01_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6c01_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,(An)+ */
+	if (f == CPUFUNC(op_10c0_4) || f == CPUFUNC(op_pair_10c0_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_10c0_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.B #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5100_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5100_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.L Dn */
+	if (f == CPUFUNC(op_4a80_4) || f == CPUFUNC(op_pair_4a80_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a80_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6f01_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6f01_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.B Dn */
+	if (f == CPUFUNC(op_4a00_4) || f == CPUFUNC(op_pair_4a00_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a00_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_10c0_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_10c0_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_4) || f == CPUFUNC(op_pair_5180_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* JSR.L (d16,An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4ea8_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4ea8_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* JMP.L (xxx).L */
+	if (f == CPUFUNC(op_4ef9_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4ef9_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (T) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6001_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6001_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_4) || f == CPUFUNC(op_pair_3008_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (d16,An),An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2068_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2068_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEA.L (d16,An),An */
+	if (f == CPUFUNC(op_2068_4) || f == CPUFUNC(op_pair_2068_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_2068_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MVMEL.L #<data>.W,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4cd8_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4cd8_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_4) || f == CPUFUNC(op_pair_4e75_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (An)+,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2058_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2058_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_4) || f == CPUFUNC(op_pair_4e75_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* RTS.L  */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4e75_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4e75_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_4) || f == CPUFUNC(op_pair_5088_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5080_4)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5080_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_4) || f == CPUFUNC(op_pair_5180_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_4)(next, regs);
+	}
+	return cycles;
+}
+
+const struct cputbl CPUFUNC(op_pairtbl_4)[] = {
+{ CPUFUNC(op_pair_7000_4), 28672 },
+{ CPUFUNC(op_pair_b080_4), 45184 },
+{ CPUFUNC(op_pair_b068_4), 45160 },
+{ CPUFUNC(op_pair_9040_4), 36928 },
+{ CPUFUNC(op_pair_3008_4), 12296 },
+{ CPUFUNC(op_pair_c080_4), 49280 },
+{ CPUFUNC(op_pair_6d01_4), 27905 },
+{ CPUFUNC(op_pair_1018_4), 4120 },
+{ CPUFUNC(op_pair_6701_4), 26369 },
+{ CPUFUNC(op_pair_1000_4), 4096 },
+{ CPUFUNC(op_pair_4600_4), 17920 },
+{ CPUFUNC(op_pair_c110_4), 49424 },
+{ CPUFUNC(op_pair_6601_4), 26113 },
+{ CPUFUNC(op_pair_e088_4), 57480 },
+{ CPUFUNC(op_pair_0c50_4), 3152 },
+{ CPUFUNC(op_pair_5088_4), 20616 },
+{ CPUFUNC(op_pair_b088_4), 45192 },
+{ CPUFUNC(op_pair_6200_4), 25088 },
+{ CPUFUNC(op_pair_6600_4), 26112 },
+{ CPUFUNC(op_pair_5188_4), 20872 },
+{ CPUFUNC(op_pair_20c0_4), 8384 },
+{ CPUFUNC(op_pair_6501_4), 25857 },
+{ CPUFUNC(op_pair_5180_4), 20864 },
+{ CPUFUNC(op_pair_d098_4), 53400 },
+{ CPUFUNC(op_pair_4a00_4), 18944 },
+{ CPUFUNC(op_pair_6401_4), 25601 },
+{ CPUFUNC(op_pair_4a80_4), 19072 },
+{ CPUFUNC(op_pair_6c01_4), 27649 },
+{ CPUFUNC(op_pair_5100_4), 20736 },
+{ CPUFUNC(op_pair_6f01_4), 28417 },
+{ CPUFUNC(op_pair_10c0_4), 4288 },
+{ CPUFUNC(op_pair_4ea8_4), 20136 },
+{ CPUFUNC(op_pair_6001_4), 24577 },
+{ CPUFUNC(op_pair_2068_4), 8296 },
+{ CPUFUNC(op_pair_4cd8_4), 19672 },
+{ CPUFUNC(op_pair_2058_4), 8280 },
+{ CPUFUNC(op_pair_4e75_4), 20085 },
+{ CPUFUNC(op_pair_5080_4), 20608 },
+{ 0, 0 }};
+
+extern cpuop_func CPUFUNC(op_pair_7000_5);
+extern cpuop_func CPUFUNC(op_pair_b080_5);
+extern cpuop_func CPUFUNC(op_pair_b068_5);
+extern cpuop_func CPUFUNC(op_pair_9040_5);
+extern cpuop_func CPUFUNC(op_pair_3008_5);
+extern cpuop_func CPUFUNC(op_pair_c080_5);
+extern cpuop_func CPUFUNC(op_pair_6d01_5);
+extern cpuop_func CPUFUNC(op_pair_1018_5);
+extern cpuop_func CPUFUNC(op_pair_6701_5);
+extern cpuop_func CPUFUNC(op_pair_1000_5);
+extern cpuop_func CPUFUNC(op_pair_4600_5);
+extern cpuop_func CPUFUNC(op_pair_c110_5);
+extern cpuop_func CPUFUNC(op_pair_6601_5);
+extern cpuop_func CPUFUNC(op_pair_e088_5);
+extern cpuop_func CPUFUNC(op_pair_0c50_5);
+extern cpuop_func CPUFUNC(op_pair_5088_5);
+extern cpuop_func CPUFUNC(op_pair_b088_5);
+extern cpuop_func CPUFUNC(op_pair_6200_5);
+extern cpuop_func CPUFUNC(op_pair_6600_5);
+extern cpuop_func CPUFUNC(op_pair_5188_5);
+extern cpuop_func CPUFUNC(op_pair_20c0_5);
+extern cpuop_func CPUFUNC(op_pair_6501_5);
+extern cpuop_func CPUFUNC(op_pair_5180_5);
+extern cpuop_func CPUFUNC(op_pair_d098_5);
+extern cpuop_func CPUFUNC(op_pair_4a00_5);
+extern cpuop_func CPUFUNC(op_pair_6401_5);
+extern cpuop_func CPUFUNC(op_pair_4a80_5);
+extern cpuop_func CPUFUNC(op_pair_6c01_5);
+extern cpuop_func CPUFUNC(op_pair_5100_5);
+extern cpuop_func CPUFUNC(op_pair_6f01_5);
+extern cpuop_func CPUFUNC(op_pair_10c0_5);
+extern cpuop_func CPUFUNC(op_pair_4ea8_5);
+extern cpuop_func CPUFUNC(op_pair_6001_5);
+extern cpuop_func CPUFUNC(op_pair_2068_5);
+extern cpuop_func CPUFUNC(op_pair_4cd8_5);
+extern cpuop_func CPUFUNC(op_pair_2058_5);
+extern cpuop_func CPUFUNC(op_pair_4e75_5);
+extern cpuop_func CPUFUNC(op_pair_5080_5);
+
+/* MOVEQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_7000_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_7000_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L Dn,Dn */
+	if (f == CPUFUNC(op_b080_4) || f == CPUFUNC(op_pair_b080_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b080_4)(next, regs);
+	}
+	/* MOVE.B (An)+,Dn */
+	if (f == CPUFUNC(op_1018_4) || f == CPUFUNC(op_pair_1018_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1018_4)(next, regs);
+	}
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_4) || f == CPUFUNC(op_pair_b088_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_4)(next, regs);
+	}
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_4) || f == CPUFUNC(op_pair_4600_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b080_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b080_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_4) || f == CPUFUNC(op_pair_6601_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W (d16,An),Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b068_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b068_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LT) */
+	if (f == CPUFUNC(op_6d01_4) || f == CPUFUNC(op_pair_6d01_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6d01_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUB.W Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_9040_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_9040_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W (d16,An),Dn */
+	if (f == CPUFUNC(op_b068_4) || f == CPUFUNC(op_pair_b068_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b068_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.W An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_3008_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_3008_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUB.W Dn,Dn */
+	if (f == CPUFUNC(op_9040_4) || f == CPUFUNC(op_pair_9040_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_9040_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.L Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c080_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c080_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (EQ) */
+	if (f == CPUFUNC(op_6701_4) || f == CPUFUNC(op_pair_6701_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6701_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LT) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6d01_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6d01_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1018_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1018_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.L Dn,Dn */
+	if (f == CPUFUNC(op_c080_4) || f == CPUFUNC(op_pair_c080_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c080_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (EQ) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6701_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6701_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,Dn */
+	if (f == CPUFUNC(op_1000_4) || f == CPUFUNC(op_pair_1000_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_1000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_1000_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_1000_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* NOT.B Dn */
+	if (f == CPUFUNC(op_4600_4) || f == CPUFUNC(op_pair_4600_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4600_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* NOT.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4600_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4600_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* AND.B Dn,(An) */
+	if (f == CPUFUNC(op_c110_4) || f == CPUFUNC(op_pair_c110_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_c110_4)(next, regs);
+	}
+	/* BccQ.B #<data> (T) */
+	if (f == CPUFUNC(op_6001_4) || f == CPUFUNC(op_pair_6001_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6001_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* AND.B Dn,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_c110_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_c110_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6601_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6601_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* LSRQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_e088_4) || f == CPUFUNC(op_pair_e088_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_e088_4)(next, regs);
+	}
+	/* ADD.L (An)+,Dn */
+	if (f == CPUFUNC(op_d098_4) || f == CPUFUNC(op_pair_d098_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_d098_4)(next, regs);
+	}
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_4) || f == CPUFUNC(op_pair_5088_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* LSRQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_e088_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_e088_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_4) || f == CPUFUNC(op_pair_3008_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.W #<data>.W,(An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_0c50_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_0c50_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (NE) */
+	if (f == CPUFUNC(op_6600_4) || f == CPUFUNC(op_pair_6600_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6600_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5088_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5088_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.L An,Dn */
+	if (f == CPUFUNC(op_b088_4) || f == CPUFUNC(op_pair_b088_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_b088_4)(next, regs);
+	}
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* CMP.L An,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_b088_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_b088_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* Bcc.W #<data>.W (HI) */
+	if (f == CPUFUNC(op_6200_4) || f == CPUFUNC(op_pair_6200_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6200_4)(next, regs);
+	}
+	/* BccQ.B #<data> (CS) */
+	if (f == CPUFUNC(op_6501_4) || f == CPUFUNC(op_pair_6501_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6501_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (HI) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6200_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6200_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* CMP.W #<data>.W,(An) */
+	if (f == CPUFUNC(op_0c50_4) || f == CPUFUNC(op_pair_0c50_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_0c50_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* Bcc.W #<data>.W (NE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6600_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6600_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_4) || f == CPUFUNC(op_pair_5088_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBAQ.L #<data>,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5188_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5188_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_7000_4) || f == CPUFUNC(op_pair_7000_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_7000_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.L Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_20c0_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_20c0_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5188_4) || f == CPUFUNC(op_pair_5188_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5188_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CS) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6501_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6501_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.L Dn,(An)+ */
+	if (f == CPUFUNC(op_20c0_4) || f == CPUFUNC(op_pair_20c0_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_20c0_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5180_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5180_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (NE) */
+	if (f == CPUFUNC(op_6601_4) || f == CPUFUNC(op_pair_6601_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6601_4)(next, regs);
+	}
+	/* SUBQ.B #<data>,Dn */
+	if (f == CPUFUNC(op_5100_4) || f == CPUFUNC(op_pair_5100_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5100_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADD.L (An)+,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_d098_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_d098_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (CC) */
+	if (f == CPUFUNC(op_6401_4) || f == CPUFUNC(op_pair_6401_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6401_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.B Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a00_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a00_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (GE) */
+	if (f == CPUFUNC(op_6c01_4) || f == CPUFUNC(op_pair_6c01_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6c01_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (CC) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6401_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6401_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_4) || f == CPUFUNC(op_pair_5180_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_4)(next, regs);
+	}
+	/* ADDQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5080_4) || f == CPUFUNC(op_pair_5080_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5080_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* TST.L Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4a80_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4a80_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* BccQ.B #<data> (LE) */
+	if (f == CPUFUNC(op_6f01_4) || f == CPUFUNC(op_pair_6f01_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_6f01_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (GE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6c01_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6c01_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.B Dn,(An)+ */
+	if (f == CPUFUNC(op_10c0_4) || f == CPUFUNC(op_pair_10c0_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_10c0_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* SUBQ.B #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5100_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5100_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.L Dn */
+	if (f == CPUFUNC(op_4a80_4) || f == CPUFUNC(op_pair_4a80_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a80_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (LE) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6f01_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6f01_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* TST.B Dn */
+	if (f == CPUFUNC(op_4a00_4) || f == CPUFUNC(op_pair_4a00_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4a00_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVE.B Dn,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_10c0_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_10c0_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_4) || f == CPUFUNC(op_pair_5180_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* JSR.L (d16,An) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4ea8_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4ea8_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* JMP.L (xxx).L */
+	if (f == CPUFUNC(op_4ef9_4)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4ef9_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* BccQ.B #<data> (T) */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_6001_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_6001_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVE.W An,Dn */
+	if (f == CPUFUNC(op_3008_4) || f == CPUFUNC(op_pair_3008_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_3008_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (d16,An),An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2068_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2068_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* MOVEA.L (d16,An),An */
+	if (f == CPUFUNC(op_2068_4) || f == CPUFUNC(op_pair_2068_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_2068_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MVMEL.L #<data>.W,(An)+ */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4cd8_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4cd8_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_4) || f == CPUFUNC(op_pair_4e75_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* MOVEA.L (An)+,An */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_2058_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_2058_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* RTS.L  */
+	if (f == CPUFUNC(op_4e75_4) || f == CPUFUNC(op_pair_4e75_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_4e75_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* RTS.L  */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_4e75_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_4e75_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* ADDAQ.L #<data>,An */
+	if (f == CPUFUNC(op_5088_4) || f == CPUFUNC(op_pair_5088_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5088_4)(next, regs);
+	}
+	return cycles;
+}
+
+/* ADDQ.L #<data>,Dn */
+uae_u32 REGPARAM2 CPUFUNC(op_pair_5080_5)(uae_u32 opcode, struct regstruct &regs)
+{
+	uae_u32 cycles = CPUFUNC(op_5080_4)(opcode, regs);
+	uae_u32 next;
+	cpuop_func *f;
+	if (regs.spcflags)
+		return cycles;
+	next = get_iword2 (regs, 0);
+	f = cpufunctbl[next];
+	/* SUBQ.L #<data>,Dn */
+	if (f == CPUFUNC(op_5180_4) || f == CPUFUNC(op_pair_5180_5)) {
+		cpu_pair_step (cycles);
+		return CPUFUNC(op_5180_4)(next, regs);
+	}
+	return cycles;
+}
+
+const struct cputbl CPUFUNC(op_pairtbl_5)[] = {
+{ CPUFUNC(op_pair_7000_5), 28672 },
+{ CPUFUNC(op_pair_b080_5), 45184 },
+{ CPUFUNC(op_pair_b068_5), 45160 },
+{ CPUFUNC(op_pair_9040_5), 36928 },
+{ CPUFUNC(op_pair_3008_5), 12296 },
+{ CPUFUNC(op_pair_c080_5), 49280 },
+{ CPUFUNC(op_pair_6d01_5), 27905 },
+{ CPUFUNC(op_pair_1018_5), 4120 },
+{ CPUFUNC(op_pair_6701_5), 26369 },
+{ CPUFUNC(op_pair_1000_5), 4096 },
+{ CPUFUNC(op_pair_4600_5), 17920 },
+{ CPUFUNC(op_pair_c110_5), 49424 },
+{ CPUFUNC(op_pair_6601_5), 26113 },
+{ CPUFUNC(op_pair_e088_5), 57480 },
+{ CPUFUNC(op_pair_0c50_5), 3152 },
+{ CPUFUNC(op_pair_5088_5), 20616 },
+{ CPUFUNC(op_pair_b088_5), 45192 },
+{ CPUFUNC(op_pair_6200_5), 25088 },
+{ CPUFUNC(op_pair_6600_5), 26112 },
+{ CPUFUNC(op_pair_5188_5), 20872 },
+{ CPUFUNC(op_pair_20c0_5), 8384 },
+{ CPUFUNC(op_pair_6501_5), 25857 },
+{ CPUFUNC(op_pair_5180_5), 20864 },
+{ CPUFUNC(op_pair_d098_5), 53400 },
+{ CPUFUNC(op_pair_4a00_5), 18944 },
+{ CPUFUNC(op_pair_6401_5), 25601 },
+{ CPUFUNC(op_pair_4a80_5), 19072 },
+{ CPUFUNC(op_pair_6c01_5), 27649 },
+{ CPUFUNC(op_pair_5100_5), 20736 },
+{ CPUFUNC(op_pair_6f01_5), 28417 },
+{ CPUFUNC(op_pair_10c0_5), 4288 },
+{ CPUFUNC(op_pair_4ea8_5), 20136 },
+{ CPUFUNC(op_pair_6001_5), 24577 },
+{ CPUFUNC(op_pair_2068_5), 8296 },
+{ CPUFUNC(op_pair_4cd8_5), 19672 },
+{ CPUFUNC(op_pair_2058_5), 8280 },
+{ CPUFUNC(op_pair_4e75_5), 20085 },
+{ CPUFUNC(op_pair_5080_5), 20608 },
+{ 0, 0 }};
@@ -230,6 +230,19 @@ struct decision line_decisions[2 * (MAXVPOS + 2) + 1];
 struct draw_info curr_drawinfo[2 * (MAXVPOS + 2) + 1];
 #define COLOR_TABLE_SIZE (MAXVPOS + 2) * 2
 struct color_entry curr_color_tables[COLOR_TABLE_SIZE];
+uae_u64 curr_color_prints[COLOR_TABLE_SIZE];
+
+/* Tables recorded this frame, indexed by their print. Copper lists often
+ * return to an earlier palette (splits, raster bars), those lines then share
+ * the already converted table instead of copying a new one. An entry is only
+ * valid if it still points at a table of this frame with the same print. */
+#define CTABLE_CACHE_SIZE 64
+static struct {
+  uae_u64 print;
+  int ctable;
+} ctable_cache[CTABLE_CACHE_SIZE];
+static uae_u64 current_colors_print;
+static int current_colors_print_dirty = 1;
 
 static int next_sprite_entry = 0;
 static int next_sprite_forced = 1;
@@ -283,6 +296,7 @@ STATIC_INLINE void setclr (uae_u16 *_GCCRES_ p, uae_u16 val)
 static void update_mirrors(void)
 {
   aga_mode = (currprefs.chipset_mask & CSMASK_AGA) ? 1 : 0;
+  current_colors_print_dirty = 1;
 }
 
 STATIC_INLINE uae_u8 *_GCCRES_ pfield_xlateptr (uaecptr plpt, int bytecount)
@@ -326,6 +340,7 @@ void notice_new_xcolors (void)
 	for (i = 0; i < (MAXVPOS + 1)*2; i++) {
 		docols(curr_color_tables + i);
 	}
+	notice_screen_contents_lost ();
 }
 
 static void do_sprites (int currhp);
@@ -336,10 +351,26 @@ static void remember_ctable (void)
 	if (next_color_entry >= COLOR_TABLE_SIZE)
 		return;
 	if (remembered_color_entry < 0) {
-		/* The colors changed since we last recorded a color map. Record a
-		 * new one. */
-		color_reg_cpy (curr_color_tables + next_color_entry, &current_colors);
-		remembered_color_entry = next_color_entry++;
+		int slot, ct;
+		if (current_colors_print_dirty) {
+			current_colors_print = color_table_print (&current_colors);
+			current_colors_print_dirty = 0;
+		}
+		slot = (current_colors_print ^ (current_colors_print >> 32)) & (CTABLE_CACHE_SIZE - 1);
+		ct = ctable_cache[slot].ctable;
+		if (ctable_cache[slot].print == current_colors_print && ct < next_color_entry
+			&& curr_color_prints[ct] == current_colors_print) {
+			/* Same palette as an earlier line of this frame. */
+			remembered_color_entry = ct;
+		} else {
+			/* The colors changed since we last recorded a color map. Record a
+			 * new one. */
+			color_reg_cpy (curr_color_tables + next_color_entry, &current_colors);
+			curr_color_prints[next_color_entry] = current_colors_print;
+			ctable_cache[slot].print = current_colors_print;
+			ctable_cache[slot].ctable = next_color_entry;
+			remembered_color_entry = next_color_entry++;
+		}
 	}
 	thisline_decision.ctable = remembered_color_entry;
 }
@@ -1001,6 +1032,17 @@ STATIC_INLINE void beginning_of_plane_block (int hpos, int fm)
 }
 
 
+#ifdef ARMV6_ASSEMBLY
+#define long_fetch_ecs_word(VAL, PT) \
+	__asm__ __volatile__ (                   \
+	    "ldrh    %[val], [%[pt]], #2   \n\t"   \
+	    "rev16   %[val], %[val]        \n\t"   \
+	    : [val] "=r" (VAL), [pt] "+r" (PT) )
+#else
+#define long_fetch_ecs_word(VAL, PT) \
+	(VAL = do_get_mem_word(PT++))
+#endif
+
 #define long_fetch_ecs_init(PLANE, NWORDS, DMA) \
   uae_u16 *real_pt = (uae_u16 *)pfield_xlateptr (bplpt[PLANE], NWORDS << 1); \
   int delay = toscr_delay[(PLANE & 1)]; \
@@ -1043,10 +1085,7 @@ STATIC_INLINE void beginning_of_plane_block (int hpos, int fm)
 		} \
 		NWORDS--; \
 		if (DMA) { \
-			__asm__ __volatile__ (                   \
-			    "ldrh    %[val], [%[pt]], #2   \n\t"   \
-			    "rev16   %[val], %[val]        \n\t"   \
-			    : [val] "=r" (fetchval), [pt] "+r" (real_pt) ); \
+			long_fetch_ecs_word(fetchval, real_pt); \
 		} \
 	} \
     fetched[PLANE] = fetchval; \
@@ -3255,6 +3294,7 @@ static void COLOR_WRITE (int hpos, uae_u16 v, int num)
 		/* Call this with the old table still intact. */
 		record_color_change (hpos, colreg, cval);
 		remembered_color_entry = -1;
+		current_colors_print ^= color_print (colreg, current_colors.color_regs_aga[colreg]) ^ color_print (colreg, cval);
 		current_colors.color_regs_aga[colreg] = cval;
 		current_colors.acolors[colreg] = CONVERT_RGB (cval);
 	} else {
@@ -3263,6 +3303,7 @@ static void COLOR_WRITE (int hpos, uae_u16 v, int num)
 		/* Call this with the old table still intact. */
 		record_color_change (hpos, num, v);
 		remembered_color_entry = -1;
+		current_colors_print ^= color_print (num, current_colors.color_regs_ecs[num]) ^ color_print (num, v);
 	  current_colors.color_regs_ecs[num] = v;
 		current_colors.acolors[num] = xcolors[v];
 	}
@@ -4055,11 +4096,18 @@ static void fpscounter (void)
 // vsync functions that are not hardware timing related
 static void vsync_handler_pre (void)
 {
-	handle_events ();
-	
+	savestate_runahead_vsync ();
+
+	/* Submit the frame that was just emulated before sleeping, the wait is
+	   then followed by the input sample and the emulation of the next one */
 #ifdef PICASSO96
   picasso_handle_vsync ();
 #endif
+	if (quit_program <= 0)
+		vsync_handle_redraw ();
+
+	frame_pace_wait ();
+	handle_events ();
 
   CIA_vsync_prehandler();
 
@@ -4076,8 +4124,6 @@ static void vsync_handler_pre (void)
   inputdevice_vsync ();
 
   filesys_vsync ();
-
-	vsync_handle_redraw ();
 }
 
 // emulated hardware vsync
@@ -4439,8 +4485,11 @@ static void hsync_handler (void)
 			uae_reset (0);
 			return;
 		}
+		savestate_capture ();
 	}
 	hsync_handler_post (vs);
+	if (runahead_pending)
+		savestate_runahead_hsync (maxvpos + lof_store - vpos);
 }
 
 void init_eventtab (void)
@@ -4482,6 +4531,61 @@ void custom_prepare (void)
 	hsync_handler_post (true);
 }
 
+/* reapply restored registers, for a state file or a run-ahead snapshot */
+static void restore_custom_regs (bool restart_copper)
+{
+	int i;
+	uae_u16 v;
+	uae_u32 vv;
+	
+	audio_update_adkmasks ();
+	INTENA (0);
+	INTREQ (0);
+	
+	if (diwhigh)
+		diwhigh_written = 1;
+	else
+	  diwhigh_written = 0;
+	if (restart_copper)
+		COPJMP (1, 1);
+	v = bplcon0;
+	BPLCON0 (0, 0);
+	BPLCON0 (0, v);
+	FMODE (0, fmode);
+	
+	current_colors_print_dirty = 1;
+	if (!(currprefs.chipset_mask & CSMASK_AGA)) {
+		for(i = 0 ; i < 32 ; i++)  {
+			vv = current_colors.color_regs_ecs[i];
+			current_colors.color_regs_ecs[i] = (unsigned short)-1;
+			record_color_change (0, i, vv);
+			remembered_color_entry = -1;
+			current_colors.color_regs_ecs[i] = vv;
+			current_colors.acolors[i] = xcolors[vv];
+		}
+	} else {
+		for(i = 0 ; i < 256 ; i++)  {
+			vv = current_colors.color_regs_aga[i];
+			current_colors.color_regs_aga[i] = -1;
+			record_color_change (0, i, vv);
+			remembered_color_entry = -1;
+			current_colors.color_regs_aga[i] = vv;
+			current_colors.acolors[i] = CONVERT_RGB(vv);
+		}
+	}
+	current_colors_print_dirty = 1;
+	CLXCON (clxcon);
+	CLXCON2 (clxcon2);
+	calcdiw ();
+	nr_armed = 0;
+	for (i = 0; i < 8; i++)
+		nr_armed += spr[i].armed != 0;
+	if (! currprefs.produce_sound) {
+	    eventtab[ev_audio].active = 0;
+	    events_schedule ();
+	}
+}
+
 void custom_reset (int hardreset)
 {
 	int i;
@@ -4489,6 +4593,7 @@ void custom_reset (int hardreset)
 
   target_reset ();
   reset_all_systems ();
+  savestate_runahead_reset ();
 
   if (! savestate_state) {
     hsync_counter = 0;
@@ -4598,53 +4703,8 @@ void custom_reset (int hardreset)
 	
 	init_regtypes ();	
 
-  if (isrestore ()) {
-		uae_u16 v;
-		uae_u32 vv;
-		
-		audio_update_adkmasks ();
-		INTENA (0);
-		INTREQ (0);
-		
-		if (diwhigh)
-			diwhigh_written = 1;
-		else
-		  diwhigh_written = 0;
-		COPJMP (1, 1);
-		v = bplcon0;
-		BPLCON0 (0, 0);
-		BPLCON0 (0, v);
-		FMODE (0, fmode);
-		
-		if (!(currprefs.chipset_mask & CSMASK_AGA)) {
-			for(i = 0 ; i < 32 ; i++)  {
-				vv = current_colors.color_regs_ecs[i];
-				current_colors.color_regs_ecs[i] = (unsigned short)-1;
-				record_color_change (0, i, vv);
-				remembered_color_entry = -1;
-				current_colors.color_regs_ecs[i] = vv;
-				current_colors.acolors[i] = xcolors[vv];
-			}
-		} else {
-			for(i = 0 ; i < 256 ; i++)  {
-				vv = current_colors.color_regs_aga[i];
-				current_colors.color_regs_aga[i] = -1;
-				record_color_change (0, i, vv);
-				remembered_color_entry = -1;
-				current_colors.color_regs_aga[i] = vv;
-				current_colors.acolors[i] = CONVERT_RGB(vv);
-			}
-		}
-		CLXCON (clxcon);
-		CLXCON2 (clxcon2);
-		calcdiw ();
-		for (i = 0; i < 8; i++)
-			nr_armed += spr[i].armed != 0;
-  	if (! currprefs.produce_sound) {
-  	    eventtab[ev_audio].active = 0;
-  	    events_schedule ();
-  	}
-	}
+  if (isrestore ())
+		restore_custom_regs (true);
 	sprres = expand_sprres (bplcon0, bplcon3);
 	sprite_width = GET_SPRITEWIDTH (fmode);
 	setup_fmodes (0);
@@ -5134,6 +5194,74 @@ void custom_prepare_savestate (void)
   }
 }
 
+/* The run-ahead snapshot keeps the copper and all pending events exactly as
+ * they are, the state file format would restart them. */
+uae_u8 *restore_custom_runahead (uae_u8 *src)
+{
+  restore_raw (eventtab);
+  restore_raw (eventtab2);
+  restore_raw (currcycle);
+  restore_raw (nextevent);
+  restore_raw (cop_state);
+  restore_raw (copper_enabled_thisline);
+  restore_raw (last_copper_hpos);
+  restore_raw (vpos);
+  restore_raw (vpos_count);
+  restore_raw (vpos_count_diff);
+  restore_raw (lof_changed);
+  restore_raw (lof_changing);
+  restore_raw (next_lineno);
+  restore_raw (prev_lineno);
+  restore_raw (diwstate);
+  restore_raw (ddfstate);
+  restore_raw (dmal);
+  restore_raw (dmal_hpos);
+  return src;
+}
+
+uae_u8 *save_custom_runahead (int *len, uae_u8 *dstptr)
+{
+  uae_u8 *dstbak, *dst;
+
+  if (dstptr)
+    dstbak = dst = dstptr;
+  else
+    dstbak = dst = xmalloc (uae_u8, sizeof eventtab + sizeof eventtab2 + sizeof currcycle
+      + sizeof nextevent + sizeof cop_state + sizeof copper_enabled_thisline
+      + sizeof last_copper_hpos + sizeof vpos + sizeof vpos_count + sizeof vpos_count_diff
+      + sizeof lof_changed + sizeof lof_changing + sizeof next_lineno + sizeof prev_lineno
+      + sizeof diwstate + sizeof ddfstate + sizeof dmal + sizeof dmal_hpos);
+  save_raw (eventtab);
+  save_raw (eventtab2);
+  save_raw (currcycle);
+  save_raw (nextevent);
+  save_raw (cop_state);
+  save_raw (copper_enabled_thisline);
+  save_raw (last_copper_hpos);
+  save_raw (vpos);
+  save_raw (vpos_count);
+  save_raw (vpos_count_diff);
+  save_raw (lof_changed);
+  save_raw (lof_changing);
+  save_raw (next_lineno);
+  save_raw (prev_lineno);
+  save_raw (diwstate);
+  save_raw (ddfstate);
+  save_raw (dmal);
+  save_raw (dmal_hpos);
+  *len = dst - dstbak;
+  return dstbak;
+}
+
+void restore_custom_runahead_finish (void)
+{
+  restore_custom_regs (false);
+	sprres = expand_sprres (bplcon0, bplcon3);
+	sprite_width = GET_SPRITEWIDTH (fmode);
+	setup_fmodes (0);
+  reset_decisions ();
+}
+
 #define RB restore_u8 ()
 #define SRB (uae_s8)restore_u8 ()
 #define RBB restore_u8 () != 0
@@ -5146,7 +5274,9 @@ uae_u8 *restore_custom (uae_u8 *src)
   int dskpt;
   int i;
 
-  audio_reset ();
+  /* run-ahead must not throw away the sound already mixed */
+  if (!runahead_restoring)
+    audio_reset ();
 
   changed_prefs.chipset_mask = currprefs.chipset_mask = RL & CSMASK_MASK;
   update_mirrors();
@@ -44,6 +44,7 @@
 #include "drawing.h"
 #include "savestate.h"
 #include "statusline.h"
+#include "p2c.h"
 #include <sys/time.h>
 #include <time.h>
 
@@ -190,7 +191,7 @@ void adjust_idletime(unsigned long ms_waited)
   idletime_time += ms_waited;
   if(idletime_frames >= IDLETIME_FRAMES)
   {
-    unsigned long ms_per_frames = time_per_frame * idletime_frames * (1 + currprefs.gfx_framerate);
+    unsigned long ms_per_frames = time_per_frame * idletime_frames;
     idletime_percent = idletime_time * 100 / ms_per_frames;
     if(idletime_percent < 0)
       idletime_percent = 0;
@@ -201,6 +202,120 @@ void adjust_idletime(unsigned long ms_waited)
   }
 }
 
+/* Frame pacing: the finished frame is handed to the display at vsync, then
+   the wait for the host vsync happens before the input is read. The next
+   frame is emulated with that input and submitted as soon as it is done,
+   so the wakeup is aimed at the host vsync minus the emulation and submit
+   cost. */
+static frame_time_t pace_next = 0;
+static volatile frame_time_t pace_vsync_time = 0;
+static frame_time_t pace_vsync_period = 0;
+static frame_time_t pace_cost = 0;
+static frame_time_t pace_wakeup = 0, pace_input = 0, pace_last_submit = 0;
+
+#define PACE_STAT_FRAMES 500
+static int pace_frames, pace_late;
+static unsigned long pace_lat_sum, pace_lat_min, pace_lat_max;
+static unsigned long pace_jitter_sum, pace_jitter_max;
+
+/* Called by backends that know when a submitted frame reached the screen */
+void frame_pace_vsync (unsigned long t)
+{
+  frame_time_t last = pace_vsync_time;
+  unsigned long d = t - last;
+
+  if (!pace_vsync_period)
+    pace_vsync_period = time_per_frame;
+  /* ignore skipped vsyncs, the shortest gaps give the host refresh */
+  if (last && d < pace_vsync_period + pace_vsync_period / 2)
+    pace_vsync_period = (pace_vsync_period * 7 + d) / 8;
+  pace_vsync_time = t;
+}
+
+/* Sleep until the next frame has to start, called right before the input is read */
+void frame_pace_wait (void)
+{
+  frame_time_t now = read_processor_time ();
+  frame_time_t vsync = pace_vsync_time;
+  unsigned long slept = 0;
+
+  /* frames run ahead go at full speed, the host waits once per shown frame */
+  if (runahead_next)
+    return;
+  if (vsync) {
+    /* aim the submit at the next host vsync, with the usual cost and a margin to spare */
+    frame_time_t period = pace_vsync_period;
+    vsync += ((now - vsync) / period + 1) * period;
+    pace_next = vsync - pace_cost - currprefs.pandora_vsync_margin;
+  }
+  if ((long)(pace_next - now) > 0 && pace_next - now <= time_per_frame) {
+    slept = pace_next - now;
+    usleep (slept);
+  } else if ((long)(now - pace_next) > (long)time_per_frame) {
+    /* more than a frame behind: restart the schedule rather than catch up */
+    pace_next = now;
+  }
+  adjust_idletime (slept);
+  pace_wakeup = read_processor_time ();
+  pace_next += time_per_frame;
+}
+
+/* Called by handle_events when the host input is sampled */
+void frame_pace_input (void)
+{
+  /* the first sample after the wait feeds the frame submitted next */
+  if ((long)(pace_input - pace_wakeup) < 0)
+    pace_input = read_processor_time ();
+}
+
+/* Called by backends right after a frame was handed to the display */
+void frame_pace_submitted (void)
+{
+  frame_time_t now = read_processor_time ();
+  unsigned long cost = now - pace_wakeup;
+  unsigned long expected = time_per_frame * (1 + currprefs.gfx_framerate);
+  unsigned long lat;
+
+  /* follow a slow frame at once, relax slowly afterwards */
+  if (cost > time_per_frame)
+    cost = time_per_frame;
+  if (cost > pace_cost)
+    pace_cost = cost;
+  else
+    pace_cost -= (pace_cost - cost) / 16;
+
+  /* the frame shown now was emulated with the input read after the last wait */
+  if (!pace_input || !pace_last_submit) {
+    pace_last_submit = now;
+    return;
+  }
+  lat = now - pace_input;
+  if (!pace_frames || lat < pace_lat_min)
+    pace_lat_min = lat;
+  if (lat > pace_lat_max)
+    pace_lat_max = lat;
+  pace_lat_sum += lat;
+  {
+    unsigned long interval = now - pace_last_submit;
+    unsigned long jitter = interval > expected ? interval - expected : expected - interval;
+    if (jitter > pace_jitter_max)
+      pace_jitter_max = jitter;
+    pace_jitter_sum += jitter;
+    if (interval > expected + time_per_frame / 2)
+      pace_late++;
+  }
+  pace_last_submit = now;
+
+  if (++pace_frames >= PACE_STAT_FRAMES) {
+    write_log (_T("Pacing: latency %lu/%lu/%lu us (min/avg/max), jitter %lu/%lu us (avg/max), %d late, cost %lu us\n"),
+      pace_lat_min, pace_lat_sum / pace_frames, pace_lat_max,
+      pace_jitter_sum / pace_frames, pace_jitter_max, pace_late, (unsigned long)pace_cost);
+    pace_frames = pace_late = 0;
+    pace_lat_sum = pace_lat_max = 0;
+    pace_jitter_sum = pace_jitter_max = 0;
+  }
+}
+
 static __inline__ void count_frame (void)
 {
 	switch(currprefs.gfx_framerate)
@@ -215,6 +330,9 @@ static __inline__ void count_frame (void)
 				fs_framecnt = 0;
       break;  
   }
+  /* of the frames run ahead only the last one is drawn */
+  if (runahead_next)
+    fs_framecnt = runahead_next != runahead_frames;
   if (inhibit_frame)
     fs_framecnt = 1;
 }
@@ -280,6 +398,15 @@ static int unpainted;
 
 #include "linetoscr.c"
 
+/* Native pixel of xlinebuffer; pick the matching linetoscr variants. */
+#ifdef USE_RGB32
+typedef uae_u32 fb_pixel;
+#define LINETOSCR(suffix) linetoscr_32##suffix
+#else
+typedef uae_u16 fb_pixel;
+#define LINETOSCR(suffix) linetoscr_16##suffix
+#endif
+
 static void pfield_do_linetoscr_0_640 (int start, int stop)
 {
 	int local_res_shift = 1 - bplres; // stretch LORES, nothing for HIRES, shrink for SUPERHIRES
@@ -287,11 +414,11 @@ static void pfield_do_linetoscr_0_640 (int start, int stop)
 	stop = stop << 1;
 
 	if (local_res_shift == 0)
-		src_pixel = linetoscr_16 (src_pixel, start, stop);
+		src_pixel = LINETOSCR() (src_pixel, start, stop);
 	else if (local_res_shift == 1)
-		src_pixel = linetoscr_16_stretch1 (src_pixel, start, stop);
+		src_pixel = LINETOSCR(_stretch1) (src_pixel, start, stop);
 	else //if (local_res_shift == -1)
-		src_pixel = linetoscr_16_shrink1 (src_pixel, start, stop);
+		src_pixel = LINETOSCR(_shrink1) (src_pixel, start, stop);
 }
 
 static void pfield_do_linetoscr_0_640_AGA (int start, int stop)
@@ -301,36 +428,36 @@ static void pfield_do_linetoscr_0_640_AGA (int start, int stop)
 	stop = stop << 1;
 
   if (local_res_shift == 0)
-	  src_pixel = linetoscr_16_aga (src_pixel, start, stop);
+	  src_pixel = LINETOSCR(_aga) (src_pixel, start, stop);
   else if (local_res_shift == 1)
-	  src_pixel = linetoscr_16_stretch1_aga (src_pixel, start, stop);
+	  src_pixel = LINETOSCR(_stretch1_aga) (src_pixel, start, stop);
   else //if (local_res_shift == -1)
-	  src_pixel = linetoscr_16_shrink1_aga (src_pixel, start, stop);
+	  src_pixel = LINETOSCR(_shrink1_aga) (src_pixel, start, stop);
 }
 
 static void pfield_do_linetoscr_0 (int start, int stop)
 {
 	if (res_shift == 0)
-		src_pixel = linetoscr_16 (src_pixel, start, stop);
+		src_pixel = LINETOSCR() (src_pixel, start, stop);
 	//else if (res_shift == 1) //can't happen, target is lores
-	//	src_pixel = linetoscr_16_stretch1 (src_pixel, start, stop);
+	//	src_pixel = LINETOSCR(_stretch1) (src_pixel, start, stop);
 	else //if (res_shift == -1)
-		src_pixel = linetoscr_16_shrink1 (src_pixel, start, stop);
+		src_pixel = LINETOSCR(_shrink1) (src_pixel, start, stop);
 }
 
 static void pfield_do_linetoscr_0_AGA (int start, int stop)
 {
   if (res_shift == 0)
-	  src_pixel = linetoscr_16_aga (src_pixel, start, stop);
+	  src_pixel = LINETOSCR(_aga) (src_pixel, start, stop);
   //else if (res_shift == 1)  //can't happen, target is lores
-	//  src_pixel = linetoscr_16_stretch1_aga (src_pixel, start, stop);
+	//  src_pixel = LINETOSCR(_stretch1_aga) (src_pixel, start, stop);
   else //if (res_shift == -1)
-	  src_pixel = linetoscr_16_shrink1_aga (src_pixel, start, stop);
+	  src_pixel = LINETOSCR(_shrink1_aga) (src_pixel, start, stop);
 }
 
 static void pfield_do_fill_line_0_640(int start, int stop)
 {
-	register uae_u16 *b = &(((uae_u16 *)xlinebuffer)[start << 1]);
+	register fb_pixel *b = &(((fb_pixel *)xlinebuffer)[start << 1]);
 	register xcolnr col = colors_for_drawing.acolors[0];
 	register int i;
 	register int max=(stop-start) << 1;
@@ -340,7 +467,7 @@ static void pfield_do_fill_line_0_640(int start, int stop)
 
 static void pfield_do_fill_line_0(int start, int stop)
 {
-	register uae_u16 *b = &(((uae_u16 *)xlinebuffer)[start]);
+	register fb_pixel *b = &(((fb_pixel *)xlinebuffer)[start]);
 	register xcolnr col = colors_for_drawing.acolors[0];
 	register int i;
 	register int max=(stop-start);
@@ -440,14 +567,16 @@ STATIC_INLINE void fill_line (void)
   int *start;
   xcolnr val;
 
-	nints = gfxvidinfo.outwidth >> 1;
+	nints = gfxvidinfo.outwidth * sizeof (fb_pixel) / sizeof (int);
 	if(gfxvidinfo.outwidth > 600)
-		start = (int *)(((uae_u8*)xlinebuffer) + (visible_left_border << 2));
+		start = (int *)(((uae_u8*)xlinebuffer) + visible_left_border * 2 * sizeof (fb_pixel));
 	else
-		start = (int *)(((uae_u8*)xlinebuffer) + (visible_left_border << 1));
+		start = (int *)(((uae_u8*)xlinebuffer) + visible_left_border * sizeof (fb_pixel));
 
 	val = colors_for_drawing.acolors[0];
+#ifndef USE_RGB32
 	val |= val << 16;
+#endif
 	for (; nints > 0; nints -= 8, start += 8) {
 		*start = val;
 		*(start+1) = val;
@@ -467,6 +596,111 @@ static void dummy_worker (int start, int stop)
 static int ham_decode_pixel;
 static unsigned int ham_lastcolor;
 
+/* HAM decoding as a chain of steps color = (color & mask) | value. Modify
+ * pixels keep the other components through the mask, set pixels have mask 0
+ * and their value ORed in from the palette through setmask. */
+struct ham_op {
+  uae_u32 mask, value, setmask, index;
+};
+
+enum { HAM_OPS_ECS, HAM_OPS_AGA6, HAM_OPS_AGA8 };
+static struct ham_op ham_ops[3][256];
+
+/* Byte alignment, so groups of pixels at any position load directly */
+typedef uae_u32 ham_vec __attribute__ ((vector_size (16), aligned (1)));
+
+static void gen_ham_tables (void)
+{
+  static const uae_u32 ecs_mask[4] = { 0, 0xFF0, 0x0FF, 0xF0F };
+  static const int ecs_shift[4] = { 0, 0, 8, 4 };
+  static const uae_u32 aga6_mask[4] = { 0, 0xFFFF00, 0x00FFFF, 0xFF00FF };
+  static const int aga6_shift[4] = { 0, 4, 20, 12 };
+  static const uae_u32 aga8_mask[4] = { 0, 0xFFFF03, 0x03FFFF, 0xFF03FF };
+  static const int aga8_shift[4] = { 0, 0, 16, 8 };
+  int i;
+
+  for (i = 0; i < 256; i++) {
+    int c6 = (i >> 4) & 3, c8 = i & 3;
+    struct ham_op *op;
+
+    op = &ham_ops[HAM_OPS_ECS][i];
+    op->mask = ecs_mask[c6];
+    op->value = c6 ? (i & 0xF) << ecs_shift[c6] : 0;
+    op->setmask = c6 ? 0 : ~0u;
+    op->index = c6 ? 0 : i & 0xF;
+
+    op = &ham_ops[HAM_OPS_AGA6][i];
+    op->mask = aga6_mask[c6];
+    op->value = c6 ? (i & 0xF) << aga6_shift[c6] : 0;
+    op->setmask = c6 ? 0 : ~0u;
+    op->index = c6 ? 0 : i;
+
+    op = &ham_ops[HAM_OPS_AGA8][i];
+    op->mask = aga8_mask[c8];
+    op->value = c8 ? (i & 0xFC) << aga8_shift[c8] : 0;
+    op->setmask = c8 ? 0 : ~0u;
+    op->index = c8 ? 0 : i >> 2;
+  }
+}
+
+/* Step table, palette and pixel xor for the current HAM mode. ECS color
+ * registers are widened into ecs_pal so all modes share one decoder. */
+static const struct ham_op *ham_ops_for_mode (const uae_u32 **pal, uae_u32 *ecs_pal, int *x)
+{
+  int i;
+
+  if (currprefs.chipset_mask & CSMASK_AGA) {
+    *pal = colors_for_drawing.color_regs_aga;
+    *x = bplxor;
+    return ham_ops[bplplanecnt >= 7 ? HAM_OPS_AGA8 : HAM_OPS_AGA6];
+  }
+  for (i = 0; i < 16; i++)
+    ecs_pal[i] = colors_for_drawing.color_regs_ecs[i];
+  *pal = ecs_pal;
+  *x = 0;
+  return ham_ops[HAM_OPS_ECS];
+}
+
+STATIC_INLINE uae_u32 ham_step (const struct ham_op *op, const uae_u32 *pal, uae_u32 c)
+{
+  return (c & op->mask) | op->value | (pal[op->index] & op->setmask);
+}
+
+/* Decode n pixels at apixels[pos] into ham_linebuf, starting from color c.
+ * The steps of four pixels are first combined with a prefix scan, so only
+ * one and/or per group depends on the color carried in from the left. */
+static uae_u32 decode_ham_ops (const struct ham_op *ops, const uae_u32 *pal, int x,
+  const uae_u8 *src, uae_u32 *dst, int n, uae_u32 c)
+{
+  static const ham_vec shift1 = { 4, 0, 1, 2 }, shift2 = { 4, 4, 0, 1 };
+  static const ham_vec keep = { ~0u, ~0u, ~0u, ~0u }, none = { 0, 0, 0, 0 };
+
+  for (; n >= 4; n -= 4, src += 4, dst += 4) {
+    const struct ham_op *o0 = ops + (src[0] ^ x), *o1 = ops + (src[1] ^ x);
+    const struct ham_op *o2 = ops + (src[2] ^ x), *o3 = ops + (src[3] ^ x);
+    ham_vec m = { o0->mask, o1->mask, o2->mask, o3->mask };
+    ham_vec v = { o0->value | (pal[o0->index] & o0->setmask),
+                  o1->value | (pal[o1->index] & o1->setmask),
+                  o2->value | (pal[o2->index] & o2->setmask),
+                  o3->value | (pal[o3->index] & o3->setmask) };
+    ham_vec cv = { c, c, c, c };
+
+    /* lane i becomes the combined step of pixels 0..i */
+    v |= __builtin_shuffle (v, none, shift1) & m;
+    m &= __builtin_shuffle (m, keep, shift1);
+    v |= __builtin_shuffle (v, none, shift2) & m;
+    m &= __builtin_shuffle (m, keep, shift2);
+    v |= cv & m;
+    *(ham_vec *)dst = v;
+    c = v[3];
+  }
+  while (n-- > 0) {
+    c = ham_step (ops + (*src++ ^ x), pal, c);
+    *dst++ = c;
+  }
+  return c;
+}
+
 /* Decode HAM in the invisible portion of the display (left of VISIBLE_LEFT_BORDER),
  * but don't draw anything in.  This is done to prepare HAM_LASTCOLOR for later,
  * when decode_ham runs.
@@ -487,42 +721,14 @@ static void init_ham_decoding (void)
 			else
 				ham_lastcolor = colors_for_drawing.color_regs_ecs[pv];
 		}
-	} else if (currprefs.chipset_mask & CSMASK_AGA) {
-		if (bplplanecnt >= 7) { /* AGA mode HAM8 */
-			while (unpainted_amiga-- > 0) {
-				int pv = pixdata.apixels[ham_decode_pixel++] ^ bplxor;
-				switch (pv & 0x3) 
-        {
-					case 0x0: ham_lastcolor = colors_for_drawing.color_regs_aga[pv >> 2]; break;
-					case 0x1: ham_lastcolor &= 0xFFFF03; ham_lastcolor |= (pv & 0xFC); break;
-					case 0x2: ham_lastcolor &= 0x03FFFF; ham_lastcolor |= (pv & 0xFC) << 16; break;
-					case 0x3: ham_lastcolor &= 0xFF03FF; ham_lastcolor |= (pv & 0xFC) << 8; break;
-				}
-			}
-		} else { /* AGA mode HAM6 */
-			while (unpainted_amiga-- > 0) {
-				int pv = pixdata.apixels[ham_decode_pixel++] ^ bplxor;
-				switch (pv & 0x30) 
-        {
-					case 0x00: ham_lastcolor = colors_for_drawing.color_regs_aga[pv]; break;
-					case 0x10: ham_lastcolor &= 0xFFFF00; ham_lastcolor |= (pv & 0xF) << 4; break;
-					case 0x20: ham_lastcolor &= 0x00FFFF; ham_lastcolor |= (pv & 0xF) << 20; break;
-					case 0x30: ham_lastcolor &= 0xFF00FF; ham_lastcolor |= (pv & 0xF) << 12; break;
-				}
-			}
-		}
 	} else {
-		/* OCS/ECS mode HAM6 */
-		while (unpainted_amiga-- > 0) {
-			int pv = pixdata.apixels[ham_decode_pixel++];
-			switch (pv & 0x30) 
-      {
-				case 0x00: ham_lastcolor = colors_for_drawing.color_regs_ecs[pv]; break;
-				case 0x10: ham_lastcolor &= 0xFF0; ham_lastcolor |= (pv & 0xF); break;
-				case 0x20: ham_lastcolor &= 0x0FF; ham_lastcolor |= (pv & 0xF) << 8; break;
-				case 0x30: ham_lastcolor &= 0xF0F; ham_lastcolor |= (pv & 0xF) << 4; break;
-			}
-		}
+		uae_u32 ecs_pal[16];
+		const uae_u32 *pal;
+		int x;
+		const struct ham_op *ops = ham_ops_for_mode (&pal, ecs_pal, &x);
+
+		while (unpainted_amiga-- > 0)
+			ham_lastcolor = ham_step (ops + (pixdata.apixels[ham_decode_pixel++] ^ x), pal, ham_lastcolor);
 	}
 }
 
@@ -540,48 +746,101 @@ static void decode_ham (int pix, int stoppos)
 			
 			ham_linebuf[ham_decode_pixel++] = ham_lastcolor;
 		}
-	} else if (currprefs.chipset_mask & CSMASK_AGA) {
-		if (bplplanecnt >= 7) { /* AGA mode HAM8 */
-			while (todraw_amiga-- > 0) {
-				int pv = pixdata.apixels[ham_decode_pixel] ^ bplxor;
-				switch (pv & 0x3) 
-        {
-					case 0x0: ham_lastcolor = colors_for_drawing.color_regs_aga[pv >> 2]; break;
-					case 0x1: ham_lastcolor &= 0xFFFF03; ham_lastcolor |= (pv & 0xFC); break;
-					case 0x2: ham_lastcolor &= 0x03FFFF; ham_lastcolor |= (pv & 0xFC) << 16; break;
-					case 0x3: ham_lastcolor &= 0xFF03FF; ham_lastcolor |= (pv & 0xFC) << 8; break;
-				}
-				ham_linebuf[ham_decode_pixel++] = ham_lastcolor;
-			}
-		} else { /* AGA mode HAM6 */
-			while (todraw_amiga-- > 0) {
-				int pv = pixdata.apixels[ham_decode_pixel] ^ bplxor;
-				switch (pv & 0x30) 
-        {
-					case 0x00: ham_lastcolor = colors_for_drawing.color_regs_aga[pv]; break;
-					case 0x10: ham_lastcolor &= 0xFFFF00; ham_lastcolor |= (pv & 0xF) << 4; break;
-					case 0x20: ham_lastcolor &= 0x00FFFF; ham_lastcolor |= (pv & 0xF) << 20; break;
-					case 0x30: ham_lastcolor &= 0xFF00FF; ham_lastcolor |= (pv & 0xF) << 12; break;
-				}
-				ham_linebuf[ham_decode_pixel++] = ham_lastcolor;
-			}
-		}
-	} else {
-		/* OCS/ECS mode HAM6 */
-		while (todraw_amiga-- > 0) {
-			int pv = pixdata.apixels[ham_decode_pixel];
-			switch (pv & 0x30) 
-      {
-				case 0x00: ham_lastcolor = colors_for_drawing.color_regs_ecs[pv]; break;
-				case 0x10: ham_lastcolor &= 0xFF0; ham_lastcolor |= (pv & 0xF); break;
-				case 0x20: ham_lastcolor &= 0x0FF; ham_lastcolor |= (pv & 0xF) << 8; break;
-				case 0x30: ham_lastcolor &= 0xF0F; ham_lastcolor |= (pv & 0xF) << 4; break;
-			}
-			ham_linebuf[ham_decode_pixel++] = ham_lastcolor;
-		}
+	} else if (todraw_amiga > 0) {
+		uae_u32 ecs_pal[16];
+		const uae_u32 *pal;
+		int x;
+		const struct ham_op *ops = ham_ops_for_mode (&pal, ecs_pal, &x);
+
+		ham_lastcolor = decode_ham_ops (ops, pal, x, pixdata.apixels + ham_decode_pixel,
+			ham_linebuf + ham_decode_pixel, todraw_amiga, ham_lastcolor);
+		ham_decode_pixel += todraw_amiga;
 	}
 }
 
+#ifdef HAM_DECODE_BENCH
+/* The sequential decoder the table driven one replaced, kept as reference */
+static uae_u32 decode_ham_ref (int mode, const uae_u32 *pal, int x,
+  const uae_u8 *src, uae_u32 *dst, int n, uae_u32 c)
+{
+  while (n-- > 0) {
+    int pv = *src++ ^ x;
+    if (mode == HAM_OPS_AGA8) {
+      switch (pv & 0x3) {
+        case 0x0: c = pal[pv >> 2]; break;
+        case 0x1: c &= 0xFFFF03; c |= (pv & 0xFC); break;
+        case 0x2: c &= 0x03FFFF; c |= (pv & 0xFC) << 16; break;
+        case 0x3: c &= 0xFF03FF; c |= (pv & 0xFC) << 8; break;
+      }
+    } else if (mode == HAM_OPS_AGA6) {
+      switch (pv & 0x30) {
+        case 0x00: c = pal[pv]; break;
+        case 0x10: c &= 0xFFFF00; c |= (pv & 0xF) << 4; break;
+        case 0x20: c &= 0x00FFFF; c |= (pv & 0xF) << 20; break;
+        case 0x30: c &= 0xFF00FF; c |= (pv & 0xF) << 12; break;
+      }
+    } else {
+      switch (pv & 0x30) {
+        case 0x00: c = pal[pv]; break;
+        case 0x10: c &= 0xFF0; c |= (pv & 0xF); break;
+        case 0x20: c &= 0x0FF; c |= (pv & 0xF) << 8; break;
+        case 0x30: c &= 0xF0F; c |= (pv & 0xF) << 4; break;
+      }
+    }
+    *dst++ = c;
+  }
+  return c;
+}
+
+/* Check the decoders agree on every mode and log their speed */
+static void ham_benchmark (void)
+{
+  static const TCHAR *names[] = { _T("OCS HAM6"), _T("AGA HAM6"), _T("AGA HAM8") };
+  const int width = 736, loops = 2000;
+  uae_u8 *src = xmalloc (uae_u8, width);
+  uae_u32 *ref = xmalloc (uae_u32, width);
+  uae_u32 *out = xmalloc (uae_u32, width);
+  uae_u32 pal[256];
+  uae_u32 seed = 1;
+  int mode, i;
+
+  for (i = 0; i < 256; i++)
+    pal[i] = (i * 0x2f1a55) & 0xffffff;
+  for (mode = HAM_OPS_ECS; mode <= HAM_OPS_AGA8; mode++) {
+    frame_time_t start, t_ref, t_ops;
+    int x = mode == HAM_OPS_ECS ? 0 : 0x40, l, same;
+
+    for (i = 0; i < width; i++) {
+      seed = seed * 1103515245 + 12345;
+      src[i] = seed >> 16;
+      if (mode != HAM_OPS_AGA8)
+        src[i] &= mode == HAM_OPS_ECS ? 0x3f : 0xcf;
+    }
+    for (i = 0; i < 16; i++)
+      pal[i] &= mode == HAM_OPS_ECS ? 0xfff : 0xffffff;
+    start = read_processor_time ();
+    for (l = 0; l < loops; l++)
+      decode_ham_ref (mode, pal, x, src, ref, width, l);
+    t_ref = read_processor_time () - start;
+    start = read_processor_time ();
+    for (l = 0; l < loops; l++)
+      decode_ham_ops (ham_ops[mode], pal, x, src, out, width, l);
+    t_ops = read_processor_time () - start;
+    same = !memcmp (ref, out, width * sizeof *out);
+    for (i = 1; i < width && same; i++) {
+      uae_u32 c = decode_ham_ref (mode, pal, x, src, ref, i, 0x123456);
+      same = decode_ham_ops (ham_ops[mode], pal, x, src, out, i, 0x123456) == c
+        && !memcmp (ref, out, i * sizeof *out);
+    }
+    write_log (_T("HAM %s: sequential %d us, prefix scan %d us per %d lines, %s\n"),
+      names[mode], (int)t_ref, (int)t_ops, loops, same ? _T("identical") : _T("MISMATCH"));
+  }
+  xfree (out);
+  xfree (ref);
+  xfree (src);
+}
+#endif
+
 static void gen_pfield_tables (void)
 {
 	int i;
@@ -640,6 +899,11 @@ static void gen_pfield_tables (void)
       (i & 0x3000) ? 0x40 :
       (i & 0xC000) ? 0x80 : 0;
   }
+
+  gen_ham_tables ();
+#ifdef HAM_DECODE_BENCH
+  ham_benchmark ();
+#endif
 }
 
 static void draw_sprites_normal_sp_lo_nat(struct sprite_entry *_GCCRES_ e)
@@ -1233,12 +1497,6 @@ static __inline__ void decide_draw_sprites(void)
 	}
 }
 
-#define MERGE(a,b,mask,shift) do {\
-    uae_u32 tmp = mask & (a ^ (b >> shift)); \
-    a ^= tmp; \
-    b ^= (tmp << shift); \
-} while (0)
-
 #define GETLONG(P) (*(uae_u32 *)P)
 
 #define DATA_POINTER(n) (line_data[lineno] + (n) * MAX_WORDS_PER_LINE * 2)
@@ -1411,37 +1669,14 @@ STATIC_INLINE void pfield_doline_1 (uae_u32 *pixels, int wordcount, int planes)
 	      case 1: b7 = GETLONG (real_bplpt[0]); real_bplpt[0] += 4;
     	}
 
-      MERGE (b0, b1, 0x55555555, 1);
-      MERGE (b2, b3, 0x55555555, 1);
-      MERGE (b4, b5, 0x55555555, 1);
-      MERGE (b6, b7, 0x55555555, 1);
-
-      MERGE (b0, b2, 0x33333333, 2);
-      MERGE (b1, b3, 0x33333333, 2);
-      MERGE (b4, b6, 0x33333333, 2);
-      MERGE (b5, b7, 0x33333333, 2);
-
-      MERGE (b0, b4, 0x0f0f0f0f, 4);
-      MERGE (b1, b5, 0x0f0f0f0f, 4);
-      MERGE (b2, b6, 0x0f0f0f0f, 4);
-      MERGE (b3, b7, 0x0f0f0f0f, 4);
-
-      MERGE (b0, b1, 0x00ff00ff, 8);
-      MERGE (b2, b3, 0x00ff00ff, 8);
-      MERGE (b4, b5, 0x00ff00ff, 8);
-      MERGE (b6, b7, 0x00ff00ff, 8);
-
-      MERGE (b0, b2, 0x0000ffff, 16);
+      P2C_TRANSPOSE (b0, b1, b2, b3, b4, b5, b6, b7);
       do_put_mem_long (pixels, b0);
-      do_put_mem_long (pixels + 4, b2);
-      MERGE (b1, b3, 0x0000ffff, 16);
-      do_put_mem_long (pixels + 2, b1);
-      do_put_mem_long (pixels + 6, b3);
-      MERGE (b4, b6, 0x0000ffff, 16);
       do_put_mem_long (pixels + 1, b4);
-      do_put_mem_long (pixels + 5, b6);
-      MERGE (b5, b7, 0x0000ffff, 16);
+      do_put_mem_long (pixels + 2, b1);
       do_put_mem_long (pixels + 3, b5);
+      do_put_mem_long (pixels + 4, b2);
+      do_put_mem_long (pixels + 5, b6);
+      do_put_mem_long (pixels + 6, b3);
       do_put_mem_long (pixels + 7, b7);
       pixels += 8;
    }
@@ -1614,10 +1849,46 @@ static void pfield_expand_dp_bplconx (int regno, int v)
 static int drawing_color_matches;
 static enum { color_match_acolors, color_match_full } color_match_type;
 
+/* colors_for_drawing is table drawing_color_matches plus the registers
+   patched by do_color_changes since, drawing_color_print is the print of
+   that state. Registers not patched may be stale in colors_for_drawing
+   when only acolors was copied. */
+static uae_u64 drawing_color_print;
+static uae_u8 drawing_color_patched[256];
+static uae_u8 drawing_patch_list[256];
+static int drawing_nr_patches;
+
+STATIC_INLINE void clear_drawing_patches (void)
+{
+  while (drawing_nr_patches > 0)
+    drawing_color_patched[drawing_patch_list[--drawing_nr_patches]] = 0;
+}
+
+/* Apply a color change to colors_for_drawing, keeping its print current. */
+STATIC_INLINE void patch_drawing_color (int regno, unsigned int value)
+{
+  if (!drawing_color_patched[regno]) {
+    drawing_color_patched[regno] = 1;
+    drawing_patch_list[drawing_nr_patches++] = regno;
+    drawing_color_print ^= color_print (regno, color_reg_get (curr_color_tables + drawing_color_matches, regno));
+  } else {
+    drawing_color_print ^= color_print (regno, color_reg_get (&colors_for_drawing, regno));
+  }
+  drawing_color_print ^= color_print (regno, value);
+  color_reg_set (&colors_for_drawing, regno, value);
+  colors_for_drawing.acolors[regno] = getxcolor (value);
+}
+
 /* Set up colors_for_drawing to the state at the beginning of the currently drawn
    line.  Try to avoid copying color tables around whenever possible.  */
 STATIC_INLINE void adjust_drawing_colors (int ctable, int need_full)
 {
+  if (drawing_color_matches >= 0 && drawing_color_matches != ctable
+    && drawing_color_print == curr_color_prints[ctable]) {
+    /* The changes of the previous line already produced this palette. */
+    drawing_color_matches = ctable;
+    clear_drawing_patches ();
+  }
   if (drawing_color_matches != ctable) {
   	if (need_full) {
 			color_reg_cpy (&colors_for_drawing, curr_color_tables + ctable);
@@ -1628,9 +1899,23 @@ STATIC_INLINE void adjust_drawing_colors (int ctable, int need_full)
 			color_match_type = color_match_acolors;
   	}
 		drawing_color_matches = ctable;
+		drawing_color_print = curr_color_prints[ctable];
+		clear_drawing_patches ();
   } else if (need_full && color_match_type != color_match_full) {
 		color_reg_cpy (&colors_for_drawing, &curr_color_tables[ctable]);
 		color_match_type = color_match_full;
+		drawing_color_print = curr_color_prints[ctable];
+		clear_drawing_patches ();
+  } else if (drawing_nr_patches > 0) {
+    /* Undo only the registers changed since the table was copied. */
+    struct color_entry *ce = curr_color_tables + ctable;
+    while (drawing_nr_patches > 0) {
+      int regno = drawing_patch_list[--drawing_nr_patches];
+      drawing_color_patched[regno] = 0;
+      colors_for_drawing.acolors[regno] = ce->acolors[regno];
+      color_reg_set (&colors_for_drawing, regno, color_reg_get (ce, regno));
+    }
+    drawing_color_print = curr_color_prints[ctable];
   }
 }
 
@@ -1676,8 +1961,7 @@ STATIC_INLINE void do_color_changes (line_draw_func worker_border, line_draw_fun
       if (regno >= 0x1000) {
 	      pfield_expand_dp_bplconx (regno, value);
       } else {
-		    color_reg_set (&colors_for_drawing, regno, value);
-		    colors_for_drawing.acolors[regno] = getxcolor (value);
+		    patch_drawing_color (regno, value);
 		  }
 	  }
 	  if (lastpos >= endpos)
@@ -1765,6 +2049,7 @@ static void init_drawing_frame (void)
   center_image ();
 
   drawing_color_matches = -1;
+  clear_drawing_patches ();
 }
 
 /*
@@ -1794,8 +2079,8 @@ static const char *letters = { /* ugly */
 
 STATIC_INLINE void putpixel (uae_u8 *buf, int x, xcolnr c8)
 {
-	uae_u16 *p = (uae_u16 *)buf + x;
-	*p = (uae_u16)c8;
+	fb_pixel *p = (fb_pixel *)buf + x;
+	*p = (fb_pixel)c8;
 }
 
 static void write_tdnumber (uae_u8 *buf, int x, int y, int num)
@@ -1851,7 +2136,7 @@ static void draw_status_line (int line)
 	x+=100 - (TD_WIDTH*(currprefs.nr_floppies-1)) - TD_WIDTH;
 #ifdef PICASSO96
   if(picasso_on)
-    memset (buf + (x - 4) * 2, 0, (picasso_vidinfo.width - x + 4) * 2);
+    memset (buf + (x - 4) * picasso_vidinfo.pixbytes, 0, (picasso_vidinfo.width - x + 4) * picasso_vidinfo.pixbytes);
   else
 #endif
     memset (buf + (x - 4) * gfxvidinfo.pixbytes, 0, (gfxvidinfo.outwidth - x + 4) * gfxvidinfo.pixbytes);
@@ -1927,11 +2212,175 @@ static void draw_status_line (int line)
 }
 
 
+/* Smart update: each output row remembers a fingerprint of everything its
+   pixels were built from (decisions, colors, bitplane and sprite data).
+   SDL may flip between several buffers, so the fingerprints are kept per
+   buffer and a row is only redrawn if it differs from what that buffer
+   already shows. */
+#define MAX_SCREEN_BUFFERS 3
+
+struct line_prints {
+  uae_u8 *bufmem;
+  int age;
+  uae_u64 rows[MAX_VIDHEIGHT];
+};
+
+static struct line_prints line_prints[MAX_SCREEN_BUFFERS];
+static uae_u64 *curr_prints;
+static int prints_frame;
+
+uae_u8 row_dirty[MAX_VIDHEIGHT];
+int row_dirty_first, row_dirty_last;
+
+/* Rows between two dirty ones closer than this are uploaded with them */
+#define ROW_RANGE_GAP 4
+
+static void mark_all_rows_dirty (void)
+{
+  memset (row_dirty, 1, sizeof row_dirty);
+  row_dirty_first = 0;
+  row_dirty_last = MAX_VIDHEIGHT - 1;
+}
+
+void notice_screen_contents_lost (void)
+{
+  int i;
+
+  for (i = 0; i < MAX_SCREEN_BUFFERS; i++)
+    line_prints[i].bufmem = NULL;
+  mark_all_rows_dirty ();
+}
+
+/* Collect the rows redrawn in the last frame (or set in also[]) into at
+   most MAX_ROW_RANGES ranges for the display backend to upload. */
+int get_dirty_row_ranges (struct row_range *r, int height, const uae_u8 *also)
+{
+  int y, n = 0, gap = 0;
+
+  if (height > MAX_VIDHEIGHT)
+    height = MAX_VIDHEIGHT;
+  for (y = 0; y < height; y++) {
+    if (!row_dirty[y] && !(also && also[y])) {
+      gap++;
+      continue;
+    }
+    if (n > 0 && (gap < ROW_RANGE_GAP || n == MAX_ROW_RANGES)) {
+      r[n - 1].count = y + 1 - r[n - 1].first;
+    } else {
+      r[n].first = y;
+      r[n].count = 1;
+      n++;
+    }
+    gap = 0;
+  }
+  return n;
+}
+
+STATIC_INLINE void print_mix (uae_u32 *h, uae_u32 v)
+{
+  h[0] = (h[0] ^ v) * 0x9e3779b1;
+  h[1] = ((h[1] << 5) | (h[1] >> 27)) ^ (v * 0x85ebca77);
+}
+
+static void print_longs (uae_u32 *h, const uae_u32 *p, int n)
+{
+  while (n-- > 0)
+    print_mix (h, *p++);
+}
+
+static uae_u64 line_print (int lineno)
+{
+  struct decision *dp = line_decisions + lineno;
+  struct draw_info *dip = curr_drawinfo + lineno;
+  uae_u64 cp = dp->ctable >= 0 ? curr_color_prints[dp->ctable] : 0;
+  uae_u32 h[2] = { (uae_u32)cp, (uae_u32)(cp >> 32) };
+  int i, j;
+
+  print_mix (h, lineno | (sprite_buffer_res << 16));
+  print_mix (h, dp->plfleft);
+  print_mix (h, dp->plfright);
+  print_mix (h, dp->plflinelen);
+  print_mix (h, dp->diwfirstword);
+  print_mix (h, dp->diwlastword);
+  print_mix (h, (dp->bplcon0 << 16) | dp->bplcon2);
+  print_mix (h, (dp->bplcon3 << 16) | dp->bplcon4);
+  print_mix (h, dp->nr_planes | (dp->bplres << 8) | (dp->ham_seen << 16) | (dp->ham_at_start << 24));
+
+  if (dp->plfleft != -1) {
+    for (i = 0; i < dp->nr_planes; i++)
+      print_longs (h, (uae_u32 *)(line_data[lineno] + i * MAX_WORDS_PER_LINE * 2), dp->plflinelen);
+    for (i = 0; i < dip->nr_sprites; i++) {
+      struct sprite_entry *e = curr_sprite_entries + dip->first_sprite_entry + i;
+      print_mix (h, e->pos | (e->max << 16));
+      print_mix (h, e->has_attached);
+      for (j = 0; j < e->max - e->pos; j++)
+        print_mix (h, spixels[e->first_pixel + j] | (spixstate.bytes[e->first_pixel + j] << 16));
+    }
+  }
+
+  print_mix (h, dip->nr_color_changes);
+  for (i = dip->first_color_change; i < dip->last_color_change; i++) {
+    print_mix (h, curr_color_changes[i].linepos);
+    print_mix (h, curr_color_changes[i].regno);
+    print_mix (h, curr_color_changes[i].value);
+  }
+
+  /* Zero is kept for "unknown" */
+  return ((uae_u64)h[1] << 32) | h[0] | 1;
+}
+
+static void select_line_prints (void)
+{
+  struct line_prints *lp = NULL;
+  int i;
+
+  prints_frame++;
+  for (i = 0; i < MAX_SCREEN_BUFFERS; i++) {
+    if (line_prints[i].bufmem == gfxvidinfo.bufmem) {
+      lp = &line_prints[i];
+      break;
+    }
+    if (!lp || line_prints[i].age < lp->age)
+      lp = &line_prints[i];
+  }
+  if (lp->bufmem != gfxvidinfo.bufmem) {
+    lp->bufmem = gfxvidinfo.bufmem;
+    memset (lp->rows, 0, sizeof lp->rows);
+  }
+  lp->age = prints_frame;
+  curr_prints = lp->rows;
+
+  memset (row_dirty, 0, sizeof row_dirty);
+  row_dirty_first = MAX_VIDHEIGHT;
+  row_dirty_last = -1;
+}
+
+STATIC_INLINE void mark_row_dirty (int gfx_ypos)
+{
+  row_dirty[gfx_ypos] = 1;
+  if (gfx_ypos < row_dirty_first)
+    row_dirty_first = gfx_ypos;
+  if (gfx_ypos > row_dirty_last)
+    row_dirty_last = gfx_ypos;
+}
+
+STATIC_INLINE bool line_unchanged (int lineno, int gfx_ypos)
+{
+  uae_u64 print = line_print (lineno);
+
+  if (curr_prints[gfx_ypos] == print)
+    return true;
+  curr_prints[gfx_ypos] = print;
+  mark_row_dirty (gfx_ypos);
+  return false;
+}
+
 static void finish_drawing_frame (void)
 {
 	int i;
 
 	lockscr();
+	select_line_prints ();
 
 	if(gfxvidinfo.outwidth > 600)
 	{
@@ -1954,6 +2403,8 @@ static void finish_drawing_frame (void)
 		int line = i + thisframe_y_adjust_real;
     if(line >= linestate_first_undecided)
 			break;
+		if (line_unchanged (line, i))
+			continue;
 
 		pfield_draw_line (line, i);
 	}
@@ -1962,9 +2413,12 @@ static void finish_drawing_frame (void)
 		for (i = 0; i < TD_TOTAL_HEIGHT; i++) {
 			int line = gfxvidinfo.outheight - TD_TOTAL_HEIGHT + i;
 			draw_status_line (line);
+			mark_row_dirty (line);
 		}
 	}
 	do_flush_screen ();
+	/* Flushes from anywhere else don't know what changed */
+	mark_all_rows_dirty ();
 }
 
 STATIC_INLINE void check_picasso (void)
@@ -1979,6 +2433,7 @@ STATIC_INLINE void check_picasso (void)
   	clear_inhibit_frame (IHF_PICASSO);
   else
     set_inhibit_frame (IHF_PICASSO);
+  notice_screen_contents_lost ();
 
   gfx_set_picasso_state (picasso_on);
   picasso_enablescreen (picasso_requested_on);
@@ -2007,19 +2462,33 @@ int wait_for_vsync = 1;
 extern uae_sem_t vsync_wait_sem;
 #endif
 
+static void show_drawing_frame (void)
+{
+#ifdef RASPBERRY
+	if (wait_for_vsync == 1)
+		uae_sem_wait (&vsync_wait_sem);
+	wait_for_vsync = 1;
+#endif
+	finish_drawing_frame ();
+}
+
+/* Run-ahead goes back in time right at the end of the frame it shows, so the
+   frame is handed over at once; the lines emulated again are not drawn. */
+void runahead_show_frame (void)
+{
+	if (framecnt != 0)
+		return;
+	show_drawing_frame ();
+	framecnt = 1;
+}
+
 void vsync_handle_redraw (void)
 {
 	count_frame ();
 
-	if (framecnt == 0)
-	{
-		#ifdef RASPBERRY
-		if (wait_for_vsync == 1)
-			uae_sem_wait (&vsync_wait_sem);
-		wait_for_vsync = 1;
-		#endif
-		finish_drawing_frame ();
-	}
+	/* a real frame that run-ahead went on from is replaced by the frame ahead */
+	if (framecnt == 0 && runahead_next != 1)
+		show_drawing_frame ();
 #ifdef PICASSO96
   else if(picasso_on)
   {
@@ -2076,6 +2545,7 @@ void reset_drawing (void)
   memset(spixels, 0, sizeof spixels);
   memset(&spixstate, 0, sizeof spixstate);
 
+  notice_screen_contents_lost ();
   init_drawing_frame ();
 }
 
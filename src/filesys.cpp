@@ -717,6 +717,8 @@ typedef struct {
   a_inode *aino;
   /* The file we're going to look up next.  */
   a_inode *curr_file;
+  /* Snapshot of the directory taken when it was populated, if any.  */
+  struct fs_dirhandle *dirhandle;
 } ExamineKey;
 
 struct lockrecord
@@ -762,7 +764,8 @@ typedef struct exallkey {
 
 #define EXKEYS 128
 #define EXALLKEYS 100
-#define MAX_AINO_HASH 128
+#define MIN_AINO_HASH 128
+#define MIN_CHILD_HASH 16
 #define NOTIFY_HASH_SIZE 127
 
 /* handler state info */
@@ -803,7 +806,10 @@ typedef struct _unit {
 
   a_inode rootnode;
   unsigned long aino_cache_size;
-  a_inode *aino_hash[MAX_AINO_HASH];
+  /* uniq -> a_inode map, grows with the number of cached a_inodes */
+  a_inode **aino_hash;
+  unsigned int aino_hash_size;
+  unsigned int aino_hash_count;
   unsigned long nr_cache_hits;
   unsigned long nr_cache_lookups;
 
@@ -927,17 +933,88 @@ static Unit*
   return u;
 }
     
+static uae_u32 nname_hashval (const TCHAR *s);
+
+/* A host directory read in one pass.  ExNext/ExAll walk the names and
+ * take file attributes from the cached stat() results until something in
+ * the directory changes (stale), after which they stat() again.  */
+struct fs_dirsnap {
+  a_inode *dir;
+  int count;
+  int pos;
+  int stale;
+  struct my_dirsnap_entry *entries;
+  unsigned int hashsize;
+  int *hashfirst;
+  int *hashnext;
+};
+
+static struct fs_dirsnap *fs_dirsnap_create (a_inode *aino)
+{
+  struct fs_dirsnap *snap;
+  struct my_dirsnap_entry *entries;
+  int count, i;
+
+  count = my_readdir_all (aino->nname, &entries);
+  if (count < 0)
+    return NULL;
+  snap = xcalloc (struct fs_dirsnap, 1);
+  snap->dir = aino;
+  snap->count = count;
+  snap->entries = entries;
+  snap->hashsize = 16;
+  while (snap->hashsize < count)
+    snap->hashsize <<= 1;
+  snap->hashfirst = xmalloc (int, snap->hashsize);
+  snap->hashnext = xmalloc (int, count + 1);
+  for (i = 0; i < snap->hashsize; i++)
+    snap->hashfirst[i] = -1;
+  for (i = 0; i < count; i++) {
+    uae_u32 h = nname_hashval (entries[i].name) & (snap->hashsize - 1);
+    snap->hashnext[i] = snap->hashfirst[h];
+    snap->hashfirst[h] = i;
+  }
+  return snap;
+}
+
+static void fs_dirsnap_free (struct fs_dirsnap *snap)
+{
+  if (!snap)
+    return;
+  my_freedir_all (snap->entries, snap->count);
+  xfree (snap->hashfirst);
+  xfree (snap->hashnext);
+  xfree (snap);
+}
+
+/* Cached stat() of NAME, or NULL if unknown or no longer trustworthy.  */
+static const struct _stat64 *fs_dirsnap_stat (struct fs_dirhandle *fsd, const TCHAR *name)
+{
+  struct fs_dirsnap *snap;
+  int i;
+
+  if (!fsd || !(snap = fsd->snap) || snap->stale)
+    return NULL;
+  for (i = snap->hashfirst[nname_hashval (name) & (snap->hashsize - 1)]; i >= 0; i = snap->hashnext[i]) {
+    if (_tcscmp (snap->entries[i].name, name) == 0)
+      return &snap->entries[i].statbuf;
+  }
+  return NULL;
+}
+
 static struct fs_dirhandle *fs_opendir (Unit *u, a_inode *aino)
 {
 	struct fs_dirhandle *fsd = xmalloc (struct fs_dirhandle, 1);
 	fsd->fstype = (u->volflags & MYVOLUMEINFO_ARCHIVE) ? FS_ARCHIVE : FS_DIRECTORY;
+	fsd->snap = NULL;
 	if (fsd->fstype == FS_ARCHIVE) {
 		fsd->zd = zfile_opendir_archive (aino->nname);
 		if (fsd->zd)
 			return fsd;
 	} else if (fsd->fstype == FS_DIRECTORY) {
-		fsd->od = my_opendir (aino->nname);
-		if (fsd->od)
+		fsd->od = NULL;
+		fsd->snap = fs_dirsnap_create (aino);
+		if (fsd->snap)
 			return fsd;
   }
 	xfree (fsd);
@@ -950,9 +1027,29 @@ static void fs_closedir (struct fs_dirhandle *fsd)
 	if (fsd->fstype  == FS_ARCHIVE)
 		zfile_closedir_archive (fsd->zd);
 	else if (fsd->fstype == FS_DIRECTORY)
-		my_closedir (fsd->od);
+		fs_dirsnap_free (fsd->snap);
 	xfree (fsd);
 }
+/* Next valid entry name; *statbuf gets the cached stat() or NULL.  */
+static int fs_readdir (struct fs_dirhandle *fsd, TCHAR *fn, const struct _stat64 **statbuf)
+{
+  *statbuf = NULL;
+  if (fsd->fstype == FS_ARCHIVE)
+    return zfile_readdir_archive (fsd->zd, fn);
+  if (fsd->fstype == FS_DIRECTORY) {
+    struct fs_dirsnap *snap = fsd->snap;
+    while (snap->pos < snap->count) {
+      struct my_dirsnap_entry *e = &snap->entries[snap->pos++];
+      if (fsdb_name_invalid (e->name))
+        continue;
+      _tcscpy (fn, e->name);
+      if (!snap->stale)
+        *statbuf = &e->statbuf;
+      return 1;
+    }
+  }
+  return 0;
+}
 static struct fs_filehandle *fs_openfile (Unit *u, a_inode *aino, int flags)
 {
 	struct fs_filehandle *fsf = xmalloc (struct fs_filehandle, 1);
@@ -1041,6 +1138,7 @@ static void set_volume_name (Unit *unit, uae_u32 ctime)
 		put_long (unit->volume + 20, mins);
 		put_long (unit->volume + 24, ticks);
 	}
+  fsdb_free_index (&unit->rootnode);
   unit->rootnode.aname = unit->ui.volname;
   unit->rootnode.nname = unit->ui.rootdir;
   unit->rootnode.mountcount = unit->mountcount;
@@ -1056,6 +1154,8 @@ static void clear_exkeys(Unit *unit)
   int i;
   a_inode *a;
   for (i = 0; i < EXKEYS; i++) {
+    fs_closedir (unit->examine_keys[i].dirhandle);
+    unit->examine_keys[i].dirhandle = NULL;
 	  unit->examine_keys[i].aino = 0;
 	  unit->examine_keys[i].curr_file = 0;
 	  unit->examine_keys[i].uniq = 0;
@@ -1365,6 +1465,162 @@ static int fsdb_cando (Unit *unit)
   return 0;
 }
 
+/* Per-directory child tables, keyed by the last component of the
+ * case-folded Amiga name and of the (case-sensitive) native name.  */
+struct aino_childhash {
+  unsigned int size;
+  unsigned int count;
+  a_inode **abuckets;
+  a_inode **nbuckets;
+};
+
+static const TCHAR *name_tail (const TCHAR *name, TCHAR sep)
+{
+  const TCHAR *p = _tcsrchr (name, sep);
+  return p ? p + 1 : name;
+}
+
+static uae_u32 aname_hashval (const TCHAR *s)
+{
+  uae_u32 hash = 2166136261u;
+  while (*s)
+  	hash = (hash ^ (uae_u8)_totlower ((uae_u8)*s++)) * 16777619u;
+  return hash;
+}
+
+static uae_u32 nname_hashval (const TCHAR *s)
+{
+  uae_u32 hash = 2166136261u;
+  while (*s)
+  	hash = (hash ^ (uae_u8)*s++) * 16777619u;
+  return hash;
+}
+
+static void childhash_resize (struct aino_childhash *ch, unsigned int size)
+{
+  a_inode **ab = xcalloc (a_inode*, size);
+  a_inode **nb = xcalloc (a_inode*, size);
+  unsigned int i;
+
+  for (i = 0; i < ch->size; i++) {
+  	a_inode *a, *next;
+  	for (a = ch->abuckets[i]; a; a = next) {
+	    next = a->aname_next;
+	    a->aname_next = ab[a->aname_hash & (size - 1)];
+	    ab[a->aname_hash & (size - 1)] = a;
+  	}
+  	for (a = ch->nbuckets[i]; a; a = next) {
+	    next = a->nname_next;
+	    a->nname_next = nb[a->nname_hash & (size - 1)];
+	    nb[a->nname_hash & (size - 1)] = a;
+  	}
+  }
+  xfree (ch->abuckets);
+  xfree (ch->nbuckets);
+  ch->abuckets = ab;
+  ch->nbuckets = nb;
+  ch->size = size;
+}
+
+static void childhash_insert (a_inode *base, a_inode *aino)
+{
+  struct aino_childhash *ch = base->childhash;
+  unsigned int idx;
+
+  if (ch == 0) {
+  	ch = base->childhash = xcalloc (struct aino_childhash, 1);
+  	childhash_resize (ch, MIN_CHILD_HASH);
+  } else if (ch->count >= ch->size) {
+  	childhash_resize (ch, ch->size * 2);
+  }
+  aino->aname_hash = aname_hashval (name_tail (aino->aname, '/'));
+  aino->nname_hash = nname_hashval (name_tail (aino->nname, FSDB_DIR_SEPARATOR));
+  idx = aino->aname_hash & (ch->size - 1);
+  aino->aname_next = ch->abuckets[idx];
+  ch->abuckets[idx] = aino;
+  idx = aino->nname_hash & (ch->size - 1);
+  aino->nname_next = ch->nbuckets[idx];
+  ch->nbuckets[idx] = aino;
+  ch->count++;
+}
+
+static void childhash_remove (a_inode *base, a_inode *aino)
+{
+  struct aino_childhash *ch = base->childhash;
+  a_inode **ap;
+
+  if (ch == 0)
+  	return;
+  for (ap = &ch->abuckets[aino->aname_hash & (ch->size - 1)]; *ap; ap = &(*ap)->aname_next) {
+  	if (*ap == aino) {
+	    *ap = aino->aname_next;
+	    break;
+  	}
+  }
+  for (ap = &ch->nbuckets[aino->nname_hash & (ch->size - 1)]; *ap; ap = &(*ap)->nname_next) {
+  	if (*ap == aino) {
+	    *ap = aino->nname_next;
+	    ch->count--;
+	    break;
+  	}
+  }
+  aino->aname_next = aino->nname_next = 0;
+  if (ch->count == 0) {
+  	xfree (ch->abuckets);
+  	xfree (ch->nbuckets);
+  	xfree (ch);
+  	base->childhash = 0;
+  }
+}
+
+static void aino_hash_resize (Unit *unit, unsigned int size)
+{
+  a_inode **tab = xcalloc (a_inode*, size);
+  unsigned int i;
+
+  for (i = 0; i < unit->aino_hash_size; i++) {
+  	a_inode *a, *next;
+  	for (a = unit->aino_hash[i]; a; a = next) {
+	    next = a->uniq_next;
+	    a->uniq_next = tab[a->uniq & (size - 1)];
+	    tab[a->uniq & (size - 1)] = a;
+  	}
+  }
+  xfree (unit->aino_hash);
+  unit->aino_hash = tab;
+  unit->aino_hash_size = size;
+}
+
+static void aino_hash_insert (Unit *unit, a_inode *aino)
+{
+  unsigned int idx;
+
+  if (unit->aino_hash == 0)
+  	aino_hash_resize (unit, MIN_AINO_HASH);
+  else if (unit->aino_hash_count >= unit->aino_hash_size)
+  	aino_hash_resize (unit, unit->aino_hash_size * 2);
+  idx = aino->uniq & (unit->aino_hash_size - 1);
+  aino->uniq_next = unit->aino_hash[idx];
+  unit->aino_hash[idx] = aino;
+  unit->aino_hash_count++;
+}
+
+static void aino_hash_remove (Unit *unit, a_inode *aino)
+{
+  a_inode **ap;
+
+  if (unit->aino_hash == 0)
+  	return;
+  for (ap = &unit->aino_hash[aino->uniq & (unit->aino_hash_size - 1)]; *ap; ap = &(*ap)->uniq_next) {
+  	if (*ap == aino) {
+	    *ap = aino->uniq_next;
+	    aino->uniq_next = 0;
+	    unit->aino_hash_count--;
+	    return;
+  	}
+  }
+}
+
 static void de_recycle_aino (Unit *unit, a_inode *aino)
 {
   if (aino->next == 0 || aino == &unit->rootnode)
@@ -1377,14 +1633,20 @@ static void de_recycle_aino (Unit *unit, a_inode *aino)
 
 static void dispose_aino (Unit *unit, a_inode **aip, a_inode *aino)
 {
-  int hash = aino->uniq % MAX_AINO_HASH;
-  if (unit->aino_hash[hash] == aino)
-  	unit->aino_hash[hash] = 0;
+  aino_hash_remove (unit, aino);
+  if (aino->parent)
+  	childhash_remove (aino->parent, aino);
 
   if (aino->dirty && aino->parent)
   	fsdb_dir_writeback (aino->parent);
 
   *aip = aino->sibling;
+  fsdb_free_index (aino);
+  if (aino->childhash) {
+  	xfree (aino->childhash->abuckets);
+  	xfree (aino->childhash->nbuckets);
+  	xfree (aino->childhash);
+  }
   xfree (aino->aname);
 	xfree (aino->comment);
   xfree (aino->nname);
@@ -1512,8 +1774,11 @@ static void update_child_names (Unit *unit, a_inode *a, a_inode *parent)
 
 static void move_aino_children (Unit *unit, a_inode *from, a_inode *to)
 {
+  /* Only the parent changes; the name tails the tables are keyed on stay. */
   to->child = from->child;
+  to->childhash = from->childhash;
   from->child = 0;
+  from->childhash = 0;
   update_child_names (unit, to->child, to);
 }
 
@@ -1591,18 +1856,21 @@ static a_inode *lookup_sub (a_inode *dir, uae_u32 uniq)
 
 static a_inode *lookup_aino (Unit *unit, uae_u32 uniq)
 {
-  a_inode *a;
-  int hash = uniq % MAX_AINO_HASH;
+  a_inode *a = 0;
 
   if (uniq == 0)
   	return &unit->rootnode;
-  a = unit->aino_hash[hash];
-  if (a == 0 || a->uniq != uniq)
+  if (unit->aino_hash) {
+  	for (a = unit->aino_hash[uniq & (unit->aino_hash_size - 1)]; a; a = a->uniq_next) {
+	    if (a->uniq == uniq)
+    		break;
+  	}
+  }
+  if (a == 0)
   	a = lookup_sub (&unit->rootnode, uniq);
   else
   	unit->nr_cache_hits++;
   unit->nr_cache_lookups++;
-  unit->aino_hash[hash] = a;
   return a;
 }
 
@@ -1684,7 +1952,7 @@ static TCHAR *create_nname (Unit *unit, a_inode *base, TCHAR *rel)
   return p;
 }
 
-static int fill_file_attrs(Unit *u, a_inode *base, a_inode *c)
+static int fill_file_attrs(Unit *u, a_inode *base, a_inode *c, const struct _stat64 *statbuf = NULL)
 {
   if (u->volflags & MYVOLUMEINFO_ARCHIVE) {
     int isdir, flags;
@@ -1697,6 +1965,8 @@ static int fill_file_attrs(Unit *u, a_inode *base, a_inode *c)
     c->comment = comment;
   	return 1;
   } else {
+    if (statbuf)
+      return fsdb_fill_file_attrs_stat (base, c, statbuf);
   	return fsdb_fill_file_attrs (base, c);
   }
   return 0;
@@ -1727,6 +1997,9 @@ static void init_child_aino_tree(Unit *unit, a_inode *base, a_inode *aino)
   base->child = aino;
   aino->next = aino->prev = 0;
   aino->volflags = unit->volflags;
+  aino->childhash = 0;
+  aino_hash_insert (unit, aino);
+  childhash_insert (base, aino);
 }
 
 static void init_child_aino (Unit *unit, a_inode *base, a_inode *aino)
@@ -1822,20 +2095,21 @@ static a_inode *create_child_aino (Unit *unit, a_inode *base, TCHAR *rel, int is
 
 static a_inode *lookup_child_aino (Unit *unit, a_inode *base, TCHAR *rel, int *err)
 {
-  a_inode *c = base->child;
-  int l0 = _tcslen (rel);
+  a_inode *c = 0;
 
   if (base->dir == 0) {
     *err = ERROR_OBJECT_WRONG_TYPE;
     return 0;
   }
    
-  while (c != 0) {
-	  int l1 = _tcslen (c->aname);
-    if (l0 <= l1 && same_aname (rel, c->aname + l1 - l0)
-	    && (l0 == l1 || c->aname[l1-l0-1] == '/') && c->mountcount == unit->mountcount)
-      break;
-    c = c->sibling;
+  if (base->childhash) {
+    struct aino_childhash *ch = base->childhash;
+    uae_u32 hash = aname_hashval (rel);
+    for (c = ch->abuckets[hash & (ch->size - 1)]; c; c = c->aname_next) {
+      if (c->aname_hash == hash && same_aname (rel, name_tail (c->aname, '/'))
+        && c->mountcount == unit->mountcount)
+        break;
+    }
   }
   if (c != 0)
     return c;
@@ -1846,20 +2120,21 @@ static a_inode *lookup_child_aino (Unit *unit, a_inode *base, TCHAR *rel, int *e
 }
 
 /* Different version because for this one, REL is an nname.  */
-static a_inode *lookup_child_aino_for_exnext (Unit *unit, a_inode *base, TCHAR *rel, uae_u32 *err, uae_u64 uniq_external)
+static a_inode *lookup_child_aino_for_exnext (Unit *unit, a_inode *base, TCHAR *rel, uae_u32 *err, uae_u64 uniq_external, const struct _stat64 *statbuf)
 {
-  a_inode *c = base->child;
-  int l0 = _tcslen (rel);
+  a_inode *c = 0;
   int isvirtual = unit->volflags & MYVOLUMEINFO_ARCHIVE;
 
   *err = 0;
-  while (c != 0) {
-  	int l1 = _tcslen (c->nname);
-  	/* Note: using _tcscmp here.  */
-  	if (l0 <= l1 && _tcscmp (rel, c->nname + l1 - l0) == 0
-	    && (l0 == l1 || c->nname[l1-l0-1] == FSDB_DIR_SEPARATOR) && c->mountcount == unit->mountcount)
-	    break;
-  	c = c->sibling;
+  if (base->childhash) {
+  	struct aino_childhash *ch = base->childhash;
+  	uae_u32 hash = nname_hashval (rel);
+  	for (c = ch->nbuckets[hash & (ch->size - 1)]; c; c = c->nname_next) {
+	    /* Note: using _tcscmp here.  */
+	    if (c->nname_hash == hash && _tcscmp (rel, name_tail (c->nname, FSDB_DIR_SEPARATOR)) == 0
+    		&& c->mountcount == unit->mountcount)
+    		break;
+  	}
   }
   if (c != 0)
   	return c;
@@ -1877,7 +2152,7 @@ static a_inode *lookup_child_aino_for_exnext (Unit *unit, a_inode *base, TCHAR *
   	c->comment = 0;
 		c->uniq_external = uniq_external;
   	c->has_dbentry = 0;
-  	if (!fill_file_attrs(unit, base, c)) {
+  	if (!fill_file_attrs(unit, base, c, statbuf)) {
 	    xfree (c);
 	    *err = ERROR_NO_FREE_STORE;
 	    return 0;
@@ -2052,9 +2327,11 @@ static Unit *startup_create_unit (UnitInfo *uinfo, int num)
   unit->rootnode.comment = 0;
   unit->rootnode.has_dbentry = 0;
   unit->rootnode.volflags = uinfo->volflags;
+  unit->rootnode.childhash = 0;
   unit->aino_cache_size = 0;
-  for (i = 0; i < MAX_AINO_HASH; i++)
-  	unit->aino_hash[i] = 0;
+  unit->aino_hash = 0;
+  unit->aino_hash_size = 0;
+  unit->aino_hash_count = 0;
   return unit;
 }
 
@@ -2401,10 +2678,31 @@ static void notify_send (Unit *unit, Notify *n)
   }
 }
 
+/* Something in DIR changed: stop trusting its cached stat() results.  */
+static void dirsnap_invalidate (Unit *unit, a_inode *dir)
+{
+  int i;
+
+  if (!dir)
+    return;
+  for (i = 0; i < EXKEYS; i++) {
+    struct fs_dirhandle *d = unit->examine_keys[i].dirhandle;
+    if (d && d->snap && d->snap->dir == dir)
+      d->snap->stale = 1;
+  }
+  for (i = 0; i < EXALLKEYS; i++) {
+    struct fs_dirhandle *d = unit->exalls[i].dirhandle;
+    if (d && d->snap && d->snap->dir == dir)
+      d->snap->stale = 1;
+  }
+}
+
 static void notify_check (Unit *unit, a_inode *a)
 {
   Notify *n;
   int hash = notifyhash (a->aname);
+
+  dirsnap_invalidate (unit, a->parent);
   for (n = unit->notifyhash[hash]; n; n = n->next) {
 	  uaecptr nr = n->notifyrequest;
 	  if (same_aname(n->partname, a->aname)) {
@@ -2693,6 +2991,8 @@ static void free_exkey (Unit *unit, ExamineKey *ek)
   	unit->total_locked_ainos -= ek->aino->locked_children;
   	ek->aino->locked_children = 0;
   }
+  fs_closedir (ek->dirhandle);
+  ek->dirhandle = NULL;
   ek->aino = 0;
   ek->uniq = 0;
 }
@@ -2775,7 +3075,7 @@ static void move_exkeys (Unit *unit, a_inode *from, a_inode *to)
 }
 
 static void
-  get_fileinfo (Unit *unit, dpacket packet, uaecptr info, a_inode *aino)
+  get_fileinfo (Unit *unit, dpacket packet, uaecptr info, a_inode *aino, const struct _stat64 *cached = NULL)
 {
   struct _stat64 statbuf;
   long days, mins, ticks;
@@ -2785,7 +3085,9 @@ static void
 
   memset(&statbuf, 0, sizeof statbuf);
   /* No error checks - this had better work. */
-  if (unit->volflags & MYVOLUMEINFO_ARCHIVE)
+  if (cached)
+    statbuf = *cached;
+  else if (unit->volflags & MYVOLUMEINFO_ARCHIVE)
   	zfile_stat_archive (aino->nname, &statbuf);
   else
     stat64 (aino->nname, &statbuf);
@@ -3070,7 +3372,7 @@ static ExAllKey *getexall (Unit *unit, uaecptr control, int id)
   return NULL;
 }
 
-static int exalldo (uaecptr exalldata, uae_u32 exalldatasize, uae_u32 type, uaecptr control, Unit *unit, a_inode *aino)
+static int exalldo (uaecptr exalldata, uae_u32 exalldatasize, uae_u32 type, uaecptr control, Unit *unit, a_inode *aino, const struct _stat64 *cached)
 {
   uaecptr exp = exalldata;
   int i;
@@ -3085,7 +3387,9 @@ static int exalldo (uaecptr exalldata, uae_u32 exalldatasize, uae_u32 type, uaec
   int ret = 0;
 
   memset(&statbuf, 0, sizeof statbuf);
-  if (unit->volflags & MYVOLUMEINFO_ARCHIVE)
+  if (cached)
+    statbuf = *cached;
+  else if (unit->volflags & MYVOLUMEINFO_ARCHIVE)
   	zfile_stat_archive (aino->nname, &statbuf);
   else
   	stat64 (aino->nname, &statbuf);
@@ -3197,29 +3501,24 @@ static int action_examine_all_do (Unit *unit, uaecptr lock, ExAllKey *eak, uaecp
     base = &unit->rootnode;
   for (;;) {
 		uae_u64 uniq = 0;
+    const struct _stat64 *statbuf;
     d = eak->dirhandle;
     if (!eak->fn) {
-	    do {
-				if (d->fstype == FS_ARCHIVE)
-					ok = zfile_readdir_archive (d->zd, fn);
-				else if (d->fstype == FS_DIRECTORY)
-					ok = my_readdir (d->od, fn);
-				else
-					ok = 0;
-			} while (ok && d->fstype == FS_DIRECTORY && fsdb_name_invalid (fn));
+      ok = fs_readdir (d, fn, &statbuf);
 	    if (!ok)
     		return 0;
 	  } else {
 	    _tcscpy (fn, eak->fn);
 	    xfree (eak->fn);
 	    eak->fn = NULL;
+      statbuf = fs_dirsnap_stat (d, fn);
 	  }
-		aino = lookup_child_aino_for_exnext (unit, base, fn, &err, uniq);
+		aino = lookup_child_aino_for_exnext (unit, base, fn, &err, uniq, statbuf);
     if (!aino)
 	    return 0;
   	eak->id = unit->exallid++;
   	put_long (control + 4, eak->id);
-  	if (!exalldo (exalldata, exalldatasize, type, control, unit, aino)) {
+  	if (!exalldo (exalldata, exalldatasize, type, control, unit, aino, statbuf)) {
 	    eak->fn = my_strdup (fn); /* no space in exallstruct, save current entry */
 	    break;
   	}
@@ -3441,14 +3740,14 @@ static void action_examine_object (Unit *unit, dpacket packet)
    leave the directory open on the host side until all ExNext()s have
    finished - they may never finish!  */
 
-static void populate_directory (Unit *unit, a_inode *base)
+static struct fs_dirhandle *populate_directory (Unit *unit, a_inode *base)
 {
   struct fs_dirhandle *d;
   a_inode *aino;
 
 	d = fs_opendir (unit, base);
   if (!d)
-  	return;
+  	return NULL;
   for (aino = base->child; aino; aino = aino->sibling) {
   	base->locked_children++;
   	unit->total_locked_ainos++;
@@ -3458,38 +3757,41 @@ static void populate_directory (Unit *unit, a_inode *base)
   for (;;) {
 		uae_u64 uniq = 0;
   	TCHAR fn[MAX_DPATH];
+    const struct _stat64 *statbuf;
   	int ok;
   	uae_u32 err;
 
   	/* Find next file that belongs to the Amiga fs (skipping things
 	   like "..", "." etc.  */
-  	do {
-			if (d->fstype == FS_ARCHIVE)
-				ok = zfile_readdir_archive(d->zd, fn);
-			else if (d->fstype == FS_DIRECTORY)
-				ok = my_readdir (d->od, fn);
-			else
-				ok = 0;
-		} while (ok && d->fstype == FS_DIRECTORY && fsdb_name_invalid (fn));
+    ok = fs_readdir (d, fn, &statbuf);
   	if (!ok)
 	    break;
   	/* This calls init_child_aino, which will notice that the parent is
 	   being ExNext()ed, and it will increment the locked counts.  */
-		aino = lookup_child_aino_for_exnext (unit, base, fn, &err, uniq);
+		aino = lookup_child_aino_for_exnext (unit, base, fn, &err, uniq, statbuf);
+  }
+  /* Keep the snapshot, do_examine takes the file attributes from it.  */
+  if (d->fstype != FS_DIRECTORY) {
+    fs_closedir (d);
+    d = NULL;
   }
-  fs_closedir (d);
+  return d;
 }
 
 static void do_examine (Unit *unit, dpacket packet, ExamineKey *ek, uaecptr info)
 {
   for (;;) {
   	TCHAR *name;
+    const struct _stat64 *statbuf;
     if (ek->curr_file == 0)
 	    break;
 	  name = ek->curr_file->nname;
-    get_fileinfo (unit, packet, info, ek->curr_file);
+    statbuf = fs_dirsnap_stat (ek->dirhandle, name_tail (name, FSDB_DIR_SEPARATOR));
+    get_fileinfo (unit, packet, info, ek->curr_file, statbuf);
     ek->curr_file = ek->curr_file->sibling;
-  	if (!(unit->volflags & MYVOLUMEINFO_ARCHIVE) && !fsdb_exists(name)) {
+    /* A name found in a snapshot that is not stale exists on the host,
+     * only names it does not hold need a stat() to find orphans.  */
+  	if (!(unit->volflags & MYVOLUMEINFO_ARCHIVE) && !statbuf && !fsdb_exists(name)) {
 	    TRACE ((_T("%s orphaned"), name));
 	    continue;
   	}
@@ -3531,7 +3833,7 @@ static void action_examine_next (Unit *unit, dpacket packet)
   	  ek = new_exkey (unit, aino);
   	  if (ek) {
 	      if (aino->exnext_count++ == 0)
-    		  populate_directory (unit, aino);
+    		  ek->dirhandle = populate_directory (unit, aino);
     	  ek->curr_file = aino->child;
 				TRACE((_T("Initial curr_file: %p %s\n"), ek->curr_file,
 					ek->curr_file ? ek->curr_file->aname : _T("NULL")));
@@ -3886,7 +4188,9 @@ static void
 			return;
 		}
 
+		jit_unprotect_range (realpt, size);
 		actual = fs_read (k->fd, realpt, size);
+		jit_unprotect_done (realpt, size);
 
 		if (actual == 0) {
 			PUT_PCK_RES1 (packet, 0);
@@ -3972,6 +4276,7 @@ static void
 		k->file_pos += actual;
 	
   k->notifyactive = 1;
+  dirsnap_invalidate (unit, k->aino->parent);
 }
 
 static void
@@ -4353,6 +4658,7 @@ static void
 
 	gui_flicker_led (LED_HD, unit->unit, 1);
   k->notifyactive = 1;
+  dirsnap_invalidate (unit, k->aino->parent);
   /* If any open files have file pointers beyond this size, truncate only
    * so far that these pointers do not become invalid.  */
   for (k1 = unit->keys; k1; k1 = k1->next) {
@@ -4612,7 +4918,9 @@ static void
   a2->comment = a1->comment;
   a1->comment = 0;
   a2->amigaos_mode = a1->amigaos_mode;
+  aino_hash_remove (unit, a2);
   a2->uniq = a1->uniq;
+  aino_hash_insert (unit, a2);
   a2->elock = a1->elock;
   a2->shlock = a1->shlock;
   a2->has_dbentry = a1->has_dbentry;
@@ -4813,6 +5121,7 @@ static void action_change_file_size64 (Unit *unit, dpacket packet)
 
 	gui_flicker_led (LED_HD, unit->unit, 1);
   k->notifyactive = 1;
+  dirsnap_invalidate (unit, k->aino->parent);
   /* If any open files have file pointers beyond this size, truncate only
    * so far that these pointers do not become invalid.  */
   for (k1 = unit->keys; k1; k1 = k1->next) {
@@ -5248,6 +5557,7 @@ void filesys_free_handles(void)
 		}
 		u->waitingrecords = NULL;
   	free_all_ainos (u, &u->rootnode);
+  	fsdb_free_index (&u->rootnode);
   	u->rootnode.next = u->rootnode.prev = &u->rootnode;
   	u->aino_cache_size = 0;
   	xfree(u->newrootdir);
@@ -5264,6 +5574,7 @@ static void filesys_reset2 (void)
   filesys_free_handles();
   for (u = units; u; u = u1) {
   	u1 = u->next;
+  	xfree (u->aino_hash);
   	xfree (u);
   }
   units = 0;
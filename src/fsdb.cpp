@@ -20,6 +20,10 @@
 #include "fsusage.h"
 #include "fsdb.h"
 
+#include <ctype.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+
 /* The on-disk format is as follows:
  * Offset 0, 1 byte, valid
  * Offset 1, 4 bytes, mode
@@ -27,6 +31,25 @@
  * Offset 263, 257 bytes, nname
  * Offset 519, 81 bytes, comment
  */
+#define FSDB_RECSIZE (1 + 4 + 257 + 257 + 81)
+#define FSDB_ANAME(r) ((char*)(r) + 5)
+#define FSDB_NNAME(r) ((char*)(r) + 5 + 257)
+
+/* The db file of a directory is mapped once and indexed by hashed aname
+ * (case-folded) and nname, so lookups don't scan it and writeback only
+ * touches the records that changed.  A directory without a db file gets
+ * an empty index, which saves the failing fopen on every lookup.  */
+struct fsdb_index {
+  int fd;
+  int readonly;
+  uae_u8 *map;
+  int nrecs;
+  /* no cleared record below this one */
+  int freehint;
+  unsigned int hashsize;
+  int *ahash, *anext;
+  int *nhash, *nnext;
+};
 
 #define TRACING_ENABLED 0
 #if TRACING_ENABLED
@@ -72,23 +95,202 @@ TCHAR *fsdb_search_dir (const TCHAR *dirname, TCHAR *rel)
 }
 #endif
 
-static FILE *get_fsdb (a_inode *dir, const TCHAR *mode)
+static uae_u32 fsdb_ahash (const TCHAR *s)
+{
+  uae_u32 hash = 2166136261u;
+  while (*s)
+  	hash = (hash ^ (uae_u8)_totlower ((uae_u8)*s++)) * 16777619u;
+  return hash;
+}
+
+static uae_u32 fsdb_nhash (const TCHAR *s)
+{
+  uae_u32 hash = 2166136261u;
+  while (*s)
+  	hash = (hash ^ (uae_u8)*s++) * 16777619u;
+  return hash;
+}
+
+static void index_link (struct fsdb_index *idx, int rec)
+{
+  uae_u8 *r = idx->map + rec * FSDB_RECSIZE;
+  unsigned int h;
+
+  idx->anext[rec] = idx->nnext[rec] = -1;
+  if (r[0] == 0)
+  	return;
+  h = fsdb_ahash (FSDB_ANAME (r)) & (idx->hashsize - 1);
+  idx->anext[rec] = idx->ahash[h];
+  idx->ahash[h] = rec;
+  h = fsdb_nhash (FSDB_NNAME (r)) & (idx->hashsize - 1);
+  idx->nnext[rec] = idx->nhash[h];
+  idx->nhash[h] = rec;
+}
+
+static void index_unlink (struct fsdb_index *idx, int rec)
+{
+  uae_u8 *r = idx->map + rec * FSDB_RECSIZE;
+  int *p;
+
+  if (r[0] == 0)
+  	return;
+  for (p = &idx->ahash[fsdb_ahash (FSDB_ANAME (r)) & (idx->hashsize - 1)]; *p >= 0; p = &idx->anext[*p]) {
+  	if (*p == rec) {
+	    *p = idx->anext[rec];
+	    break;
+  	}
+  }
+  for (p = &idx->nhash[fsdb_nhash (FSDB_NNAME (r)) & (idx->hashsize - 1)]; *p >= 0; p = &idx->nnext[*p]) {
+  	if (*p == rec) {
+	    *p = idx->nnext[rec];
+	    break;
+  	}
+  }
+}
+
+static void index_rehash (struct fsdb_index *idx)
+{
+  unsigned int i;
+
+  xfree (idx->ahash);
+  xfree (idx->nhash);
+  xfree (idx->anext);
+  xfree (idx->nnext);
+  idx->hashsize = 16;
+  while (idx->hashsize < idx->nrecs)
+  	idx->hashsize <<= 1;
+  idx->ahash = xmalloc (int, idx->hashsize);
+  idx->nhash = xmalloc (int, idx->hashsize);
+  idx->anext = xmalloc (int, idx->nrecs + 1);
+  idx->nnext = xmalloc (int, idx->nrecs + 1);
+  for (i = 0; i < idx->hashsize; i++)
+  	idx->ahash[i] = idx->nhash[i] = -1;
+  for (i = 0; i < idx->nrecs; i++)
+  	index_link (idx, i);
+}
+
+static void index_unmap (struct fsdb_index *idx)
+{
+  if (idx->map)
+  	munmap (idx->map, idx->nrecs * FSDB_RECSIZE);
+  if (idx->fd >= 0)
+  	close (idx->fd);
+  idx->map = NULL;
+  idx->fd = -1;
+  idx->readonly = 0;
+  idx->nrecs = 0;
+  idx->freehint = 0;
+}
+
+/* The map stays valid without the file, so only keep the fd open while
+ * the db is being written.  Every cached directory holding one would run
+ * into the open file limit.  */
+static void index_close (struct fsdb_index *idx)
+{
+  if (idx->fd >= 0)
+  	close (idx->fd);
+  idx->fd = -1;
+}
+
+void fsdb_free_index (a_inode *dir)
+{
+  struct fsdb_index *idx = dir->dbindex;
+
+  if (!idx)
+  	return;
+  index_unmap (idx);
+  xfree (idx->ahash);
+  xfree (idx->nhash);
+  xfree (idx->anext);
+  xfree (idx->nnext);
+  xfree (idx);
+  dir->dbindex = NULL;
+}
+
+/* Map the db file of DIR and build its index.  CREATE makes an empty db
+ * file if there is none.  */
+static struct fsdb_index *get_index (a_inode *dir, int create)
 {
+  struct fsdb_index *idx = dir->dbindex;
+  struct stat st;
   TCHAR *n;
-  FILE *f;
-    
-	if (!dir->nname)
-		return NULL;
+
+  if (idx && (idx->fd >= 0 || !create))
+  	return idx;
+  if (!dir->nname)
+  	return NULL;
   n = build_nname (dir->nname, FSDB_FILE);
-  f = _tfopen (n, mode);
+  if (idx && !idx->readonly) {
+  	/* Already mapped writable, the fd is only needed to grow the file.  */
+  	idx->fd = open (n, O_RDWR | O_CREAT, 0666);
+  	if (idx->fd >= 0) {
+	    xfree (n);
+	    return idx;
+  	}
+  }
+  if (!idx) {
+  	idx = dir->dbindex = xcalloc (struct fsdb_index, 1);
+  	idx->fd = -1;
+  }
+  index_unmap (idx);
+  idx->fd = open (n, O_RDWR | (create ? O_CREAT : 0), 0666);
+  if (idx->fd < 0) {
+  	idx->fd = open (n, O_RDONLY);
+  	if (idx->fd >= 0)
+	    idx->readonly = 1;
+  }
   xfree (n);
-  return f;
+  if (idx->fd >= 0 && fstat (idx->fd, &st) == 0) {
+  	idx->nrecs = st.st_size / FSDB_RECSIZE;
+  	if (idx->nrecs > 0) {
+	    idx->map = (uae_u8*)mmap (NULL, idx->nrecs * FSDB_RECSIZE,
+	      idx->readonly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, idx->fd, 0);
+	    if (idx->map == MAP_FAILED) {
+    		idx->map = NULL;
+    		idx->nrecs = 0;
+	    }
+  	}
+  }
+  index_rehash (idx);
+  if (!create)
+  	index_close (idx);
+  return idx;
+}
+
+/* Append an empty record, returning its number or -1.  */
+static int index_grow (struct fsdb_index *idx)
+{
+  int rec = idx->nrecs;
+  uae_u8 *map;
+
+  if (idx->fd < 0 || idx->readonly)
+  	return -1;
+  if (ftruncate (idx->fd, (rec + 1) * FSDB_RECSIZE) < 0)
+  	return -1;
+  map = (uae_u8*)mmap (NULL, (rec + 1) * FSDB_RECSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, idx->fd, 0);
+  if (map == MAP_FAILED)
+  	return -1;
+  if (idx->map)
+  	munmap (idx->map, rec * FSDB_RECSIZE);
+  idx->map = map;
+  idx->nrecs = rec + 1;
+  memset (map + rec * FSDB_RECSIZE, 0, FSDB_RECSIZE);
+  if (idx->nrecs > idx->hashsize) {
+  	index_rehash (idx);
+  } else {
+  	idx->anext = xrealloc (int, idx->anext, idx->nrecs + 1);
+  	idx->nnext = xrealloc (int, idx->nnext, idx->nrecs + 1);
+  	index_link (idx, rec);
+  }
+  return rec;
 }
 
 static void kill_fsdb (a_inode *dir)
 {
 	if (!dir->nname)
 		return;
+  if (dir->dbindex)
+  	index_unmap (dir->dbindex);
   TCHAR *n = build_nname (dir->nname, FSDB_FILE);
   _wunlink (n);
   xfree (n);
@@ -123,6 +325,8 @@ void fsdb_clean_dir (a_inode *dir)
 
 	if (!dir->nname)
 		return;
+  /* Record offsets change below, map it again when needed.  */
+  fsdb_free_index (dir);
   n = build_nname (dir->nname, FSDB_FILE);
 	f = _tfopen (n, _T("r+b"));
   if (f == 0) {
@@ -170,69 +374,46 @@ static a_inode *aino_from_buf (a_inode *base, uae_u8 *buf, long off)
 
 a_inode *fsdb_lookup_aino_aname (a_inode *base, const TCHAR *aname)
 {
-  FILE *f;
+  struct fsdb_index *idx = get_index (base, 0);
+  int rec;
 
-  f = get_fsdb (base, _T("r+b"));
-  if (f == 0) {
+  if (idx == 0 || idx->nrecs == 0)
     return 0;
+  for (rec = idx->ahash[fsdb_ahash (aname) & (idx->hashsize - 1)]; rec >= 0; rec = idx->anext[rec]) {
+  	uae_u8 *r = idx->map + rec * FSDB_RECSIZE;
+  	if (r[0] != 0 && same_aname (FSDB_ANAME (r), aname))
+	    return aino_from_buf (base, r, rec * FSDB_RECSIZE);
   }
-  for (;;) {
-  	uae_u8 buf[1 + 4 + 257 + 257 + 81];
-  	if (fread (buf, 1, sizeof buf, f) < sizeof buf)
-	    break;
-  	if (buf[0] != 0 && same_aname ((char*)buf + 5, aname)) {
-	    long pos = ftell (f) - sizeof buf;
-	    fclose (f);
-	    return aino_from_buf (base, buf, pos);
-  	}
-  }
-  fclose (f);
   return 0;
 }
 
+static int lookup_nname_rec (a_inode *base, const TCHAR *nname)
+{
+  struct fsdb_index *idx = get_index (base, 0);
+  int rec;
+
+  if (idx == 0 || idx->nrecs == 0)
+  	return -1;
+  for (rec = idx->nhash[fsdb_nhash (nname) & (idx->hashsize - 1)]; rec >= 0; rec = idx->nnext[rec]) {
+  	uae_u8 *r = idx->map + rec * FSDB_RECSIZE;
+  	if (r[0] != 0 && strcmp (FSDB_NNAME (r), nname) == 0)
+	    return rec;
+  }
+  return -1;
+}
+
 a_inode *fsdb_lookup_aino_nname (a_inode *base, const TCHAR *nname)
 {
-  FILE *f;
+  int rec = lookup_nname_rec (base, nname);
 
-  f = get_fsdb (base, _T("r+b"));
-  if (f == 0) {
+  if (rec < 0)
   	return 0;
-  }
-  for (;;) {
-  	uae_u8 buf[1 + 4 + 257 + 257 + 81];
-  	if (fread (buf, 1, sizeof buf, f) < sizeof buf)
-	    break;
-  	if (buf[0] != 0 && strcmp ((char*)buf + 5 + 257, nname) == 0) {
-	    long pos = ftell (f) - sizeof buf;
-	    fclose (f);
-	    return aino_from_buf (base, buf, pos);
-  	}
-  }
-  fclose (f);
-  return 0;
+  return aino_from_buf (base, base->dbindex->map + rec * FSDB_RECSIZE, rec * FSDB_RECSIZE);
 }
 
 int fsdb_used_as_nname (a_inode *base, const TCHAR *nname)
 {
-  FILE *f;
-  uae_u8 buf[1 + 4 + 257 + 257 + 81];
-
-	f = get_fsdb (base, _T("r+b"));
-  if (f == 0) {
-    return 0;
-  }
-  for (;;) {
-  	if (fread (buf, 1, sizeof buf, f) < sizeof buf)
-	    break;
-  	if (buf[0] == 0)
-	    continue;
-  	if (strcmp ((char*)buf + 5 + 257, nname) == 0) {
-	    fclose (f);
-	    return 1;
-  	}
-  }
-  fclose (f);
-  return 0;
+  return lookup_nname_rec (base, nname) >= 0;
 }
 
 static int needs_dbentry (a_inode *aino)
@@ -249,9 +430,9 @@ static int needs_dbentry (a_inode *aino)
   return _tcscmp (nn_begin, aino->aname) != 0;
 }
 
-static void write_aino (FILE *f, a_inode *aino)
+static void write_aino (struct fsdb_index *idx, int rec, a_inode *aino)
 {
-  uae_u8 buf[1 + 4 + 257 + 257 + 81] = { 0 };
+  uae_u8 buf[FSDB_RECSIZE] = { 0 };
   buf[0] = aino->needs_dbentry;
   do_put_mem_long ((uae_u32 *)(buf + 1), aino->amigaos_mode);
   strncpy ((char*)buf + 5, aino->aname, 256);
@@ -260,22 +441,24 @@ static void write_aino (FILE *f, a_inode *aino)
   buf[5 + 257 + 256] = '\0';
   strncpy ((char*)buf + 5 + 2 * 257, aino->comment ? aino->comment : _T(""), 80);
   buf[5 + 2 * 257 + 80] = '\0';
-  aino->db_offset = ftell (f);
-  fwrite (buf, 1, sizeof buf, f);
+  index_unlink (idx, rec);
+  memcpy (idx->map + rec * FSDB_RECSIZE, buf, sizeof buf);
+  index_link (idx, rec);
+  if (buf[0] == 0 && rec < idx->freehint)
+  	idx->freehint = rec;
+  aino->db_offset = rec * FSDB_RECSIZE;
   aino->has_dbentry = aino->needs_dbentry;
 	TRACE ((_T("%d '%s' '%s' written\n"), aino->db_offset, aino->aname, aino->nname));
 }
 
-/* Write back the db file for a directory.  */
+/* Write back the changed db entries of a directory.  */
 
 void fsdb_dir_writeback (a_inode *dir)
 {
-  FILE *f;
+  struct fsdb_index *idx;
   int changes_needed = 0;
   int entries_needed = 0;
   a_inode *aino;
-  uae_u8 *tmpbuf;
-  int size, i;
 
 	TRACE ((_T("fsdb writeback %s\n"), dir->aname));
   /* First pass: clear dirty bits where unnecessary, and see if any work
@@ -303,47 +486,46 @@ void fsdb_dir_writeback (a_inode *dir)
     return;
   }
 
-	f = get_fsdb (dir, _T("r+b"));
-  if (f == 0) {
-  	f = get_fsdb (dir, _T("w+b"));
-  	if (f == 0) {
-	    TRACE ((_T("failed\n")));
-	    /* This shouldn't happen... */
-	    return;
-    }
-  }
-  fseek (f, 0, SEEK_END);
-  size = ftell (f);
-  fseek (f, 0, SEEK_SET);
-  tmpbuf = 0;
-  if (size > 0) {
-  	tmpbuf = (uae_u8 *)malloc (size);
-  	fread (tmpbuf, 1, size, f);
+  idx = get_index (dir, 1);
+  if (idx == 0 || idx->fd < 0 || idx->readonly) {
+    if (idx)
+    	index_close (idx);
+    TRACE ((_T("failed\n")));
+    /* This shouldn't happen... */
+    return;
   }
-	TRACE ((_T("**** updating '%s' %d\n"), dir->aname, size));
+	TRACE ((_T("**** updating '%s' %d\n"), dir->aname, idx->nrecs));
 
   for (aino = dir->child; aino; aino = aino->sibling) {
+  	int rec = -1;
   	if (! aino->dirty)
 	    continue;
   	aino->dirty = 0;
 
-  	i = 0;
-  	while (!aino->has_dbentry && i < size) {
-	    if (!strcmp ((const char *)(tmpbuf + i + 5), aino->aname)) {
-    		aino->has_dbentry = 1;
-    		aino->db_offset = i;
+  	if (aino->has_dbentry && aino->db_offset / FSDB_RECSIZE < idx->nrecs) {
+	    rec = aino->db_offset / FSDB_RECSIZE;
+  	} else {
+	    for (rec = idx->ahash[fsdb_ahash (aino->aname) & (idx->hashsize - 1)]; rec >= 0; rec = idx->anext[rec]) {
+    		if (!strcmp (FSDB_ANAME (idx->map + rec * FSDB_RECSIZE), aino->aname))
+  		    break;
 	    }
-	    i += 1 + 4 + 257 + 257 + 81;
-	  }
-	  if (! aino->has_dbentry) {
-	    fseek (f, 0, SEEK_END);
-	    aino->has_dbentry = 1;
-	  } else {
-	    fseek (f, aino->db_offset, SEEK_SET);
-    }
-	  write_aino (f, aino);
+  	}
+  	if (rec < 0 && ! aino->needs_dbentry)
+	    continue;
+  	if (rec < 0) {
+	    /* Reuse a cleared record before making the file longer.  */
+	    for (rec = idx->freehint; rec < idx->nrecs; rec++) {
+    		if (idx->map[rec * FSDB_RECSIZE] == 0)
+  		    break;
+	    }
+	    idx->freehint = rec + 1;
+	    if (rec == idx->nrecs)
+    		rec = index_grow (idx);
+	    if (rec < 0)
+    		continue;
+  	}
+	  write_aino (idx, rec, aino);
   }
+  index_close (idx);
 	TRACE ((_T("end\n")));
-  fclose (f);
-  xfree (tmpbuf);
 }
@@ -54,19 +54,15 @@ int fsdb_exists (char *nname)
     return (stat (nname, &statbuf) != -1);
 }
 
-/* For an a_inode we have newly created based on a filename we found on the
- * native fs, fill in information about this file/directory.  */
-int fsdb_fill_file_attrs (a_inode *base, a_inode *aino)
+/* Same as fsdb_fill_file_attrs, for callers that already have the
+ * stat() result, e.g. from a directory snapshot.  */
+int fsdb_fill_file_attrs_stat (a_inode *base, a_inode *aino, const struct _stat64 *statbuf)
 {
-    struct stat statbuf;
-    /* This really shouldn't happen...  */
-    if (stat (aino->nname, &statbuf) == -1)
-	return 0;
-    aino->dir = S_ISDIR (statbuf.st_mode) ? 1 : 0;
+    aino->dir = S_ISDIR (statbuf->st_mode) ? 1 : 0;
     
-    aino->amigaos_mode = ((S_IXUSR & statbuf.st_mode ? 0 : A_FIBF_EXECUTE)
-    			  | (S_IWUSR & statbuf.st_mode ? 0 : A_FIBF_WRITE)
-    			  | (S_IRUSR & statbuf.st_mode ? 0 : A_FIBF_READ));
+    aino->amigaos_mode = ((S_IXUSR & statbuf->st_mode ? 0 : A_FIBF_EXECUTE)
+    			  | (S_IWUSR & statbuf->st_mode ? 0 : A_FIBF_WRITE)
+    			  | (S_IRUSR & statbuf->st_mode ? 0 : A_FIBF_READ));
 
 #if defined(WIN32) || defined(ANDROIDSDL)
     // Always give execute & read permission
@@ -76,6 +72,17 @@ int fsdb_fill_file_attrs (a_inode *base, a_inode *aino)
     return 1;
 }
 
+/* For an a_inode we have newly created based on a filename we found on the
+ * native fs, fill in information about this file/directory.  */
+int fsdb_fill_file_attrs (a_inode *base, a_inode *aino)
+{
+    struct _stat64 statbuf;
+    /* This really shouldn't happen...  */
+    if (stat64 (aino->nname, &statbuf) == -1)
+	return 0;
+    return fsdb_fill_file_attrs_stat (base, aino, &statbuf);
+}
+
 int fsdb_set_file_attrs (a_inode *aino)
 {
     struct stat statbuf;
@@ -30,6 +30,7 @@
 
 static FILE *headerfile;
 static FILE *stblfile;
+static FILE *pairfile;
 
 static int using_prefetch, using_indirect, using_mmu;
 static int using_prefetch_020, using_ce020;
@@ -74,6 +75,19 @@ static int *opcode_next_clev;
 static int *opcode_last_postfix;
 static unsigned long *counts;
 static int generate_stbl;
+
+/* Superinstructions: hot opcode pairs read from frequent_pairs.68k. Each
+* opcode is reduced to the opcode of its handler, so one pair covers all
+* register variants. */
+#define MAX_PAIRS 48
+#define MAX_PAIR_SECONDS 4
+struct opcode_pair {
+	uae_u16 first, second;
+};
+static struct opcode_pair pairs[MAX_PAIRS];
+static int nr_pairs;
+/* Postfix of the handler used for each opcode in the table being generated. */
+static int *opcode_cur_postfix;
 static int mmufixupcnt;
 static int mmufixupstate;
 static int disp020cnt;
@@ -156,6 +170,47 @@ static void read_counts (void)
 		term ();
 }
 
+static int handler_opcode (unsigned int opcode)
+{
+	if (table68k[opcode].handler != -1)
+		return table68k[opcode].handler;
+	return opcode;
+}
+
+static void read_pairs (void)
+{
+	FILE *file;
+	unsigned int first, second, count, total;
+	int i;
+
+	nr_pairs = 0;
+	file = fopen ("frequent_pairs.68k", "r");
+	if (!file)
+		return;
+	if (fscanf (file, "Total: %u\n", &total) != 1) {
+		fclose (file);
+		return;
+	}
+	while (nr_pairs < MAX_PAIRS && fscanf (file, "%x %x: %u\n", &first, &second, &count) == 3) {
+		if (first > 0xffff || second > 0xffff)
+			continue;
+		if (table68k[first].mnemo == i_ILLG || table68k[second].mnemo == i_ILLG)
+			continue;
+		first = handler_opcode (first);
+		second = handler_opcode (second);
+		for (i = 0; i < nr_pairs; i++) {
+			if (pairs[i].first == first && pairs[i].second == second)
+				break;
+		}
+		if (i < nr_pairs)
+			continue;
+		pairs[nr_pairs].first = first;
+		pairs[nr_pairs].second = second;
+		nr_pairs++;
+	}
+	fclose (file);
+}
+
 static char endlabelstr[80];
 static int endlabelno = 0;
 static int need_endlabel;
@@ -5618,6 +5673,7 @@ static void generate_one_opcode (int rp, const char *extra)
 			(using_ce || using_ce020) ? "(cpuop_func*)" : "",
 			opcode, opcode_last_postfix[rp],
 			extra, opcode, name);
+		opcode_cur_postfix[opcode] = opcode_last_postfix[rp];
 		xfree (name);
 		return;
 	}
@@ -5737,6 +5793,7 @@ static void generate_one_opcode (int rp, const char *extra)
 
 	opcode_next_clev[rp] = next_cpu_level;
 	opcode_last_postfix[rp] = postfix;
+	opcode_cur_postfix[opcode] = postfix;
 
 	if ((opcode & 0xf000) == 0xf000)
 		m68k_pc_total = -1;
@@ -5798,6 +5855,84 @@ static void generate_func (const char *extra)
 		fprintf (stblfile, "{ 0, 0 }};\n");
 }
 
+/* Emit fused handlers for the hot pairs of the current table. A fused
+* handler runs the first instruction, then does exactly what m68k_run_2
+* would do before dispatching the next one, and calls the second
+* handler directly if the next opcode belongs to one of the expected
+* handlers. */
+static int pair_head (int i)
+{
+	int j;
+
+	if (opcode_cur_postfix[pairs[i].first] < 0)
+		return 0;
+	for (j = 0; j < i; j++) {
+		if (pairs[j].first == pairs[i].first)
+			return 0;
+	}
+	for (j = i; j < nr_pairs; j++) {
+		if (pairs[j].first == pairs[i].first && opcode_cur_postfix[pairs[j].second] >= 0)
+			return 1;
+	}
+	return 0;
+}
+
+static int is_pair_head (int opcode)
+{
+	int i;
+
+	for (i = 0; i < nr_pairs; i++) {
+		if (pairs[i].first == opcode)
+			return pair_head (i);
+	}
+	return 0;
+}
+
+static void generate_pairs (void)
+{
+	int i, j, n;
+
+	fprintf (pairfile, "\n");
+	for (i = 0; i < nr_pairs; i++) {
+		if (pair_head (i))
+			fprintf (pairfile, "extern cpuop_func CPUFUNC(op_pair_%04x_%d);\n", pairs[i].first, postfix);
+	}
+	for (i = 0; i < nr_pairs; i++) {
+		int first = pairs[i].first;
+		if (!pair_head (i))
+			continue;
+		fprintf (pairfile, "\n/* %s */\n", outopcode (first));
+		fprintf (pairfile, "uae_u32 REGPARAM2 CPUFUNC(op_pair_%04x_%d)(uae_u32 opcode, struct regstruct &regs)\n{\n", first, postfix);
+		fprintf (pairfile, "\tuae_u32 cycles = CPUFUNC(op_%04x_%d)(opcode, regs);\n", first, opcode_cur_postfix[first]);
+		fprintf (pairfile, "\tuae_u32 next;\n");
+		fprintf (pairfile, "\tcpuop_func *f;\n");
+		fprintf (pairfile, "\tif (regs.spcflags)\n\t\treturn cycles;\n");
+		fprintf (pairfile, "\tnext = get_iword2 (regs, 0);\n");
+		fprintf (pairfile, "\tf = cpufunctbl[next];\n");
+		for (j = i, n = 0; j < nr_pairs && n < MAX_PAIR_SECONDS; j++) {
+			int second = pairs[j].second;
+			if (pairs[j].first != first || opcode_cur_postfix[second] < 0)
+				continue;
+			fprintf (pairfile, "\t/* %s */\n", outopcode (second));
+			if (is_pair_head (second))
+				fprintf (pairfile, "\tif (f == CPUFUNC(op_%04x_%d) || f == CPUFUNC(op_pair_%04x_%d)) {\n",
+					second, opcode_cur_postfix[second], second, postfix);
+			else
+				fprintf (pairfile, "\tif (f == CPUFUNC(op_%04x_%d)) {\n", second, opcode_cur_postfix[second]);
+			fprintf (pairfile, "\t\tcpu_pair_step (cycles);\n");
+			fprintf (pairfile, "\t\treturn CPUFUNC(op_%04x_%d)(next, regs);\n\t}\n", second, opcode_cur_postfix[second]);
+			n++;
+		}
+		fprintf (pairfile, "\treturn cycles;\n}\n");
+	}
+	fprintf (pairfile, "\nconst struct cputbl CPUFUNC(op_pairtbl_%d)[] = {\n", postfix);
+	for (i = 0; i < nr_pairs; i++) {
+		if (pair_head (i))
+			fprintf (pairfile, "{ CPUFUNC(op_pair_%04x_%d), %d },\n", pairs[i].first, postfix, pairs[i].first);
+	}
+	fprintf (pairfile, "{ 0, 0 }};\n");
+}
+
 static void generate_cpu (int id, int mode)
 {
 	char fname[100];
@@ -5814,6 +5949,8 @@ static void generate_cpu (int id, int mode)
 	}
 
 	postfix = id;
+	for (rp = 0; rp < 65536; rp++)
+		opcode_cur_postfix[rp] = -1;
 	if (id == 0 || id == 4 || id == 11 || id == 13 || id == 20 || id == 21 || id == 22 || id == 23 || id == 24 || id == 31 || id == 32 || id == 33 || id == 40) {
 		if (generate_stbl && id != 4)
 			fprintf (stblfile, "#ifdef CPUEMU_%d%s\n", postfix, extraup);
@@ -5953,6 +6090,9 @@ static void generate_cpu (int id, int mode)
 	}
 	endlabelno = id * 10000;
 	generate_func (extra);
+	/* superinstructions for the m68k_run_2 tables */
+	if (pairfile && id >= 1 && id <= 5 && !using_tracer)
+		generate_pairs ();
 	if (generate_stbl) {
 //		if ((id > 0 && id < 6) || (id >= 20 && id < 40) || (id > 40 && id < 46) || (id > 50 && id < 56))
 //			fprintf (stblfile, "#endif /* CPUEMU_68000_ONLY */\n");
@@ -5973,7 +6113,9 @@ int main(int argc, char *argv[])
 	opcode_last_postfix = xmalloc (int, nr_cpuop_funcs);
 	opcode_next_clev = xmalloc (int, nr_cpuop_funcs);
 	counts = xmalloc (unsigned long, 65536);
+	opcode_cur_postfix = xmalloc (int, 65536);
 	read_counts ();
+	read_pairs ();
 
 	/* It would be a lot nicer to put all in one file (we'd also get rid of
 	* cputbl.h that way), but cpuopti can't cope.  That could be fixed, but
@@ -5984,6 +6126,9 @@ int main(int argc, char *argv[])
 	stblfile = fopen ("cpustbl.cpp", "wb");
 	generate_includes (stblfile, 0);
 
+	pairfile = fopen ("cpuemu_pair.cpp", "wb");
+	generate_includes (pairfile, 0);
+
 	for (i = 0; i < 12; i++) {
 		if ((i >= 6 && i < 11) || (i > 14 && i < 20) || (i > 25 && i < 31) || (i > 33 && i < 40))
 			continue;
@@ -5994,6 +6139,7 @@ int main(int argc, char *argv[])
 	free (table68k);
   fclose(headerfile);
   fclose(stblfile);
+	fclose (pairfile);
 	return 0;
 }
 
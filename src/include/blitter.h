@@ -51,7 +51,7 @@ STATIC_INLINE void maybe_blit (int hack)
 
 
 extern void blitter_check_start (void);
-typedef void blitter_func(uaecptr, uaecptr, uaecptr, uaecptr, struct bltinfo *_GCCRES_);
+typedef void blitter_func(uae_u8 *, uae_u8 *, uae_u8 *, uae_u8 *, struct bltinfo *_GCCRES_);
 
 #define BLITTER_MAX_WORDS 2048
 
@@ -62,6 +62,7 @@ STATIC_INLINE void do_copper (void)
 #define SPCFLAG_TRAP 4096 /* enforcer-hack */
 #define SPCFLAG_MODE_CHANGE 8192
 #define SPCFLAG_END_COMPILE 16384
+#define SPCFLAG_RUNAHEAD 32768
 
 extern uae_u16 adkcon;
 
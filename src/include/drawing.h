@@ -62,7 +62,12 @@ struct color_entry {
 
 /* convert 24 bit AGA Amiga RGB to native color */
 //#ifndef PANDORA
-#if !defined(PANDORA) || !defined(USE_ARMNEON)  // Well not really since ubfx is arm6t2...
+#if defined(USE_RGB32)
+STATIC_INLINE xcolnr CONVERT_RGB(uae_u32 c)
+{
+  return xbluecolors[c & 0xff] | xgreencolors[(c >> 8) & 0xff] | xredcolors[(c >> 16) & 0xff];
+}
+#elif !defined(PANDORA) || !defined(USE_ARMNEON)  // Well not really since ubfx is arm6t2...
 #define CONVERT_RGB(c) \
     ( xbluecolors[((uae_u8*)(&c))[0]] | xgreencolors[((uae_u8*)(&c))[1]] | xredcolors[((uae_u8*)(&c))[2]] )
 #else
@@ -105,6 +110,31 @@ STATIC_INLINE void color_reg_set (struct color_entry *_GCCRES_ ce, int c, int v)
 		ce->color_regs_ecs[c] = v;
 }
 
+/* 64 bit print of one color register. The print of a whole palette is the
+ * xor of its registers, so a single color write updates it in O(1). */
+STATIC_INLINE uae_u64 color_print (int c, uae_u32 v)
+{
+  uae_u64 x = (((uae_u64)c << 32) | v) * 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+STATIC_INLINE uae_u64 color_table_print (struct color_entry *_GCCRES_ ce)
+{
+  uae_u64 p = 0;
+  int i;
+
+  if (aga_mode) {
+    for (i = 0; i < 256; i++)
+      p ^= color_print (i, ce->color_regs_aga[i]);
+  } else {
+    for (i = 0; i < 32; i++)
+      p ^= color_print (i, ce->color_regs_ecs[i]);
+  }
+  return p;
+}
+
 /* ugly copy hack, is there better solution? */
 STATIC_INLINE void color_reg_cpy (struct color_entry *_GCCRES_ dst, struct color_entry *_GCCRES_ src)
 {
@@ -162,6 +192,7 @@ extern uae_u16 spixels[MAX_SPR_PIXELS];
 extern struct color_change *curr_color_changes;
 
 extern struct color_entry curr_color_tables[(MAXVPOS + 2) * 2];
+extern uae_u64 curr_color_prints[(MAXVPOS + 2) * 2];
 
 extern struct sprite_entry *curr_sprite_entries;
 
@@ -201,13 +232,30 @@ extern int coord_native_to_amiga_x (int);
 
 extern void hsync_record_line_state (int lineno);
 extern void vsync_handle_redraw (void);
+extern void runahead_show_frame (void);
 extern void vsync_handle_check (void);
 extern void init_hardware_for_drawing_frame (void);
 extern void reset_drawing (void);
 extern void drawing_init (void);
+extern void notice_screen_contents_lost (void);
+
+/* Output rows redrawn in the last frame, compared to what that screen
+   buffer held before */
+extern uae_u8 row_dirty[MAX_VIDHEIGHT];
+extern int row_dirty_first, row_dirty_last;
+
+#define MAX_ROW_RANGES 16
+struct row_range {
+  int first, count;
+};
+extern int get_dirty_row_ranges (struct row_range *r, int height, const uae_u8 *also);
 
 extern unsigned long time_per_frame;
 extern void adjust_idletime(unsigned long ns_waited);
+extern void frame_pace_wait (void);
+extern void frame_pace_input (void);
+extern void frame_pace_submitted (void);
+extern void frame_pace_vsync (unsigned long t);
 
 /* Finally, stuff that shouldn't really be shared.  */
 
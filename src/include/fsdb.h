@@ -93,6 +93,13 @@ typedef struct a_inode_struct {
     /* not equaling unit.mountcount -> not in this volume */
     unsigned int mountcount;
   	uae_u64 uniq_external;
+    /* Hash chains: by uniq within the unit, by name within the parent.  */
+    struct a_inode_struct *uniq_next, *aname_next, *nname_next;
+    uae_u32 aname_hash, nname_hash;
+    /* For a directory, hash tables of its children (NULL until needed).  */
+    struct aino_childhash *childhash;
+    /* For a directory, the mapped and indexed db file (see fsdb.cpp).  */
+    struct fsdb_index *dbindex;
 } a_inode;
 
 extern TCHAR *nname_begin (TCHAR *);
@@ -104,6 +111,7 @@ extern TCHAR *build_aname (const TCHAR *d, const TCHAR *n);
 extern void fsdb_clean_dir (a_inode *);
 extern TCHAR *fsdb_search_dir (const TCHAR *dirname, TCHAR *rel);
 extern void fsdb_dir_writeback (a_inode *);
+extern void fsdb_free_index (a_inode *);
 extern int fsdb_used_as_nname (a_inode *base, const TCHAR *);
 extern a_inode *fsdb_lookup_aino_aname (a_inode *base, const TCHAR *);
 extern a_inode *fsdb_lookup_aino_nname (a_inode *base, const TCHAR *);
@@ -117,6 +125,7 @@ STATIC_INLINE int same_aname (const TCHAR *an1, const TCHAR *an2)
 /* Filesystem-dependent functions.  */
 extern int fsdb_name_invalid (const TCHAR *n);
 extern int fsdb_fill_file_attrs (a_inode *, a_inode *);
+extern int fsdb_fill_file_attrs_stat (a_inode *, a_inode *, const struct _stat64 *);
 extern int fsdb_set_file_attrs (a_inode *);
 extern int fsdb_mode_representable_p (const a_inode *, int);
 extern int fsdb_mode_supported (const a_inode *);
@@ -130,6 +139,14 @@ extern struct my_opendir_s *my_opendir (const TCHAR*);
 extern void my_closedir (struct my_opendir_s *);
 extern int my_readdir (struct my_opendir_s *, TCHAR*);
 
+/* Name and stat() result of one directory entry, see my_readdir_all.  */
+struct my_dirsnap_entry {
+  TCHAR *name;
+  struct _stat64 statbuf;
+};
+extern int my_readdir_all (const TCHAR *dirname, struct my_dirsnap_entry **entries);
+extern void my_freedir_all (struct my_dirsnap_entry *entries, int count);
+
 extern int my_rmdir (const TCHAR*);
 extern int my_mkdir (const TCHAR*);
 extern int my_unlink (const TCHAR*);
@@ -22,6 +22,7 @@ extern void cache_free (void*, int);
 
 #ifdef PANDORA
 extern uae_u8* natmem_offset;
+extern uae_u32 natmem_size;
 extern void free_AmigaMem(void);
 extern void alloc_AmigaMem(void);
 #endif
@@ -124,8 +125,12 @@ extern uae_u32 REGPARAM3 dummy_wgeti (uaecptr addr) REGPARAM;
 #define bankindex(addr) (((uaecptr)(addr)) >> 16)
 
 extern addrbank *mem_banks[MEMORY_BANKS];
+/* Host address of every bank that is plain RAM, NULL for everything else.
+   RAM is then accessed directly without calling the bank functions. */
+extern uae_u8 *mem_banks_ram[MEMORY_BANKS];
 
 #define get_mem_bank(addr) (*mem_banks[bankindex(addr)])
+#define get_mem_ram(addr) (mem_banks_ram[bankindex(addr)])
 
 extern void memory_init (void);
 extern void memory_cleanup (void);
@@ -145,16 +150,25 @@ extern void free_fastmemory (void);
 
 STATIC_INLINE uae_u32 get_long(uaecptr addr)
 {
+  uae_u8 *m = get_mem_ram(addr);
+  if (m)
+    return do_get_mem_long((uae_u32 *)(m + (addr & 0xffff)));
   return longget(addr);
 }
 
 STATIC_INLINE uae_u32 get_word(uaecptr addr)
 {
+  uae_u8 *m = get_mem_ram(addr);
+  if (m)
+    return do_get_mem_word((uae_u16 *)(m + (addr & 0xffff)));
   return wordget(addr);
 }
 
 STATIC_INLINE uae_u32 get_byte(uaecptr addr)
 {
+  uae_u8 *m = get_mem_ram(addr);
+  if (m)
+    return m[addr & 0xffff];
   return byteget(addr);
 }
 
@@ -169,15 +183,27 @@ STATIC_INLINE uae_u32 get_wordi(uaecptr addr)
 
 STATIC_INLINE void put_long(uaecptr addr, uae_u32 l)
 {
-    longput(addr, l);
+    uae_u8 *m = get_mem_ram(addr);
+    if (m)
+      do_put_mem_long((uae_u32 *)(m + (addr & 0xffff)), l);
+    else
+      longput(addr, l);
 }
 STATIC_INLINE void put_word(uaecptr addr, uae_u32 w)
 {
-    wordput(addr, w);
+    uae_u8 *m = get_mem_ram(addr);
+    if (m)
+      do_put_mem_word((uae_u16 *)(m + (addr & 0xffff)), w);
+    else
+      wordput(addr, w);
 }
 STATIC_INLINE void put_byte(uaecptr addr, uae_u32 b)
 {
-    byteput(addr, b);
+    uae_u8 *m = get_mem_ram(addr);
+    if (m)
+      m[addr & 0xffff] = b;
+    else
+      byteput(addr, b);
 }
 
 /*
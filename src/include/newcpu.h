@@ -300,6 +300,13 @@ extern const struct cputbl op_smalltbl_4_ff[];
 extern const struct cputbl op_smalltbl_5_ff[];
 /* 68000 slow but compatible.  */
 extern const struct cputbl op_smalltbl_11_ff[];
+/* Superinstructions for the above, generated into cpuemu_pair.cpp */
+extern const struct cputbl op_pairtbl_1_ff[];
+extern const struct cputbl op_pairtbl_2_ff[];
+extern const struct cputbl op_pairtbl_3_ff[];
+extern const struct cputbl op_pairtbl_4_ff[];
+extern const struct cputbl op_pairtbl_5_ff[];
+extern void cpu_pair_step (uae_u32 cycles);
 
 extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
 
@@ -307,8 +314,12 @@ extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
 extern void (*flush_icache)(uaecptr, int);
 extern void compemu_reset(void);
 extern bool check_prefs_changed_comp (void);
+extern void jit_unprotect_range (uae_u8 *p, uae_u32 len);
+extern void jit_unprotect_done (uae_u8 *p, uae_u32 len);
 #else
 #define flush_icache(uaecptr, int) do {} while (0)
+#define jit_unprotect_range(p, len) do {} while (0)
+#define jit_unprotect_done(p, len) do {} while (0)
 #endif
 
 extern int movec_illg (int regno);
@@ -80,6 +80,7 @@ struct uae_prefs {
   int sound_filter_type;
 
   int cachesize;
+  bool compfpu;
   int optcount[10];
 
   int gfx_framerate;
@@ -116,6 +117,8 @@ struct uae_prefs {
   int fpu_model;
   bool cpu_compatible;
   bool address_space_24;
+  bool cpu_pairs;
+  bool cpu_predecode;
   int picasso96_modeflags;
 
   uae_u32 z3fastmem_size;
@@ -140,6 +143,12 @@ struct uae_prefs {
   int pandora_joyConf;
   int pandora_joyPort;
   int pandora_tapDelay;
+  int pandora_savestate_incremental;
+  int pandora_rewind_interval;
+  int pandora_rewind_memory;
+  int pandora_rewind_budget;
+  int pandora_vsync_margin;
+  int pandora_runahead;
   
   int pandora_customControls;
   int pandora_custom_dpad;    // 0-joystick, 1-mouse, 2-custom
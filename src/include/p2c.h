@@ -0,0 +1,54 @@
+/*
+ * Planar to chunky conversion shared by the chipset line renderer
+ * and the Picasso96 planar blits.
+ */
+
+#define MERGE(a,b,mask,shift) do {\
+    uae_u32 tmp = mask & (a ^ (b >> shift)); \
+    a ^= tmp; \
+    b ^= (tmp << shift); \
+} while (0)
+
+/* Transpose 32 pixels of 8 bitplanes. On entry b7 holds plane 0 and b0
+ * plane 7, leftmost pixel in bit 31. On exit each long holds 4 chunky
+ * pixels, leftmost in the top byte, in the order b0 b4 b1 b5 b2 b6 b3 b7. */
+#define P2C_TRANSPOSE(b0,b1,b2,b3,b4,b5,b6,b7) do {\
+    MERGE (b0, b1, 0x55555555, 1); \
+    MERGE (b2, b3, 0x55555555, 1); \
+    MERGE (b4, b5, 0x55555555, 1); \
+    MERGE (b6, b7, 0x55555555, 1); \
+    MERGE (b0, b2, 0x33333333, 2); \
+    MERGE (b1, b3, 0x33333333, 2); \
+    MERGE (b4, b6, 0x33333333, 2); \
+    MERGE (b5, b7, 0x33333333, 2); \
+    MERGE (b0, b4, 0x0f0f0f0f, 4); \
+    MERGE (b1, b5, 0x0f0f0f0f, 4); \
+    MERGE (b2, b6, 0x0f0f0f0f, 4); \
+    MERGE (b3, b7, 0x0f0f0f0f, 4); \
+    MERGE (b0, b1, 0x00ff00ff, 8); \
+    MERGE (b2, b3, 0x00ff00ff, 8); \
+    MERGE (b4, b5, 0x00ff00ff, 8); \
+    MERGE (b6, b7, 0x00ff00ff, 8); \
+    MERGE (b0, b2, 0x0000ffff, 16); \
+    MERGE (b1, b3, 0x0000ffff, 16); \
+    MERGE (b4, b6, 0x0000ffff, 16); \
+    MERGE (b5, b7, 0x0000ffff, 16); \
+} while (0)
+
+/* Convert 32 pixels of up to 8 big endian plane longs (pl[0] is plane 0)
+ * into 32 chunky bytes. */
+STATIC_INLINE void p2c_32 (const uae_u32 *pl, uae_u8 *chunky)
+{
+  uae_u32 b0 = pl[7], b1 = pl[6], b2 = pl[5], b3 = pl[4];
+  uae_u32 b4 = pl[3], b5 = pl[2], b6 = pl[1], b7 = pl[0];
+
+  P2C_TRANSPOSE (b0, b1, b2, b3, b4, b5, b6, b7);
+  do_put_mem_long ((uae_u32 *)(chunky +  0), b0);
+  do_put_mem_long ((uae_u32 *)(chunky +  4), b4);
+  do_put_mem_long ((uae_u32 *)(chunky +  8), b1);
+  do_put_mem_long ((uae_u32 *)(chunky + 12), b5);
+  do_put_mem_long ((uae_u32 *)(chunky + 16), b2);
+  do_put_mem_long ((uae_u32 *)(chunky + 20), b6);
+  do_put_mem_long ((uae_u32 *)(chunky + 24), b3);
+  do_put_mem_long ((uae_u32 *)(chunky + 28), b7);
+}
@@ -606,6 +606,8 @@ struct picasso_vidbuf_description {
     uae_u32 rgbformat;
     uae_u32 selected_rgbformat;
     uae_u32 clut[256];
+    int direct_ok; /* backend can display straight from board memory */
+    uae_u8 *direct_mem; /* frame to display when no copy was made, else NULL */
 };
 
 extern struct picasso_vidbuf_description picasso_vidinfo;
@@ -49,6 +49,10 @@ extern TCHAR *restore_path_func (uae_u8 **, int type);
 #define save_path(x, p) save_path_func (&dst, (x), p)
 #define restore_path(p) restore_path_func (&src, p)
 
+/* plain copies for the run-ahead snapshot, which never leaves memory */
+#define save_raw(x) do { memcpy (dst, &(x), sizeof (x)); dst += sizeof (x); } while (0)
+#define restore_raw(x) do { memcpy (&(x), src, sizeof (x)); src += sizeof (x); } while (0)
+
 
 /* save, restore and initialize routines for Amiga's subsystems */
 
@@ -57,6 +61,8 @@ extern void restore_cpu_finish (void);
 extern uae_u8 *save_cpu (int *, uae_u8 *);
 extern uae_u8 *restore_cpu_extra (uae_u8 *);
 extern uae_u8 *save_cpu_extra (int *, uae_u8 *);
+extern uae_u8 *restore_cpu_runahead (uae_u8 *);
+extern uae_u8 *save_cpu_runahead (int *, uae_u8 *);
 
 extern uae_u8 *restore_fpu (uae_u8 *);
 extern uae_u8 *save_fpu (int *, uae_u8 *);
@@ -73,6 +79,9 @@ extern void restore_disk_finish (void);
 
 extern uae_u8 *restore_custom (uae_u8 *);
 extern uae_u8 *save_custom (int *, uae_u8 *, int);
+extern uae_u8 *restore_custom_runahead (uae_u8 *);
+extern uae_u8 *save_custom_runahead (int *, uae_u8 *);
+extern void restore_custom_runahead_finish (void);
 
 extern uae_u8 *restore_custom_sprite (int num, uae_u8 *src);
 extern uae_u8 *save_custom_sprite (int num, int *len, uae_u8 *);
@@ -88,6 +97,8 @@ extern uae_u8 *save_blitter_new (int *len, uae_u8 *);
 extern uae_u8 *restore_audio (int, uae_u8 *);
 extern uae_u8 *save_audio (int, int *, uae_u8 *);
 extern void restore_audio_finish (void);
+extern uae_u8 *restore_audio_runahead (uae_u8 *);
+extern uae_u8 *save_audio_runahead (int *, uae_u8 *);
 
 extern uae_u8 *restore_cia (int, uae_u8 *);
 extern uae_u8 *save_cia (int, int *, uae_u8 *);
@@ -102,6 +113,8 @@ extern void restore_p96_finish (void);
 
 extern uae_u8 *restore_keyboard (uae_u8 *);
 extern uae_u8 *save_keyboard (int *,uae_u8*);
+extern uae_u8 *restore_keybuf_runahead (uae_u8 *);
+extern uae_u8 *save_keybuf_runahead (int *, uae_u8 *);
 
 extern uae_u8 *restore_filesys (uae_u8 *src);
 extern uae_u8 *save_filesys (int num, int *len);
@@ -136,6 +149,15 @@ extern void custom_save_state (void);
 extern void custom_prepare_savestate (void);
 
 extern bool savestate_check (void);
+extern void savestate_capture (void);
+extern void savestate_rewind_reset (void);
+
+extern int runahead_phase, runahead_next, runahead_frames;
+extern int runahead_pending, runahead_restoring;
+extern void savestate_runahead_vsync (void);
+extern void savestate_runahead_hsync (int lines_left);
+extern void savestate_runahead_step (void);
+extern void savestate_runahead_reset (void);
 
 #define STATE_SAVE 1
 #define STATE_RESTORE 2
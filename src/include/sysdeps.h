@@ -453,6 +453,12 @@ static inline uae_u32 do_byteswap_16(uae_u32 v) {__asm__ (
               "uxth %0, %0"
                                                 : "=r" (v) : "0" (v) ); return v;}
 
+#elif defined(CPU_x86_64) || defined(CPU_AARCH64)
+
+static inline uae_u32 do_byteswap_32(uae_u32 v) { return __builtin_bswap32(v); }
+
+static inline uae_u32 do_byteswap_16(uae_u32 v) { return __builtin_bswap16(v); }
+
 #endif
 
 #define bswap_16(x) (((x) >> 8) | (((x) & 0xFF) << 8))
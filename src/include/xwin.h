@@ -47,6 +47,18 @@ extern unsigned int doMask256 (int p, int bits, int shift);
 extern void alloc_colors64k (int, int, int, int, int, int, int);
 extern void alloc_colors_picasso (int rw, int gw, int bw, int rs, int gs, int bs, int rgbfmt);
 
+/* Native framebuffer format: RGB565, or with USE_RGB32 one uae_u32 per pixel
+ * with red in the low byte (same byte order as RGBFB_R8G8B8A8 and GL_RGBA). */
+#ifdef USE_RGB32
+#define DISPLAY_BPP 32
+#define DISPLAY_RMASK 0x000000ff
+#define DISPLAY_GMASK 0x0000ff00
+#define DISPLAY_BMASK 0x00ff0000
+#else
+#define DISPLAY_BPP 16
+#endif
+#define DISPLAY_PIXBYTES (DISPLAY_BPP >> 3)
+
 struct vidbuf_description
 {
   uae_u8 *bufmem;
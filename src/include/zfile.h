@@ -20,6 +20,8 @@ struct fs_dirhandle
 		struct zdirectory *zd;
 		struct my_opendir_s *od;
 	};
+	/* FS_DIRECTORY: whole directory read and stat()ed in one pass */
+	struct fs_dirsnap *snap;
 };
 struct fs_filehandle
 {
@@ -59,6 +61,9 @@ extern void zfile_exit (void);
 extern int execute_command (TCHAR *);
 extern int zfile_iscompressed (struct zfile *z);
 extern int zfile_zcompress (struct zfile *dst, void *src, int size);
+extern int zfile_lzbound (int len);
+extern int zfile_lzcompress (uae_u8 *dst, const uae_u8 *src, int len);
+extern int zfile_lzuncompress (uae_u8 *dst, int dstsize, const uae_u8 *src, int srcsize);
 extern int zfile_zuncompress (void *dst, int dstsize, struct zfile *src, int srcsize);
 extern int zfile_gettype (struct zfile *z);
 extern int zfile_zopen (const TCHAR *name, zfile_callback zc, void *user);
@@ -79,6 +79,13 @@ extern void __clear_cache (char*, char*);
 #define REG_WORK1 R2_INDEX
 #define REG_WORK2 R3_INDEX
 
+/* FPU registers: d0-d5 are allocated (N_FREGS), d6/d7 are scratch.
+   All of them are caller saved, flush() and prepare_for_call() keep
+   them in memory across calls. */
+#define FREG_WORK1 6
+#define FREG_WORK2 7
+#define SREG_WORK1 12 /* s12, lower half of d6 */
+
 //#define REG_DATAPTR R10_INDEX
 
 #define REG_PC_PRE R0_INDEX /* The register we use for preloading regs.pc_p */
@@ -2315,8 +2322,8 @@ static inline void raw_load_flagreg(uae_u32 t, uae_u32 r)
 	raw_mov_l_rm(t,(uintptr)live.state[r].mem);
 }
 
-/* %eax register is clobbered if target processor doesn't support fucomi */
-#define FFLAG_NREG_CLOBBER_CONDITION !have_cmov
+/* VMRS writes the flags directly, no integer register is needed */
+#define FFLAG_NREG_CLOBBER_CONDITION 0
 #define FFLAG_NREG R0_INDEX
 #define FLAG_NREG2 -1
 #define FLAG_NREG1 -1
@@ -2324,64 +2331,149 @@ static inline void raw_load_flagreg(uae_u32 t, uae_u32 r)
 
 static inline void raw_fflags_into_flags(int r)
 {
-	jit_unimplemented("raw_fflags_into_flags %x", r);
+	VCMP64_d0(r);										// vcmp.f64 d<r>, #0
+	VMRS_CPSR();										// vmrs     APSR_nzcv, fpscr
 }
 
+/* VFP registers are addressed directly, there is no stack to set up */
 static inline void raw_fp_init(void)
 {
-#ifdef USE_JIT_FPU
-    int i;
-
-    for (i=0;i<N_FREGS;i++)
-	live.spos[i]=-2;
-    live.tos=-1;  /* Stack is empty */
-#endif
 }
 
-// Verify
 static inline void raw_fp_cleanup_drop(void)
 {
-#ifdef USE_JIT_FPU
-D(panicbug("raw_fp_cleanup_drop"));
+}
 
-    while (live.tos>=1) {
-//	emit_byte(0xde);
-//	emit_byte(0xd9);
-	live.tos-=2;
-    }
-    while (live.tos>=0) {
-//	emit_byte(0xdd);
-//	emit_byte(0xd8);
-	live.tos--;
-    }
-    raw_fp_init();
+LOWFUNC(NONE,WRITE,2,raw_fmov_mr,(MEMW m, FR r))
+{
+#if defined(USE_DATA_BUFFER)
+  long offs = data_long_offs(m);
+	LDR_rRI(REG_WORK1, RPC_INDEX, offs); 	  // ldr     r2, [r10, #offs]
+	VSTR64_dRI(r, REG_WORK1, 0);						// vstr    d<r>, [r2]
+#else
+	LDR_rRI(REG_WORK1, RPC_INDEX, 4); 			// ldr     r2, [pc, #4]    ; <value>
+	VSTR64_dRI(r, REG_WORK1, 0);						// vstr    d<r>, [r2]
+
+	B_i(0);                            			// b       <jp>
+	emit_long(m);														//<value>:
+	//<jp>:
 #endif
 }
+LENDFUNC(NONE,WRITE,2,raw_fmov_mr,(MEMW m, FR r))
 
+/* Nothing to pop on ARM, dropping is the same as storing */
 LOWFUNC(NONE,WRITE,2,raw_fmov_mr_drop,(MEMW m, FR r))
 {
-	jit_unimplemented("raw_fmov_mr_drop %x %x", m, r);
+	raw_fmov_mr(m, r);
 }
 LENDFUNC(NONE,WRITE,2,raw_fmov_mr_drop,(MEMW m, FR r))
 
-LOWFUNC(NONE,WRITE,2,raw_fmov_mr,(MEMW m, FR r))
-{
-	jit_unimplemented("raw_fmov_mr %x %x", m, r);
-}
-LENDFUNC(NONE,WRITE,2,raw_fmov_mr,(MEMW m, FR r))
-
 LOWFUNC(NONE,READ,2,raw_fmov_rm,(FW r, MEMR m))
 {
-	jit_unimplemented("raw_fmov_rm %x %x", r, m);
+#if defined(USE_DATA_BUFFER)
+  long offs = data_long_offs(m);
+	LDR_rRI(REG_WORK1, RPC_INDEX, offs); 	  // ldr     r2, [r10, #offs]
+	VLDR64_dRI(r, REG_WORK1, 0);						// vldr    d<r>, [r2]
+#else
+	LDR_rRI(REG_WORK1, RPC_INDEX, 4); 			// ldr     r2, [pc, #4]    ; <value>
+	VLDR64_dRI(r, REG_WORK1, 0);						// vldr    d<r>, [r2]
+
+	B_i(0);                            			// b       <jp>
+	emit_long(m);														//<value>:
+	//<jp>:
+#endif
 }
 LENDFUNC(NONE,READ,2,raw_fmov_rm,(FW r, MEMR m))
 
 LOWFUNC(NONE,NONE,2,raw_fmov_rr,(FW d, FR s))
 {
-	jit_unimplemented("raw_fmov_rr %x %x", d, s);
+	VMOV64_dd(d, s);												// vmov.f64 d<d>, d<s>
 }
 LENDFUNC(NONE,NONE,2,raw_fmov_rr,(FW d, FR s))
 
+LOWFUNC(NONE,NONE,2,raw_fmovi_rr,(FW d, RR4 s))
+{
+	VMOV32_sr(SREG_WORK1, s);								// vmov     s12, r<s>
+	VCVTIto64_ds(d, SREG_WORK1);						// vcvt.f64.s32 d<d>, s12
+}
+LENDFUNC(NONE,NONE,2,raw_fmovi_rr,(FW d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,raw_fmovs_rr,(FW d, RR4 s))
+{
+	VMOV32_sr(SREG_WORK1, s);								// vmov     s12, r<s>
+	VCVT32to64_ds(d, SREG_WORK1);						// vcvt.f64.f32 d<d>, s12
+}
+LENDFUNC(NONE,NONE,2,raw_fmovs_rr,(FW d, RR4 s))
+
+/* The 68k keeps the high word of a double first */
+LOWFUNC(NONE,NONE,3,raw_fmovd_rrr,(FW d, RR4 hi, RR4 lo))
+{
+	VMOV64_drr(d, lo, hi);									// vmov     d<d>, r<lo>, r<hi>
+}
+LENDFUNC(NONE,NONE,3,raw_fmovd_rrr,(FW d, RR4 hi, RR4 lo))
+
+LOWFUNC(NONE,NONE,2,raw_fmovs_to_rr,(W4 d, FR s))
+{
+	VCVT64to32_sd(SREG_WORK1, s);						// vcvt.f32.f64 s12, d<s>
+	VMOV32_rs(d, SREG_WORK1);								// vmov     r<d>, s12
+}
+LENDFUNC(NONE,NONE,2,raw_fmovs_to_rr,(W4 d, FR s))
+
+LOWFUNC(NONE,NONE,3,raw_fmovd_to_rrr,(W4 hi, W4 lo, FR s))
+{
+	VMOV64_rrd(lo, hi, s);									// vmov     r<lo>, r<hi>, d<s>
+}
+LENDFUNC(NONE,NONE,3,raw_fmovd_to_rrr,(W4 hi, W4 lo, FR s))
+
+LOWFUNC(NONE,NONE,1,raw_fround_s_r,(FRW r))
+{
+	VCVT64to32_sd(SREG_WORK1, r);						// vcvt.f32.f64 s12, d<r>
+	VCVT32to64_ds(r, SREG_WORK1);						// vcvt.f64.f32 d<r>, s12
+}
+LENDFUNC(NONE,NONE,1,raw_fround_s_r,(FRW r))
+
+LOWFUNC(NONE,NONE,2,raw_fadd_rr,(FRW d, FR s))
+{
+	VADD64_ddd(d, d, s);										// vadd.f64 d<d>, d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fadd_rr,(FRW d, FR s))
+
+LOWFUNC(NONE,NONE,2,raw_fsub_rr,(FRW d, FR s))
+{
+	VSUB64_ddd(d, d, s);										// vsub.f64 d<d>, d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fsub_rr,(FRW d, FR s))
+
+LOWFUNC(NONE,NONE,2,raw_fmul_rr,(FRW d, FR s))
+{
+	VMUL64_ddd(d, d, s);										// vmul.f64 d<d>, d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fmul_rr,(FRW d, FR s))
+
+LOWFUNC(NONE,NONE,2,raw_fdiv_rr,(FRW d, FR s))
+{
+	VDIV64_ddd(d, d, s);										// vdiv.f64 d<d>, d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fdiv_rr,(FRW d, FR s))
+
+LOWFUNC(NONE,NONE,2,raw_fsqrt_rr,(FW d, FR s))
+{
+	VSQRT64_dd(d, s);												// vsqrt.f64 d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fsqrt_rr,(FW d, FR s))
+
+LOWFUNC(NONE,NONE,2,raw_fabs_rr,(FW d, FR s))
+{
+	VABS64_dd(d, s);												// vabs.f64 d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fabs_rr,(FW d, FR s))
+
+LOWFUNC(NONE,NONE,2,raw_fneg_rr,(FW d, FR s))
+{
+	VNEG64_dd(d, s);												// vneg.f64 d<d>, d<s>
+}
+LENDFUNC(NONE,NONE,2,raw_fneg_rr,(FW d, FR s))
+
 static inline void raw_emit_nop_filler(int nbytes)
 {
 	nbytes >>= 2;
@@ -2734,6 +2826,18 @@ LOWFUNC(NONE,NONE,3,compemu_raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
 }
 LENDFUNC(NONE,NONE,3,compemu_raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
 
+LOWFUNC(NONE,READ,3,compemu_raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+{
+	LDR_rRI(d, s, offset);	  	// ldr     %[d], [%[s], #offset]
+}
+LENDFUNC(NONE,READ,3,compemu_raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_cmp_l_rr,(RR4 d, RR4 s))
+{
+	CMP_rr(d, s);	          	// cmp     %[d], %[s]
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_cmp_l_rr,(RR4 d, RR4 s))
+
 LOWFUNC(NONE,NONE,4,compemu_raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
 {
 	int shft;
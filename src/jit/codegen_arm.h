@@ -1252,4 +1252,58 @@ enum {
 #define CC_BFI_rrii(cc,Rd,Rn,lsb,msb)   _W(((cc) << 28) | (0x3e << 21) | ((msb) << 16) | (Rd << 12) | ((lsb) << 7) | (0x1 << 4) | (Rn))
 #define BFI_rrii(Rd,Rn,lsb,msb)         CC_BFI_rrii(NATIVE_CC_AL,Rd,Rn,lsb,msb)
 
+/* ========================================================================= */
+/* --- VFP (double precision, d0-d15) -------------------------------------- */
+/* ========================================================================= */
+
+#define _VSd(Sd) ((((Sd) >> 1) << 12) | (((Sd) & 1) << 22))
+#define _VSn(Sn) ((((Sn) >> 1) << 16) | (((Sn) & 1) << 7))
+#define _VSm(Sm) (((Sm) >> 1) | (((Sm) & 1) << 5))
+
+#define CC_VLDR64_dRI(cc,Dd,Rn,i)			_W(((cc) << 28) | (0xd9 << 20) | ((Rn) << 16) | ((Dd) << 12) | (0xb << 8) | ((i) >> 2))
+#define VLDR64_dRI(Dd,Rn,i)					CC_VLDR64_dRI(NATIVE_CC_AL,Dd,Rn,i)
+#define CC_VSTR64_dRI(cc,Dd,Rn,i)			_W(((cc) << 28) | (0xd8 << 20) | ((Rn) << 16) | ((Dd) << 12) | (0xb << 8) | ((i) >> 2))
+#define VSTR64_dRI(Dd,Rn,i)					CC_VSTR64_dRI(NATIVE_CC_AL,Dd,Rn,i)
+
+#define CC_VMOV64_dd(cc,Dd,Dm)				_W(((cc) << 28) | (0xeb << 20) | ((Dd) << 12) | (0xb4 << 4) | (Dm))
+#define VMOV64_dd(Dd,Dm)					CC_VMOV64_dd(NATIVE_CC_AL,Dd,Dm)
+#define CC_VABS64_dd(cc,Dd,Dm)				_W(((cc) << 28) | (0xeb << 20) | ((Dd) << 12) | (0xbc << 4) | (Dm))
+#define VABS64_dd(Dd,Dm)					CC_VABS64_dd(NATIVE_CC_AL,Dd,Dm)
+#define CC_VNEG64_dd(cc,Dd,Dm)				_W(((cc) << 28) | (0xeb << 20) | (0x1 << 16) | ((Dd) << 12) | (0xb4 << 4) | (Dm))
+#define VNEG64_dd(Dd,Dm)					CC_VNEG64_dd(NATIVE_CC_AL,Dd,Dm)
+#define CC_VSQRT64_dd(cc,Dd,Dm)				_W(((cc) << 28) | (0xeb << 20) | (0x1 << 16) | ((Dd) << 12) | (0xbc << 4) | (Dm))
+#define VSQRT64_dd(Dd,Dm)					CC_VSQRT64_dd(NATIVE_CC_AL,Dd,Dm)
+
+#define CC_VADD64_ddd(cc,Dd,Dn,Dm)			_W(((cc) << 28) | (0xe3 << 20) | ((Dn) << 16) | ((Dd) << 12) | (0xb0 << 4) | (Dm))
+#define VADD64_ddd(Dd,Dn,Dm)				CC_VADD64_ddd(NATIVE_CC_AL,Dd,Dn,Dm)
+#define CC_VSUB64_ddd(cc,Dd,Dn,Dm)			_W(((cc) << 28) | (0xe3 << 20) | ((Dn) << 16) | ((Dd) << 12) | (0xb4 << 4) | (Dm))
+#define VSUB64_ddd(Dd,Dn,Dm)				CC_VSUB64_ddd(NATIVE_CC_AL,Dd,Dn,Dm)
+#define CC_VMUL64_ddd(cc,Dd,Dn,Dm)			_W(((cc) << 28) | (0xe2 << 20) | ((Dn) << 16) | ((Dd) << 12) | (0xb0 << 4) | (Dm))
+#define VMUL64_ddd(Dd,Dn,Dm)				CC_VMUL64_ddd(NATIVE_CC_AL,Dd,Dn,Dm)
+#define CC_VDIV64_ddd(cc,Dd,Dn,Dm)			_W(((cc) << 28) | (0xe8 << 20) | ((Dn) << 16) | ((Dd) << 12) | (0xb0 << 4) | (Dm))
+#define VDIV64_ddd(Dd,Dn,Dm)				CC_VDIV64_ddd(NATIVE_CC_AL,Dd,Dn,Dm)
+
+#define CC_VCMP64_dd(cc,Dd,Dm)				_W(((cc) << 28) | (0xeb << 20) | (0x4 << 16) | ((Dd) << 12) | (0xb4 << 4) | (Dm))
+#define VCMP64_dd(Dd,Dm)					CC_VCMP64_dd(NATIVE_CC_AL,Dd,Dm)
+#define CC_VCMP64_d0(cc,Dd)					_W(((cc) << 28) | (0xeb << 20) | (0x5 << 16) | ((Dd) << 12) | (0xb4 << 4))
+#define VCMP64_d0(Dd)						CC_VCMP64_d0(NATIVE_CC_AL,Dd)
+#define CC_VMRS_CPSR(cc)					_W(((cc) << 28) | (0xef << 20) | (0x1 << 16) | (0xf << 12) | (0xa1 << 4))
+#define VMRS_CPSR()							CC_VMRS_CPSR(NATIVE_CC_AL)
+
+#define CC_VCVTIto64_ds(cc,Dd,Sm)			_W(((cc) << 28) | (0xeb << 20) | (0x8 << 16) | ((Dd) << 12) | (0xbc << 4) | _VSm(Sm))
+#define VCVTIto64_ds(Dd,Sm)					CC_VCVTIto64_ds(NATIVE_CC_AL,Dd,Sm)
+#define CC_VCVT32to64_ds(cc,Dd,Sm)			_W(((cc) << 28) | (0xeb << 20) | (0x7 << 16) | ((Dd) << 12) | (0xac << 4) | _VSm(Sm))
+#define VCVT32to64_ds(Dd,Sm)				CC_VCVT32to64_ds(NATIVE_CC_AL,Dd,Sm)
+#define CC_VCVT64to32_sd(cc,Sd,Dm)			_W(((cc) << 28) | (0xeb << 20) | (0x7 << 16) | _VSd(Sd) | (0xbc << 4) | (Dm))
+#define VCVT64to32_sd(Sd,Dm)				CC_VCVT64to32_sd(NATIVE_CC_AL,Sd,Dm)
+
+#define CC_VMOV32_sr(cc,Sn,Rt)				_W(((cc) << 28) | (0xe0 << 20) | _VSn(Sn) | ((Rt) << 12) | (0xa1 << 4))
+#define VMOV32_sr(Sn,Rt)					CC_VMOV32_sr(NATIVE_CC_AL,Sn,Rt)
+#define CC_VMOV32_rs(cc,Rt,Sn)				_W(((cc) << 28) | (0xe1 << 20) | _VSn(Sn) | ((Rt) << 12) | (0xa1 << 4))
+#define VMOV32_rs(Rt,Sn)					CC_VMOV32_rs(NATIVE_CC_AL,Rt,Sn)
+#define CC_VMOV64_drr(cc,Dm,Rt,Rt2)			_W(((cc) << 28) | (0xc4 << 20) | ((Rt2) << 16) | ((Rt) << 12) | (0xb1 << 4) | (Dm))
+#define VMOV64_drr(Dm,Rt,Rt2)				CC_VMOV64_drr(NATIVE_CC_AL,Dm,Rt,Rt2)
+#define CC_VMOV64_rrd(cc,Rt,Rt2,Dm)			_W(((cc) << 28) | (0xc5 << 20) | ((Rt2) << 16) | ((Rt) << 12) | (0xb1 << 4) | (Dm))
+#define VMOV64_rrd(Rt,Rt2,Dm)				CC_VMOV64_rrd(NATIVE_CC_AL,Rt,Rt2,Dm)
+
 #endif /* ARM_RTASM_H */
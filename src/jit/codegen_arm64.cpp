@@ -0,0 +1,1798 @@
+/*
+ * compiler/codegen_arm64.cpp - AArch64 code generator
+ *
+ * JIT compiler m68k -> AArch64
+ *
+ * Original 68040 JIT compiler for UAE, copyright 2000-2002 Bernd Meyer
+ * Adaptation for Basilisk II and improvements, copyright 2000-2004 Gwenole Beauchesne
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Current state:
+ * 	- Experimental
+ *	- gencomp emits x86 semantics (flags, carry, condition codes). As in
+ *	  codegen_arm.cpp, C holds the borrow after a subtraction, and byte
+ *	  and word operations work on the operands shifted to the top.
+ *	- D0-D7 and A0-A7 stay in x19-x29 and x11-x15 while generated code
+ *	  runs. Accesses to regs.regs[] go to those registers instead of
+ *	  memory; they are written back before a call or an exit and loaded
+ *	  again afterwards.
+ *	- no FPU support, the FPU instructions run in the interpreter
+ *
+ */
+
+#include "flags_arm.h"
+
+/*************************************************************************
+ * Some basic information about the the target CPU                       *
+ *************************************************************************/
+
+#define X0_INDEX  0
+#define X1_INDEX  1
+#define X2_INDEX  2
+#define X3_INDEX  3
+
+/* The register in which subroutines return an integer return value */
+#define REG_RESULT X0_INDEX
+
+/* The registers subroutines take their first and second argument in */
+#define REG_PAR1 X0_INDEX
+#define REG_PAR2 X1_INDEX
+
+#define REG_WORK1 X2_INDEX
+#define REG_WORK2 X3_INDEX
+
+#define REG_PC_PRE X0_INDEX /* The register we use for preloading regs.pc_p */
+#define REG_PC_TMP X1_INDEX /* Another register that is not the above */
+
+#define SHIFTCOUNT_NREG X1_INDEX  /* Register that can be used for shiftcount.
+			      -1 if any reg will do */
+#define MUL_NREG1 X0_INDEX /* x0 will hold the low 32 bits after a 32x32 mul */
+#define MUL_NREG2 X1_INDEX /* x1 will hold the high 32 bits */
+
+/* The generated code calls C functions, keep the stack 16 byte aligned.
+   raw_push_regs_to_preserve() saves 96 bytes. */
+#define STACK_ALIGN		16
+#define STACK_OFFSET	0
+
+/* x0-x10 are allocated, x11-x15 are homes of 68k registers and x16-x18,
+   the remaining homes, the frame pointer and the link register are above
+   N_REGS */
+uae_u8 always_used[]={2,3,11,12,13,14,15,0xff};
+uae_u8 can_byte[]={0,1,4,5,6,7,8,9,10,0xff};
+uae_u8 can_word[]={0,1,4,5,6,7,8,9,10,0xff};
+
+uae_u8 call_saved[]={0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0};
+
+/* This *should* be the same as call_saved. But:
+   - We might not really know which registers are saved, and which aren't,
+     so we need to preserve some, but don't want to rely on everyone else
+     also saving those registers
+   - Special registers (such like the stack pointer) should not be "preserved"
+     by pushing, even though they are "saved" across function calls
+   x19-x30 are saved by raw_push_regs_to_preserve() itself.
+*/
+static const uae_u8 need_to_preserve[]={0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0};
+
+/* Whether classes of instructions do or don't clobber the native flags */
+#define CLOBBER_MOV
+#define CLOBBER_LEA
+#define CLOBBER_CMOV
+#define CLOBBER_POP
+#define CLOBBER_PUSH
+#define CLOBBER_SUB  clobber_flags()
+#define CLOBBER_SBB  clobber_flags()
+#define CLOBBER_CMP  clobber_flags()
+#define CLOBBER_ADD  clobber_flags()
+#define CLOBBER_ADC  clobber_flags()
+#define CLOBBER_AND  clobber_flags()
+#define CLOBBER_OR   clobber_flags()
+#define CLOBBER_XOR  clobber_flags()
+
+#define CLOBBER_ROL  clobber_flags()
+#define CLOBBER_ROR  clobber_flags()
+#define CLOBBER_SHLL clobber_flags()
+#define CLOBBER_SHRL clobber_flags()
+#define CLOBBER_SHRA clobber_flags()
+#define CLOBBER_TEST clobber_flags()
+#define CLOBBER_CL16
+#define CLOBBER_CL8
+#define CLOBBER_SE32
+#define CLOBBER_SE16
+#define CLOBBER_SE8
+#define CLOBBER_ZE32
+#define CLOBBER_ZE16
+#define CLOBBER_ZE8
+#define CLOBBER_SW16
+#define CLOBBER_SW32
+#define CLOBBER_SETCC
+#define CLOBBER_MUL
+#define CLOBBER_BT   clobber_flags()
+#define CLOBBER_BSF  clobber_flags()
+
+#include "codegen_arm64.h"
+
+#define arm64_emit_failure(MSG)	jit_fail(MSG, __FILE__, __LINE__, __FUNCTION__)
+
+static void jit_fail(const char *msg, const char *file, int line, const char *function)
+{
+	panicbug("JIT failure in function %s from file %s at line %d: %s\n",
+			function, file, line, msg);
+	abort();
+}
+
+/* Homes of D0-D7 and A0-A7 */
+static const uae_u8 arm64_home[16]={19,20,21,22,23,24,25,26,27,28,29,11,12,13,14,15};
+
+/* Returns the home register for an access of size bytes to regs.regs[]
+   and the position of the accessed bits in *lsb, or -1 for any other
+   address */
+STATIC_INLINE int arm64_home_reg(uintptr addr, int size, int *lsb)
+{
+	uintptr base = (uintptr)&regs.regs[0];
+
+	if (addr < base || addr >= base + 16 * 4)
+		return -1;
+	int off = addr - base;
+	if ((off & 3) + size > 4)
+		arm64_emit_failure("access straddles two 68k registers");
+	*lsb = (off & 3) * 8;
+	return arm64_home[off >> 2];
+}
+
+STATIC_INLINE int arm64_log2(int size)
+{
+	return (size == 8) ? 3 : (size == 4) ? 2 : (size == 2) ? 1 : 0;
+}
+
+STATIC_INLINE int arm64_scale(int factor)
+{
+	switch (factor) {
+	case 1: return 0;
+	case 2: return 1;
+	case 4: return 2;
+	case 8: return 3;
+	}
+	arm64_emit_failure("bad scale factor");
+	return 0;
+}
+
+STATIC_INLINE void arm64_mov_rr(int d, int s)
+{
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, ARM64_ZR, s, ARM64_LSL, 0);	// mov  w<d>, w<s>
+}
+
+STATIC_INLINE void arm64_lsl_ri(int d, int s, int i)
+{
+	arm64_bitfield(0, ARM64_UBFM, d, s, (32 - i) & 31, 31 - i);
+}
+
+STATIC_INLINE void arm64_bfi(int d, int s, int lsb, int width)
+{
+	arm64_bitfield(0, ARM64_BFM, d, s, (32 - lsb) & 31, width - 1);
+}
+
+STATIC_INLINE void arm64_bfxil(int d, int s, int lsb, int width)
+{
+	arm64_bitfield(0, ARM64_BFM, d, s, lsb, lsb + width - 1);
+}
+
+STATIC_INLINE void arm64_ubfx(int d, int s, int lsb, int width)
+{
+	arm64_bitfield(0, ARM64_UBFM, d, s, lsb, lsb + width - 1);
+}
+
+/* w<d> = i */
+STATIC_INLINE void arm64_mov_ri(int d, uae_u32 i)
+{
+	int enc;
+
+	if ((i & 0xffff0000) == 0)
+		arm64_movw(0, ARM64_MOVZ, d, i, 0);
+	else if ((i & 0xffff) == 0)
+		arm64_movw(0, ARM64_MOVZ, d, i >> 16, 1);
+	else if ((i | 0xffff) == 0xffffffff)
+		arm64_movw(0, ARM64_MOVN, d, ~i, 0);
+	else if ((i | 0xffff0000) == 0xffffffff)
+		arm64_movw(0, ARM64_MOVN, d, ~i >> 16, 1);
+	else if ((enc = arm64_logic_imm_enc(i)) >= 0)
+		arm64_logic_imm(0, ARM64_ORR, d, ARM64_ZR, enc);
+	else {
+		arm64_movw(0, ARM64_MOVZ, d, i, 0);
+		arm64_movw(0, ARM64_MOVK, d, i >> 16, 1);
+	}
+}
+
+/* x<d> = i sign extended to 64 bit */
+STATIC_INLINE void arm64_mov_q_si(int d, uae_s32 i)
+{
+	if (i >= 0)
+		arm64_mov_ri(d, i);
+	else {
+		arm64_movw(1, ARM64_MOVN, d, ~i, 0);
+		if (((i >> 16) & 0xffff) != 0xffff)
+			arm64_movw(1, ARM64_MOVK, d, i >> 16, 1);
+	}
+}
+
+/* op d, n, #i with the logical immediate, or through IP1 */
+STATIC_INLINE void arm64_logic_ri(int opc, int d, int n, uae_u32 i)
+{
+	int enc = arm64_logic_imm_enc(i);
+
+	if (enc >= 0)
+		arm64_logic_imm(0, opc, d, n, enc);
+	else {
+		arm64_mov_ri(ARM64_IP1, i);
+		arm64_logic_rrr(0, opc, 0, d, n, ARM64_IP1, ARM64_LSL, 0);
+	}
+}
+
+/* add d, n, #i, adds if s is set. Negative values without flags become
+   a sub. */
+STATIC_INLINE void arm64_add_ri(int s, int d, int n, uae_s32 i)
+{
+	if (i >= 0 && i < 4096)
+		arm64_addsub_imm(0, 0, s, d, n, i, 0);
+	else if (!s && i < 0 && i > -4096)
+		arm64_addsub_imm(0, 1, 0, d, n, -i, 0);
+	else {
+		arm64_mov_ri(ARM64_IP1, i);
+		arm64_addsub_rrr(0, 0, s, d, n, ARM64_IP1, ARM64_LSL, 0);
+	}
+}
+
+/* SUBS leaves the inverse of the borrow in C, x86 and the 68k keep the
+   borrow itself */
+STATIC_INLINE void arm64_invert_c(void)
+{
+	arm64_mrs_nzcv(ARM64_IP1);							// mrs  x17, nzcv
+	arm64_logic_ri(ARM64_EOR, ARM64_IP1, ARM64_IP1, ARM64_C_FLAG);	// eor  w17, w17, #0x20000000
+	arm64_msr_nzcv(ARM64_IP1);							// msr  nzcv, x17
+}
+
+/* N and Z from the low "bits" bits of r, C and V cleared */
+STATIC_INLINE void arm64_flags_nz(int bits, int r)
+{
+	if (bits == 32)
+		arm64_logic_rrr(0, ARM64_ANDS, 0, ARM64_ZR, r, r, ARM64_LSL, 0);	// tst  w<r>, w<r>
+	else {
+		arm64_lsl_ri(ARM64_IP0, r, 32 - bits);
+		arm64_logic_rrr(0, ARM64_ANDS, 0, ARM64_ZR, ARM64_IP0, ARM64_IP0, ARM64_LSL, 0);
+	}
+}
+
+/* add or sub on the low "bits" bits of d, with the flags of that size */
+STATIC_INLINE void arm64_addsub_bw(int bits, int sub, int d, int s)
+{
+	int sh = 32 - bits;
+
+	arm64_lsl_ri(ARM64_IP0, d, sh);						// lsl  w16, w<d>, #sh
+	arm64_addsub_rrr(0, sub, 1, ARM64_IP0, ARM64_IP0, s, ARM64_LSL, sh);	// adds w16, w16, w<s>, lsl #sh
+	arm64_bfxil(d, ARM64_IP0, sh, bits);				// bfxil w<d>, w16, #sh, #bits
+	if (sub)
+		arm64_invert_c();
+}
+
+/* adc or sbb on the low "bits" bits of d. Ones below the shifted operand
+   let the carry in ripple into it. */
+STATIC_INLINE void arm64_adcsbc_bw(int bits, int sub, int d, int s)
+{
+	int sh = 32 - bits;
+	int ones = sub ? ARM64_IP1 : ARM64_IP0;
+
+	if (sub)
+		arm64_invert_c();
+	arm64_lsl_ri(ARM64_IP0, d, sh);						// lsl  w16, w<d>, #sh
+	arm64_lsl_ri(ARM64_IP1, s, sh);						// lsl  w17, w<s>, #sh
+	arm64_bcc(sub ? NATIVE_CC_CS : NATIVE_CC_CC, 8);	// b.cs/b.cc <no_carry>
+	arm64_logic_ri(ARM64_ORR, ones, ones, (1 << sh) - 1);
+	//<no_carry>:
+	arm64_adc(0, sub, 1, ARM64_IP0, ARM64_IP0, ARM64_IP1);	// adcs w16, w16, w17
+	arm64_bfxil(d, ARM64_IP0, sh, bits);
+	if (sub)
+		arm64_invert_c();
+}
+
+/* d = cc ? 1 : 0. HI and LS follow the borrow in C. */
+STATIC_INLINE void arm64_cset(int d, int cc)
+{
+	switch (cc) {
+	case NATIVE_CC_HI:
+		arm64_csel(0, 0, 1, d, ARM64_ZR, ARM64_ZR, NATIVE_CC_CS);	// cset d, cc
+		arm64_csel(0, 0, 0, d, d, ARM64_ZR, NATIVE_CC_NE);		// csel d, d, wzr, ne
+		break;
+	case NATIVE_CC_LS:
+		arm64_csel(0, 0, 1, d, ARM64_ZR, ARM64_ZR, NATIVE_CC_CC);	// cset d, cs
+		arm64_csel(0, 0, 1, d, d, ARM64_ZR, NATIVE_CC_NE);		// csinc d, d, wzr, ne
+		break;
+	default:
+		arm64_csel(0, 0, 1, d, ARM64_ZR, ARM64_ZR, cc ^ 1);		// cset d, cc
+		break;
+	}
+}
+
+/* d = cc ? s : d. s must not be IP1. */
+STATIC_INLINE void arm64_cmov(int d, int s, int cc)
+{
+	switch (cc) {
+	case NATIVE_CC_HI:
+		arm64_csel(0, 0, 0, ARM64_IP1, d, s, NATIVE_CC_EQ);		// csel w17, d, s, eq
+		arm64_csel(0, 0, 0, d, d, ARM64_IP1, NATIVE_CC_CS);		// csel d, d, w17, cs
+		break;
+	case NATIVE_CC_LS:
+		arm64_csel(0, 0, 0, d, s, d, NATIVE_CC_EQ);			// csel d, s, d, eq
+		arm64_csel(0, 0, 0, d, s, d, NATIVE_CC_CS);			// csel d, s, d, cs
+		break;
+	default:
+		arm64_csel(0, 0, 0, d, s, d, cc);					// csel d, s, d, cc
+		break;
+	}
+}
+
+/* w<t> = the size bytes at addr, zero extended */
+STATIC_INLINE void arm64_load_m(int size, int t, uintptr addr)
+{
+	int lsb, h = arm64_home_reg(addr, size, &lsb);
+
+	if (h >= 0) {
+		if (size == 4)
+			arm64_mov_rr(t, h);
+		else
+			arm64_ubfx(t, h, lsb, size * 8);
+	}
+	else {
+		arm64_mov_ri(ARM64_IP0, addr);
+		arm64_ldst_uimm(arm64_log2(size), ARM64_LDR, t, ARM64_IP0, 0);
+	}
+}
+
+/* the size bytes at addr = w<s>. s must not be IP0. */
+STATIC_INLINE void arm64_store_m(int size, int s, uintptr addr)
+{
+	int lsb, h = arm64_home_reg(addr, size, &lsb);
+
+	if (h >= 0) {
+		if (size == 4)
+			arm64_mov_rr(h, s);
+		else
+			arm64_bfi(h, s, lsb, size * 8);
+	}
+	else {
+		arm64_mov_ri(ARM64_IP0, addr);
+		arm64_ldst_uimm(arm64_log2(size), ARM64_STR, s, ARM64_IP0, 0);
+	}
+}
+
+/* ldr/str t, [b, #offset] for a host pointer in b. t must not be IP0. */
+STATIC_INLINE void arm64_ldst_off(int size, int opc, int t, int b, uae_s32 offset)
+{
+	int l = arm64_log2(size);
+
+	if (offset >= 0 && (offset & (size - 1)) == 0 && (offset >> l) < 4096)
+		arm64_ldst_uimm(l, opc, t, b, offset >> l);
+	else if (offset >= -256 && offset < 256)
+		arm64_ldst_simm(l, opc, t, b, offset);
+	else {
+		arm64_mov_q_si(ARM64_IP0, offset);
+		arm64_ldst_reg(l, opc, t, b, ARM64_IP0, ARM64_UXTX, 0);
+	}
+}
+
+/* ldr/str t, [offset + s] for an Amiga address in s. Only this form
+   reaches natmem, handle_aarch64_instruction() decodes it. */
+STATIC_INLINE void arm64_ldst_natmem(int size, int opc, int t, int s, uae_s32 offset)
+{
+	arm64_mov_q_si(ARM64_IP0, offset);
+	arm64_ldst_reg(arm64_log2(size), opc, t, ARM64_IP0, s, ARM64_UXTW, 0);
+}
+
+/* Load into the low size bytes of d, leaving the rest alone */
+STATIC_INLINE void arm64_load_natmem_bw(int size, int d, int s, uae_s32 offset)
+{
+	arm64_ldst_natmem(size, ARM64_LDR, ARM64_IP1, s, offset);
+	arm64_bfi(d, ARM64_IP1, 0, size * 8);
+}
+
+/* IP1 = s & 0x00ffffff, for the 24 bit addressing variants */
+STATIC_INLINE void arm64_mask24(int s)
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP1, s, 0x00ffffff);
+}
+
+/* Replicates the low byte or word of r over IP0, a 32 bit rotate of that
+   rotates the byte or word */
+STATIC_INLINE void arm64_replicate(int bits, int r)
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, r, (1 << bits) - 1);
+	for (; bits < 32; bits *= 2)
+		arm64_logic_rrr(0, ARM64_ORR, 0, ARM64_IP0, ARM64_IP0, ARM64_IP0, ARM64_LSL, bits);
+}
+
+STATIC_INLINE void arm64_shift_bw_ri(int bits, int op, int r, int i)
+{
+	switch (op) {
+	case ARM64_LSLV:
+		arm64_lsl_ri(ARM64_IP0, r, i & 31);
+		break;
+	case ARM64_LSRV:
+		arm64_ubfx(ARM64_IP0, r, 0, bits);
+		arm64_bitfield(0, ARM64_UBFM, ARM64_IP0, ARM64_IP0, i & 31, 31);	// lsr
+		break;
+	case ARM64_ASRV:
+		arm64_bitfield(0, ARM64_SBFM, ARM64_IP0, r, 0, bits - 1);			// sxtb/sxth
+		arm64_bitfield(0, ARM64_SBFM, ARM64_IP0, ARM64_IP0, i & 31, 31);	// asr
+		break;
+	}
+	arm64_bfi(r, ARM64_IP0, 0, bits);
+}
+
+/* The shift count is taken modulo 32 like on x86 */
+STATIC_INLINE void arm64_shift_bw_rr(int bits, int op, int d, int r)
+{
+	switch (op) {
+	case ARM64_LSLV:
+		arm64_mov_rr(ARM64_IP0, d);
+		break;
+	case ARM64_LSRV:
+		arm64_ubfx(ARM64_IP0, d, 0, bits);
+		break;
+	case ARM64_ASRV:
+		arm64_bitfield(0, ARM64_SBFM, ARM64_IP0, d, 0, bits - 1);
+		break;
+	}
+	arm64_dp2(0, op, ARM64_IP0, ARM64_IP0, r);
+	arm64_bfi(d, ARM64_IP0, 0, bits);
+}
+
+STATIC_INLINE void arm64_ror_bw_ri(int bits, int r, int i)
+{
+	arm64_replicate(bits, r);
+	arm64_extr(0, ARM64_IP0, ARM64_IP0, ARM64_IP0, i & 31);	// ror  w16, w16, #i
+	arm64_bfi(r, ARM64_IP0, 0, bits);
+}
+
+/* ror by r, or rol by r with neg set */
+STATIC_INLINE void arm64_ror_bw_rr(int bits, int d, int r, int neg)
+{
+	arm64_replicate(bits, d);
+	if (neg) {
+		arm64_addsub_rrr(0, 1, 0, ARM64_IP1, ARM64_ZR, r, ARM64_LSL, 0);	// neg  w17, w<r>
+		r = ARM64_IP1;
+	}
+	arm64_dp2(0, ARM64_RORV, ARM64_IP0, ARM64_IP0, r);
+	arm64_bfi(d, ARM64_IP0, 0, bits);
+}
+
+STATIC_INLINE int arm64_in_b26(uintptr t)
+{
+	uae_s64 rel = (uae_s64)t - (uae_s64)(uintptr)get_target();
+	return rel >= -(1 << 27) && rel < (1 << 27);
+}
+
+LOWFUNC(RMW,NONE,2,raw_adc_b,(RW1 d, RR1 s))
+{
+	arm64_adcsbc_bw(8, 0, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_adc_b,(RW1 d, RR1 s))
+
+LOWFUNC(RMW,NONE,2,raw_adc_w,(RW2 d, RR2 s))
+{
+	arm64_adcsbc_bw(16, 0, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_adc_w,(RW2 d, RR2 s))
+
+LOWFUNC(RMW,NONE,2,raw_adc_l,(RW4 d, RR4 s))
+{
+	arm64_adc(0, 0, 1, d, d, s);							// adcs w<d>, w<d>, w<s>
+}
+LENDFUNC(RMW,NONE,2,raw_adc_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_b,(RW1 d, RR1 s))
+{
+	arm64_addsub_bw(8, 0, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_w,(RW2 d, RR2 s))
+{
+	arm64_addsub_bw(16, 0, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_l,(RW4 d, RR4 s))
+{
+	arm64_addsub_rrr(0, 0, 1, d, d, s, ARM64_LSL, 0);		// adds w<d>, w<d>, w<s>
+}
+LENDFUNC(WRITE,NONE,2,raw_add_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_w_ri,(RW2 d, IMM i))
+{
+	arm64_mov_ri(ARM64_IP1, i);
+	arm64_addsub_bw(16, 0, d, ARM64_IP1);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_w_ri,(RW2 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_add_b_ri,(RW1 d, IMM i))
+{
+	arm64_mov_ri(ARM64_IP1, i);
+	arm64_addsub_bw(8, 0, d, ARM64_IP1);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_b_ri,(RW1 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_add_l_ri,(RW4 d, IMM i))
+{
+	arm64_add_ri(1, d, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_and_b,(RW1 d, RR1 s))
+{
+	arm64_logic_ri(ARM64_ORR, ARM64_IP0, s, 0xffffff00);	// orr  w16, w<s>, #0xffffff00
+	arm64_logic_rrr(0, ARM64_AND, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+	arm64_flags_nz(8, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_and_w,(RW2 d, RR2 s))
+{
+	arm64_logic_ri(ARM64_ORR, ARM64_IP0, s, 0xffff0000);	// orr  w16, w<s>, #0xffff0000
+	arm64_logic_rrr(0, ARM64_AND, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+	arm64_flags_nz(16, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_and_l,(RW4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_ANDS, 0, d, d, s, ARM64_LSL, 0);	// ands w<d>, w<d>, w<s>
+}
+LENDFUNC(WRITE,NONE,2,raw_and_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_and_l_ri,(RW4 d, IMM i))
+{
+	arm64_logic_ri(ARM64_ANDS, d, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_l_ri,(RW4 d, IMM i))
+
+/* d = index of the lowest set bit, Z set if s is 0, the other flags
+   are kept */
+LOWFUNC(WRITE,NONE,2,raw_bsf_l_rr,(W4 d, RR4 s))
+{
+	arm64_mrs_nzcv(ARM64_IP1);								// mrs  x17, nzcv
+	arm64_dp1(0, ARM64_RBIT, ARM64_IP0, s);					// rbit w16, w<s>
+	arm64_dp1(0, ARM64_CLZ, ARM64_IP0, ARM64_IP0);			// clz  w16, w16
+	arm64_logic_ri(ARM64_AND, ARM64_IP1, ARM64_IP1, ~ARM64_Z_FLAG);
+	arm64_cbz(1, s, 8);										// cbnz w<s>, <nonzero>
+	arm64_logic_ri(ARM64_ORR, ARM64_IP1, ARM64_IP1, ARM64_Z_FLAG);
+	//<nonzero>:
+	arm64_mov_rr(d, ARM64_IP0);
+	arm64_msr_nzcv(ARM64_IP1);								// msr  nzcv, x17
+}
+LENDFUNC(WRITE,NONE,2,raw_bsf_l_rr,(W4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,1,raw_bswap_16,(RW2 r))
+{
+	arm64_dp1(0, ARM64_REV16, ARM64_IP0, r);				// rev16 w16, w<r>
+	arm64_bfi(r, ARM64_IP0, 0, 16);
+}
+LENDFUNC(WRITE,NONE,1,raw_bswap_16,(RW2 r))
+
+LOWFUNC(NONE,NONE,1,raw_bswap_32,(RW4 r))
+{
+	arm64_dp1(0, ARM64_REV, r, r);							// rev  w<r>, w<r>
+}
+LENDFUNC(NONE,NONE,1,raw_bswap_32,(RW4 r))
+
+/* The bit tests put the bit into C and keep the other flags */
+STATIC_INLINE void arm64_bit_to_c(void)
+{
+	arm64_mrs_nzcv(ARM64_IP1);								// mrs  x17, nzcv
+	arm64_bfi(ARM64_IP1, ARM64_IP0, 29, 1);					// bfi  w17, w16, #29, #1
+	arm64_msr_nzcv(ARM64_IP1);								// msr  nzcv, x17
+}
+
+LOWFUNC(WRITE,NONE,2,raw_bt_l_ri,(RR4 r, IMM i))
+{
+	arm64_ubfx(ARM64_IP0, r, i & 31, 1);
+	arm64_bit_to_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_bt_l_ri,(RR4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_bt_l_rr,(RR4 r, RR4 b))
+{
+	arm64_dp2(0, ARM64_LSRV, ARM64_IP0, r, b);				// lsr  w16, w<r>, w<b>
+	arm64_bit_to_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_bt_l_rr,(RR4 r, RR4 b))
+
+/* Tests bit b of r, then applies op with neg to r and the bit mask */
+STATIC_INLINE void arm64_bt_op(int r, int b, int opc, int neg)
+{
+	arm64_dp2(0, ARM64_LSRV, ARM64_IP0, r, b);
+	arm64_bit_to_c();
+	arm64_movw(0, ARM64_MOVZ, ARM64_IP0, 1, 0);				// mov  w16, #1
+	arm64_dp2(0, ARM64_LSLV, ARM64_IP0, ARM64_IP0, b);		// lsl  w16, w16, w<b>
+	arm64_logic_rrr(0, opc, neg, r, r, ARM64_IP0, ARM64_LSL, 0);
+}
+
+LOWFUNC(WRITE,NONE,2,raw_btc_l_rr,(RW4 r, RR4 b))
+{
+	arm64_bt_op(r, b, ARM64_EOR, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_btc_l_rr,(RW4 r, RR4 b))
+
+LOWFUNC(WRITE,NONE,2,raw_btr_l_rr,(RW4 r, RR4 b))
+{
+	arm64_bt_op(r, b, ARM64_AND, 1);						// bic
+}
+LENDFUNC(WRITE,NONE,2,raw_btr_l_rr,(RW4 r, RR4 b))
+
+LOWFUNC(WRITE,NONE,2,raw_bts_l_rr,(RW4 r, RR4 b))
+{
+	arm64_bt_op(r, b, ARM64_ORR, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_bts_l_rr,(RW4 r, RR4 b))
+
+LOWFUNC(READ,NONE,3,raw_cmov_l_rr,(RW4 d, RR4 s, IMM cc))
+{
+	arm64_cmov(d, s, cc);
+}
+LENDFUNC(READ,NONE,3,raw_cmov_l_rr,(RW4 d, RR4 s, IMM cc))
+
+LOWFUNC(WRITE,NONE,2,raw_cmp_b,(RR1 d, RR1 s))
+{
+	arm64_lsl_ri(ARM64_IP0, d, 24);
+	arm64_addsub_rrr(0, 1, 1, ARM64_ZR, ARM64_IP0, s, ARM64_LSL, 24);	// cmp  w16, w<s>, lsl #24
+	arm64_invert_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_cmp_b,(RR1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_cmp_w,(RR2 d, RR2 s))
+{
+	arm64_lsl_ri(ARM64_IP0, d, 16);
+	arm64_addsub_rrr(0, 1, 1, ARM64_ZR, ARM64_IP0, s, ARM64_LSL, 16);	// cmp  w16, w<s>, lsl #16
+	arm64_invert_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_cmp_w,(RR2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_cmp_l,(RR4 d, RR4 s))
+{
+	arm64_addsub_rrr(0, 1, 1, ARM64_ZR, d, s, ARM64_LSL, 0);	// cmp  w<d>, w<s>
+	arm64_invert_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_cmp_l,(RR4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,raw_imul_32_32,(RW4 d, RR4 s))
+{
+	arm64_madd(0, d, d, s, ARM64_ZR);						// mul  w<d>, w<d>, w<s>
+}
+LENDFUNC(NONE,NONE,2,raw_imul_32_32,(RW4 d, RR4 s))
+
+/* x16 = the 64 bit product, low half to MUL_NREG1, high half to MUL_NREG2 */
+STATIC_INLINE void arm64_mul_64_32(int is_unsigned, int d, int s)
+{
+	arm64_mull(is_unsigned, ARM64_IP0, d, s);				// smull/umull x16, w<d>, w<s>
+	arm64_mov_rr(MUL_NREG1, ARM64_IP0);
+	arm64_bitfield(1, ARM64_UBFM, MUL_NREG2, ARM64_IP0, 32, 63);	// lsr  x1, x16, #32
+}
+
+LOWFUNC(NONE,NONE,2,raw_imul_64_32,(RW4 d, RW4 s))
+{
+	arm64_mul_64_32(0, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_imul_64_32,(RW4 d, RW4 s))
+
+LOWFUNC(NONE,NONE,3,raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+{
+	arm64_add_ri(0, d, s, offset);
+}
+LENDFUNC(NONE,NONE,3,raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,NONE,3,raw_lea_l_brr24,(W4 d, RR4 s, IMM offset))
+{
+	arm64_mask24(s);
+	arm64_add_ri(0, d, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,NONE,3,raw_lea_l_brr24,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,NONE,5,raw_lea_l_brr_indexed,(W4 d, RR4 s, RR4 index, IMM factor, IMM offset))
+{
+	arm64_addsub_rrr(0, 0, 0, ARM64_IP0, s, index, ARM64_LSL, arm64_scale(factor));
+	arm64_add_ri(0, d, ARM64_IP0, offset);
+}
+LENDFUNC(NONE,NONE,5,raw_lea_l_brr_indexed,(W4 d, RR4 s, RR4 index, IMM factor, IMM offset))
+
+LOWFUNC(NONE,NONE,4,raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+{
+	arm64_addsub_rrr(0, 0, 0, d, s, index, ARM64_LSL, arm64_scale(factor));
+}
+LENDFUNC(NONE,NONE,4,raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+
+LOWFUNC(NONE,READ,3,raw_mov_b_brR,(W1 d, RR4 s, IMM offset))
+{
+	arm64_load_natmem_bw(1, d, s, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_b_brR,(W1 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,READ,3,raw_mov_b_brR24,(W1 d, RR4 s, IMM offset))
+{
+	arm64_mask24(s);
+	arm64_load_natmem_bw(1, d, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,READ,3,raw_mov_b_brR24,(W1 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_b_bRr,(RR4 d, RR1 s, IMM offset))
+{
+	arm64_ldst_natmem(1, ARM64_STR, s, d, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_b_bRr,(RR4 d, RR1 s, IMM offset))
+
+LOWFUNC(WRITE,WRITE,3,raw_mov_b_bRr24,(RR4 d, RR1 s, IMM offset))
+{
+	arm64_mask24(d);
+	arm64_ldst_natmem(1, ARM64_STR, s, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,WRITE,3,raw_mov_b_bRr24,(RR4 d, RR1 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_b_mi,(MEMW d, IMM s))
+{
+	arm64_mov_ri(ARM64_IP1, s & 0xff);
+	arm64_store_m(1, ARM64_IP1, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_b_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, RR1 s))
+{
+	arm64_store_m(1, s, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, RR1 s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_b_ri,(W1 d, IMM s))
+{
+	arm64_mov_ri(ARM64_IP0, s & 0xff);
+	arm64_bfi(d, ARM64_IP0, 0, 8);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_b_ri,(W1 d, IMM s))
+
+LOWFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+{
+	arm64_load_m(1, ARM64_IP1, s);
+	arm64_bfi(d, ARM64_IP1, 0, 8);
+}
+LENDFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_b_rr,(W1 d, RR1 s))
+{
+	arm64_bfi(d, s, 0, 8);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_b_rr,(W1 d, RR1 s))
+
+LOWFUNC(NONE,READ,3,raw_mov_l_brR,(W4 d, RR4 s, IMM offset))
+{
+	arm64_ldst_natmem(4, ARM64_LDR, d, s, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_l_brR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,READ,3,raw_mov_l_brR24,(W4 d, RR4 s, IMM offset))
+{
+	arm64_mask24(s);
+	arm64_ldst_natmem(4, ARM64_LDR, d, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,READ,3,raw_mov_l_brR24,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_l_bRr,(RR4 d, RR4 s, IMM offset))
+{
+	arm64_ldst_natmem(4, ARM64_STR, s, d, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_l_bRr,(RR4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,WRITE,3,raw_mov_l_bRr24,(RR4 d, RR4 s, IMM offset))
+{
+	arm64_mask24(d);
+	arm64_ldst_natmem(4, ARM64_STR, s, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,WRITE,3,raw_mov_l_bRr24,(RR4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_l_mi,(MEMW d, IMM s))
+{
+	int lsb, h = arm64_home_reg(d, 4, &lsb);
+
+	if (h >= 0)
+		arm64_mov_ri(h, s);
+	else {
+		arm64_mov_ri(ARM64_IP1, s);
+		arm64_store_m(4, ARM64_IP1, d);
+	}
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_l_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,READ,3,raw_mov_w_brR,(W2 d, RR4 s, IMM offset))
+{
+	arm64_load_natmem_bw(2, d, s, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_w_brR,(W2 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,READ,3,raw_mov_w_brR24,(W2 d, RR4 s, IMM offset))
+{
+	arm64_mask24(s);
+	arm64_load_natmem_bw(2, d, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,READ,3,raw_mov_w_brR24,(W2 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_w_bRr,(RR4 d, RR2 s, IMM offset))
+{
+	arm64_ldst_natmem(2, ARM64_STR, s, d, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_w_bRr,(RR4 d, RR2 s, IMM offset))
+
+LOWFUNC(WRITE,WRITE,3,raw_mov_w_bRr24,(RR4 d, RR2 s, IMM offset))
+{
+	arm64_mask24(d);
+	arm64_ldst_natmem(2, ARM64_STR, s, ARM64_IP1, offset);
+}
+LENDFUNC(WRITE,WRITE,3,raw_mov_w_bRr24,(RR4 d, RR2 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, RR2 s))
+{
+	arm64_store_m(2, s, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, RR2 s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_w_ri,(W2 d, IMM s))
+{
+	arm64_movw(0, ARM64_MOVK, d, s, 0);						// movk w<d>, #s
+}
+LENDFUNC(NONE,NONE,2,raw_mov_w_ri,(W2 d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_w_mi,(MEMW d, IMM s))
+{
+	arm64_mov_ri(ARM64_IP1, s & 0xffff);
+	arm64_store_m(2, ARM64_IP1, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_w_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, RR4 s))
+{
+	arm64_store_m(4, s, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, RR4 s))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_w_Ri,(RR4 d, IMM i, IMM offset))
+{
+	arm64_mov_ri(ARM64_IP1, i & 0xffff);
+	arm64_ldst_off(2, ARM64_STR, ARM64_IP1, d, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_w_Ri,(RR4 d, IMM i, IMM offset))
+
+LOWFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+{
+	arm64_load_m(2, ARM64_IP1, s);
+	arm64_bfi(d, ARM64_IP1, 0, 16);
+}
+LENDFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_w_rr,(W2 d, RR2 s))
+{
+	arm64_bfi(d, s, 0, 16);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_w_rr,(W2 d, RR2 s))
+
+LOWFUNC(NONE,READ,3,raw_mov_w_rR,(W2 d, RR4 s, IMM offset))
+{
+	arm64_ldst_off(2, ARM64_LDR, ARM64_IP1, s, offset);
+	arm64_bfi(d, ARM64_IP1, 0, 16);
+}
+LENDFUNC(NONE,READ,3,raw_mov_w_rR,(W2 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_w_Rr,(RR4 d, RR2 s, IMM offset))
+{
+	arm64_ldst_off(2, ARM64_STR, s, d, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_w_Rr,(RR4 d, RR2 s, IMM offset))
+
+LOWFUNC(NONE,READ,2,raw_mov_l_rm,(W4 d, MEMR s))
+{
+	arm64_load_m(4, d, s);
+}
+LENDFUNC(NONE,READ,2,raw_mov_l_rm,(W4 d, MEMR s))
+
+/* Only used on tables, never on regs.regs[] */
+LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, RR4 index, IMM factor))
+{
+	int lsb;
+
+	if (arm64_home_reg(base, 4, &lsb) >= 0)
+		arm64_emit_failure("indexed access to the 68k registers");
+	arm64_mov_ri(ARM64_IP0, base);
+	arm64_addsub_ext(1, 0, 0, ARM64_IP0, ARM64_IP0, index, ARM64_UXTW, arm64_scale(factor));	// add  x16, x16, w<index>, uxtw #s
+	arm64_ldst_uimm(2, ARM64_LDR, d, ARM64_IP0, 0);
+}
+LENDFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, RR4 index, IMM factor))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_l_Ri,(RR4 d, IMM i, IMM offset8))
+{
+	arm64_mov_ri(ARM64_IP1, i);
+	arm64_ldst_off(4, ARM64_STR, ARM64_IP1, d, offset8);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_l_Ri,(RR4 d, IMM i, IMM offset8))
+
+LOWFUNC(NONE,READ,3,raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+{
+	arm64_ldst_off(4, ARM64_LDR, d, s, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, RR4 s))
+{
+	arm64_mov_rr(d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, RR4 s))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_l_Rr,(RR4 d, RR4 s, IMM offset))
+{
+	arm64_ldst_off(4, ARM64_STR, s, d, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_l_Rr,(RR4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,NONE,2,raw_mul_64_32,(RW4 d, RW4 s))
+{
+	arm64_mul_64_32(1, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_mul_64_32,(RW4 d, RW4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_b,(RW1 d, RR1 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xff);
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+	arm64_flags_nz(8, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_w,(RW2 d, RR2 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xffff);
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+	arm64_flags_nz(16, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_l,(RW4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, d, s, ARM64_LSL, 0);
+	arm64_flags_nz(32, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_l_ri,(RW4 d, IMM i))
+{
+	arm64_logic_ri(ARM64_ORR, d, d, i);
+	arm64_flags_nz(32, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_l_ri,(RW4 d, IMM i))
+
+/* gencomp sets the flags of rotates and shifts with test and bt_l_ri
+   afterwards, the native flags are left alone */
+LOWFUNC(WRITE,NONE,2,raw_rol_b_ri,(RW1 r, IMM i))
+{
+	arm64_ror_bw_ri(8, r, 32 - (i & 31));
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_b_rr,(RW1 d, RR1 r))
+{
+	arm64_ror_bw_rr(8, d, r, 1);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_w_ri,(RW2 r, IMM i))
+{
+	arm64_ror_bw_ri(16, r, 32 - (i & 31));
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_w_rr,(RW2 d, RR1 r))
+{
+	arm64_ror_bw_rr(16, d, r, 1);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_l_ri,(RW4 r, IMM i))
+{
+	arm64_extr(0, r, r, r, (32 - (i & 31)) & 31);			// ror  w<r>, w<r>, #32-i
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_l_ri,(RW4 r, IMM i))
+{
+	arm64_extr(0, r, r, r, i & 31);							// ror  w<r>, w<r>, #i
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_l_rr,(RW4 d, RR1 r))
+{
+	arm64_addsub_rrr(0, 1, 0, ARM64_IP1, ARM64_ZR, r, ARM64_LSL, 0);	// neg  w17, w<r>
+	arm64_dp2(0, ARM64_RORV, d, d, ARM64_IP1);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_l_rr,(RW4 d, RR1 r))
+{
+	arm64_dp2(0, ARM64_RORV, d, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_b_ri,(RW1 r, IMM i))
+{
+	arm64_ror_bw_ri(8, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_b_rr,(RW1 d, RR1 r))
+{
+	arm64_ror_bw_rr(8, d, r, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_w_ri,(RW2 r, IMM i))
+{
+	arm64_ror_bw_ri(16, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_w_rr,(RW2 d, RR1 r))
+{
+	arm64_ror_bw_rr(16, d, r, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(RMW,NONE,2,raw_sbb_b,(RW1 d, RR1 s))
+{
+	arm64_adcsbc_bw(8, 1, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_sbb_b,(RW1 d, RR1 s))
+
+LOWFUNC(RMW,NONE,2,raw_sbb_l,(RW4 d, RR4 s))
+{
+	arm64_invert_c();
+	arm64_adc(0, 1, 1, d, d, s);							// sbcs w<d>, w<d>, w<s>
+	arm64_invert_c();
+}
+LENDFUNC(RMW,NONE,2,raw_sbb_l,(RW4 d, RR4 s))
+
+LOWFUNC(RMW,NONE,2,raw_sbb_w,(RW2 d, RR2 s))
+{
+	arm64_adcsbc_bw(16, 1, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_sbb_w,(RW2 d, RR2 s))
+
+LOWFUNC(READ,NONE,2,raw_setcc,(W1 d, IMM cc))
+{
+	arm64_cset(d, cc);
+}
+LENDFUNC(READ,NONE,2,raw_setcc,(W1 d, IMM cc))
+
+LOWFUNC(READ,WRITE,2,raw_setcc_m,(MEMW d, IMM cc))
+{
+	arm64_cset(ARM64_IP1, cc);
+	arm64_store_m(1, ARM64_IP1, d);
+}
+LENDFUNC(READ,WRITE,2,raw_setcc_m,(MEMW d, IMM cc))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_b_ri,(RW1 r, IMM i))
+{
+	arm64_shift_bw_ri(8, ARM64_LSLV, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_b_rr,(RW1 d, RR1 r))
+{
+	arm64_shift_bw_rr(8, ARM64_LSLV, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_l_ri,(RW4 r, IMM i))
+{
+	arm64_lsl_ri(r, r, i & 31);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_l_rr,(RW4 d, RR1 r))
+{
+	arm64_dp2(0, ARM64_LSLV, d, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_w_ri,(RW2 r, IMM i))
+{
+	arm64_shift_bw_ri(16, ARM64_LSLV, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_w_rr,(RW2 d, RR1 r))
+{
+	arm64_shift_bw_rr(16, ARM64_LSLV, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_b_ri,(RW1 r, IMM i))
+{
+	arm64_shift_bw_ri(8, ARM64_ASRV, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_b_rr,(RW1 d, RR1 r))
+{
+	arm64_shift_bw_rr(8, ARM64_ASRV, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_w_ri,(RW2 r, IMM i))
+{
+	arm64_shift_bw_ri(16, ARM64_ASRV, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_w_rr,(RW2 d, RR1 r))
+{
+	arm64_shift_bw_rr(16, ARM64_ASRV, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_l_ri,(RW4 r, IMM i))
+{
+	arm64_bitfield(0, ARM64_SBFM, r, r, i & 31, 31);		// asr  w<r>, w<r>, #i
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_l_rr,(RW4 d, RR1 r))
+{
+	arm64_dp2(0, ARM64_ASRV, d, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_b_ri,(RW1 r, IMM i))
+{
+	arm64_shift_bw_ri(8, ARM64_LSRV, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_b_rr,(RW1 d, RR1 r))
+{
+	arm64_shift_bw_rr(8, ARM64_LSRV, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_l_ri,(RW4 r, IMM i))
+{
+	arm64_bitfield(0, ARM64_UBFM, r, r, i & 31, 31);		// lsr  w<r>, w<r>, #i
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_w_ri,(RW2 r, IMM i))
+{
+	arm64_shift_bw_ri(16, ARM64_LSRV, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_w_rr,(RW2 d, RR1 r))
+{
+	arm64_shift_bw_rr(16, ARM64_LSRV, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_l_rr,(RW4 d, RR1 r))
+{
+	arm64_dp2(0, ARM64_LSRV, d, d, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_b,(RW1 d, RR1 s))
+{
+	arm64_addsub_bw(8, 1, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_b_ri,(RW1 d, IMM i))
+{
+	arm64_mov_ri(ARM64_IP1, i);
+	arm64_addsub_bw(8, 1, d, ARM64_IP1);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_b_ri,(RW1 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_l,(RW4 d, RR4 s))
+{
+	arm64_addsub_rrr(0, 1, 1, d, d, s, ARM64_LSL, 0);		// subs w<d>, w<d>, w<s>
+	arm64_invert_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_l_ri,(RW4 d, IMM i))
+{
+	if (i >= 0 && i < 4096)
+		arm64_addsub_imm(0, 1, 1, d, d, i, 0);				// subs w<d>, w<d>, #i
+	else {
+		arm64_mov_ri(ARM64_IP1, i);
+		arm64_addsub_rrr(0, 1, 1, d, d, ARM64_IP1, ARM64_LSL, 0);
+	}
+	arm64_invert_c();
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_w,(RW2 d, RR2 s))
+{
+	arm64_addsub_bw(16, 1, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_w_ri,(RW2 d, IMM i))
+{
+	arm64_mov_ri(ARM64_IP1, i);
+	arm64_addsub_bw(16, 1, d, ARM64_IP1);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_w_ri,(RW2 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_test_b_rr,(RR1 d, RR1 s))
+{
+	arm64_lsl_ri(ARM64_IP0, d, 24);
+	arm64_logic_rrr(0, ARM64_ANDS, 0, ARM64_ZR, ARM64_IP0, s, ARM64_LSL, 24);	// tst  w16, w<s>, lsl #24
+}
+LENDFUNC(WRITE,NONE,2,raw_test_b_rr,(RR1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_test_l_ri,(RR4 d, IMM i))
+{
+	arm64_logic_ri(ARM64_ANDS, ARM64_ZR, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_test_l_ri,(RR4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_test_l_rr,(RR4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_ANDS, 0, ARM64_ZR, d, s, ARM64_LSL, 0);	// tst  w<d>, w<s>
+}
+LENDFUNC(WRITE,NONE,2,raw_test_l_rr,(RR4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_test_w_rr,(RR2 d, RR2 s))
+{
+	arm64_lsl_ri(ARM64_IP0, d, 16);
+	arm64_logic_rrr(0, ARM64_ANDS, 0, ARM64_ZR, ARM64_IP0, s, ARM64_LSL, 16);	// tst  w16, w<s>, lsl #16
+}
+LENDFUNC(WRITE,NONE,2,raw_test_w_rr,(RR2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_xor_b,(RW1 d, RR1 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xff);
+	arm64_logic_rrr(0, ARM64_EOR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+	arm64_flags_nz(8, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_xor_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_xor_w,(RW2 d, RR2 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xffff);
+	arm64_logic_rrr(0, ARM64_EOR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+	arm64_flags_nz(16, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_xor_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_xor_l,(RW4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_EOR, 0, d, d, s, ARM64_LSL, 0);
+	arm64_flags_nz(32, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_xor_l,(RW4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,raw_sign_extend_16_rr,(W4 d, RR2 s))
+{
+	arm64_bitfield(0, ARM64_SBFM, d, s, 0, 15);				// sxth w<d>, w<s>
+}
+LENDFUNC(NONE,NONE,2,raw_sign_extend_16_rr,(W4 d, RR2 s))
+
+LOWFUNC(NONE,NONE,2,raw_sign_extend_8_rr,(W4 d, RR1 s))
+{
+	arm64_bitfield(0, ARM64_SBFM, d, s, 0, 7);				// sxtb w<d>, w<s>
+}
+LENDFUNC(NONE,NONE,2,raw_sign_extend_8_rr,(W4 d, RR1 s))
+
+LOWFUNC(NONE,NONE,2,raw_zero_extend_8_rr,(W4 d, RR1 s))
+{
+	arm64_bitfield(0, ARM64_UBFM, d, s, 0, 7);				// uxtb w<d>, w<s>
+}
+LENDFUNC(NONE,NONE,2,raw_zero_extend_8_rr,(W4 d, RR1 s))
+
+LOWFUNC(NONE,NONE,2,raw_zero_extend_16_rr,(W4 d, RR2 s))
+{
+	arm64_bitfield(0, ARM64_UBFM, d, s, 0, 15);				// uxth w<d>, w<s>
+}
+LENDFUNC(NONE,NONE,2,raw_zero_extend_16_rr,(W4 d, RR2 s))
+
+static inline void raw_dec_sp(int off)
+{
+	if (off)
+		arm64_addsub_imm(1, 1, 0, ARM64_SP, ARM64_SP, off, 0);	// sub  sp, sp, #off
+}
+
+static inline void raw_inc_sp(int off)
+{
+	if (off)
+		arm64_addsub_imm(1, 0, 0, ARM64_SP, ARM64_SP, off, 0);	// add  sp, sp, #off
+}
+
+/* The homes go to regs.regs[] before anything outside the generated code
+   runs, and are loaded from there when it is entered again */
+static inline void arm64_homes_to_mem(int load)
+{
+	arm64_mov_ri(ARM64_IP0, (uintptr)&regs.regs[0]);
+	for (int i = 0; i < 16; i += 2)
+		arm64_ldstp(0, load, ARM64_OFFSET, arm64_home[i], arm64_home[i + 1], ARM64_IP0, i);	// stp/ldp w<a>, w<b>, [x16, #4*i]
+}
+
+/* Entering the generated code from C. Saves x19-x30, then loads the homes. */
+static inline void raw_push_regs_to_preserve(void) {
+	arm64_ldstp(1, 0, ARM64_PRE, 29, 30, ARM64_SP, -12);	// stp  x29, x30, [sp, #-96]!
+	for (int i = 0; i < 5; i++)
+		arm64_ldstp(1, 0, ARM64_OFFSET, 19 + 2 * i, 20 + 2 * i, ARM64_SP, 2 + 2 * i);
+	arm64_homes_to_mem(1);
+}
+
+static inline void raw_pop_preserved_regs(void) {
+	arm64_homes_to_mem(0);
+	for (int i = 4; i >= 0; i--)
+		arm64_ldstp(1, 1, ARM64_OFFSET, 19 + 2 * i, 20 + 2 * i, ARM64_SP, 2 + 2 * i);
+	arm64_ldstp(1, 1, ARM64_POST, 29, 30, ARM64_SP, 12);	// ldp  x29, x30, [sp], #96
+}
+
+/* FLAGX is byte sized, and we *do* write it at that size */
+static inline void raw_load_flagx(uae_u32 t, uae_u32 r)
+{
+	raw_mov_l_rm(t,(uintptr)live.state[r].mem);
+}
+
+static inline void raw_flags_evicted(int r)
+{
+  live.state[FLAGTMP].status=INMEM;
+  live.state[FLAGTMP].realreg=-1;
+  /* We just "evicted" FLAGTMP. */
+  if (live.nat[r].nholds!=1) {
+      /* Huh? */
+      abort();
+  }
+  live.nat[r].nholds=0;
+}
+
+static inline void raw_flags_init(void) {
+}
+
+static __inline__ void raw_flags_set_zero(int s, int tmp)
+{
+	raw_mov_l_rr(tmp,s);
+	arm64_mrs_nzcv(s);
+	arm64_logic_ri(ARM64_AND, s, s, ~ARM64_Z_FLAG);
+	arm64_logic_ri(ARM64_AND, tmp, tmp, ARM64_Z_FLAG);
+	arm64_logic_ri(ARM64_EOR, tmp, tmp, ARM64_Z_FLAG);
+	arm64_logic_rrr(0, ARM64_ORR, 0, s, s, tmp, ARM64_LSL, 0);
+	arm64_msr_nzcv(s);
+}
+
+/* NZCV has the layout of regs.ccrflags.nzcv, see md-pandora/m68k.h */
+static inline void raw_flags_to_reg(int r)
+{
+	arm64_mrs_nzcv(r);
+	raw_mov_l_mr((uintptr)live.state[FLAGTMP].mem,r);
+	raw_flags_evicted(r);
+}
+
+static inline void raw_reg_to_flags(int r)
+{
+	arm64_msr_nzcv(r);
+}
+
+/* Apparently, there are enough instructions between flag store and
+   flag reload to avoid the partial memory stall */
+static inline void raw_load_flagreg(uae_u32 t, uae_u32 r)
+{
+	raw_mov_l_rm(t,(uintptr)live.state[r].mem);
+}
+
+/* MRS and MSR work with any register */
+#define FLAG_NREG1 -1
+#define FLAG_NREG2 -1
+#define FLAG_NREG3 -1
+
+static inline void raw_emit_nop_filler(int nbytes)
+{
+	for (; nbytes > 0; nbytes -= 4)
+		_L(ARM64_NOP);
+}
+
+static inline void raw_emit_nop(void)
+{
+	_L(ARM64_NOP);
+}
+
+/* There is no bsf, raw_bsf_l_rr() sets Z itself */
+static bool target_check_bsf(void)
+{
+	return false;
+}
+
+static void raw_init_cpu(void)
+{
+	/* CSEL does what cmov does */
+	have_cmov = true;
+	have_rat_stall = false;
+
+	align_loops = 0;
+	align_jumps = 0;
+
+	raw_flags_init();
+}
+
+//
+// Arm instructions
+//
+LOWFUNC(WRITE,NONE,2,raw_ADD_l_rr,(RW4 d, RR4 s))
+{
+	arm64_addsub_rrr(0, 0, 0, d, d, s, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_ADD_l_rr,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_ADD_l_rri,(RW4 d, RR4 s, IMM i))
+{
+	arm64_add_ri(0, d, s, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_ADD_l_rri,(RW4 d, RR4 s, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_SUB_l_rri,(RW4 d, RR4 s, IMM i))
+{
+	arm64_add_ri(0, d, s, -i);
+}
+LENDFUNC(WRITE,NONE,2,raw_SUB_l_rri,(RW4 d, RR4 s, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_AND_b_rr,(RW1 d, RR1 s))
+{
+	arm64_logic_ri(ARM64_ORR, ARM64_IP0, s, 0xffffff00);
+	arm64_logic_rrr(0, ARM64_AND, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_AND_b_rr,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_AND_l_rr,(RW4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_AND, 0, d, d, s, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_AND_l_rr,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_AND_l_ri,(RW4 d, IMM i))
+{
+	arm64_logic_ri(ARM64_AND, d, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_AND_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_AND_w_rr,(RW2 d, RR2 s))
+{
+	arm64_logic_ri(ARM64_ORR, ARM64_IP0, s, 0xffff0000);
+	arm64_logic_rrr(0, ARM64_AND, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_AND_w_rr,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_EOR_b_rr,(RW1 d, RR1 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xff);
+	arm64_logic_rrr(0, ARM64_EOR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_EOR_b_rr,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_EOR_l_rr,(RW4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_EOR, 0, d, d, s, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_EOR_l_rr,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_EOR_w_rr,(RW2 d, RR2 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xffff);
+	arm64_logic_rrr(0, ARM64_EOR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_EOR_w_rr,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_LDR_l_ri,(RW4 d, IMM i))
+{
+	arm64_mov_ri(d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_LDR_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ORR_b_rr,(RW1 d, RR1 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xff);
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_ORR_b_rr,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_ORR_l_rr,(RW4 d, RR4 s))
+{
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, d, s, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_ORR_l_rr,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_ORR_w_rr,(RW2 d, RR2 s))
+{
+	arm64_logic_ri(ARM64_AND, ARM64_IP0, s, 0xffff);
+	arm64_logic_rrr(0, ARM64_ORR, 0, d, d, ARM64_IP0, ARM64_LSL, 0);
+}
+LENDFUNC(WRITE,NONE,2,raw_ORR_w_rr,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_ROR_l_ri,(RW4 r, IMM i))
+{
+	arm64_extr(0, r, r, r, i & 31);
+}
+LENDFUNC(WRITE,NONE,2,raw_ROR_l_ri,(RW4 r, IMM i))
+
+//
+// compuemu_support used raw calls
+//
+LOWFUNC(WRITE,RMW,2,compemu_raw_add_l_mi,(IMM d, IMM s))
+{
+	int lsb, h = arm64_home_reg(d, 4, &lsb);
+
+	if (h >= 0)
+		arm64_add_ri(0, h, h, s);
+	else {
+		arm64_mov_ri(ARM64_IP0, d);
+		arm64_ldst_uimm(2, ARM64_LDR, REG_WORK1, ARM64_IP0, 0);
+		arm64_add_ri(0, REG_WORK1, REG_WORK1, s);
+		arm64_ldst_uimm(2, ARM64_STR, REG_WORK1, ARM64_IP0, 0);
+	}
+}
+LENDFUNC(WRITE,RMW,2,compemu_raw_add_l_mi,(IMM d, IMM s))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_and_l_ri,(RW4 d, IMM i))
+{
+	arm64_logic_ri(ARM64_AND, d, d, i);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_and_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(NONE,NONE,1,compemu_raw_bswap_32,(RW4 r))
+{
+	raw_bswap_32(r);
+}
+LENDFUNC(NONE,NONE,1,compemu_raw_bswap_32,(RW4 r))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_bt_l_ri,(RR4 r, IMM i))
+{
+	raw_bt_l_ri(r, i);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_bt_l_ri,(RR4 r, IMM i))
+
+/* The table holds 64 bit pointers into the low 2 GB, the low half is
+   loaded */
+LOWFUNC(NONE,READ,5,compemu_raw_cmov_l_rm_indexed,(W4 d, IMM base, RR4 index, IMM factor, IMM cond))
+{
+	arm64_mov_ri(ARM64_IP0, base);
+	arm64_addsub_ext(1, 0, 0, ARM64_IP0, ARM64_IP0, index, ARM64_UXTW, arm64_scale(factor));
+	arm64_ldst_uimm(2, ARM64_LDR, ARM64_IP0, ARM64_IP0, 0);	// ldr  w16, [x16]
+	arm64_cmov(d, ARM64_IP0, cond);
+}
+LENDFUNC(NONE,READ,5,compemu_raw_cmov_l_rm_indexed,(W4 d, IMM base, RR4 index, IMM factor, IMM cond))
+
+/* x86 semantics, C is the borrow */
+STATIC_INLINE void arm64_cmp_l_mi(uintptr d, uae_s32 s)
+{
+	arm64_load_m(4, REG_WORK1, d);
+	arm64_mov_ri(ARM64_IP1, s);
+	arm64_addsub_rrr(0, 1, 1, ARM64_ZR, REG_WORK1, ARM64_IP1, ARM64_LSL, 0);	// cmp  w2, w17
+	arm64_invert_c();
+}
+
+LOWFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi,(MEMR d, IMM s))
+{
+	arm64_cmp_l_mi(d, s);
+}
+LENDFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi,(MEMR d, IMM s))
+
+LOWFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi8,(MEMR d, IMM s))
+{
+	arm64_cmp_l_mi(d, s);
+}
+LENDFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi8,(MEMR d, IMM s))
+
+LOWFUNC(NONE,NONE,3,compemu_raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+{
+	arm64_add_ri(0, d, s, offset);
+}
+LENDFUNC(NONE,NONE,3,compemu_raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,READ,3,compemu_raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+{
+	arm64_ldst_off(4, ARM64_LDR, d, s, offset);
+}
+LENDFUNC(NONE,READ,3,compemu_raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_cmp_l_rr,(RR4 d, RR4 s))
+{
+	raw_cmp_l(d, s);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_cmp_l_rr,(RR4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,4,compemu_raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+{
+	arm64_addsub_rrr(0, 0, 0, d, s, index, ARM64_LSL, arm64_scale(factor));
+}
+LENDFUNC(NONE,NONE,4,compemu_raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_b_mr,(IMM d, RR1 s))
+{
+	arm64_store_m(1, s, d);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_b_mr,(IMM d, RR1 s))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_l_mi,(MEMW d, IMM s))
+{
+	raw_mov_l_mi(d, s);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_l_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_l_mr,(IMM d, RR4 s))
+{
+	arm64_store_m(4, s, d);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_l_mr,(IMM d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,compemu_raw_mov_l_ri,(W4 d, IMM s))
+{
+	arm64_mov_ri(d, s);
+}
+LENDFUNC(NONE,NONE,2,compemu_raw_mov_l_ri,(W4 d, IMM s))
+
+LOWFUNC(NONE,READ,2,compemu_raw_mov_l_rm,(W4 d, MEMR s))
+{
+	arm64_load_m(4, d, s);
+}
+LENDFUNC(NONE,READ,2,compemu_raw_mov_l_rm,(W4 d, MEMR s))
+
+LOWFUNC(NONE,NONE,2,compemu_raw_mov_l_rr,(W4 d, RR4 s))
+{
+	arm64_mov_rr(d, s);
+}
+LENDFUNC(NONE,NONE,2,compemu_raw_mov_l_rr,(W4 d, RR4 s))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_w_mr,(IMM d, RR2 s))
+{
+	arm64_store_m(2, s, d);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_w_mr,(IMM d, RR2 s))
+
+/* Sets N and V the way x86 does, the countdown checks test MI and LT */
+LOWFUNC(WRITE,RMW,2,compemu_raw_sub_l_mi,(MEMRW d, IMM s))
+{
+	int lsb, h = arm64_home_reg(d, 4, &lsb);
+
+	if (h >= 0)
+		raw_sub_l_ri(h, s);
+	else {
+		arm64_mov_ri(ARM64_IP0, d);
+		arm64_ldst_uimm(2, ARM64_LDR, REG_WORK1, ARM64_IP0, 0);
+		raw_sub_l_ri(REG_WORK1, s);
+		arm64_ldst_uimm(2, ARM64_STR, REG_WORK1, ARM64_IP0, 0);
+	}
+}
+LENDFUNC(WRITE,RMW,2,compemu_raw_sub_l_mi,(MEMRW d, IMM s))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_test_l_rr,(RR4 d, RR4 s))
+{
+	raw_test_l_rr(d, s);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_test_l_rr,(RR4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,compemu_raw_zero_extend_16_rr,(W4 d, RR2 s))
+{
+	raw_zero_extend_16_rr(d, s);
+}
+LENDFUNC(NONE,NONE,2,compemu_raw_zero_extend_16_rr,(W4 d, RR2 s))
+
+/* The C function sees the 68k registers in regs.regs[] and may change
+   them there */
+static inline void compemu_raw_call(uintptr t)
+{
+	arm64_homes_to_mem(0);
+	arm64_mov_ri(ARM64_IP0, t);
+	arm64_blr(ARM64_IP0);									// blr  x16
+	arm64_homes_to_mem(1);
+}
+
+static inline void compemu_raw_call_r(RR4 r)
+{
+	arm64_homes_to_mem(0);
+	arm64_blr(r);											// blr  x<r>
+	arm64_homes_to_mem(1);
+}
+
+/* Only the branch, the caller emits the 32 bit absolute target, see
+   write_jmp_target() */
+static inline void compemu_raw_jcc_l_oponly(int cc)
+{
+	switch (cc) {
+	case NATIVE_CC_HI:	// !C && !Z
+		arm64_bcc(NATIVE_CC_EQ, 20);						// b.eq <continue>
+		arm64_bcc(NATIVE_CC_CS, 16);						// b.cs <continue>
+		break;
+	case NATIVE_CC_LS:	// C || Z
+		arm64_bcc(NATIVE_CC_EQ, 8);							// b.eq <jump>
+		arm64_bcc(NATIVE_CC_CC, 16);						// b.cc <continue>
+		break;
+	default:
+		arm64_bcc(cc ^ 1, 16);								// b.!cc <continue>
+		break;
+	}
+	//<jump>:
+	arm64_ldr_lit(ARM64_IP0, 8);							// ldr  w16, <target>
+	arm64_br(ARM64_IP0);									// br   x16
+	//<target>:
+	//<continue>:
+}
+
+static inline void compemu_raw_jmp(uintptr t)
+{
+	if (arm64_in_b26(t))
+		arm64_b(t - (uintptr)get_target());
+	else {
+		arm64_ldr_lit(ARM64_IP0, 8);						// ldr  w16, <target>
+		arm64_br(ARM64_IP0);								// br   x16
+		_L(t);
+	}
+}
+
+STATIC_INLINE void arm64_jcc_l(int cc, uintptr t)
+{
+	compemu_raw_jcc_l_oponly(cc);
+	_L(t);
+}
+
+static inline void compemu_raw_jl(uintptr t)
+{
+	arm64_jcc_l(NATIVE_CC_LT, t);
+}
+
+/* The table holds 64 bit pointers, the whole entry is loaded */
+static inline void compemu_raw_jmp_m_indexed(uintptr base, uae_u32 r, uae_u32 m)
+{
+	arm64_mov_ri(ARM64_IP0, base);
+	arm64_addsub_ext(1, 0, 0, ARM64_IP0, ARM64_IP0, r, ARM64_UXTW, arm64_scale(m));	// add  x16, x16, w<r>, uxtw #s
+	arm64_ldst_uimm(3, ARM64_LDR, ARM64_IP0, ARM64_IP0, 0);	// ldr  x16, [x16]
+	arm64_br(ARM64_IP0);									// br   x16
+}
+
+static inline void compemu_raw_jmp_r(RR4 r)
+{
+	arm64_br(r);											// br   x<r>
+}
+
+static inline void compemu_raw_jnz(uintptr t)
+{
+	arm64_jcc_l(NATIVE_CC_NE, t);
+}
+
+/* Only the branch, the caller emits the displacement byte, counted from
+   the byte itself less one, i.e. from the end of the 24 byte sequence */
+static inline void compemu_raw_jz_b_oponly(void)
+{
+	arm64_bcc(NATIVE_CC_NE, 24);							// b.ne <continue>
+	arm64_adr(ARM64_IP0, 20);								// adr  x16, <continue>
+	arm64_ldst_simm(0, ARM64_LDRS, ARM64_IP1, ARM64_IP0, -1);	// ldursb x17, [x16, #-1]
+	arm64_addsub_rrr(1, 0, 0, ARM64_IP0, ARM64_IP0, ARM64_IP1, ARM64_LSL, 0);	// add  x16, x16, x17
+	arm64_br(ARM64_IP0);									// br   x16
+	emit_byte(0);
+	emit_byte(0);
+	emit_byte(0);
+	//<displacement>:
+	//<continue>:
+}
@@ -0,0 +1,310 @@
+/*
+ * compiler/codegen_arm64.h - AArch64 code generator
+ *
+ * JIT compiler m68k -> AArch64
+ *
+ * Original 68040 JIT compiler for UAE, copyright 2000-2002 Bernd Meyer
+ * This file is derived from CCG, copyright 1999-2003 Ian Piumarta
+ * Adaptation for Basilisk II and improvements, copyright 2000-2004 Gwenole Beauchesne
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ARM64_RTASM_H
+#define ARM64_RTASM_H
+
+/* NOTES
+ *
+ *	- All integer operations are done on the 32 bit W registers. A write
+ *	  to a W register clears the upper half of the X register, so
+ *	  registers used as base or index in an address always hold a zero
+ *	  extended value.
+ *	- Absolute addresses are 32 bit values. Everything the generated code
+ *	  addresses that way (the emulator's globals, the translation cache,
+ *	  the blockinfos and the Amiga memory) lives in the low 2 GB, see
+ *	  jit_mmap_low().
+ *	- The condition field of B.cond and CSEL uses the same numbers as
+ *	  32 bit ARM, so flags_arm.h is shared.
+ */
+
+/* --- Configuration ------------------------------------------------------- */
+
+/* Bits of NZCV, as read by MRS */
+
+#define ARM64_N_FLAG      0x80000000
+#define ARM64_Z_FLAG      0x40000000
+#define ARM64_C_FLAG      0x20000000
+#define ARM64_V_FLAG      0x10000000
+
+/* --- Macros -------------------------------------------------------------- */
+
+/* ========================================================================= */
+/* --- UTILITY ------------------------------------------------------------- */
+/* ========================================================================= */
+
+/* Register 31 is the zero register in data processing instructions and
+   the stack pointer as the base of a load or store */
+#define ARM64_ZR		31
+#define ARM64_SP		31
+
+/* The intra-procedure-call scratch registers, never handed out */
+#define ARM64_IP0		16
+#define ARM64_IP1		17
+
+#define _L(c) emit_long(c)
+
+/* ========================================================================= */
+/* --- ENCODINGS ----------------------------------------------------------- */
+/* ========================================================================= */
+
+/* sf selects the 32 bit (0) or the 64 bit (1) form */
+
+/* Shift types of the shifted register forms */
+#define ARM64_LSL		0
+#define ARM64_LSR		1
+#define ARM64_ASR		2
+#define ARM64_ROR		3
+
+/* ADD, ADDS, SUB, SUBS d, n, m <shift> #amount */
+STATIC_INLINE void arm64_addsub_rrr(int sf, int sub, int s, int d, int n, int m, int shift, int amount)
+{
+	_L(0x0b000000 | (sf << 31) | (sub << 30) | (s << 29) | (shift << 22) | (m << 16) | (amount << 10) | (n << 5) | d);
+}
+
+/* Extend types of the extended register forms */
+#define ARM64_UXTW		2
+#define ARM64_UXTX		3
+
+/* ADD, ADDS, SUB, SUBS d, n, m <extend> #amount, n and d may be SP */
+STATIC_INLINE void arm64_addsub_ext(int sf, int sub, int s, int d, int n, int m, int option, int amount)
+{
+	_L(0x0b200000 | (sf << 31) | (sub << 30) | (s << 29) | (m << 16) | (option << 13) | (amount << 10) | (n << 5) | d);
+}
+
+/* ADD, ADDS, SUB, SUBS d, n, #imm12 {, lsl #12}, n and d may be SP */
+STATIC_INLINE void arm64_addsub_imm(int sf, int sub, int s, int d, int n, int imm12, int lsl12)
+{
+	_L(0x11000000 | (sf << 31) | (sub << 30) | (s << 29) | (lsl12 << 22) | (imm12 << 10) | (n << 5) | d);
+}
+
+/* Logical operations, with neg set they invert the second operand
+   (BIC, ORN, EON and BICS) */
+#define ARM64_AND		0
+#define ARM64_ORR		1
+#define ARM64_EOR		2
+#define ARM64_ANDS		3
+
+STATIC_INLINE void arm64_logic_rrr(int sf, int opc, int neg, int d, int n, int m, int shift, int amount)
+{
+	_L(0x0a000000 | (sf << 31) | (opc << 29) | (shift << 22) | (neg << 21) | (m << 16) | (amount << 10) | (n << 5) | d);
+}
+
+/* Returns the N:immr:imms field of a 32 bit logical immediate, or -1 if
+   the value is not a rotated run of ones repeated over 2 to 32 bits */
+STATIC_INLINE int arm64_logic_imm_enc(uae_u32 v)
+{
+	if (v == 0 || v == 0xffffffff)
+		return -1;
+
+	int size = 32;
+	while (size > 2) {
+		int half = size / 2;
+		uae_u32 mask = (1U << half) - 1;
+		if ((v & mask) != ((v >> half) & mask))
+			break;
+		size = half;
+	}
+
+	uae_u64 mask = (1ULL << size) - 1;
+	uae_u64 e = v & mask;
+	for (int r = 0; r < size; r++) {
+		/* rotate left by r, a run of ones at the bottom is encodable */
+		uae_u64 rot = ((e << r) | (e >> ((size - r) % size))) & mask;
+		if ((rot & (rot + 1)) == 0) {
+			int ones = 0;
+			while (rot & (1ULL << ones))
+				ones++;
+			return (r << 6) | ((0x40 - 2 * size) & 0x3f) | (ones - 1);
+		}
+	}
+	return -1;
+}
+
+/* AND, ORR, EOR, ANDS d, n, #imm with the field from arm64_logic_imm_enc() */
+STATIC_INLINE void arm64_logic_imm(int sf, int opc, int d, int n, int enc)
+{
+	_L(0x12000000 | (sf << 31) | (opc << 29) | (enc << 10) | (n << 5) | d);
+}
+
+/* Wide immediate moves, hw selects the 16 bit slot */
+#define ARM64_MOVN		0
+#define ARM64_MOVZ		2
+#define ARM64_MOVK		3
+
+STATIC_INLINE void arm64_movw(int sf, int opc, int d, int imm16, int hw)
+{
+	_L(0x12800000 | (sf << 31) | (opc << 29) | (hw << 21) | ((imm16 & 0xffff) << 5) | d);
+}
+
+/* Bitfield moves, the aliases LSL, LSR, ASR, UBFX, BFI, BFXIL, SXTB
+   and friends are all expressed through these */
+#define ARM64_SBFM		0
+#define ARM64_BFM		1
+#define ARM64_UBFM		2
+
+STATIC_INLINE void arm64_bitfield(int sf, int opc, int d, int n, int immr, int imms)
+{
+	_L(0x13000000 | (sf << 31) | (opc << 29) | (sf << 22) | (immr << 16) | (imms << 10) | (n << 5) | d);
+}
+
+/* EXTR d, n, m, #lsb, ROR #imm is EXTR d, s, s, #imm */
+STATIC_INLINE void arm64_extr(int sf, int d, int n, int m, int lsb)
+{
+	_L(0x13800000 | (sf << 31) | (sf << 22) | (m << 16) | (lsb << 10) | (n << 5) | d);
+}
+
+/* Data processing, two sources */
+#define ARM64_LSLV		0x08
+#define ARM64_LSRV		0x09
+#define ARM64_ASRV		0x0a
+#define ARM64_RORV		0x0b
+
+STATIC_INLINE void arm64_dp2(int sf, int op, int d, int n, int m)
+{
+	_L(0x1ac00000 | (sf << 31) | (m << 16) | (op << 10) | (n << 5) | d);
+}
+
+/* Data processing, one source. REV is 2 on W and 3 on X registers. */
+#define ARM64_RBIT		0x00
+#define ARM64_REV16		0x01
+#define ARM64_REV		0x02
+#define ARM64_CLZ		0x04
+
+STATIC_INLINE void arm64_dp1(int sf, int op, int d, int n)
+{
+	_L(0x5ac00000 | (sf << 31) | (op << 10) | (n << 5) | d);
+}
+
+/* ADC, ADCS, SBC, SBCS d, n, m */
+STATIC_INLINE void arm64_adc(int sf, int sub, int s, int d, int n, int m)
+{
+	_L(0x1a000000 | (sf << 31) | (sub << 30) | (s << 29) | (m << 16) | (n << 5) | d);
+}
+
+/* CSEL (inv 0, inc 0), CSINC (0, 1), CSINV (1, 0): d = cond ? n : op(m) */
+STATIC_INLINE void arm64_csel(int sf, int inv, int inc, int d, int n, int m, int cond)
+{
+	_L(0x1a800000 | (sf << 31) | (inv << 30) | (m << 16) | (cond << 12) | (inc << 10) | (n << 5) | d);
+}
+
+/* MADD d, n, m, a: d = a + n * m */
+STATIC_INLINE void arm64_madd(int sf, int d, int n, int m, int a)
+{
+	_L(0x1b000000 | (sf << 31) | (m << 16) | (a << 10) | (n << 5) | d);
+}
+
+/* SMULL, UMULL Xd, Wn, Wm */
+STATIC_INLINE void arm64_mull(int is_unsigned, int d, int n, int m)
+{
+	_L(0x9b200000 | (is_unsigned << 23) | (m << 16) | (ARM64_ZR << 10) | (n << 5) | d);
+}
+
+/* MRS Xt, NZCV and MSR NZCV, Xt */
+STATIC_INLINE void arm64_mrs_nzcv(int t)
+{
+	_L(0xd53b4200 | t);
+}
+
+STATIC_INLINE void arm64_msr_nzcv(int t)
+{
+	_L(0xd51b4200 | t);
+}
+
+/* Branches, the offsets are relative to the branch instruction itself */
+STATIC_INLINE void arm64_b(uae_s32 off)
+{
+	_L(0x14000000 | ((off >> 2) & 0x3ffffff));
+}
+
+STATIC_INLINE void arm64_bcc(int cond, uae_s32 off)
+{
+	_L(0x54000000 | (((off >> 2) & 0x7ffff) << 5) | cond);
+}
+
+/* CBZ, CBNZ Wt */
+STATIC_INLINE void arm64_cbz(int nz, int t, uae_s32 off)
+{
+	_L(0x34000000 | (nz << 24) | (((off >> 2) & 0x7ffff) << 5) | t);
+}
+
+STATIC_INLINE void arm64_br(int n)
+{
+	_L(0xd61f0000 | (n << 5));
+}
+
+STATIC_INLINE void arm64_blr(int n)
+{
+	_L(0xd63f0000 | (n << 5));
+}
+
+STATIC_INLINE void arm64_adr(int d, uae_s32 off)
+{
+	_L(0x10000000 | ((off & 3) << 29) | (((off >> 2) & 0x7ffff) << 5) | d);
+}
+
+/* LDR Wt, <pc + off> */
+STATIC_INLINE void arm64_ldr_lit(int t, uae_s32 off)
+{
+	_L(0x18000000 | (((off >> 2) & 0x7ffff) << 5) | t);
+}
+
+/* Loads and stores. size is log2 of the access size, opc is 0 for a store,
+   1 for a zero extending load and 2 for a sign extending load to X. */
+#define ARM64_STR		0
+#define ARM64_LDR		1
+#define ARM64_LDRS		2
+
+/* [n, #imm12 << size] */
+STATIC_INLINE void arm64_ldst_uimm(int size, int opc, int t, int n, int imm12)
+{
+	_L(0x39000000 | (size << 30) | (opc << 22) | (imm12 << 10) | (n << 5) | t);
+}
+
+/* [n, #imm9], unscaled */
+STATIC_INLINE void arm64_ldst_simm(int size, int opc, int t, int n, int imm9)
+{
+	_L(0x38000000 | (size << 30) | (opc << 22) | ((imm9 & 0x1ff) << 12) | (n << 5) | t);
+}
+
+/* [n, m <extend> {#size}] */
+STATIC_INLINE void arm64_ldst_reg(int size, int opc, int t, int n, int m, int option, int scaled)
+{
+	_L(0x38200800 | (size << 30) | (opc << 22) | (m << 16) | (option << 13) | (scaled << 12) | (n << 5) | t);
+}
+
+/* LDP and STP, mode 1 is post-index, 2 signed offset and 3 pre-index.
+   The offset is scaled by the register size. */
+#define ARM64_POST		1
+#define ARM64_OFFSET	2
+#define ARM64_PRE		3
+
+STATIC_INLINE void arm64_ldstp(int sf, int load, int mode, int t1, int t2, int n, int imm7)
+{
+	_L(0x28000000 | (sf << 31) | (mode << 23) | (load << 22) | ((imm7 & 0x7f) << 15) | (t2 << 10) | (n << 5) | t1);
+}
+
+#define ARM64_NOP		0xd503201f
+
+#endif /* ARM64_RTASM_H */
@@ -0,0 +1,1291 @@
+/*
+ * compiler/codegen_x86.cpp - AMD64 code generator
+ *
+ * Inspired by Christian Bauer's Basilisk II
+ *
+ * JIT compiler m68k -> AMD64
+ *
+ * Original 68040 JIT compiler for UAE, copyright 2000-2002 Bernd Meyer
+ * Adaptation for Basilisk II and improvements, copyright 2000-2004 Gwenole Beauchesne
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Current state:
+ * 	- Experimental
+ *	- gencomp emits x86 semantics (flags, carry, condition codes), so
+ *	  most raw functions map to a single instruction
+ *	- no FPU support, the FPU instructions run in the interpreter
+ *
+ */
+
+#include "flags_x86.h"
+
+/*************************************************************************
+ * Some basic information about the the target CPU                       *
+ *************************************************************************/
+
+#define RAX_INDEX 0
+#define RCX_INDEX 1
+#define RDX_INDEX 2
+#define RBX_INDEX 3
+#define RSP_INDEX 4
+#define RBP_INDEX 5
+#define RSI_INDEX 6
+#define RDI_INDEX 7
+#define R8_INDEX  8
+#define R9_INDEX  9
+#define R10_INDEX 10
+#define R11_INDEX 11
+#define R12_INDEX 12
+#define R13_INDEX 13
+#define R14_INDEX 14
+#define R15_INDEX 15
+
+/* The register in which subroutines return an integer return value */
+#define REG_RESULT RAX_INDEX
+
+/* The registers subroutines take their first and second argument in */
+#define REG_PAR1 RDI_INDEX
+#define REG_PAR2 RSI_INDEX
+
+#define REG_WORK1 R11_INDEX
+#define REG_WORK2 R10_INDEX
+
+#define REG_PC_PRE RAX_INDEX /* The register we use for preloading regs.pc_p */
+#define REG_PC_TMP RCX_INDEX /* Another register that is not the above */
+
+#define SHIFTCOUNT_NREG RCX_INDEX  /* Register that can be used for shiftcount.
+			      -1 if any reg will do */
+#define MUL_NREG1 RAX_INDEX /* %rax will hold the low 32 bits after a 32x32 mul */
+#define MUL_NREG2 RDX_INDEX /* %rdx will hold the high 32 bits */
+
+/* The generated code calls C functions, keep the stack 16 byte aligned.
+   Entering pushall_call_handler has pushed the return address. */
+#define STACK_ALIGN		16
+#define STACK_OFFSET	sizeof(void *)
+
+uae_u8 always_used[]={4,10,11,0xff};
+uae_u8 can_byte[]={0,1,2,3,5,6,7,8,9,12,13,14,15,0xff};
+uae_u8 can_word[]={0,1,2,3,5,6,7,8,9,12,13,14,15,0xff};
+
+uae_u8 call_saved[]={0,0,0,1,0,1,0,0, 0,0,0,0,1,1,1,1};
+
+/* This *should* be the same as call_saved. But:
+   - We might not really know which registers are saved, and which aren't,
+     so we need to preserve some, but don't want to rely on everyone else
+     also saving those registers
+   - Special registers (such like the stack pointer) should not be "preserved"
+     by pushing, even though they are "saved" across function calls
+*/
+static const uae_u8 need_to_preserve[]={0,0,0,1,0,1,0,0, 0,0,0,0,1,1,1,1};
+
+/* Whether classes of instructions do or don't clobber the native flags */
+#define CLOBBER_MOV
+#define CLOBBER_LEA
+#define CLOBBER_CMOV
+#define CLOBBER_POP
+#define CLOBBER_PUSH
+#define CLOBBER_SUB  clobber_flags()
+#define CLOBBER_SBB  clobber_flags()
+#define CLOBBER_CMP  clobber_flags()
+#define CLOBBER_ADD  clobber_flags()
+#define CLOBBER_ADC  clobber_flags()
+#define CLOBBER_AND  clobber_flags()
+#define CLOBBER_OR   clobber_flags()
+#define CLOBBER_XOR  clobber_flags()
+
+#define CLOBBER_ROL  clobber_flags()
+#define CLOBBER_ROR  clobber_flags()
+#define CLOBBER_SHLL clobber_flags()
+#define CLOBBER_SHRL clobber_flags()
+#define CLOBBER_SHRA clobber_flags()
+#define CLOBBER_TEST clobber_flags()
+#define CLOBBER_CL16
+#define CLOBBER_CL8
+#define CLOBBER_SE32
+#define CLOBBER_SE16
+#define CLOBBER_SE8
+#define CLOBBER_ZE32
+#define CLOBBER_ZE16
+#define CLOBBER_ZE8
+#define CLOBBER_SW16 clobber_flags()
+#define CLOBBER_SW32
+#define CLOBBER_SETCC
+#define CLOBBER_MUL  clobber_flags()
+#define CLOBBER_BT   clobber_flags()
+#define CLOBBER_BSF  clobber_flags()
+
+#include "codegen_x86.h"
+
+#define x86_emit_failure(MSG)	jit_fail(MSG, __FILE__, __LINE__, __FUNCTION__)
+
+static void jit_fail(const char *msg, const char *file, int line, const char *function)
+{
+	panicbug("JIT failure in function %s from file %s at line %d: %s\n",
+			function, file, line, msg);
+	abort();
+}
+
+/* Shifts by a register count only work with %cl */
+STATIC_INLINE void x86_check_shiftcount(int r)
+{
+	if (r != SHIFTCOUNT_NREG)
+		x86_emit_failure("shift count not in %cl");
+}
+
+/* movzx/movsx from a byte register */
+STATIC_INLINE void x86_rr_b(int op, int d, int s)
+{
+	x86_prefix(1, d, X86_NOREG, s, s >= 4 && s < 8);
+	x86_opcode(op);
+	_B(0xc0 | ((d & 7) << 3) | (s & 7));
+}
+
+/* mov r64, imm64 */
+STATIC_INLINE void x86_mov_q_ri(int d, uae_u64 i)
+{
+	x86_prefix(8, 0, X86_NOREG, d, 0);
+	_B(0xb8 | (d & 7));
+	emit_quad(i);
+}
+
+/* REG_WORK1 = s & 0x00ffffff, for the 24 bit addressing variants */
+STATIC_INLINE void x86_mask24(int s)
+{
+	x86_rr(4, 0x89, s, REG_WORK1);
+	x86_alu_ri(4, X86_ALU_AND, REG_WORK1, 0x00ffffff);
+}
+
+STATIC_INLINE int x86_in_rel32(uintptr t, int len)
+{
+	uae_s64 rel = (uae_s64)t - (uae_s64)((uintptr)get_target() + len);
+	return rel == (uae_s32)rel;
+}
+
+LOWFUNC(NONE,WRITE,1,raw_push_l_r,(RR4 r))
+{
+	x86_prefix(4, 0, X86_NOREG, r, 0);
+	_B(0x50 | (r & 7));
+}
+LENDFUNC(NONE,WRITE,1,raw_push_l_r,(RR4 r))
+
+LOWFUNC(NONE,READ,1,raw_pop_l_r,(RR4 r))
+{
+	x86_prefix(4, 0, X86_NOREG, r, 0);
+	_B(0x58 | (r & 7));
+}
+LENDFUNC(NONE,READ,1,raw_pop_l_r,(RR4 r))
+
+LOWFUNC(RMW,NONE,2,raw_adc_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_ADC, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_adc_b,(RW1 d, RR1 s))
+
+LOWFUNC(RMW,NONE,2,raw_adc_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_ADC, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_adc_w,(RW2 d, RR2 s))
+
+LOWFUNC(RMW,NONE,2,raw_adc_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_ADC, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_adc_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_ADD, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_ADD, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_ADD, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_add_w_ri,(RW2 d, IMM i))
+{
+	x86_alu_ri(2, X86_ALU_ADD, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_w_ri,(RW2 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_add_b_ri,(RW1 d, IMM i))
+{
+	x86_alu_ri(1, X86_ALU_ADD, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_b_ri,(RW1 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_add_l_ri,(RW4 d, IMM i))
+{
+	x86_alu_ri(4, X86_ALU_ADD, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_add_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_and_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_AND, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_and_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_AND, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_and_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_AND, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_and_l_ri,(RW4 d, IMM i))
+{
+	x86_alu_ri(4, X86_ALU_AND, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_and_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_bsf_l_rr,(W4 d, RR4 s))
+{
+	x86_rr(4, 0x0fbc, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_bsf_l_rr,(W4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,1,raw_bswap_16,(RW2 r))
+{
+	x86_shift_ri(2, X86_SHF_ROL, r, 8);					// rol  %[r]w, 8
+}
+LENDFUNC(WRITE,NONE,1,raw_bswap_16,(RW2 r))
+
+LOWFUNC(NONE,NONE,1,raw_bswap_32,(RW4 r))
+{
+	x86_prefix(4, 0, X86_NOREG, r, 0);
+	_B(0x0f);
+	_B(0xc8 | (r & 7));
+}
+LENDFUNC(NONE,NONE,1,raw_bswap_32,(RW4 r))
+
+LOWFUNC(WRITE,NONE,2,raw_bt_l_ri,(RR4 r, IMM i))
+{
+	x86_rr(4, 0x0fba, 4, r);
+	_B(i);
+}
+LENDFUNC(WRITE,NONE,2,raw_bt_l_ri,(RR4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_bt_l_rr,(RR4 r, RR4 b))
+{
+	x86_rr(4, 0x0fa3, b, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_bt_l_rr,(RR4 r, RR4 b))
+
+LOWFUNC(WRITE,NONE,2,raw_btc_l_rr,(RW4 r, RR4 b))
+{
+	x86_rr(4, 0x0fbb, b, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_btc_l_rr,(RW4 r, RR4 b))
+
+LOWFUNC(WRITE,NONE,2,raw_btr_l_rr,(RW4 r, RR4 b))
+{
+	x86_rr(4, 0x0fb3, b, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_btr_l_rr,(RW4 r, RR4 b))
+
+LOWFUNC(WRITE,NONE,2,raw_bts_l_rr,(RW4 r, RR4 b))
+{
+	x86_rr(4, 0x0fab, b, r);
+}
+LENDFUNC(WRITE,NONE,2,raw_bts_l_rr,(RW4 r, RR4 b))
+
+LOWFUNC(READ,NONE,3,raw_cmov_l_rr,(RW4 d, RR4 s, IMM cc))
+{
+	x86_rr(4, 0x0f40 | cc, d, s);
+}
+LENDFUNC(READ,NONE,3,raw_cmov_l_rr,(RW4 d, RR4 s, IMM cc))
+
+LOWFUNC(WRITE,NONE,2,raw_cmp_b,(RR1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_CMP, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_cmp_b,(RR1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_cmp_w,(RR2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_CMP, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_cmp_w,(RR2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_cmp_l,(RR4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_CMP, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_cmp_l,(RR4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,raw_imul_32_32,(RW4 d, RR4 s))
+{
+	x86_rr(4, 0x0faf, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_imul_32_32,(RW4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,raw_imul_64_32,(RW4 d, RW4 s))
+{
+	if (d != MUL_NREG1 || s != MUL_NREG2)
+		x86_emit_failure("imul_64_32 needs %eax and %edx");
+	x86_rr(4, 0xf7, 5, s);								// imul %edx
+}
+LENDFUNC(NONE,NONE,2,raw_imul_64_32,(RW4 d, RW4 s))
+
+LOWFUNC(NONE,NONE,3,raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+{
+	x86_lea(d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,NONE,3,raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+
+/* The 24 bit variants mask the address with an and, the midfuncs
+   clobber the flags before calling them */
+LOWFUNC(WRITE,NONE,3,raw_lea_l_brr24,(W4 d, RR4 s, IMM offset))
+{
+	x86_mask24(s);
+	x86_lea(d, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,NONE,3,raw_lea_l_brr24,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,NONE,5,raw_lea_l_brr_indexed,(W4 d, RR4 s, RR4 index, IMM factor, IMM offset))
+{
+	x86_lea(d, s, index, factor, offset);
+}
+LENDFUNC(NONE,NONE,5,raw_lea_l_brr_indexed,(W4 d, RR4 s, RR4 index, IMM factor, IMM offset))
+
+LOWFUNC(NONE,NONE,4,raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+{
+	x86_lea(d, s, index, factor, 0);
+}
+LENDFUNC(NONE,NONE,4,raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+
+LOWFUNC(NONE,READ,3,raw_mov_b_brR,(W1 d, RR4 s, IMM offset))
+{
+	x86_load(1, d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_b_brR,(W1 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,READ,3,raw_mov_b_brR24,(W1 d, RR4 s, IMM offset))
+{
+	x86_mask24(s);
+	x86_load(1, d, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,READ,3,raw_mov_b_brR24,(W1 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_b_bRr,(RR4 d, RR1 s, IMM offset))
+{
+	x86_store(1, s, d, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_b_bRr,(RR4 d, RR1 s, IMM offset))
+
+LOWFUNC(WRITE,WRITE,3,raw_mov_b_bRr24,(RR4 d, RR1 s, IMM offset))
+{
+	x86_mask24(d);
+	x86_store(1, s, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,WRITE,3,raw_mov_b_bRr24,(RR4 d, RR1 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_b_mi,(MEMW d, IMM s))
+{
+	x86_store_imm(1, X86_NOREG, d, s);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_b_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, RR1 s))
+{
+	x86_store(1, s, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, RR1 s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_b_ri,(W1 d, IMM s))
+{
+	x86_rr(1, 0xc6, 0, d);
+	_B(s);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_b_ri,(W1 d, IMM s))
+
+LOWFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+{
+	x86_load(1, d, X86_NOREG, X86_NOREG, 1, s);
+}
+LENDFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_b_rr,(W1 d, RR1 s))
+{
+	x86_rr(1, 0x88, s, d);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_b_rr,(W1 d, RR1 s))
+
+LOWFUNC(NONE,READ,3,raw_mov_l_brR,(W4 d, RR4 s, IMM offset))
+{
+	x86_load(4, d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_l_brR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,READ,3,raw_mov_l_brR24,(W4 d, RR4 s, IMM offset))
+{
+	x86_mask24(s);
+	x86_load(4, d, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,READ,3,raw_mov_l_brR24,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_l_bRr,(RR4 d, RR4 s, IMM offset))
+{
+	x86_store(4, s, d, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_l_bRr,(RR4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,WRITE,3,raw_mov_l_bRr24,(RR4 d, RR4 s, IMM offset))
+{
+	x86_mask24(d);
+	x86_store(4, s, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,WRITE,3,raw_mov_l_bRr24,(RR4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_l_mi,(MEMW d, IMM s))
+{
+	x86_store_imm(4, X86_NOREG, d, s);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_l_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,READ,3,raw_mov_w_brR,(W2 d, RR4 s, IMM offset))
+{
+	x86_load(2, d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_w_brR,(W2 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,READ,3,raw_mov_w_brR24,(W2 d, RR4 s, IMM offset))
+{
+	x86_mask24(s);
+	x86_load(2, d, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,READ,3,raw_mov_w_brR24,(W2 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_w_bRr,(RR4 d, RR2 s, IMM offset))
+{
+	x86_store(2, s, d, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_w_bRr,(RR4 d, RR2 s, IMM offset))
+
+LOWFUNC(WRITE,WRITE,3,raw_mov_w_bRr24,(RR4 d, RR2 s, IMM offset))
+{
+	x86_mask24(d);
+	x86_store(2, s, REG_WORK1, X86_NOREG, 1, offset);
+}
+LENDFUNC(WRITE,WRITE,3,raw_mov_w_bRr24,(RR4 d, RR2 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, RR2 s))
+{
+	x86_store(2, s, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, RR2 s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_w_ri,(W2 d, IMM s))
+{
+	x86_prefix(2, 0, X86_NOREG, d, 0);
+	_B(0xb8 | (d & 7));
+	emit_word(s);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_w_ri,(W2 d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_w_mi,(MEMW d, IMM s))
+{
+	x86_store_imm(2, X86_NOREG, d, s);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_w_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, RR4 s))
+{
+	x86_store(4, s, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, RR4 s))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_w_Ri,(RR4 d, IMM i, IMM offset))
+{
+	x86_store_imm(2, d, offset, i);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_w_Ri,(RR4 d, IMM i, IMM offset))
+
+LOWFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+{
+	x86_load(2, d, X86_NOREG, X86_NOREG, 1, s);
+}
+LENDFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+
+LOWFUNC(NONE,NONE,2,raw_mov_w_rr,(W2 d, RR2 s))
+{
+	x86_rr(2, 0x89, s, d);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_w_rr,(W2 d, RR2 s))
+
+LOWFUNC(NONE,READ,3,raw_mov_w_rR,(W2 d, RR4 s, IMM offset))
+{
+	x86_load(2, d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_w_rR,(W2 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_w_Rr,(RR4 d, RR2 s, IMM offset))
+{
+	x86_store(2, s, d, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_w_Rr,(RR4 d, RR2 s, IMM offset))
+
+LOWFUNC(NONE,READ,2,raw_mov_l_rm,(W4 d, MEMR s))
+{
+	x86_load(4, d, X86_NOREG, X86_NOREG, 1, s);
+}
+LENDFUNC(NONE,READ,2,raw_mov_l_rm,(W4 d, MEMR s))
+
+LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, RR4 index, IMM factor))
+{
+	x86_load(4, d, X86_NOREG, index, factor, base);
+}
+LENDFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, RR4 index, IMM factor))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_l_Ri,(RR4 d, IMM i, IMM offset8))
+{
+	x86_store_imm(4, d, offset8, i);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_l_Ri,(RR4 d, IMM i, IMM offset8))
+
+LOWFUNC(NONE,READ,3,raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+{
+	x86_load(4, d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,READ,3,raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, RR4 s))
+{
+	x86_rr(4, 0x89, s, d);
+}
+LENDFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, RR4 s))
+
+LOWFUNC(NONE,WRITE,3,raw_mov_l_Rr,(RR4 d, RR4 s, IMM offset))
+{
+	x86_store(4, s, d, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,WRITE,3,raw_mov_l_Rr,(RR4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,NONE,2,raw_mul_64_32,(RW4 d, RW4 s))
+{
+	if (d != MUL_NREG1 || s != MUL_NREG2)
+		x86_emit_failure("mul_64_32 needs %eax and %edx");
+	x86_rr(4, 0xf7, 4, s);								// mul  %edx
+}
+LENDFUNC(NONE,NONE,2,raw_mul_64_32,(RW4 d, RW4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_OR, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_OR, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_OR, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_or_l_ri,(RW4 d, IMM i))
+{
+	x86_alu_ri(4, X86_ALU_OR, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_or_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_b_ri,(RW1 r, IMM i))
+{
+	x86_shift_ri(1, X86_SHF_ROL, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_b_rr,(RW1 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(1, X86_SHF_ROL, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_w_ri,(RW2 r, IMM i))
+{
+	x86_shift_ri(2, X86_SHF_ROL, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_w_rr,(RW2 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(2, X86_SHF_ROL, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_l_ri,(RW4 r, IMM i))
+{
+	x86_shift_ri(4, X86_SHF_ROL, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_l_ri,(RW4 r, IMM i))
+{
+	x86_shift_ri(4, X86_SHF_ROR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_rol_l_rr,(RW4 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(4, X86_SHF_ROL, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_rol_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_l_rr,(RW4 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(4, X86_SHF_ROR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_b_ri,(RW1 r, IMM i))
+{
+	x86_shift_ri(1, X86_SHF_ROR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_b_rr,(RW1 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(1, X86_SHF_ROR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_w_ri,(RW2 r, IMM i))
+{
+	x86_shift_ri(2, X86_SHF_ROR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_ror_w_rr,(RW2 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(2, X86_SHF_ROR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_ror_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(RMW,NONE,2,raw_sbb_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_SBB, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_sbb_b,(RW1 d, RR1 s))
+
+LOWFUNC(RMW,NONE,2,raw_sbb_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_SBB, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_sbb_l,(RW4 d, RR4 s))
+
+LOWFUNC(RMW,NONE,2,raw_sbb_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_SBB, d, s);
+}
+LENDFUNC(RMW,NONE,2,raw_sbb_w,(RW2 d, RR2 s))
+
+LOWFUNC(READ,NONE,2,raw_setcc,(W1 d, IMM cc))
+{
+	x86_rr(1, 0x0f90 | cc, 0, d);
+}
+LENDFUNC(READ,NONE,2,raw_setcc,(W1 d, IMM cc))
+
+LOWFUNC(READ,WRITE,2,raw_setcc_m,(MEMW d, IMM cc))
+{
+	x86_rm(1, 0x0f90 | cc, 0, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(READ,WRITE,2,raw_setcc_m,(MEMW d, IMM cc))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_b_ri,(RW1 r, IMM i))
+{
+	x86_shift_ri(1, X86_SHF_SHL, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_b_rr,(RW1 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(1, X86_SHF_SHL, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_l_ri,(RW4 r, IMM i))
+{
+	x86_shift_ri(4, X86_SHF_SHL, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_l_rr,(RW4 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(4, X86_SHF_SHL, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_w_ri,(RW2 r, IMM i))
+{
+	x86_shift_ri(2, X86_SHF_SHL, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shll_w_rr,(RW2 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(2, X86_SHF_SHL, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shll_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_b_ri,(RW1 r, IMM i))
+{
+	x86_shift_ri(1, X86_SHF_SAR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_b_rr,(RW1 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(1, X86_SHF_SAR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_w_ri,(RW2 r, IMM i))
+{
+	x86_shift_ri(2, X86_SHF_SAR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_w_rr,(RW2 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(2, X86_SHF_SAR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_l_ri,(RW4 r, IMM i))
+{
+	x86_shift_ri(4, X86_SHF_SAR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shra_l_rr,(RW4 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(4, X86_SHF_SAR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shra_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_b_ri,(RW1 r, IMM i))
+{
+	x86_shift_ri(1, X86_SHF_SHR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_b_ri,(RW1 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_b_rr,(RW1 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(1, X86_SHF_SHR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_b_rr,(RW1 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_l_ri,(RW4 r, IMM i))
+{
+	x86_shift_ri(4, X86_SHF_SHR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_l_ri,(RW4 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_w_ri,(RW2 r, IMM i))
+{
+	x86_shift_ri(2, X86_SHF_SHR, r, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_w_ri,(RW2 r, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_w_rr,(RW2 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(2, X86_SHF_SHR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_w_rr,(RW2 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_shrl_l_rr,(RW4 d, RR1 r))
+{
+	x86_check_shiftcount(r);
+	x86_shift_rcl(4, X86_SHF_SHR, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_shrl_l_rr,(RW4 d, RR1 r))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_SUB, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_b_ri,(RW1 d, IMM i))
+{
+	x86_alu_ri(1, X86_ALU_SUB, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_b_ri,(RW1 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_SUB, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_l,(RW4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_l_ri,(RW4 d, IMM i))
+{
+	x86_alu_ri(4, X86_ALU_SUB, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_SUB, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_sub_w_ri,(RW2 d, IMM i))
+{
+	x86_alu_ri(2, X86_ALU_SUB, d, i);
+}
+LENDFUNC(WRITE,NONE,2,raw_sub_w_ri,(RW2 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_test_b_rr,(RR1 d, RR1 s))
+{
+	x86_rr(1, 0x84, s, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_test_b_rr,(RR1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_test_l_ri,(RR4 d, IMM i))
+{
+	x86_rr(4, 0xf7, 0, d);
+	_L(i);
+}
+LENDFUNC(WRITE,NONE,2,raw_test_l_ri,(RR4 d, IMM i))
+
+LOWFUNC(WRITE,NONE,2,raw_test_l_rr,(RR4 d, RR4 s))
+{
+	x86_rr(4, 0x85, s, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_test_l_rr,(RR4 d, RR4 s))
+
+LOWFUNC(WRITE,NONE,2,raw_test_w_rr,(RR2 d, RR2 s))
+{
+	x86_rr(2, 0x85, s, d);
+}
+LENDFUNC(WRITE,NONE,2,raw_test_w_rr,(RR2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_xor_b,(RW1 d, RR1 s))
+{
+	x86_alu_rr(1, X86_ALU_XOR, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_xor_b,(RW1 d, RR1 s))
+
+LOWFUNC(WRITE,NONE,2,raw_xor_w,(RW2 d, RR2 s))
+{
+	x86_alu_rr(2, X86_ALU_XOR, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_xor_w,(RW2 d, RR2 s))
+
+LOWFUNC(WRITE,NONE,2,raw_xor_l,(RW4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_XOR, d, s);
+}
+LENDFUNC(WRITE,NONE,2,raw_xor_l,(RW4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,raw_sign_extend_16_rr,(W4 d, RR2 s))
+{
+	x86_rr(4, 0x0fbf, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_sign_extend_16_rr,(W4 d, RR2 s))
+
+LOWFUNC(NONE,NONE,2,raw_sign_extend_8_rr,(W4 d, RR1 s))
+{
+	x86_rr_b(0x0fbe, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_sign_extend_8_rr,(W4 d, RR1 s))
+
+LOWFUNC(NONE,NONE,2,raw_zero_extend_8_rr,(W4 d, RR1 s))
+{
+	x86_rr_b(0x0fb6, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_zero_extend_8_rr,(W4 d, RR1 s))
+
+LOWFUNC(NONE,NONE,2,raw_zero_extend_16_rr,(W4 d, RR2 s))
+{
+	x86_rr(4, 0x0fb7, d, s);
+}
+LENDFUNC(NONE,NONE,2,raw_zero_extend_16_rr,(W4 d, RR2 s))
+
+static inline void raw_dec_sp(int off)
+{
+	if (off)
+		x86_rm(8, 0x8d, RSP_INDEX, RSP_INDEX, X86_NOREG, 1, -off);	// lea  -off(%rsp), %rsp
+}
+
+static inline void raw_inc_sp(int off)
+{
+	if (off)
+		x86_rm(8, 0x8d, RSP_INDEX, RSP_INDEX, X86_NOREG, 1, off);	// lea  off(%rsp), %rsp
+}
+
+static inline void raw_push_regs_to_preserve(void) {
+	for (int i = 0; i < N_REGS; i++) {
+		if (need_to_preserve[i])
+			raw_push_l_r(i);
+	}
+}
+
+static inline void raw_pop_preserved_regs(void) {
+	for (int i = N_REGS - 1; i >= 0; i--) {
+		if (need_to_preserve[i])
+			raw_pop_l_r(i);
+	}
+}
+
+/* FLAGX is byte sized, and we *do* write it at that size */
+static inline void raw_load_flagx(uae_u32 t, uae_u32 r)
+{
+	raw_mov_l_rm(t,(uintptr)live.state[r].mem);
+}
+
+static inline void raw_flags_evicted(int r)
+{
+  live.state[FLAGTMP].status=INMEM;
+  live.state[FLAGTMP].realreg=-1;
+  /* We just "evicted" FLAGTMP. */
+  if (live.nat[r].nholds!=1) {
+      /* Huh? */
+      abort();
+  }
+  live.nat[r].nholds=0;
+}
+
+static inline void raw_flags_init(void) {
+}
+
+/* lahf puts SF, ZF and CF into %ah, seto the overflow flag into %al. That
+   is the layout of regs.ccrflags.cznv, see md-pandora/m68k.h. */
+static inline void x86_lahf_seto(void)
+{
+	_B(0x9f);											// lahf
+	_B(0x0f); _B(0x90); _B(0xc0);						// seto %al
+}
+
+/* cmp $-127, %al overflows iff %al is 1, sahf restores the rest */
+static inline void x86_cmp_sahf(void)
+{
+	_B(0x3c); _B(0x81);									// cmp  $-127, %al
+	_B(0x9e);											// sahf
+}
+
+static __inline__ void raw_flags_set_zero(int s, int tmp)
+{
+	if (s != RAX_INDEX)
+		x86_emit_failure("flags need %eax");
+	raw_mov_l_rr(tmp,s);
+	x86_lahf_seto();
+	raw_and_l_ri(s,~(X86_Z_FLAG << 8));
+	raw_and_l_ri(tmp,X86_Z_FLAG << 8);
+	x86_alu_ri(4,X86_ALU_XOR,tmp,X86_Z_FLAG << 8);
+	raw_or_l(s,tmp);
+	x86_cmp_sahf();
+}
+
+static inline void raw_flags_to_reg(int r)
+{
+	if (r != RAX_INDEX)
+		x86_emit_failure("flags need %eax");
+	x86_lahf_seto();
+	raw_mov_l_mr((uintptr)live.state[FLAGTMP].mem,r);
+	raw_flags_evicted(r);
+}
+
+static inline void raw_reg_to_flags(int r)
+{
+	if (r != RAX_INDEX)
+		x86_emit_failure("flags need %eax");
+	x86_cmp_sahf();
+}
+
+/* Apparently, there are enough instructions between flag store and
+   flag reload to avoid the partial memory stall */
+static inline void raw_load_flagreg(uae_u32 t, uae_u32 r)
+{
+	raw_mov_l_rm(t,(uintptr)live.state[r].mem);
+}
+
+/* lahf/sahf and seto only work on %ah/%al */
+#define FLAG_NREG1 RAX_INDEX
+#define FLAG_NREG2 RAX_INDEX
+#define FLAG_NREG3 RAX_INDEX
+
+static inline void raw_emit_nop_filler(int nbytes)
+{
+	while(nbytes--) { _B(0x90); }
+}
+
+static inline void raw_emit_nop(void)
+{
+	_B(0x90);
+}
+
+static bool target_check_bsf(void)
+{
+	/* bsf leaves the other flags undefined, but every CPU with long mode
+	   handles them the way gencomp expects */
+	return true;
+}
+
+static void raw_init_cpu(void)
+{
+	/* Every x86-64 has cmov */
+	have_cmov = true;
+	have_rat_stall = false;
+
+	align_loops = 16;
+	align_jumps = 16;
+
+	raw_flags_init();
+}
+
+//
+// compuemu_support used raw calls
+//
+LOWFUNC(WRITE,RMW,2,compemu_raw_add_l_mi,(IMM d, IMM s))
+{
+	x86_alu_mi(4, X86_ALU_ADD, X86_NOREG, d, s);
+}
+LENDFUNC(WRITE,RMW,2,compemu_raw_add_l_mi,(IMM d, IMM s))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_and_l_ri,(RW4 d, IMM i))
+{
+	x86_alu_ri(4, X86_ALU_AND, d, i);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_and_l_ri,(RW4 d, IMM i))
+
+LOWFUNC(NONE,NONE,1,compemu_raw_bswap_32,(RW4 r))
+{
+	raw_bswap_32(r);
+}
+LENDFUNC(NONE,NONE,1,compemu_raw_bswap_32,(RW4 r))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_bt_l_ri,(RR4 r, IMM i))
+{
+	raw_bt_l_ri(r, i);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_bt_l_ri,(RR4 r, IMM i))
+
+LOWFUNC(NONE,READ,5,compemu_raw_cmov_l_rm_indexed,(W4 d, IMM base, RR4 index, IMM factor, IMM cond))
+{
+	x86_rm(4, 0x0f40 | cond, d, X86_NOREG, index, factor, base);
+}
+LENDFUNC(NONE,READ,5,compemu_raw_cmov_l_rm_indexed,(W4 d, IMM base, RR4 index, IMM factor, IMM cond))
+
+LOWFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi,(MEMR d, IMM s))
+{
+	x86_alu_mi(4, X86_ALU_CMP, X86_NOREG, d, s);
+}
+LENDFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi,(MEMR d, IMM s))
+
+LOWFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi8,(MEMR d, IMM s))
+{
+	x86_alu_mi(4, X86_ALU_CMP, X86_NOREG, d, s);
+}
+LENDFUNC(WRITE,READ,2,compemu_raw_cmp_l_mi8,(MEMR d, IMM s))
+
+LOWFUNC(NONE,NONE,3,compemu_raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+{
+	x86_lea(d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,NONE,3,compemu_raw_lea_l_brr,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(NONE,READ,3,compemu_raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+{
+	x86_load(4, d, s, X86_NOREG, 1, offset);
+}
+LENDFUNC(NONE,READ,3,compemu_raw_mov_l_rR,(W4 d, RR4 s, IMM offset))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_cmp_l_rr,(RR4 d, RR4 s))
+{
+	x86_alu_rr(4, X86_ALU_CMP, d, s);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_cmp_l_rr,(RR4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,4,compemu_raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+{
+	x86_lea(d, s, index, factor, 0);
+}
+LENDFUNC(NONE,NONE,4,compemu_raw_lea_l_rr_indexed,(W4 d, RR4 s, RR4 index, IMM factor))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_b_mr,(IMM d, RR1 s))
+{
+	x86_store(1, s, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_b_mr,(IMM d, RR1 s))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_l_mi,(MEMW d, IMM s))
+{
+	x86_store_imm(4, X86_NOREG, d, s);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_l_mi,(MEMW d, IMM s))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_l_mr,(IMM d, RR4 s))
+{
+	x86_store(4, s, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_l_mr,(IMM d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,compemu_raw_mov_l_ri,(W4 d, IMM s))
+{
+	x86_prefix(4, 0, X86_NOREG, d, 0);
+	_B(0xb8 | (d & 7));
+	_L(s);
+}
+LENDFUNC(NONE,NONE,2,compemu_raw_mov_l_ri,(W4 d, IMM s))
+
+LOWFUNC(NONE,READ,2,compemu_raw_mov_l_rm,(W4 d, MEMR s))
+{
+	x86_load(4, d, X86_NOREG, X86_NOREG, 1, s);
+}
+LENDFUNC(NONE,READ,2,compemu_raw_mov_l_rm,(W4 d, MEMR s))
+
+LOWFUNC(NONE,NONE,2,compemu_raw_mov_l_rr,(W4 d, RR4 s))
+{
+	x86_rr(4, 0x89, s, d);
+}
+LENDFUNC(NONE,NONE,2,compemu_raw_mov_l_rr,(W4 d, RR4 s))
+
+LOWFUNC(NONE,WRITE,2,compemu_raw_mov_w_mr,(IMM d, RR2 s))
+{
+	x86_store(2, s, X86_NOREG, X86_NOREG, 1, d);
+}
+LENDFUNC(NONE,WRITE,2,compemu_raw_mov_w_mr,(IMM d, RR2 s))
+
+LOWFUNC(WRITE,RMW,2,compemu_raw_sub_l_mi,(MEMRW d, IMM s))
+{
+	x86_alu_mi(4, X86_ALU_SUB, X86_NOREG, d, s);
+}
+LENDFUNC(WRITE,RMW,2,compemu_raw_sub_l_mi,(MEMRW d, IMM s))
+
+LOWFUNC(WRITE,NONE,2,compemu_raw_test_l_rr,(RR4 d, RR4 s))
+{
+	x86_rr(4, 0x85, s, d);
+}
+LENDFUNC(WRITE,NONE,2,compemu_raw_test_l_rr,(RR4 d, RR4 s))
+
+LOWFUNC(NONE,NONE,2,compemu_raw_zero_extend_16_rr,(W4 d, RR2 s))
+{
+	x86_rr(4, 0x0fb7, d, s);
+}
+LENDFUNC(NONE,NONE,2,compemu_raw_zero_extend_16_rr,(W4 d, RR2 s))
+
+/* C functions may be out of reach of a rel32 call or jump, go through
+   REG_WORK1 then. It is free between instructions. */
+static inline void compemu_raw_call(uintptr t)
+{
+	if (x86_in_rel32(t, 5)) {
+		_B(X86_CALL_rel32);
+		_L(t - ((uintptr)get_target() + 4));
+	}
+	else {
+		x86_mov_q_ri(REG_WORK1, t);
+		x86_rr(4, 0xff, 2, REG_WORK1);					// call *%r11
+	}
+}
+
+static inline void compemu_raw_call_r(RR4 r)
+{
+	x86_rr(4, 0xff, 2, r);								// call *%r
+}
+
+/* Only the opcode, the caller emits the displacement */
+static inline void compemu_raw_jcc_l_oponly(int cc)
+{
+	x86_opcode(X86_Jcc_rel32(cc));
+}
+
+static inline void x86_jcc_l(int cc, uintptr t)
+{
+	if (x86_in_rel32(t, 6)) {
+		x86_opcode(X86_Jcc_rel32(cc));
+		_L(t - ((uintptr)get_target() + 4));
+	}
+	else {
+		_B(X86_Jcc_rel8(cc ^ 1));							// skip the 13 bytes below
+		_B(13);
+		x86_mov_q_ri(REG_WORK1, t);
+		x86_rr(4, 0xff, 4, REG_WORK1);					// jmp  *%r11
+	}
+}
+
+static inline void compemu_raw_jl(uintptr t)
+{
+	x86_jcc_l(NATIVE_CC_LT, t);
+}
+
+static inline void compemu_raw_jmp(uintptr t)
+{
+	if (x86_in_rel32(t, 5)) {
+		_B(X86_JMP_rel32);
+		_L(t - ((uintptr)get_target() + 4));
+	}
+	else {
+		x86_mov_q_ri(REG_WORK1, t);
+		x86_rr(4, 0xff, 4, REG_WORK1);					// jmp  *%r11
+	}
+}
+
+/* The table holds 64 bit pointers, jmp *base(,%r,m) loads all of them */
+static inline void compemu_raw_jmp_m_indexed(uintptr base, uae_u32 r, uae_u32 m)
+{
+	x86_rm(4, 0xff, 4, X86_NOREG, r, m, base);
+}
+
+static inline void compemu_raw_jmp_r(RR4 r)
+{
+	x86_rr(4, 0xff, 4, r);								// jmp  *%r
+}
+
+static inline void compemu_raw_jnz(uintptr t)
+{
+	x86_jcc_l(NATIVE_CC_NE, t);
+}
+
+/* Only the opcode, the caller emits the displacement byte */
+static inline void compemu_raw_jz_b_oponly(void)
+{
+	_B(X86_Jcc_rel8(NATIVE_CC_EQ));
+}
@@ -0,0 +1,264 @@
+/*
+ * compiler/codegen_x86.h - AMD64 code generator
+ *
+ * Inspired by Christian Bauer's Basilisk II
+ *
+ * JIT compiler m68k -> AMD64
+ *
+ * Original 68040 JIT compiler for UAE, copyright 2000-2002 Bernd Meyer
+ * This file is derived from CCG, copyright 1999-2003 Ian Piumarta
+ * Adaptation for Basilisk II and improvements, copyright 2000-2004 Gwenole Beauchesne
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef X86_RTASM_H
+#define X86_RTASM_H
+
+/* NOTES
+ *
+ *	- All integer operations are done on 32 bit (or smaller) registers.
+ *	  A 32 bit write clears the upper half of the 64 bit register, so
+ *	  registers used as base or index in an address always hold a
+ *	  zero extended value.
+ *	- Absolute addresses are encoded as 32 bit displacements. Everything
+ *	  the generated code addresses that way (the emulator's globals, the
+ *	  translation cache, the blockinfos and the Amiga memory) lives in the
+ *	  low 2 GB, see cache_alloc() and alloc_AmigaMem().
+ */
+
+/* --- Configuration ------------------------------------------------------- */
+
+/* Bits of the low flag byte, as loaded into AH by LAHF */
+
+#define X86_C_FLAG        0x01
+#define X86_Z_FLAG        0x40
+#define X86_N_FLAG        0x80
+
+/* --- Macros -------------------------------------------------------------- */
+
+/* ========================================================================= */
+/* --- UTILITY ------------------------------------------------------------- */
+/* ========================================================================= */
+
+#define X86_NOREG		(-1)
+
+#define _B(c) emit_byte(c)
+#define _L(c) emit_long(c)
+
+STATIC_INLINE int x86_is_imm8(uae_s32 x)
+{
+	return (x>=-128 && x<=127);
+}
+
+/* ========================================================================= */
+/* --- ENCODINGS ----------------------------------------------------------- */
+/* ========================================================================= */
+
+/* Operand size prefix and REX byte. A REX byte is also needed to address
+   SPL, BPL, SIL and DIL instead of AH, CH, DH and BH in byte operations. */
+STATIC_INLINE void x86_prefix(int size, int reg, int index, int base, int byteregs)
+{
+	int rex = 0;
+
+	if (size == 2)
+		_B(0x66);
+	if (size == 8)
+		rex |= 0x08;
+	if (reg & 8)
+		rex |= 0x04;
+	if (index != X86_NOREG && (index & 8))
+		rex |= 0x02;
+	if (base != X86_NOREG && (base & 8))
+		rex |= 0x01;
+	if (rex || (size == 1 && byteregs))
+		_B(0x40 | rex);
+}
+
+STATIC_INLINE void x86_opcode(int op)
+{
+	if (op > 0xff)
+		_B(op >> 8);
+	_B(op & 0xff);
+}
+
+STATIC_INLINE int x86_byteregs(int r1, int r2)
+{
+	return (r1 >= 4 && r1 < 8) || (r2 >= 4 && r2 < 8);
+}
+
+/* op reg, rm (both registers) */
+STATIC_INLINE void x86_rr(int size, int op, int reg, int rm)
+{
+	x86_prefix(size, reg, X86_NOREG, rm, size == 1 && x86_byteregs(reg, rm));
+	x86_opcode(op);
+	_B(0xc0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+/* op reg, [base + index * factor + disp]. base and index may be X86_NOREG,
+   without a base the displacement is an absolute address. */
+STATIC_INLINE void x86_rm(int size, int op, int reg, int base, int index, int factor, uae_s32 disp)
+{
+	int scale = (factor == 8) ? 3 : (factor == 4) ? 2 : (factor == 2) ? 1 : 0;
+	int r = (reg & 7) << 3;
+
+	x86_prefix(size, reg, index, base, size == 1 && reg >= 4 && reg < 8);
+	x86_opcode(op);
+	if (base == X86_NOREG) {
+		/* [index * factor + disp32] or [disp32], both need a SIB byte
+		   since mod 00 rm 101 is RIP relative in 64 bit mode */
+		_B(0x04 | r);
+		_B((scale << 6) | ((index == X86_NOREG ? 4 : index) & 7) << 3 | 5);
+		_L(disp);
+		return;
+	}
+
+	int mod;
+	if (disp == 0 && (base & 7) != 5)
+		mod = 0x00;
+	else if (x86_is_imm8(disp))
+		mod = 0x40;
+	else
+		mod = 0x80;
+
+	if (index == X86_NOREG && (base & 7) != 4) {
+		_B(mod | r | (base & 7));
+	}
+	else {
+		/* RSP and R12 as base always need a SIB byte */
+		_B(mod | r | 4);
+		_B((scale << 6) | ((index == X86_NOREG ? 4 : index) & 7) << 3 | (base & 7));
+	}
+	if (mod == 0x40)
+		_B(disp);
+	else if (mod == 0x80)
+		_L(disp);
+}
+
+/* Group 1 ALU operations, /digit for the immediate forms and the opcode
+   of "op r/m8, r8" for the register forms */
+#define X86_ALU_ADD		0
+#define X86_ALU_OR		1
+#define X86_ALU_ADC		2
+#define X86_ALU_SBB		3
+#define X86_ALU_AND		4
+#define X86_ALU_SUB		5
+#define X86_ALU_XOR		6
+#define X86_ALU_CMP		7
+
+/* op d, s */
+STATIC_INLINE void x86_alu_rr(int size, int alu, int d, int s)
+{
+	x86_rr(size, (alu << 3) | (size == 1 ? 0x00 : 0x01), s, d);
+}
+
+/* op d, imm */
+STATIC_INLINE void x86_alu_ri(int size, int alu, int d, uae_s32 i)
+{
+	if (size == 1) {
+		x86_rr(1, 0x80, alu, d);
+		_B(i);
+	}
+	else if (x86_is_imm8(i)) {
+		x86_rr(size, 0x83, alu, d);
+		_B(i);
+	}
+	else {
+		x86_rr(size, 0x81, alu, d);
+		if (size == 2)
+			emit_word(i);
+		else
+			_L(i);
+	}
+}
+
+/* op [base + disp], imm */
+STATIC_INLINE void x86_alu_mi(int size, int alu, int base, uae_s32 disp, uae_s32 i)
+{
+	if (size == 1) {
+		x86_rm(1, 0x80, alu, base, X86_NOREG, 1, disp);
+		_B(i);
+	}
+	else if (x86_is_imm8(i)) {
+		x86_rm(size, 0x83, alu, base, X86_NOREG, 1, disp);
+		_B(i);
+	}
+	else {
+		x86_rm(size, 0x81, alu, base, X86_NOREG, 1, disp);
+		if (size == 2)
+			emit_word(i);
+		else
+			_L(i);
+	}
+}
+
+/* Group 2 shift operations, /digit */
+#define X86_SHF_ROL		0
+#define X86_SHF_ROR		1
+#define X86_SHF_SHL		4
+#define X86_SHF_SHR		5
+#define X86_SHF_SAR		7
+
+/* shift r, imm */
+STATIC_INLINE void x86_shift_ri(int size, int shf, int r, int i)
+{
+	x86_rr(size, size == 1 ? 0xc0 : 0xc1, shf, r);
+	_B(i);
+}
+
+/* shift r, cl */
+STATIC_INLINE void x86_shift_rcl(int size, int shf, int r)
+{
+	x86_rr(size, size == 1 ? 0xd2 : 0xd3, shf, r);
+}
+
+/* mov d, [base + index * factor + disp] */
+STATIC_INLINE void x86_load(int size, int d, int base, int index, int factor, uae_s32 disp)
+{
+	x86_rm(size, size == 1 ? 0x8a : 0x8b, d, base, index, factor, disp);
+}
+
+/* mov [base + index * factor + disp], s */
+STATIC_INLINE void x86_store(int size, int s, int base, int index, int factor, uae_s32 disp)
+{
+	x86_rm(size, size == 1 ? 0x88 : 0x89, s, base, index, factor, disp);
+}
+
+/* mov [base + disp], imm */
+STATIC_INLINE void x86_store_imm(int size, int base, uae_s32 disp, uae_s32 i)
+{
+	x86_rm(size, size == 1 ? 0xc6 : 0xc7, 0, base, X86_NOREG, 1, disp);
+	if (size == 1)
+		_B(i);
+	else if (size == 2)
+		emit_word(i);
+	else
+		_L(i);
+}
+
+/* lea d, [base + index * factor + disp], 32 bit result */
+STATIC_INLINE void x86_lea(int d, int base, int index, int factor, uae_s32 disp)
+{
+	x86_rm(4, 0x8d, d, base, index, factor, disp);
+}
+
+/* Branches. The 32 bit displacement is relative to the end of the
+   instruction, i.e. to the address after the displacement itself. */
+#define X86_JMP_rel32	0xe9
+#define X86_CALL_rel32	0xe8
+#define X86_Jcc_rel32(cc)	(0x0f80 | (cc))
+#define X86_Jcc_rel8(cc)	(0x70 | (cc))
+
+#endif /* X86_RTASM_H */
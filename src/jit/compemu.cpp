@@ -5,6 +5,7 @@
 #include "memory.h"
 #include "newcpu.h"
 #include "custom.h"
+#include "events.h"
 #include "comptbl.h"
 #include "debug.h"
 #include "compemu.h"
@@ -1295,77 +1296,6 @@ unsigned long REGPARAM2 op_179_0_comp_ff(uae_u32 opcode) /* BCHG */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_17a_0_comp_ff(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_17b_0_comp_ff(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_180_0_comp_ff(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -1655,77 +1585,6 @@ unsigned long REGPARAM2 op_1b9_0_comp_ff(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1ba_0_comp_ff(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_1bb_0_comp_ff(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_1c0_0_comp_ff(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -2015,77 +1874,6 @@ unsigned long REGPARAM2 op_1f9_0_comp_ff(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1fa_0_comp_ff(uae_u32 opcode) /* BSET */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	bts_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_1fb_0_comp_ff(uae_u32 opcode) /* BSET */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	bts_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_200_0_comp_ff(uae_u32 opcode) /* AND */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -4582,69 +4370,6 @@ unsigned long REGPARAM2 op_879_0_comp_ff(uae_u32 opcode) /* BCHG */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_87a_0_comp_ff(uae_u32 opcode) /* BCHG */
-{
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_87b_0_comp_ff(uae_u32 opcode) /* BCHG */
-{
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_880_0_comp_ff(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -4902,69 +4627,6 @@ unsigned long REGPARAM2 op_8b9_0_comp_ff(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8ba_0_comp_ff(uae_u32 opcode) /* BCLR */
-{
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_8bb_0_comp_ff(uae_u32 opcode) /* BCLR */
-{
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_8c0_0_comp_ff(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5222,69 +4884,6 @@ unsigned long REGPARAM2 op_8f9_0_comp_ff(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8fa_0_comp_ff(uae_u32 opcode) /* BSET */
-{
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	bts_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_8fb_0_comp_ff(uae_u32 opcode) /* BSET */
-{
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	bts_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	start_needflags();
-	set_zero(s,tmp);
-	live_flags();
-	end_needflags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_a00_0_comp_ff(uae_u32 opcode) /* EOR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5738,9 +5337,6 @@ unsigned long REGPARAM2 op_a90_0_comp_ff(uae_u32 opcode) /* EOR */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_2
 unsigned long REGPARAM2 op_a98_0_comp_ff(uae_u32 opcode) /* EOR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -5891,6 +5487,9 @@ unsigned long REGPARAM2 op_ab9_0_comp_ff(uae_u32 opcode) /* EOR */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_2
 unsigned long REGPARAM2 op_c00_0_comp_ff(uae_u32 opcode) /* CMP */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -11308,9 +10907,6 @@ unsigned long REGPARAM2 op_2178_0_comp_ff(uae_u32 opcode) /* MOVE */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_3
 unsigned long REGPARAM2 op_2179_0_comp_ff(uae_u32 opcode) /* MOVE */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -11480,6 +11076,9 @@ unsigned long REGPARAM2 op_2188_0_comp_ff(uae_u32 opcode) /* MOVE */
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_3
 unsigned long REGPARAM2 op_2190_0_comp_ff(uae_u32 opcode) /* MOVE */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -15511,14 +15110,14 @@ unsigned long REGPARAM2 op_4000_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15555,14 +15154,14 @@ unsigned long REGPARAM2 op_4010_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15598,14 +15197,14 @@ unsigned long REGPARAM2 op_4018_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15642,14 +15241,14 @@ unsigned long REGPARAM2 op_4020_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15685,14 +15284,14 @@ unsigned long REGPARAM2 op_4028_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15727,14 +15326,14 @@ unsigned long REGPARAM2 op_4030_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15764,14 +15363,14 @@ unsigned long REGPARAM2 op_4038_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15801,14 +15400,14 @@ unsigned long REGPARAM2 op_4039_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15840,14 +15439,14 @@ unsigned long REGPARAM2 op_4040_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15884,14 +15483,14 @@ unsigned long REGPARAM2 op_4050_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15927,14 +15526,14 @@ unsigned long REGPARAM2 op_4058_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -15971,14 +15570,14 @@ unsigned long REGPARAM2 op_4060_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16014,14 +15613,14 @@ unsigned long REGPARAM2 op_4068_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16056,14 +15655,14 @@ unsigned long REGPARAM2 op_4070_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16093,14 +15692,14 @@ unsigned long REGPARAM2 op_4078_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16130,14 +15729,14 @@ unsigned long REGPARAM2 op_4079_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16169,14 +15768,14 @@ unsigned long REGPARAM2 op_4080_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16213,14 +15812,14 @@ unsigned long REGPARAM2 op_4090_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16256,14 +15855,14 @@ unsigned long REGPARAM2 op_4098_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16300,14 +15899,14 @@ unsigned long REGPARAM2 op_40a0_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16343,14 +15942,14 @@ unsigned long REGPARAM2 op_40a8_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16385,14 +15984,14 @@ unsigned long REGPARAM2 op_40b0_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16422,14 +16021,14 @@ unsigned long REGPARAM2 op_40b8_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -16459,14 +16058,14 @@ unsigned long REGPARAM2 op_40b9_0_comp_ff(uae_u32 opcode) /* NEGX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -21435,9 +21034,6 @@ if (!(needed_flags & FLAG_CZNV)) dont_care_flags();
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_5
 unsigned long REGPARAM2 op_5088_0_comp_ff(uae_u32 opcode) /* ADDA */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -21467,6 +21063,9 @@ unsigned long REGPARAM2 op_5088_0_comp_ff(uae_u32 opcode) /* ADDA */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_5
 unsigned long REGPARAM2 op_5090_0_comp_ff(uae_u32 opcode) /* ADD */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -22750,7 +22349,7 @@ unsigned long REGPARAM2 op_51c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 {	uae_u32 v2;
 	uae_u32 v1=get_const(PC_P);
 	v2=get_const(offs);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -22905,7 +22504,7 @@ unsigned long REGPARAM2 op_52c0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -22937,12 +22536,12 @@ unsigned long REGPARAM2 op_52c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,8);
-	cmov_l_rr(src,nsrc,8);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_HI);
+	cmov_l_rr(src,nsrc,NATIVE_CC_HI);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -22964,7 +22563,7 @@ unsigned long REGPARAM2 op_52d0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -22986,7 +22585,7 @@ unsigned long REGPARAM2 op_52d8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23009,7 +22608,7 @@ unsigned long REGPARAM2 op_52e0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23031,7 +22630,7 @@ unsigned long REGPARAM2 op_52e8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23052,7 +22651,7 @@ unsigned long REGPARAM2 op_52f0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23068,7 +22667,7 @@ unsigned long REGPARAM2 op_52f8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23084,7 +22683,7 @@ unsigned long REGPARAM2 op_52f9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23104,7 +22703,7 @@ unsigned long REGPARAM2 op_53c0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -23136,12 +22735,12 @@ unsigned long REGPARAM2 op_53c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,9);
-	cmov_l_rr(src,nsrc,9);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_LS);
+	cmov_l_rr(src,nsrc,NATIVE_CC_LS);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23163,7 +22762,7 @@ unsigned long REGPARAM2 op_53d0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23185,7 +22784,7 @@ unsigned long REGPARAM2 op_53d8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23208,7 +22807,7 @@ unsigned long REGPARAM2 op_53e0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23230,7 +22829,7 @@ unsigned long REGPARAM2 op_53e8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23251,7 +22850,7 @@ unsigned long REGPARAM2 op_53f0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23267,7 +22866,7 @@ unsigned long REGPARAM2 op_53f8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23283,7 +22882,7 @@ unsigned long REGPARAM2 op_53f9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23303,7 +22902,7 @@ unsigned long REGPARAM2 op_54c0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -23335,12 +22934,12 @@ unsigned long REGPARAM2 op_54c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,3);
-	cmov_l_rr(src,nsrc,3);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_CC);
+	cmov_l_rr(src,nsrc,NATIVE_CC_CC);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23362,7 +22961,7 @@ unsigned long REGPARAM2 op_54d0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23384,7 +22983,7 @@ unsigned long REGPARAM2 op_54d8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23407,7 +23006,7 @@ unsigned long REGPARAM2 op_54e0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23429,7 +23028,7 @@ unsigned long REGPARAM2 op_54e8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23450,7 +23049,7 @@ unsigned long REGPARAM2 op_54f0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23466,7 +23065,7 @@ unsigned long REGPARAM2 op_54f8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23482,7 +23081,7 @@ unsigned long REGPARAM2 op_54f9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23502,7 +23101,7 @@ unsigned long REGPARAM2 op_55c0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -23534,12 +23133,12 @@ unsigned long REGPARAM2 op_55c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,2);
-	cmov_l_rr(src,nsrc,2);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_CS);
+	cmov_l_rr(src,nsrc,NATIVE_CC_CS);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23561,7 +23160,7 @@ unsigned long REGPARAM2 op_55d0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23583,7 +23182,7 @@ unsigned long REGPARAM2 op_55d8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23606,7 +23205,7 @@ unsigned long REGPARAM2 op_55e0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23628,7 +23227,7 @@ unsigned long REGPARAM2 op_55e8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23649,7 +23248,7 @@ unsigned long REGPARAM2 op_55f0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23665,7 +23264,7 @@ unsigned long REGPARAM2 op_55f8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23681,7 +23280,7 @@ unsigned long REGPARAM2 op_55f9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23701,7 +23300,7 @@ unsigned long REGPARAM2 op_56c0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -23733,12 +23332,12 @@ unsigned long REGPARAM2 op_56c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,1);
-	cmov_l_rr(src,nsrc,1);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_NE);
+	cmov_l_rr(src,nsrc,NATIVE_CC_NE);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23760,7 +23359,7 @@ unsigned long REGPARAM2 op_56d0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23782,7 +23381,7 @@ unsigned long REGPARAM2 op_56d8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23805,7 +23404,7 @@ unsigned long REGPARAM2 op_56e0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23827,7 +23426,7 @@ unsigned long REGPARAM2 op_56e8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23848,7 +23447,7 @@ unsigned long REGPARAM2 op_56f0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23864,7 +23463,7 @@ unsigned long REGPARAM2 op_56f8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23880,7 +23479,7 @@ unsigned long REGPARAM2 op_56f9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23900,7 +23499,7 @@ unsigned long REGPARAM2 op_57c0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -23932,12 +23531,12 @@ unsigned long REGPARAM2 op_57c8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,0);
-	cmov_l_rr(src,nsrc,0);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_EQ);
+	cmov_l_rr(src,nsrc,NATIVE_CC_EQ);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23959,7 +23558,7 @@ unsigned long REGPARAM2 op_57d0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -23981,7 +23580,7 @@ unsigned long REGPARAM2 op_57d8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24004,7 +23603,7 @@ unsigned long REGPARAM2 op_57e0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24026,7 +23625,7 @@ unsigned long REGPARAM2 op_57e8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24047,7 +23646,7 @@ unsigned long REGPARAM2 op_57f0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24063,7 +23662,7 @@ unsigned long REGPARAM2 op_57f8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24079,7 +23678,7 @@ unsigned long REGPARAM2 op_57f9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24099,7 +23698,7 @@ unsigned long REGPARAM2 op_5ac0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -24131,12 +23730,12 @@ unsigned long REGPARAM2 op_5ac8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,5);
-	cmov_l_rr(src,nsrc,5);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_PL);
+	cmov_l_rr(src,nsrc,NATIVE_CC_PL);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24158,7 +23757,7 @@ unsigned long REGPARAM2 op_5ad0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24180,7 +23779,7 @@ unsigned long REGPARAM2 op_5ad8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24203,7 +23802,7 @@ unsigned long REGPARAM2 op_5ae0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24225,7 +23824,7 @@ unsigned long REGPARAM2 op_5ae8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24246,7 +23845,7 @@ unsigned long REGPARAM2 op_5af0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24262,7 +23861,7 @@ unsigned long REGPARAM2 op_5af8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24278,7 +23877,7 @@ unsigned long REGPARAM2 op_5af9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24298,7 +23897,7 @@ unsigned long REGPARAM2 op_5bc0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -24330,12 +23929,12 @@ unsigned long REGPARAM2 op_5bc8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,4);
-	cmov_l_rr(src,nsrc,4);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_MI);
+	cmov_l_rr(src,nsrc,NATIVE_CC_MI);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24357,7 +23956,7 @@ unsigned long REGPARAM2 op_5bd0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24379,7 +23978,7 @@ unsigned long REGPARAM2 op_5bd8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24402,7 +24001,7 @@ unsigned long REGPARAM2 op_5be0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24424,7 +24023,7 @@ unsigned long REGPARAM2 op_5be8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24445,7 +24044,7 @@ unsigned long REGPARAM2 op_5bf0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24461,7 +24060,7 @@ unsigned long REGPARAM2 op_5bf8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24477,7 +24076,7 @@ unsigned long REGPARAM2 op_5bf9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24497,7 +24096,7 @@ unsigned long REGPARAM2 op_5cc0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -24529,12 +24128,12 @@ unsigned long REGPARAM2 op_5cc8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,10);
-	cmov_l_rr(src,nsrc,10);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_GE);
+	cmov_l_rr(src,nsrc,NATIVE_CC_GE);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24556,7 +24155,7 @@ unsigned long REGPARAM2 op_5cd0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24578,7 +24177,7 @@ unsigned long REGPARAM2 op_5cd8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24601,7 +24200,7 @@ unsigned long REGPARAM2 op_5ce0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24623,7 +24222,7 @@ unsigned long REGPARAM2 op_5ce8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24644,7 +24243,7 @@ unsigned long REGPARAM2 op_5cf0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24660,7 +24259,7 @@ unsigned long REGPARAM2 op_5cf8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24676,7 +24275,7 @@ unsigned long REGPARAM2 op_5cf9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24696,7 +24295,7 @@ unsigned long REGPARAM2 op_5dc0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -24728,12 +24327,12 @@ unsigned long REGPARAM2 op_5dc8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,11);
-	cmov_l_rr(src,nsrc,11);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_LT);
+	cmov_l_rr(src,nsrc,NATIVE_CC_LT);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24755,7 +24354,7 @@ unsigned long REGPARAM2 op_5dd0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24777,7 +24376,7 @@ unsigned long REGPARAM2 op_5dd8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24800,7 +24399,7 @@ unsigned long REGPARAM2 op_5de0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24822,7 +24421,7 @@ unsigned long REGPARAM2 op_5de8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24843,7 +24442,7 @@ unsigned long REGPARAM2 op_5df0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24859,7 +24458,7 @@ unsigned long REGPARAM2 op_5df8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24875,7 +24474,7 @@ unsigned long REGPARAM2 op_5df9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24895,7 +24494,7 @@ unsigned long REGPARAM2 op_5ec0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -24927,12 +24526,12 @@ unsigned long REGPARAM2 op_5ec8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,12);
-	cmov_l_rr(src,nsrc,12);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_GT);
+	cmov_l_rr(src,nsrc,NATIVE_CC_GT);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24954,7 +24553,7 @@ unsigned long REGPARAM2 op_5ed0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24976,7 +24575,7 @@ unsigned long REGPARAM2 op_5ed8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -24999,7 +24598,7 @@ unsigned long REGPARAM2 op_5ee0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25021,7 +24620,7 @@ unsigned long REGPARAM2 op_5ee8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25042,7 +24641,7 @@ unsigned long REGPARAM2 op_5ef0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25058,7 +24657,7 @@ unsigned long REGPARAM2 op_5ef8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25074,7 +24673,7 @@ unsigned long REGPARAM2 op_5ef9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25094,7 +24693,7 @@ unsigned long REGPARAM2 op_5fc0_0_comp_ff(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -25126,12 +24725,12 @@ unsigned long REGPARAM2 op_5fc8_0_comp_ff(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,13);
-	cmov_l_rr(src,nsrc,13);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_LE);
+	cmov_l_rr(src,nsrc,NATIVE_CC_LE);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25153,7 +24752,7 @@ unsigned long REGPARAM2 op_5fd0_0_comp_ff(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25175,7 +24774,7 @@ unsigned long REGPARAM2 op_5fd8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25198,7 +24797,7 @@ unsigned long REGPARAM2 op_5fe0_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25220,7 +24819,7 @@ unsigned long REGPARAM2 op_5fe8_0_comp_ff(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25241,7 +24840,7 @@ unsigned long REGPARAM2 op_5ff0_0_comp_ff(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25257,7 +24856,7 @@ unsigned long REGPARAM2 op_5ff8_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25273,7 +24872,7 @@ unsigned long REGPARAM2 op_5ff9_0_comp_ff(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -25296,7 +24895,7 @@ unsigned long REGPARAM2 op_6000_0_comp_ff(uae_u32 opcode) /* Bcc */
 	arm_ADD_l_ri(PC_P,m68k_pc_offset);
 	m68k_pc_offset=0;
 	mov_l_rr(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -25322,7 +24921,7 @@ unsigned long REGPARAM2 op_6001_0_comp_ff(uae_u32 opcode) /* Bcc */
 	arm_ADD_l_ri(PC_P,m68k_pc_offset);
 	m68k_pc_offset=0;
 	mov_l_rr(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -25342,7 +24941,7 @@ unsigned long REGPARAM2 op_60ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	arm_ADD_l_ri(PC_P,m68k_pc_offset);
 	m68k_pc_offset=0;
 	mov_l_rr(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -25362,7 +24961,7 @@ unsigned long REGPARAM2 op_6100_0_comp_ff(uae_u32 opcode) /* BSR */
 	arm_ADD_l_ri(src,m68k_pc_offset_thisinst+2);
 	m68k_pc_offset=0;
 	arm_ADD_l(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -25387,7 +24986,7 @@ unsigned long REGPARAM2 op_6101_0_comp_ff(uae_u32 opcode) /* BSR */
 	arm_ADD_l_ri(src,m68k_pc_offset_thisinst+2);
 	m68k_pc_offset=0;
 	arm_ADD_l(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -25409,7 +25008,7 @@ unsigned long REGPARAM2 op_6200_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,8);
+	register_branch(v1,v2,NATIVE_CC_HI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25437,11 +25036,14 @@ unsigned long REGPARAM2 op_6201_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,8);
+	register_branch(v1,v2,NATIVE_CC_HI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_6
 unsigned long REGPARAM2 op_62ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 dodgy=0;
@@ -25459,7 +25061,7 @@ unsigned long REGPARAM2 op_62ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,8);
+	register_branch(v1,v2,NATIVE_CC_HI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25482,14 +25084,11 @@ unsigned long REGPARAM2 op_6300_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,9);
+	register_branch(v1,v2,NATIVE_CC_LS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_6
 unsigned long REGPARAM2 op_6301_0_comp_ff(uae_u32 opcode) /* Bcc */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -25513,7 +25112,7 @@ unsigned long REGPARAM2 op_6301_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,9);
+	register_branch(v1,v2,NATIVE_CC_LS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25535,7 +25134,7 @@ unsigned long REGPARAM2 op_63ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,9);
+	register_branch(v1,v2,NATIVE_CC_LS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25558,7 +25157,7 @@ unsigned long REGPARAM2 op_6400_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25586,7 +25185,7 @@ unsigned long REGPARAM2 op_6401_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25608,7 +25207,7 @@ unsigned long REGPARAM2 op_64ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25631,7 +25230,7 @@ unsigned long REGPARAM2 op_6500_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,2);
+	register_branch(v1,v2,NATIVE_CC_CS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25659,7 +25258,7 @@ unsigned long REGPARAM2 op_6501_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,2);
+	register_branch(v1,v2,NATIVE_CC_CS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25681,7 +25280,7 @@ unsigned long REGPARAM2 op_65ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,2);
+	register_branch(v1,v2,NATIVE_CC_CS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25704,7 +25303,7 @@ unsigned long REGPARAM2 op_6600_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,1);
+	register_branch(v1,v2,NATIVE_CC_NE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25732,7 +25331,7 @@ unsigned long REGPARAM2 op_6601_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,1);
+	register_branch(v1,v2,NATIVE_CC_NE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25754,7 +25353,7 @@ unsigned long REGPARAM2 op_66ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,1);
+	register_branch(v1,v2,NATIVE_CC_NE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25777,7 +25376,7 @@ unsigned long REGPARAM2 op_6700_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,0);
+	register_branch(v1,v2,NATIVE_CC_EQ);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25805,7 +25404,7 @@ unsigned long REGPARAM2 op_6701_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,0);
+	register_branch(v1,v2,NATIVE_CC_EQ);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25827,7 +25426,7 @@ unsigned long REGPARAM2 op_67ff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,0);
+	register_branch(v1,v2,NATIVE_CC_EQ);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25850,7 +25449,7 @@ unsigned long REGPARAM2 op_6a00_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,5);
+	register_branch(v1,v2,NATIVE_CC_PL);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25878,7 +25477,7 @@ unsigned long REGPARAM2 op_6a01_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,5);
+	register_branch(v1,v2,NATIVE_CC_PL);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25900,7 +25499,7 @@ unsigned long REGPARAM2 op_6aff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,5);
+	register_branch(v1,v2,NATIVE_CC_PL);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25923,7 +25522,7 @@ unsigned long REGPARAM2 op_6b00_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,4);
+	register_branch(v1,v2,NATIVE_CC_MI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25951,7 +25550,7 @@ unsigned long REGPARAM2 op_6b01_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,4);
+	register_branch(v1,v2,NATIVE_CC_MI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25973,7 +25572,7 @@ unsigned long REGPARAM2 op_6bff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,4);
+	register_branch(v1,v2,NATIVE_CC_MI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -25996,7 +25595,7 @@ unsigned long REGPARAM2 op_6c00_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,10);
+	register_branch(v1,v2,NATIVE_CC_GE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26024,7 +25623,7 @@ unsigned long REGPARAM2 op_6c01_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,10);
+	register_branch(v1,v2,NATIVE_CC_GE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26046,7 +25645,7 @@ unsigned long REGPARAM2 op_6cff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,10);
+	register_branch(v1,v2,NATIVE_CC_GE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26069,7 +25668,7 @@ unsigned long REGPARAM2 op_6d00_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,11);
+	register_branch(v1,v2,NATIVE_CC_LT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26097,7 +25696,7 @@ unsigned long REGPARAM2 op_6d01_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,11);
+	register_branch(v1,v2,NATIVE_CC_LT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26119,7 +25718,7 @@ unsigned long REGPARAM2 op_6dff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,11);
+	register_branch(v1,v2,NATIVE_CC_LT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26142,7 +25741,7 @@ unsigned long REGPARAM2 op_6e00_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,12);
+	register_branch(v1,v2,NATIVE_CC_GT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26170,7 +25769,7 @@ unsigned long REGPARAM2 op_6e01_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,12);
+	register_branch(v1,v2,NATIVE_CC_GT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26192,7 +25791,7 @@ unsigned long REGPARAM2 op_6eff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,12);
+	register_branch(v1,v2,NATIVE_CC_GT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26215,7 +25814,7 @@ unsigned long REGPARAM2 op_6f00_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,13);
+	register_branch(v1,v2,NATIVE_CC_LE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26243,7 +25842,7 @@ unsigned long REGPARAM2 op_6f01_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,13);
+	register_branch(v1,v2,NATIVE_CC_LE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -26265,7 +25864,7 @@ unsigned long REGPARAM2 op_6fff_0_comp_ff(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,13);
+	register_branch(v1,v2,NATIVE_CC_LE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -29352,14 +28951,14 @@ unsigned long REGPARAM2 op_9100_0_comp_ff(uae_u32 opcode) /* SUBX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -29406,14 +29005,14 @@ unsigned long REGPARAM2 op_9108_0_comp_ff(uae_u32 opcode) /* SUBX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -29668,14 +29267,14 @@ unsigned long REGPARAM2 op_9140_0_comp_ff(uae_u32 opcode) /* SUBX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -29722,14 +29321,14 @@ unsigned long REGPARAM2 op_9148_0_comp_ff(uae_u32 opcode) /* SUBX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -29984,14 +29583,14 @@ unsigned long REGPARAM2 op_9180_0_comp_ff(uae_u32 opcode) /* SUBX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -30038,14 +29637,14 @@ unsigned long REGPARAM2 op_9188_0_comp_ff(uae_u32 opcode) /* SUBX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	sbb_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -31331,6 +30930,9 @@ if (!(needed_flags & FLAG_CZNV)) dont_care_flags();
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_7
 unsigned long REGPARAM2 op_b090_0_comp_ff(uae_u32 opcode) /* CMP */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -31456,9 +31058,6 @@ if (!(needed_flags & FLAG_CZNV)) dont_care_flags();
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_7
 unsigned long REGPARAM2 op_b0b0_0_comp_ff(uae_u32 opcode) /* CMP */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -37059,14 +36658,14 @@ unsigned long REGPARAM2 op_d100_0_comp_ff(uae_u32 opcode) /* ADDX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	adc_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -37113,14 +36712,14 @@ unsigned long REGPARAM2 op_d108_0_comp_ff(uae_u32 opcode) /* ADDX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	adc_b(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -37375,14 +36974,14 @@ unsigned long REGPARAM2 op_d140_0_comp_ff(uae_u32 opcode) /* ADDX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	adc_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -37429,14 +37028,14 @@ unsigned long REGPARAM2 op_d148_0_comp_ff(uae_u32 opcode) /* ADDX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	adc_w(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -37691,14 +37290,14 @@ unsigned long REGPARAM2 op_d180_0_comp_ff(uae_u32 opcode) /* ADDX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	adc_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -37745,14 +37344,14 @@ unsigned long REGPARAM2 op_d188_0_comp_ff(uae_u32 opcode) /* ADDX */
 	mov_l_ri(zero,0);
 	mov_l_ri(one,-1);
 	make_flags_live();
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	}
 	restore_carry();
 	start_needflags();
 	adc_l(dst,src);
 	live_flags();
 	if (needed_flags&FLAG_Z) {
-	cmov_l_rr(zero,one,1);
+	cmov_l_rr(zero,one,NATIVE_CC_NE);
 	set_zero(zero, one);
 	live_flags();
 	}
@@ -38475,20 +38074,20 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shra_b_rr(data,cnt);
 	highmask=0x38;
 	width=8;
 test_l_ri(cnt,highmask);
 mov_l_ri(highshift,0);
 mov_l_ri(scratchie,width/2);
-cmov_l_rr(highshift,scratchie,1);
+cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);
 	shra_b_rr(data,highshift);
 	shra_b_rr(data,highshift);
 	sub_l_ri(tmpcnt,1);
 	shra_b_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
-cmov_l_rr(cdata,data,1);
+cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_b_rr(data,data);
@@ -38503,6 +38102,9 @@ if (!(needed_flags & FLAG_CZNV)) dont_care_flags();
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 return 0;
 }
+#endif
+
+#ifdef PART_8
 unsigned long REGPARAM2 op_e028_0_comp_ff(uae_u32 opcode) /* LSR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -38532,18 +38134,18 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shrl_b_rr(data,cnt);
 	highmask=0x38;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_b_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shrl_b_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_b_rr(data,data);
@@ -38705,9 +38307,6 @@ unsigned long REGPARAM2 op_e058_0_comp_ff(uae_u32 opcode) /* ROR */
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 return 0;
 }
-#endif
-
-#ifdef PART_8
 unsigned long REGPARAM2 op_e060_0_comp_ff(uae_u32 opcode) /* ASR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -38739,20 +38338,20 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shra_w_rr(data,cnt);
 	highmask=0x30;
 	width=16;
 test_l_ri(cnt,highmask);
 mov_l_ri(highshift,0);
 mov_l_ri(scratchie,width/2);
-cmov_l_rr(highshift,scratchie,1);
+cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);
 	shra_w_rr(data,highshift);
 	shra_w_rr(data,highshift);
 	sub_l_ri(tmpcnt,1);
 	shra_w_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
-cmov_l_rr(cdata,data,1);
+cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_w_rr(data,data);
@@ -38796,18 +38395,18 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shrl_w_rr(data,cnt);
 	highmask=0x30;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_w_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shrl_w_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_w_rr(data,data);
@@ -39000,20 +38599,20 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shra_l_rr(data,cnt);
 	highmask=0x20;
 	width=32;
 test_l_ri(cnt,highmask);
 mov_l_ri(highshift,0);
 mov_l_ri(scratchie,width/2);
-cmov_l_rr(highshift,scratchie,1);
+cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);
 	shra_l_rr(data,highshift);
 	shra_l_rr(data,highshift);
 	sub_l_ri(tmpcnt,1);
 	shra_l_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
-cmov_l_rr(cdata,data,1);
+cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_l_rr(data,data);
@@ -39057,18 +38656,18 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shrl_l_rr(data,cnt);
 	highmask=0x20;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_l_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shrl_l_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_l_rr(data,data);
@@ -39267,18 +38866,18 @@ if (needed_flags & FLAG_V) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shll_b_rr(data,cnt);
 	highmask=0x38;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_b_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shll_b_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_b_rr(data,data);
@@ -39322,18 +38921,18 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shll_b_rr(data,cnt);
 	highmask=0x38;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_b_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shll_b_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_b_rr(data,data);
@@ -39532,18 +39131,18 @@ if (needed_flags & FLAG_V) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shll_w_rr(data,cnt);
 	highmask=0x30;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_w_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shll_w_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_w_rr(data,data);
@@ -39587,18 +39186,18 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shll_w_rr(data,cnt);
 	highmask=0x30;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_w_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shll_w_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_w_rr(data,data);
@@ -39797,18 +39396,18 @@ if (needed_flags & FLAG_V) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shll_l_rr(data,cnt);
 	highmask=0x20;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_l_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shll_l_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_l_rr(data,data);
@@ -39852,18 +39451,18 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	mov_l_rr(tmpcnt,cnt);
 	and_l_ri(tmpcnt,63);
 	mov_l_ri(cdata,0);
-	cmov_l_rr(cdata,data,1);
+	cmov_l_rr(cdata,data,NATIVE_CC_NE);
 	shll_l_rr(data,cnt);
 	highmask=0x20;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_l_rr(data,scratchie);
 	sub_l_ri(tmpcnt,1);
 	shll_l_rr(cdata,tmpcnt);
 test_l_ri(tmpcnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(cdata,scratchie,1);
+cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);
 	start_needflags();
 	if (needed_flags & FLAG_ZNV)
 	  test_l_rr(data,data);
@@ -39914,6 +39513,411 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 return 0;
 }
+unsigned long REGPARAM2 op_f200_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f208_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f210_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f218_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f220_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f228_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f230_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f238_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f239_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f23a_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+	uae_s32 dstreg = 2;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f23b_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+	uae_s32 dstreg = 3;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f23c_0_comp_ff(uae_u32 opcode) /* FPP */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f240_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f250_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f258_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f260_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f268_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f270_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f278_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f279_0_comp_ff(uae_u32 opcode) /* FScc */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f280_0_comp_ff(uae_u32 opcode) /* FBcc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f2c0_0_comp_ff(uae_u32 opcode) /* FBcc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
 unsigned long REGPARAM2 op_f600_0_comp_ff(uae_u32 opcode) /* MOVE16 */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41259,327 +41263,7 @@ unsigned long REGPARAM2 op_158_0_comp_nf(uae_u32 opcode) /* BCHG */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_160_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{{	int dsta=dodgy?scratchie++:dstreg+8;
-	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
-	if (dodgy) 
-	mov_l_rr(dsta,8+dstreg);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_168_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	mov_l_rr(dsta,8+dstreg);
-	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_170_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_178_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_179_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_17a_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_17b_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_180_0_comp_nf(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dst=dstreg;
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,31);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	if(dstreg!=dst)
-		mov_l_rr(dstreg,dst);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_190_0_comp_nf(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=dodgy?scratchie++:dstreg+8;
-	if (dodgy) 
-		mov_l_rr(dsta,dstreg+8);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_198_0_comp_nf(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_s32 srcreg = ((opcode >> 9) & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src=srcreg;
-{	int dsta=scratchie++;
-	mov_l_rr(dsta,dstreg+8);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41587,7 +41271,7 @@ unsigned long REGPARAM2 op_198_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1a0_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_160_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41614,7 +41298,7 @@ unsigned long REGPARAM2 op_1a0_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41622,7 +41306,7 @@ unsigned long REGPARAM2 op_1a0_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1a8_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_168_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41648,7 +41332,7 @@ unsigned long REGPARAM2 op_1a8_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41656,7 +41340,7 @@ unsigned long REGPARAM2 op_1a8_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1b0_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_170_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41681,7 +41365,7 @@ unsigned long REGPARAM2 op_1b0_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41689,7 +41373,7 @@ unsigned long REGPARAM2 op_1b0_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1b8_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_178_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41709,7 +41393,7 @@ unsigned long REGPARAM2 op_1b8_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41717,7 +41401,7 @@ unsigned long REGPARAM2 op_1b8_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1b9_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_179_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41737,7 +41421,7 @@ unsigned long REGPARAM2 op_1b9_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41745,23 +41429,57 @@ unsigned long REGPARAM2 op_1b9_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1ba_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_180_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
 	uae_s32 srcreg = ((opcode >> 9) & 7);
 #endif
-	uae_s32 dstreg = 2;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
+{	int dst=dstreg;
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,31);
+	btr_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	if(dstreg!=dst)
+		mov_l_rr(dstreg,dst);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_190_0_comp_nf(uae_u32 opcode) /* BCLR */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_s32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src=srcreg;
+{	int dsta=dodgy?scratchie++:dstreg+8;
+	if (dodgy) 
+		mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -41776,26 +41494,28 @@ unsigned long REGPARAM2 op_1ba_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1bb_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_198_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
 	uae_s32 srcreg = ((opcode >> 9) & 7);
 #endif
-	uae_s32 dstreg = 3;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
+	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
@@ -41805,10 +41525,10 @@ unsigned long REGPARAM2 op_1bb_0_comp_nf(uae_u32 opcode) /* BCLR */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1c0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1a0_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41825,21 +41545,25 @@ unsigned long REGPARAM2 op_1c0_0_comp_nf(uae_u32 opcode) /* BSET */
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dst=dstreg;
+{{	int dsta=dodgy?scratchie++:dstreg+8;
+	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
+	if (dodgy) 
+	mov_l_rr(dsta,8+dstreg);
+{	int dst=scratchie++;
+	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
-	and_l_ri(s,31);
-	bts_l_rr(dst,s);
+	and_l_ri(s,7);
+	btr_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
-	if(dstreg!=dst)
-		mov_l_rr(dstreg,dst);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	writebyte(dsta,dst,scratchie);
+}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1d0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1a8_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41856,16 +41580,16 @@ unsigned long REGPARAM2 op_1d0_0_comp_nf(uae_u32 opcode) /* BSET */
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dsta=dodgy?scratchie++:dstreg+8;
-	if (dodgy) 
-		mov_l_rr(dsta,dstreg+8);
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,8+dstreg);
+	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	bts_l_rr(dst,s);
+	btr_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41873,7 +41597,7 @@ unsigned long REGPARAM2 op_1d0_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1d8_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1b0_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41891,15 +41615,14 @@ unsigned long REGPARAM2 op_1d8_0_comp_nf(uae_u32 opcode) /* BSET */
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
 {	int dsta=scratchie++;
-	mov_l_rr(dsta,dstreg+8);
+	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
-	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	bts_l_rr(dst,s);
+	btr_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -41907,7 +41630,63 @@ unsigned long REGPARAM2 op_1d8_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1e0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1b8_0_comp_nf(uae_u32 opcode) /* BCLR */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_s32 srcreg = ((opcode >> 9) & 7);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src=srcreg;
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dst=scratchie++;
+	readbyte(dsta,dst,scratchie);
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,7);
+	btr_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	writebyte(dsta,dst,scratchie);
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_1b9_0_comp_nf(uae_u32 opcode) /* BCLR */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_s32 srcreg = ((opcode >> 9) & 7);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src=srcreg;
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
+{	int dst=scratchie++;
+	readbyte(dsta,dst,scratchie);
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,7);
+	btr_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	writebyte(dsta,dst,scratchie);
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_1c0_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41924,10 +41703,40 @@ unsigned long REGPARAM2 op_1e0_0_comp_nf(uae_u32 opcode) /* BSET */
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{{	int dsta=dodgy?scratchie++:dstreg+8;
-	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
+{	int dst=dstreg;
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,31);
+	bts_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	if(dstreg!=dst)
+		mov_l_rr(dstreg,dst);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_1d0_0_comp_nf(uae_u32 opcode) /* BSET */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_s32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src=srcreg;
+{	int dsta=dodgy?scratchie++:dstreg+8;
 	if (dodgy) 
-	mov_l_rr(dsta,8+dstreg);
+		mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -41939,10 +41748,10 @@ unsigned long REGPARAM2 op_1e0_0_comp_nf(uae_u32 opcode) /* BSET */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1e8_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1d8_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41960,10 +41769,10 @@ unsigned long REGPARAM2 op_1e8_0_comp_nf(uae_u32 opcode) /* BSET */
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
 {	int dsta=scratchie++;
-	mov_l_rr(dsta,8+dstreg);
-	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+	mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
+	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
@@ -41976,7 +41785,7 @@ unsigned long REGPARAM2 op_1e8_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1f0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1e0_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
@@ -41993,8 +41802,10 @@ unsigned long REGPARAM2 op_1f0_0_comp_nf(uae_u32 opcode) /* BSET */
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dsta=scratchie++;
-	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{{	int dsta=dodgy?scratchie++:dstreg+8;
+	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
+	if (dodgy) 
+	mov_l_rr(dsta,8+dstreg);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -42006,23 +41817,29 @@ unsigned long REGPARAM2 op_1f0_0_comp_nf(uae_u32 opcode) /* BSET */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1f8_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1e8_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
 	uae_s32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
 #endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,8+dstreg);
+	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -42037,20 +41854,25 @@ unsigned long REGPARAM2 op_1f8_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1f9_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1f0_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
 	uae_s32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
 #endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
+{	int dsta=scratchie++;
+	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -42065,23 +41887,20 @@ unsigned long REGPARAM2 op_1f9_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1fa_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1f8_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
 	uae_s32 srcreg = ((opcode >> 9) & 7);
 #endif
-	uae_s32 dstreg = 2;
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -42096,24 +41915,20 @@ unsigned long REGPARAM2 op_1fa_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_1fb_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_1f9_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
 	uae_s32 srcreg = ((opcode >> 9) & 7);
 #endif
-	uae_s32 dstreg = 3;
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src=srcreg;
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -42125,7 +41940,7 @@ unsigned long REGPARAM2 op_1fb_0_comp_nf(uae_u32 opcode) /* BSET */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
 unsigned long REGPARAM2 op_200_0_comp_nf(uae_u32 opcode) /* AND */
@@ -44156,287 +43971,7 @@ unsigned long REGPARAM2 op_850_0_comp_nf(uae_u32 opcode) /* BCHG */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_858_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	mov_l_rr(dsta,dstreg+8);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_860_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{{	int dsta=dodgy?scratchie++:dstreg+8;
-	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
-	if (dodgy) 
-	mov_l_rr(dsta,8+dstreg);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_868_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	mov_l_rr(dsta,8+dstreg);
-	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_870_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_878_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_879_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_87a_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-	uae_s32 dstreg = 2;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_87b_0_comp_nf(uae_u32 opcode) /* BCHG */
-{
-	uae_s32 dstreg = 3;
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btc_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_880_0_comp_nf(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=dstreg;
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,31);
-	btr_l_rr(dst,s);
-	sbb_l(s,s);
-	make_flags_live();
-	dont_care_flags();
-	if(dstreg!=dst)
-		mov_l_rr(dstreg,dst);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_890_0_comp_nf(uae_u32 opcode) /* BCLR */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=dodgy?scratchie++:dstreg+8;
-	if (dodgy) 
-		mov_l_rr(dsta,dstreg+8);
-{	int dst=scratchie++;
-	readbyte(dsta,dst,scratchie);
-{	int s=scratchie++;
-	int tmp=scratchie++;
-	mov_l_rr(s,src);
-	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44444,7 +43979,7 @@ unsigned long REGPARAM2 op_890_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_898_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_858_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44466,7 +44001,7 @@ unsigned long REGPARAM2 op_898_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44474,7 +44009,7 @@ unsigned long REGPARAM2 op_898_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8a0_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_860_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44497,7 +44032,7 @@ unsigned long REGPARAM2 op_8a0_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44505,7 +44040,7 @@ unsigned long REGPARAM2 op_8a0_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8a8_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_868_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44527,7 +44062,7 @@ unsigned long REGPARAM2 op_8a8_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44535,7 +44070,7 @@ unsigned long REGPARAM2 op_8a8_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8b0_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_870_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44556,7 +44091,7 @@ unsigned long REGPARAM2 op_8b0_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44564,7 +44099,7 @@ unsigned long REGPARAM2 op_8b0_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8b8_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_878_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
@@ -44580,7 +44115,7 @@ unsigned long REGPARAM2 op_8b8_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44588,7 +44123,7 @@ unsigned long REGPARAM2 op_8b8_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8b9_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_879_0_comp_nf(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
@@ -44604,7 +44139,7 @@ unsigned long REGPARAM2 op_8b9_0_comp_nf(uae_u32 opcode) /* BCLR */
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	btr_l_rr(dst,s);
+	btc_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44612,19 +44147,49 @@ unsigned long REGPARAM2 op_8b9_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8ba_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_880_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
-	uae_s32 dstreg = 2;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
+{	int dst=dstreg;
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,31);
+	btr_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	if(dstreg!=dst)
+		mov_l_rr(dstreg,dst);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_890_0_comp_nf(uae_u32 opcode) /* BCLR */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dsta=dodgy?scratchie++:dstreg+8;
+	if (dodgy) 
+		mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44639,22 +44204,24 @@ unsigned long REGPARAM2 op_8ba_0_comp_nf(uae_u32 opcode) /* BCLR */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8bb_0_comp_nf(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 op_898_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
-	uae_s32 dstreg = 3;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
+	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
@@ -44664,10 +44231,10 @@ unsigned long REGPARAM2 op_8bb_0_comp_nf(uae_u32 opcode) /* BCLR */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8c0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8a0_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44680,21 +44247,25 @@ unsigned long REGPARAM2 op_8c0_0_comp_nf(uae_u32 opcode) /* BSET */
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=dstreg;
+{{	int dsta=dodgy?scratchie++:dstreg+8;
+	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
+	if (dodgy) 
+	mov_l_rr(dsta,8+dstreg);
+{	int dst=scratchie++;
+	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
-	and_l_ri(s,31);
-	bts_l_rr(dst,s);
+	and_l_ri(s,7);
+	btr_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
-	if(dstreg!=dst)
-		mov_l_rr(dstreg,dst);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	writebyte(dsta,dst,scratchie);
+}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8d0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8a8_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44707,16 +44278,16 @@ unsigned long REGPARAM2 op_8d0_0_comp_nf(uae_u32 opcode) /* BSET */
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=dodgy?scratchie++:dstreg+8;
-	if (dodgy) 
-		mov_l_rr(dsta,dstreg+8);
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,8+dstreg);
+	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	bts_l_rr(dst,s);
+	btr_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44724,7 +44295,7 @@ unsigned long REGPARAM2 op_8d0_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8d8_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8b0_0_comp_nf(uae_u32 opcode) /* BCLR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44738,15 +44309,14 @@ unsigned long REGPARAM2 op_8d8_0_comp_nf(uae_u32 opcode) /* BSET */
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dsta=scratchie++;
-	mov_l_rr(dsta,dstreg+8);
+	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
-	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
 	and_l_ri(s,7);
-	bts_l_rr(dst,s);
+	btr_l_rr(dst,s);
 	sbb_l(s,s);
 	make_flags_live();
 	dont_care_flags();
@@ -44754,7 +44324,55 @@ unsigned long REGPARAM2 op_8d8_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8e0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8b8_0_comp_nf(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dst=scratchie++;
+	readbyte(dsta,dst,scratchie);
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,7);
+	btr_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	writebyte(dsta,dst,scratchie);
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_8b9_0_comp_nf(uae_u32 opcode) /* BCLR */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
+{	int dst=scratchie++;
+	readbyte(dsta,dst,scratchie);
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,7);
+	btr_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	writebyte(dsta,dst,scratchie);
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_8c0_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44767,10 +44385,36 @@ unsigned long REGPARAM2 op_8e0_0_comp_nf(uae_u32 opcode) /* BSET */
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{{	int dsta=dodgy?scratchie++:dstreg+8;
-	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
+{	int dst=dstreg;
+{	int s=scratchie++;
+	int tmp=scratchie++;
+	mov_l_rr(s,src);
+	and_l_ri(s,31);
+	bts_l_rr(dst,s);
+	sbb_l(s,s);
+	make_flags_live();
+	dont_care_flags();
+	if(dstreg!=dst)
+		mov_l_rr(dstreg,dst);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_8d0_0_comp_nf(uae_u32 opcode) /* BSET */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dsta=dodgy?scratchie++:dstreg+8;
 	if (dodgy) 
-	mov_l_rr(dsta,8+dstreg);
+		mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44782,10 +44426,10 @@ unsigned long REGPARAM2 op_8e0_0_comp_nf(uae_u32 opcode) /* BSET */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8e8_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8d8_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44799,10 +44443,10 @@ unsigned long REGPARAM2 op_8e8_0_comp_nf(uae_u32 opcode) /* BSET */
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dsta=scratchie++;
-	mov_l_rr(dsta,8+dstreg);
-	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+	mov_l_rr(dsta,dstreg+8);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
+	lea_l_brr(dstreg+8,dstreg+8,areg_byteinc[dstreg]);
 {	int s=scratchie++;
 	int tmp=scratchie++;
 	mov_l_rr(s,src);
@@ -44815,7 +44459,7 @@ unsigned long REGPARAM2 op_8e8_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8f0_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8e0_0_comp_nf(uae_u32 opcode) /* BSET */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
@@ -44828,8 +44472,10 @@ unsigned long REGPARAM2 op_8f0_0_comp_nf(uae_u32 opcode) /* BSET */
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{{	int dsta=dodgy?scratchie++:dstreg+8;
+	lea_l_brr(dstreg+8,dstreg+8,(uae_s32)-areg_byteinc[dstreg]);
+	if (dodgy) 
+	mov_l_rr(dsta,8+dstreg);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44841,19 +44487,25 @@ unsigned long REGPARAM2 op_8f0_0_comp_nf(uae_u32 opcode) /* BSET */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8f8_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8e8_0_comp_nf(uae_u32 opcode) /* BSET */
 {
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,8+dstreg);
+	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44868,16 +44520,21 @@ unsigned long REGPARAM2 op_8f8_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8f9_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8f0_0_comp_nf(uae_u32 opcode) /* BSET */
 {
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
+{	int dsta=scratchie++;
+	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44892,19 +44549,16 @@ unsigned long REGPARAM2 op_8f9_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8fa_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8f8_0_comp_nf(uae_u32 opcode) /* BSET */
 {
-	uae_s32 dstreg = 2;
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-	uae_s32 PC16off = (uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2);
-	mov_l_ri(dsta,address+PC16off);
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44919,20 +44573,16 @@ unsigned long REGPARAM2 op_8fa_0_comp_nf(uae_u32 opcode) /* BSET */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_8fb_0_comp_nf(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 op_8f9_0_comp_nf(uae_u32 opcode) /* BSET */
 {
-	uae_s32 dstreg = 3;
 	uae_u32 dodgy=0;
 	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
 	m68k_pc_offset+=2;
 {	uae_u8 scratchie=S1;
 {	int src = scratchie++;
 	mov_l_ri(src,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int pctmp=scratchie++;
-	int dsta=scratchie++;
-	uae_u32 address=start_pc+((char *)comp_pc_p-(char *)start_pc_p)+m68k_pc_offset;
-{	mov_l_ri(pctmp,address);
-	calc_disp_ea_020(pctmp,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int dst=scratchie++;
 	readbyte(dsta,dst,scratchie);
 {	int s=scratchie++;
@@ -44944,7 +44594,7 @@ unsigned long REGPARAM2 op_8fb_0_comp_nf(uae_u32 opcode) /* BSET */
 	make_flags_live();
 	dont_care_flags();
 	writebyte(dsta,dst,scratchie);
-}}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
 unsigned long REGPARAM2 op_a00_0_comp_nf(uae_u32 opcode) /* EOR */
@@ -45426,9 +45076,6 @@ unsigned long REGPARAM2 op_a90_0_comp_nf(uae_u32 opcode) /* EOR */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_2
 unsigned long REGPARAM2 op_a98_0_comp_nf(uae_u32 opcode) /* EOR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -45561,6 +45208,9 @@ unsigned long REGPARAM2 op_ab9_0_comp_nf(uae_u32 opcode) /* EOR */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_2
 unsigned long REGPARAM2 op_c00_0_comp_nf(uae_u32 opcode) /* CMP */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -50112,9 +49762,6 @@ unsigned long REGPARAM2 op_2178_0_comp_nf(uae_u32 opcode) /* MOVE */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_3
 unsigned long REGPARAM2 op_2179_0_comp_nf(uae_u32 opcode) /* MOVE */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -50254,6 +49901,9 @@ unsigned long REGPARAM2 op_2188_0_comp_nf(uae_u32 opcode) /* MOVE */
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_3
 unsigned long REGPARAM2 op_2190_0_comp_nf(uae_u32 opcode) /* MOVE */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -58749,262 +58399,262 @@ unsigned long REGPARAM2 op_5048_0_comp_nf(uae_u32 opcode) /* ADDA */
 	if (dodgy) 
 		mov_l_rr(dst,dstreg+8);
 {	int tmp=scratchie++;
-	sign_extend_16_rr(tmp,src);
+	sign_extend_16_rr(tmp,src);
+	arm_ADD_l(dst,tmp);
+	if(dstreg+8!=dst)
+		mov_l_rr(dstreg+8,dst);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5050_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dsta=dodgy?scratchie++:dstreg+8;
+	if (dodgy) 
+		mov_l_rr(dsta,dstreg+8);
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5058_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,dstreg+8);
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	lea_l_brr(dstreg+8,dstreg+8,2);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5060_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{{	int dsta=dodgy?scratchie++:dstreg+8;
+	lea_l_brr(dstreg+8,dstreg+8,-2);
+	if (dodgy) 
+	mov_l_rr(dsta,8+dstreg);
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5068_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dsta=scratchie++;
+	mov_l_rr(dsta,8+dstreg);
+	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5070_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dsta=scratchie++;
+	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5078_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5079_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dsta = scratchie++;
+	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
+{	int dst=scratchie++;
+	readword(dsta,dst,scratchie);
+	dont_care_flags();
+	add_w(dst,src);
+	writeword(dsta,dst,scratchie);
+}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5080_0_comp_nf(uae_u32 opcode) /* ADD */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dst=dstreg;
+	dont_care_flags();
+	add_l(dst,src);
+	if(dstreg!=dst)
+		mov_l_rr(dstreg,dst);
+}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+return 0;
+}
+unsigned long REGPARAM2 op_5088_0_comp_nf(uae_u32 opcode) /* ADDA */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+{	int src = scratchie++;
+	mov_l_ri(src,srcreg);
+{	int dst=dodgy?scratchie++:dstreg+8;
+	if (dodgy) 
+		mov_l_rr(dst,dstreg+8);
+{	int tmp=scratchie++;
+	tmp=src;
 	arm_ADD_l(dst,tmp);
 	if(dstreg+8!=dst)
 		mov_l_rr(dstreg+8,dst);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-unsigned long REGPARAM2 op_5050_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dsta=dodgy?scratchie++:dstreg+8;
-	if (dodgy) 
-		mov_l_rr(dsta,dstreg+8);
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5058_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dsta=scratchie++;
-	mov_l_rr(dsta,dstreg+8);
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	lea_l_brr(dstreg+8,dstreg+8,2);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5060_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{{	int dsta=dodgy?scratchie++:dstreg+8;
-	lea_l_brr(dstreg+8,dstreg+8,-2);
-	if (dodgy) 
-	mov_l_rr(dsta,8+dstreg);
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5068_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dsta=scratchie++;
-	mov_l_rr(dsta,8+dstreg);
-	lea_l_brr(dsta,dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5070_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dsta=scratchie++;
-	calc_disp_ea_020(dstreg+8,comp_get_iword((m68k_pc_offset+=2)-2),dsta,scratchie);
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5078_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5079_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dsta = scratchie++;
-	mov_l_ri(dsta,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
-{	int dst=scratchie++;
-	readword(dsta,dst,scratchie);
-	dont_care_flags();
-	add_w(dst,src);
-	writeword(dsta,dst,scratchie);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
-unsigned long REGPARAM2 op_5080_0_comp_nf(uae_u32 opcode) /* ADD */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dst=dstreg;
-	dont_care_flags();
-	add_l(dst,src);
-	if(dstreg!=dst)
-		mov_l_rr(dstreg,dst);
-}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 #endif
 
 #ifdef PART_5
-unsigned long REGPARAM2 op_5088_0_comp_nf(uae_u32 opcode) /* ADDA */
-{
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_s32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-	uae_u32 dodgy=0;
-	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
-	m68k_pc_offset+=2;
-{	uae_u8 scratchie=S1;
-{	int src = scratchie++;
-	mov_l_ri(src,srcreg);
-{	int dst=dodgy?scratchie++:dstreg+8;
-	if (dodgy) 
-		mov_l_rr(dst,dstreg+8);
-{	int tmp=scratchie++;
-	tmp=src;
-	arm_ADD_l(dst,tmp);
-	if(dstreg+8!=dst)
-		mov_l_rr(dstreg+8,dst);
-}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
-return 0;
-}
 unsigned long REGPARAM2 op_5090_0_comp_nf(uae_u32 opcode) /* ADD */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -60133,7 +59783,7 @@ unsigned long REGPARAM2 op_51c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 {	uae_u32 v2;
 	uae_u32 v1=get_const(PC_P);
 	v2=get_const(offs);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60288,7 +59938,7 @@ unsigned long REGPARAM2 op_52c0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -60320,12 +59970,12 @@ unsigned long REGPARAM2 op_52c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,8);
-	cmov_l_rr(src,nsrc,8);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_HI);
+	cmov_l_rr(src,nsrc,NATIVE_CC_HI);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60347,7 +59997,7 @@ unsigned long REGPARAM2 op_52d0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60369,7 +60019,7 @@ unsigned long REGPARAM2 op_52d8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60392,7 +60042,7 @@ unsigned long REGPARAM2 op_52e0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60414,7 +60064,7 @@ unsigned long REGPARAM2 op_52e8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60435,7 +60085,7 @@ unsigned long REGPARAM2 op_52f0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60451,7 +60101,7 @@ unsigned long REGPARAM2 op_52f8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60467,7 +60117,7 @@ unsigned long REGPARAM2 op_52f9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,9);
+	setcc(val,NATIVE_CC_LS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60487,7 +60137,7 @@ unsigned long REGPARAM2 op_53c0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -60519,12 +60169,12 @@ unsigned long REGPARAM2 op_53c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,9);
-	cmov_l_rr(src,nsrc,9);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_LS);
+	cmov_l_rr(src,nsrc,NATIVE_CC_LS);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60546,7 +60196,7 @@ unsigned long REGPARAM2 op_53d0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60568,7 +60218,7 @@ unsigned long REGPARAM2 op_53d8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60591,7 +60241,7 @@ unsigned long REGPARAM2 op_53e0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60613,7 +60263,7 @@ unsigned long REGPARAM2 op_53e8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60634,7 +60284,7 @@ unsigned long REGPARAM2 op_53f0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60650,7 +60300,7 @@ unsigned long REGPARAM2 op_53f8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60666,7 +60316,7 @@ unsigned long REGPARAM2 op_53f9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,8);
+	setcc(val,NATIVE_CC_HI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60686,7 +60336,7 @@ unsigned long REGPARAM2 op_54c0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -60718,12 +60368,12 @@ unsigned long REGPARAM2 op_54c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,3);
-	cmov_l_rr(src,nsrc,3);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_CC);
+	cmov_l_rr(src,nsrc,NATIVE_CC_CC);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60745,7 +60395,7 @@ unsigned long REGPARAM2 op_54d0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60767,7 +60417,7 @@ unsigned long REGPARAM2 op_54d8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60790,7 +60440,7 @@ unsigned long REGPARAM2 op_54e0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60812,7 +60462,7 @@ unsigned long REGPARAM2 op_54e8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60833,7 +60483,7 @@ unsigned long REGPARAM2 op_54f0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60849,7 +60499,7 @@ unsigned long REGPARAM2 op_54f8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60865,7 +60515,7 @@ unsigned long REGPARAM2 op_54f9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,2);
+	setcc(val,NATIVE_CC_CS);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60885,7 +60535,7 @@ unsigned long REGPARAM2 op_55c0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -60917,12 +60567,12 @@ unsigned long REGPARAM2 op_55c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,2);
-	cmov_l_rr(src,nsrc,2);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_CS);
+	cmov_l_rr(src,nsrc,NATIVE_CC_CS);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60944,7 +60594,7 @@ unsigned long REGPARAM2 op_55d0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60966,7 +60616,7 @@ unsigned long REGPARAM2 op_55d8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -60989,7 +60639,7 @@ unsigned long REGPARAM2 op_55e0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61011,7 +60661,7 @@ unsigned long REGPARAM2 op_55e8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61032,7 +60682,7 @@ unsigned long REGPARAM2 op_55f0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61048,7 +60698,7 @@ unsigned long REGPARAM2 op_55f8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61064,7 +60714,7 @@ unsigned long REGPARAM2 op_55f9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,3);
+	setcc(val,NATIVE_CC_CC);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61084,7 +60734,7 @@ unsigned long REGPARAM2 op_56c0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -61116,12 +60766,12 @@ unsigned long REGPARAM2 op_56c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,1);
-	cmov_l_rr(src,nsrc,1);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_NE);
+	cmov_l_rr(src,nsrc,NATIVE_CC_NE);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61143,7 +60793,7 @@ unsigned long REGPARAM2 op_56d0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61165,7 +60815,7 @@ unsigned long REGPARAM2 op_56d8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61188,7 +60838,7 @@ unsigned long REGPARAM2 op_56e0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61210,7 +60860,7 @@ unsigned long REGPARAM2 op_56e8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61231,7 +60881,7 @@ unsigned long REGPARAM2 op_56f0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61247,7 +60897,7 @@ unsigned long REGPARAM2 op_56f8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61263,7 +60913,7 @@ unsigned long REGPARAM2 op_56f9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,0);
+	setcc(val,NATIVE_CC_EQ);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61283,7 +60933,7 @@ unsigned long REGPARAM2 op_57c0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -61315,12 +60965,12 @@ unsigned long REGPARAM2 op_57c8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,0);
-	cmov_l_rr(src,nsrc,0);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_EQ);
+	cmov_l_rr(src,nsrc,NATIVE_CC_EQ);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61342,7 +60992,7 @@ unsigned long REGPARAM2 op_57d0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61364,7 +61014,7 @@ unsigned long REGPARAM2 op_57d8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61387,7 +61037,7 @@ unsigned long REGPARAM2 op_57e0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61409,7 +61059,7 @@ unsigned long REGPARAM2 op_57e8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61430,7 +61080,7 @@ unsigned long REGPARAM2 op_57f0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61446,7 +61096,7 @@ unsigned long REGPARAM2 op_57f8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61462,7 +61112,7 @@ unsigned long REGPARAM2 op_57f9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,1);
+	setcc(val,NATIVE_CC_NE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61482,7 +61132,7 @@ unsigned long REGPARAM2 op_5ac0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -61514,12 +61164,12 @@ unsigned long REGPARAM2 op_5ac8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,5);
-	cmov_l_rr(src,nsrc,5);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_PL);
+	cmov_l_rr(src,nsrc,NATIVE_CC_PL);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61541,7 +61191,7 @@ unsigned long REGPARAM2 op_5ad0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61563,7 +61213,7 @@ unsigned long REGPARAM2 op_5ad8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61586,7 +61236,7 @@ unsigned long REGPARAM2 op_5ae0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61608,7 +61258,7 @@ unsigned long REGPARAM2 op_5ae8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61629,7 +61279,7 @@ unsigned long REGPARAM2 op_5af0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61645,7 +61295,7 @@ unsigned long REGPARAM2 op_5af8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61661,7 +61311,7 @@ unsigned long REGPARAM2 op_5af9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,4);
+	setcc(val,NATIVE_CC_MI);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61681,7 +61331,7 @@ unsigned long REGPARAM2 op_5bc0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -61713,12 +61363,12 @@ unsigned long REGPARAM2 op_5bc8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,4);
-	cmov_l_rr(src,nsrc,4);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_MI);
+	cmov_l_rr(src,nsrc,NATIVE_CC_MI);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61740,7 +61390,7 @@ unsigned long REGPARAM2 op_5bd0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61762,7 +61412,7 @@ unsigned long REGPARAM2 op_5bd8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61785,7 +61435,7 @@ unsigned long REGPARAM2 op_5be0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61807,7 +61457,7 @@ unsigned long REGPARAM2 op_5be8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61828,7 +61478,7 @@ unsigned long REGPARAM2 op_5bf0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61844,7 +61494,7 @@ unsigned long REGPARAM2 op_5bf8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61860,7 +61510,7 @@ unsigned long REGPARAM2 op_5bf9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,5);
+	setcc(val,NATIVE_CC_PL);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61880,7 +61530,7 @@ unsigned long REGPARAM2 op_5cc0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -61912,12 +61562,12 @@ unsigned long REGPARAM2 op_5cc8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,10);
-	cmov_l_rr(src,nsrc,10);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_GE);
+	cmov_l_rr(src,nsrc,NATIVE_CC_GE);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61939,7 +61589,7 @@ unsigned long REGPARAM2 op_5cd0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61961,7 +61611,7 @@ unsigned long REGPARAM2 op_5cd8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -61984,7 +61634,7 @@ unsigned long REGPARAM2 op_5ce0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62006,7 +61656,7 @@ unsigned long REGPARAM2 op_5ce8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62027,7 +61677,7 @@ unsigned long REGPARAM2 op_5cf0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62043,7 +61693,7 @@ unsigned long REGPARAM2 op_5cf8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62059,7 +61709,7 @@ unsigned long REGPARAM2 op_5cf9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,11);
+	setcc(val,NATIVE_CC_LT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62079,7 +61729,7 @@ unsigned long REGPARAM2 op_5dc0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -62111,12 +61761,12 @@ unsigned long REGPARAM2 op_5dc8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,11);
-	cmov_l_rr(src,nsrc,11);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_LT);
+	cmov_l_rr(src,nsrc,NATIVE_CC_LT);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62138,7 +61788,7 @@ unsigned long REGPARAM2 op_5dd0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62160,7 +61810,7 @@ unsigned long REGPARAM2 op_5dd8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62183,7 +61833,7 @@ unsigned long REGPARAM2 op_5de0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62205,7 +61855,7 @@ unsigned long REGPARAM2 op_5de8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62226,7 +61876,7 @@ unsigned long REGPARAM2 op_5df0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62242,7 +61892,7 @@ unsigned long REGPARAM2 op_5df8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62258,7 +61908,7 @@ unsigned long REGPARAM2 op_5df9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,10);
+	setcc(val,NATIVE_CC_GE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62278,7 +61928,7 @@ unsigned long REGPARAM2 op_5ec0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -62310,12 +61960,12 @@ unsigned long REGPARAM2 op_5ec8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,12);
-	cmov_l_rr(src,nsrc,12);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_GT);
+	cmov_l_rr(src,nsrc,NATIVE_CC_GT);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62337,7 +61987,7 @@ unsigned long REGPARAM2 op_5ed0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62359,7 +62009,7 @@ unsigned long REGPARAM2 op_5ed8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62382,7 +62032,7 @@ unsigned long REGPARAM2 op_5ee0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62404,7 +62054,7 @@ unsigned long REGPARAM2 op_5ee8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62425,7 +62075,7 @@ unsigned long REGPARAM2 op_5ef0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62441,7 +62091,7 @@ unsigned long REGPARAM2 op_5ef8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62457,7 +62107,7 @@ unsigned long REGPARAM2 op_5ef9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,13);
+	setcc(val,NATIVE_CC_LE);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62477,7 +62127,7 @@ unsigned long REGPARAM2 op_5fc0_0_comp_nf(uae_u32 opcode) /* Scc */
 {	int src=srcreg;
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	if(srcreg!=val)
 		mov_b_rr(srcreg,val);
@@ -62509,12 +62159,12 @@ unsigned long REGPARAM2 op_5fc8_0_comp_nf(uae_u32 opcode) /* DBcc */
 	mov_l_rr(nsrc,src);
 	lea_l_brr(scratchie,src,(uae_s32)-1);
 	mov_w_rr(src,scratchie);
-	cmov_l_rr(offs,PC_P,13);
-	cmov_l_rr(src,nsrc,13);
+	cmov_l_rr(offs,PC_P,NATIVE_CC_LE);
+	cmov_l_rr(src,nsrc,NATIVE_CC_LE);
 	 start_needflags();
 	test_w_rr(nsrc,nsrc);
 	 end_needflags();
-	cmov_l_rr(PC_P,offs,1);
+	cmov_l_rr(PC_P,offs,NATIVE_CC_NE);
 	if(srcreg!=src)
 		mov_w_rr(srcreg,src);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62536,7 +62186,7 @@ unsigned long REGPARAM2 op_5fd0_0_comp_nf(uae_u32 opcode) /* Scc */
 		mov_l_rr(srca,srcreg+8);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62558,7 +62208,7 @@ unsigned long REGPARAM2 op_5fd8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srcreg+8,srcreg+8,areg_byteinc[srcreg]);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62581,7 +62231,7 @@ unsigned long REGPARAM2 op_5fe0_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_rr(srca,8+srcreg);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62603,7 +62253,7 @@ unsigned long REGPARAM2 op_5fe8_0_comp_nf(uae_u32 opcode) /* Scc */
 	lea_l_brr(srca,srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62624,7 +62274,7 @@ unsigned long REGPARAM2 op_5ff0_0_comp_nf(uae_u32 opcode) /* Scc */
 	calc_disp_ea_020(srcreg+8,comp_get_iword((m68k_pc_offset+=2)-2),srca,scratchie);
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62640,7 +62290,7 @@ unsigned long REGPARAM2 op_5ff8_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,(uae_s32)(uae_s16)comp_get_iword((m68k_pc_offset+=2)-2));
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62656,7 +62306,7 @@ unsigned long REGPARAM2 op_5ff9_0_comp_nf(uae_u32 opcode) /* Scc */
 	mov_l_ri(srca,comp_get_ilong((m68k_pc_offset+=4)-4)); /* absl */
 {	int val = scratchie++;
 	make_flags_live();
-	setcc(val,12);
+	setcc(val,NATIVE_CC_GT);
 	sub_b_ri(val,1);
 	writebyte(srca,val,scratchie);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
@@ -62679,7 +62329,7 @@ unsigned long REGPARAM2 op_6000_0_comp_nf(uae_u32 opcode) /* Bcc */
 	arm_ADD_l_ri(PC_P,m68k_pc_offset);
 	m68k_pc_offset=0;
 	mov_l_rr(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -62705,7 +62355,7 @@ unsigned long REGPARAM2 op_6001_0_comp_nf(uae_u32 opcode) /* Bcc */
 	arm_ADD_l_ri(PC_P,m68k_pc_offset);
 	m68k_pc_offset=0;
 	mov_l_rr(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -62725,7 +62375,7 @@ unsigned long REGPARAM2 op_60ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	arm_ADD_l_ri(PC_P,m68k_pc_offset);
 	m68k_pc_offset=0;
 	mov_l_rr(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -62745,7 +62395,7 @@ unsigned long REGPARAM2 op_6100_0_comp_nf(uae_u32 opcode) /* BSR */
 	arm_ADD_l_ri(src,m68k_pc_offset_thisinst+2);
 	m68k_pc_offset=0;
 	arm_ADD_l(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -62770,7 +62420,7 @@ unsigned long REGPARAM2 op_6101_0_comp_nf(uae_u32 opcode) /* BSR */
 	arm_ADD_l_ri(src,m68k_pc_offset_thisinst+2);
 	m68k_pc_offset=0;
 	arm_ADD_l(PC_P,src);
-	comp_pc_p=(uae_u8*)get_const(PC_P);
+	comp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);
 }}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
@@ -62792,7 +62442,7 @@ unsigned long REGPARAM2 op_6200_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,8);
+	register_branch(v1,v2,NATIVE_CC_HI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -62820,11 +62470,14 @@ unsigned long REGPARAM2 op_6201_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,8);
+	register_branch(v1,v2,NATIVE_CC_HI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_6
 unsigned long REGPARAM2 op_62ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 dodgy=0;
@@ -62842,7 +62495,7 @@ unsigned long REGPARAM2 op_62ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,8);
+	register_branch(v1,v2,NATIVE_CC_HI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -62865,14 +62518,11 @@ unsigned long REGPARAM2 op_6300_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,9);
+	register_branch(v1,v2,NATIVE_CC_LS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_6
 unsigned long REGPARAM2 op_6301_0_comp_nf(uae_u32 opcode) /* Bcc */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -62896,7 +62546,7 @@ unsigned long REGPARAM2 op_6301_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,9);
+	register_branch(v1,v2,NATIVE_CC_LS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -62918,7 +62568,7 @@ unsigned long REGPARAM2 op_63ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,9);
+	register_branch(v1,v2,NATIVE_CC_LS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -62941,7 +62591,7 @@ unsigned long REGPARAM2 op_6400_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -62969,7 +62619,7 @@ unsigned long REGPARAM2 op_6401_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -62991,7 +62641,7 @@ unsigned long REGPARAM2 op_64ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,3);
+	register_branch(v1,v2,NATIVE_CC_CC);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63014,7 +62664,7 @@ unsigned long REGPARAM2 op_6500_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,2);
+	register_branch(v1,v2,NATIVE_CC_CS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63042,7 +62692,7 @@ unsigned long REGPARAM2 op_6501_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,2);
+	register_branch(v1,v2,NATIVE_CC_CS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63064,7 +62714,7 @@ unsigned long REGPARAM2 op_65ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,2);
+	register_branch(v1,v2,NATIVE_CC_CS);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63087,7 +62737,7 @@ unsigned long REGPARAM2 op_6600_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,1);
+	register_branch(v1,v2,NATIVE_CC_NE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63115,7 +62765,7 @@ unsigned long REGPARAM2 op_6601_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,1);
+	register_branch(v1,v2,NATIVE_CC_NE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63137,7 +62787,7 @@ unsigned long REGPARAM2 op_66ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,1);
+	register_branch(v1,v2,NATIVE_CC_NE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63160,7 +62810,7 @@ unsigned long REGPARAM2 op_6700_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,0);
+	register_branch(v1,v2,NATIVE_CC_EQ);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63188,7 +62838,7 @@ unsigned long REGPARAM2 op_6701_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,0);
+	register_branch(v1,v2,NATIVE_CC_EQ);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63210,7 +62860,7 @@ unsigned long REGPARAM2 op_67ff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,0);
+	register_branch(v1,v2,NATIVE_CC_EQ);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63233,7 +62883,7 @@ unsigned long REGPARAM2 op_6a00_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,5);
+	register_branch(v1,v2,NATIVE_CC_PL);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63261,7 +62911,7 @@ unsigned long REGPARAM2 op_6a01_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,5);
+	register_branch(v1,v2,NATIVE_CC_PL);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63283,7 +62933,7 @@ unsigned long REGPARAM2 op_6aff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,5);
+	register_branch(v1,v2,NATIVE_CC_PL);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63306,7 +62956,7 @@ unsigned long REGPARAM2 op_6b00_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,4);
+	register_branch(v1,v2,NATIVE_CC_MI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63334,7 +62984,7 @@ unsigned long REGPARAM2 op_6b01_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,4);
+	register_branch(v1,v2,NATIVE_CC_MI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63356,7 +63006,7 @@ unsigned long REGPARAM2 op_6bff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,4);
+	register_branch(v1,v2,NATIVE_CC_MI);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63379,7 +63029,7 @@ unsigned long REGPARAM2 op_6c00_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,10);
+	register_branch(v1,v2,NATIVE_CC_GE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63407,7 +63057,7 @@ unsigned long REGPARAM2 op_6c01_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,10);
+	register_branch(v1,v2,NATIVE_CC_GE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63429,7 +63079,7 @@ unsigned long REGPARAM2 op_6cff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,10);
+	register_branch(v1,v2,NATIVE_CC_GE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63452,7 +63102,7 @@ unsigned long REGPARAM2 op_6d00_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,11);
+	register_branch(v1,v2,NATIVE_CC_LT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63480,7 +63130,7 @@ unsigned long REGPARAM2 op_6d01_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,11);
+	register_branch(v1,v2,NATIVE_CC_LT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63502,7 +63152,7 @@ unsigned long REGPARAM2 op_6dff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,11);
+	register_branch(v1,v2,NATIVE_CC_LT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63525,7 +63175,7 @@ unsigned long REGPARAM2 op_6e00_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,12);
+	register_branch(v1,v2,NATIVE_CC_GT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63553,7 +63203,7 @@ unsigned long REGPARAM2 op_6e01_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,12);
+	register_branch(v1,v2,NATIVE_CC_GT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63575,7 +63225,7 @@ unsigned long REGPARAM2 op_6eff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,12);
+	register_branch(v1,v2,NATIVE_CC_GT);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63598,7 +63248,7 @@ unsigned long REGPARAM2 op_6f00_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,13);
+	register_branch(v1,v2,NATIVE_CC_LE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63626,7 +63276,7 @@ unsigned long REGPARAM2 op_6f01_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,13);
+	register_branch(v1,v2,NATIVE_CC_LE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -63648,7 +63298,7 @@ unsigned long REGPARAM2 op_6fff_0_comp_nf(uae_u32 opcode) /* Bcc */
 	m68k_pc_offset=0;
 	v1=get_const(PC_P);
 	v2=get_const(src);
-	register_branch(v1,v2,13);
+	register_branch(v1,v2,NATIVE_CC_LE);
 	make_flags_live();
 }}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
@@ -68235,6 +67885,9 @@ unsigned long REGPARAM2 op_b088_0_comp_nf(uae_u32 opcode) /* CMP */
 }}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
+#endif
+
+#ifdef PART_7
 unsigned long REGPARAM2 op_b090_0_comp_nf(uae_u32 opcode) /* CMP */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -68344,9 +67997,6 @@ unsigned long REGPARAM2 op_b0a8_0_comp_nf(uae_u32 opcode) /* CMP */
 }}}}}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
 return 0;
 }
-#endif
-
-#ifdef PART_7
 unsigned long REGPARAM2 op_b0b0_0_comp_nf(uae_u32 opcode) /* CMP */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -74774,7 +74424,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 test_l_ri(cnt,highmask);
 mov_l_ri(highshift,0);
 mov_l_ri(scratchie,width/2);
-cmov_l_rr(highshift,scratchie,1);
+cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);
 	shra_b_rr(data,highshift);
 	shra_b_rr(data,highshift);
 	if(dstreg!=data)
@@ -74783,6 +74433,9 @@ cmov_l_rr(highshift,scratchie,1);
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 return 0;
 }
+#endif
+
+#ifdef PART_8
 unsigned long REGPARAM2 op_e028_0_comp_nf(uae_u32 opcode) /* LSR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -74811,7 +74464,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	highmask=0x38;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_b_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_b_rr(dstreg,data);
@@ -74938,9 +74591,6 @@ unsigned long REGPARAM2 op_e058_0_comp_nf(uae_u32 opcode) /* ROR */
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 return 0;
 }
-#endif
-
-#ifdef PART_8
 unsigned long REGPARAM2 op_e060_0_comp_nf(uae_u32 opcode) /* ASR */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -74973,7 +74623,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 test_l_ri(cnt,highmask);
 mov_l_ri(highshift,0);
 mov_l_ri(scratchie,width/2);
-cmov_l_rr(highshift,scratchie,1);
+cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);
 	shra_w_rr(data,highshift);
 	shra_w_rr(data,highshift);
 	if(dstreg!=data)
@@ -75010,7 +74660,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	highmask=0x30;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_w_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_w_rr(dstreg,data);
@@ -75169,7 +74819,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 test_l_ri(cnt,highmask);
 mov_l_ri(highshift,0);
 mov_l_ri(scratchie,width/2);
-cmov_l_rr(highshift,scratchie,1);
+cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);
 	shra_l_rr(data,highshift);
 	shra_l_rr(data,highshift);
 	if(dstreg!=data)
@@ -75206,7 +74856,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	highmask=0x20;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_l_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_l_rr(dstreg,data);
@@ -75369,7 +75019,7 @@ if (needed_flags & FLAG_V) {
 	highmask=0x38;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_b_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_b_rr(dstreg,data);
@@ -75405,7 +75055,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	highmask=0x38;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_b_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_b_rr(dstreg,data);
@@ -75568,7 +75218,7 @@ if (needed_flags & FLAG_V) {
 	highmask=0x30;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_w_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_w_rr(dstreg,data);
@@ -75604,7 +75254,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	highmask=0x30;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_w_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_w_rr(dstreg,data);
@@ -75767,7 +75417,7 @@ if (needed_flags & FLAG_V) {
 	highmask=0x20;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_l_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_l_rr(dstreg,data);
@@ -75803,7 +75453,7 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	highmask=0x20;
 test_l_ri(cnt,highmask);
 mov_l_ri(scratchie,0);
-cmov_l_rr(scratchie,data,0);
+cmov_l_rr(scratchie,data,NATIVE_CC_EQ);
 	mov_l_rr(data,scratchie);
 	if(dstreg!=data)
 		mov_l_rr(dstreg,data);
@@ -75841,6 +75491,411 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 return 0;
 }
+unsigned long REGPARAM2 op_f200_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f208_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f210_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f218_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f220_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f228_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f230_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f238_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f239_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f23a_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+	uae_s32 dstreg = 2;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f23b_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+	uae_s32 dstreg = 3;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f23c_0_comp_nf(uae_u32 opcode) /* FPP */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f240_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f250_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f258_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f260_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f268_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f270_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f278_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f279_0_comp_nf(uae_u32 opcode) /* FScc */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f280_0_comp_nf(uae_u32 opcode) /* FBcc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
+unsigned long REGPARAM2 op_f2c0_0_comp_nf(uae_u32 opcode) /* FBcc */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>SYNC_PC_OFFSET) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+return 0;
+}
 unsigned long REGPARAM2 op_f600_0_comp_nf(uae_u32 opcode) /* MOVE16 */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
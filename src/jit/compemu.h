@@ -29,7 +29,11 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#if SIZEOF_VOID_P == 8
+typedef uae_u64 uintptr;
+#else
 typedef uae_u32 uintptr;
+#endif
 
 #define panicbug printf
 
@@ -52,21 +56,27 @@ typedef uae_u32 uintptr;
 
 /* Flags for Bernie during development/debugging. Should go away eventually */
 #define DISTRUST_CONSISTENT_MEM 0
-#define TAGMASK 0x000fffff
+/* Size of the block lookup table, indexed by the low bits of the host pc.
+   Each 68k instruction start uses two entries (handler and block list).
+   Raise it (e.g. -DJIT_TAGBITS=22) if distant code keeps colliding. */
+#ifndef JIT_TAGBITS
+#define JIT_TAGBITS 20
+#endif
+#define TAGMASK ((1 << JIT_TAGBITS) - 1)
 #define TAGSIZE (TAGMASK+1)
 #define MAXRUN 1024
 
 extern uae_u8* start_pc_p;
 extern uae_u32 start_pc;
 
-#define cacheline(x) (((uae_u32)x)&TAGMASK)
+#define cacheline(x) (((uintptr)x)&TAGMASK)
 
 typedef struct {
   uae_u16* location;
-  uae_u8  cycles;
+  int     cycles; /* of the block up to and including this instruction */
   uae_u8  specmem;
-  uae_u8  dummy2;
-  uae_u8  dummy3;
+  uae_u8  retlen; /* JSR/BSR: bytes to the return address */
+  uae_u16 dummy3;
 } cpu_history;
 
 struct blockinfo_t;
@@ -128,6 +138,11 @@ typedef union {
 #define USE_DATA_BUFFER
 #define ALIGN_NOT_NEEDED
 # define N_REGS 13  /* really 16, but 13 to 15 are SP, LR, PC */
+#elif defined(CPU_AARCH64)
+#define ALIGN_NOT_NEEDED
+#define N_REGS 16  /* really 31, 16 and above are scratch, homes, FP and LR */
+#elif defined(CPU_x86_64)
+#define N_REGS 16 /* really only 15, RSP is numbered 4 */
 #else
 #define N_REGS 8  /* really only 7, but they are numbered 0,1,2,3,5,6,7 */
 #endif
@@ -148,8 +163,10 @@ extern int get_cache_state(void);
 extern uae_u32 get_jitted_size(void);
 #ifdef JIT
 extern void (*flush_icache)(uaecptr ptr, int n);
+extern bool jit_page_fault(uintptr addr);
 #endif
 extern void alloc_cache(void);
+extern void *jit_mmap_low(size_t size, int prot);
 extern void compile_block(cpu_history* pc_hist, int blocklen, int totcyles);
 extern int check_for_cache_miss(void);
 
@@ -308,10 +325,14 @@ extern int touchcnt;
 /* What we expose to the outside */
 #define DECLARE_MIDFUNC(func) extern void func
 
-#if defined(CPU_arm)
+#if defined(CPU_arm) || defined(CPU_AARCH64)
+#include "flags_arm.h"
 #include "compemu_midfunc_arm.h"
-#else
+#elif defined(CPU_x86_64)
+#include "flags_x86.h"
 #include "compemu_midfunc_x86.h"
+#elif defined(JIT)
+#error "No JIT midfuncs for this CPU"
 #endif
 
 #undef DECLARE_MIDFUNC
@@ -48,59 +48,412 @@ static const uae_u16 x86_fpucw[]={
 static const int sz1[8] = { 4, 4, 12, 12, 2, 8, 1, 0 };
 static const int sz2[8] = { 4, 4, 12, 12, 2, 8, 2, 0 };
 
-/* return the required floating point precision or -1 for failure, 0=E, 1=S, 2=D */
-STATIC_INLINE int comp_fp_get (uae_u32 opcode, uae_u16 extra, int treg)
+#ifdef USE_JIT_FPU
+/* Native condition for each 68k FPU condition after fflags_into_flags(),
+   -1 where no single ARM condition fits (the interpreter handles those).
+   NATIVE_CC_HI/LS are avoided, the jcc code reads them with 68k carry. */
+static const int fpp_cond_native[16] = {
+  -1,            NATIVE_CC_EQ, NATIVE_CC_GT, NATIVE_CC_GE, /* F EQ OGT OGE */
+  NATIVE_CC_MI,  -1,           -1,           NATIVE_CC_VC, /* OLT OLE OGL OR */
+  NATIVE_CC_VS,  -1,           -1,           NATIVE_CC_PL, /* UN UEQ UGT UGE */
+  NATIVE_CC_LT,  NATIVE_CC_LE, NATIVE_CC_NE, -1            /* ULT ULE NE T */
+};
+
+/* 1 if the condition can be translated; F and T need no flags at all */
+STATIC_INLINE int comp_fp_cond_ok (int cond)
+{
+  cond &= 0x0f;
+  return cond == 0x00 || cond == 0x0f || fpp_cond_native[cond] >= 0;
+}
+
+/* Checked before anything is emitted, so FAIL(1) leaves a clean state.
+   X and P sizes, and integer stores (68k rounding), are left to the
+   interpreter. */
+STATIC_INLINE int comp_fp_ea_ok (uae_u32 opcode, int size, int put)
+{
+  int mode = (opcode >> 3) & 7;
+  int reg = opcode & 7;
+
+  switch (size) {
+    case 0: /* L */
+    case 4: /* W */
+    case 6: /* B */
+      if (put)
+        return 0;
+      break;
+    case 1: /* S */
+      break;
+    case 5: /* D */
+      if (mode == 0)
+        return 0;
+      break;
+    default:
+      return 0;
+  }
+  switch (mode) {
+    case 0:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return 1;
+    case 7:
+      if (reg == 2 || reg == 4)
+        return !put;
+      return reg <= 1;
+  }
+  return 0;
+}
+
+/* Calculate the address of a memory <ea> into S1, updating An for (An)+
+   and -(An) */
+STATIC_INLINE int comp_fp_adr (uae_u32 opcode, int size)
 {
-  printf("comp_fp_get not yet implemented\n");
-  return -1;
+  int mode = (opcode >> 3) & 7;
+  int reg = opcode & 7;
+  int len = reg == 7 ? sz2[size] : sz1[size];
+
+  switch (mode) {
+    case 2:
+      mov_l_rr (S1, reg + 8);
+      break;
+    case 3:
+      mov_l_rr (S1, reg + 8);
+      lea_l_brr (reg + 8, reg + 8, len);
+      break;
+    case 4:
+      lea_l_brr (reg + 8, reg + 8, -len);
+      mov_l_rr (S1, reg + 8);
+      break;
+    case 5:
+      mov_l_rr (S1, reg + 8);
+      lea_l_brr (S1, S1, (uae_s32)(uae_s16)comp_get_iword ((m68k_pc_offset += 2) - 2));
+      break;
+    case 6:
+      calc_disp_ea_020 (reg + 8, comp_get_iword ((m68k_pc_offset += 2) - 2), S1, S2);
+      break;
+    case 7:
+      switch (reg) {
+        case 0:
+          mov_l_ri (S1, (uae_s32)(uae_s16)comp_get_iword ((m68k_pc_offset += 2) - 2));
+          break;
+        case 1:
+          mov_l_ri (S1, comp_get_ilong ((m68k_pc_offset += 4) - 4));
+          break;
+        case 2:
+        {
+          uae_u32 address = start_pc + ((char *)comp_pc_p - (char *)start_pc_p) + m68k_pc_offset;
+          mov_l_ri (S1, address + (uae_s32)(uae_s16)comp_get_iword ((m68k_pc_offset += 2) - 2));
+          break;
+        }
+      }
+      break;
+  }
+  return S1;
 }
 
-/* return of -1 means failure, >=0 means OK */
-STATIC_INLINE int comp_fp_put (uae_u32 opcode, uae_u16 extra)
+/* Load the source operand into treg */
+STATIC_INLINE void comp_fp_get (uae_u32 opcode, uae_u16 extra, int treg)
 {
-  printf("comp_fp_put not yet implemented\n");
-  return -1;
+  int size = (extra >> 10) & 7;
+  int mode = (opcode >> 3) & 7;
+  int reg = opcode & 7;
+  int ad;
+
+  if (mode == 0) {
+    switch (size) {
+      case 6:
+        sign_extend_8_rr (S1, reg);
+        fmovi_rr (treg, S1);
+        break;
+      case 4:
+        sign_extend_16_rr (S1, reg);
+        fmovi_rr (treg, S1);
+        break;
+      case 0:
+        fmovi_rr (treg, reg);
+        break;
+      case 1:
+        fmovs_rr (treg, reg);
+        break;
+    }
+    return;
+  }
+  if (mode == 7 && reg == 4) {
+    switch (size) {
+      case 6:
+        mov_l_ri (S2, (uae_s32)(uae_s8)comp_get_ibyte ((m68k_pc_offset += 2) - 2));
+        fmovi_rr (treg, S2);
+        break;
+      case 4:
+        mov_l_ri (S2, (uae_s32)(uae_s16)comp_get_iword ((m68k_pc_offset += 2) - 2));
+        fmovi_rr (treg, S2);
+        break;
+      case 0:
+        mov_l_ri (S2, comp_get_ilong ((m68k_pc_offset += 4) - 4));
+        fmovi_rr (treg, S2);
+        break;
+      case 1:
+        mov_l_ri (S2, comp_get_ilong ((m68k_pc_offset += 4) - 4));
+        fmovs_rr (treg, S2);
+        break;
+      case 5:
+        mov_l_ri (S2, comp_get_ilong ((m68k_pc_offset += 4) - 4));
+        mov_l_ri (S3, comp_get_ilong ((m68k_pc_offset += 4) - 4));
+        fmovd_rrr (treg, S2, S3);
+        break;
+    }
+    return;
+  }
+
+  ad = comp_fp_adr (opcode, size);
+  switch (size) {
+    case 6:
+      readbyte (ad, S2, S3);
+      sign_extend_8_rr (S2, S2);
+      fmovi_rr (treg, S2);
+      break;
+    case 4:
+      readword (ad, S2, S3);
+      sign_extend_16_rr (S2, S2);
+      fmovi_rr (treg, S2);
+      break;
+    case 0:
+      readlong (ad, S2, S3);
+      fmovi_rr (treg, S2);
+      break;
+    case 1:
+      readlong (ad, S2, S3);
+      fmovs_rr (treg, S2);
+      break;
+    case 5:
+      readlong (ad, S2, S3);
+      arm_ADD_l_ri (ad, 4);
+      readlong (ad, S4, S3);
+      fmovd_rrr (treg, S2, S4);
+      break;
+  }
 }
 
-/* return -1 for failure, or register number for success */
-STATIC_INLINE int comp_fp_adr (uae_u32 opcode)
+/* FMOVE FPn,<ea> for single and double precision */
+STATIC_INLINE void comp_fp_put (uae_u32 opcode, uae_u16 extra)
 {
-  printf("comp_fp_adr not yet implemented\n");
-  return -1;
+  int size = (extra >> 10) & 7;
+  int sreg = (extra >> 7) & 7;
+  int mode = (opcode >> 3) & 7;
+  int reg = opcode & 7;
+  int ad;
+
+  if (mode == 0) {
+    fmovs_to_rr (reg, sreg);
+    return;
+  }
+
+  ad = comp_fp_adr (opcode, size);
+  if (size == 1) {
+    fmovs_to_rr (S2, sreg);
+    writelong (ad, S2, S3);
+  } else {
+    fmovd_to_rrr (S2, S4, sreg);
+    writelong (ad, S2, S3);
+    arm_ADD_l_ri (ad, 4);
+    writelong (ad, S4, S3);
+  }
 }
+#endif
 
 void comp_fdbcc_opp (uae_u32 opcode, uae_u16 extra)
 {
-  printf("comp_fdbcc_opp not yet implemented\n");
+  FAIL (1);
 }
 
 void comp_fscc_opp (uae_u32 opcode, uae_u16 extra)
 {
-  printf("comp_fscc_opp not yet implemented\n");
+#ifdef USE_JIT_FPU
+  int cond = extra & 0x0f;
+  int reg = opcode & 7;
+
+  /* Only Dn, memory destinations go through the interpreter */
+  if ((opcode & 0x38) != 0 || !comp_fp_cond_ok (cond)) {
+    FAIL (1);
+    return;
+  }
+
+  /* Same as Scc: 0 where we want 0xff, 1 where we want 0 */
+  switch (cond) {
+    case 0x00:
+      mov_l_ri (S1, 1);
+      break;
+    case 0x0f:
+      mov_l_ri (S1, 0);
+      break;
+    default:
+      fflags_into_flags (S2);
+      setcc (S1, fpp_cond_native[cond] ^ 1);
+      break;
+  }
+  sub_b_ri (S1, 1);
+  mov_b_rr (reg, S1);
+#else
+  FAIL (1);
+#endif
 }
 
 void comp_ftrapcc_opp (uae_u32 opcode, uaecptr oldpc)
 {
-  printf("comp_ftrapcc_opp not yet implemented\n");
+  FAIL (1);
 }
 
 void comp_fbcc_opp (uae_u32 opcode)
 {
-  printf("comp_fbcc_opp not yet implemented\n");
+#ifdef USE_JIT_FPU
+  int cond = opcode & 0x0f;
+  uae_u32 start = m68k_pc_offset;
+  uae_u32 off;
+  uae_u32 v1, v2;
+
+  if (!comp_fp_cond_ok (cond)) {
+    FAIL (1);
+    return;
+  }
+
+  /* Displacement is relative to the first extension word */
+  if (opcode & 0x40)
+    off = comp_get_ilong ((m68k_pc_offset += 4) - 4);
+  else
+    off = (uae_s32)(uae_s16)comp_get_iword ((m68k_pc_offset += 2) - 2);
+
+  mov_l_ri (S1, (uintptr)comp_pc_p + start + off);
+  mov_l_ri (PC_P, (uintptr)comp_pc_p + m68k_pc_offset);
+  m68k_pc_offset = 0;
+
+  switch (cond) {
+    case 0x00: /* never */
+      break;
+    case 0x0f: /* always */
+      mov_l_rr (PC_P, S1);
+      comp_pc_p = (uae_u8*)get_const (PC_P);
+      break;
+    default:
+      v1 = get_const (PC_P);
+      v2 = get_const (S1);
+      /* Last thing before the block ends, nothing may touch the flags */
+      fflags_into_flags (S2);
+      register_branch (v1, v2, fpp_cond_native[cond]);
+      break;
+  }
+#else
+  FAIL (1);
+#endif
 }
 
 void comp_fsave_opp (uae_u32 opcode)
 {
-  printf("comp_fsave_opp not yet implemented\n");
+  FAIL (1);
 }
 
 void comp_frestore_opp (uae_u32 opcode)
 {
-  printf("comp_frestore_opp not yet implemented\n");
+  FAIL (1);
 }
 
 void comp_fpp_opp (uae_u32 opcode, uae_u16 extra)
 {
-  printf("comp_fpp_opp not yet implemented\n");
+#ifdef USE_JIT_FPU
+  int reg = (extra >> 7) & 7;
+  int size = (extra >> 10) & 7;
+  int src;
+
+  switch ((extra >> 13) & 7) {
+    case 3: /* FMOVE FPn,<ea> */
+      if (!comp_fp_ea_ok (opcode, size, 1)) {
+        FAIL (1);
+        return;
+      }
+      comp_fp_put (opcode, extra);
+      return;
+    case 0:
+      break;
+    case 2:
+      if ((extra & 0xfc00) == 0x5c00) { /* FMOVECR */
+        FAIL (1);
+        return;
+      }
+      if (!comp_fp_ea_ok (opcode, size, 0)) {
+        FAIL (1);
+        return;
+      }
+      break;
+    default: /* FMOVE(M) of control registers, FMOVEM */
+      FAIL (1);
+      return;
+  }
+
+  switch (extra & 0x7f) {
+    case 0x00: case 0x40: case 0x44: /* FMOVE */
+    case 0x04: case 0x41: case 0x45: /* FSQRT */
+    case 0x18: case 0x58: case 0x5c: /* FABS */
+    case 0x1a: case 0x5a: case 0x5e: /* FNEG */
+    case 0x20: case 0x60: case 0x64: /* FDIV */
+    case 0x22: case 0x62: case 0x66: /* FADD */
+    case 0x23: case 0x63: case 0x67: /* FMUL */
+    case 0x28: case 0x68: case 0x6c: /* FSUB */
+    case 0x38: /* FCMP */
+    case 0x3a: /* FTST */
+      break;
+    default:
+      FAIL (1);
+      return;
+  }
+
+  if (extra & 0x4000) {
+    comp_fp_get (opcode, extra, FS1);
+    src = FS1;
+  } else {
+    src = (extra >> 10) & 7;
+  }
+
+  switch (extra & 0x7f) {
+    case 0x00: case 0x40: case 0x44:
+      fmov_rr (reg, src);
+      break;
+    case 0x04: case 0x41: case 0x45:
+      fsqrt_rr (reg, src);
+      break;
+    case 0x18: case 0x58: case 0x5c:
+      fabs_rr (reg, src);
+      break;
+    case 0x1a: case 0x5a: case 0x5e:
+      fneg_rr (reg, src);
+      break;
+    case 0x20: case 0x60: case 0x64:
+      fdiv_rr (reg, src);
+      break;
+    case 0x22: case 0x62: case 0x66:
+      fadd_rr (reg, src);
+      break;
+    case 0x23: case 0x63: case 0x67:
+      fmul_rr (reg, src);
+      break;
+    case 0x28: case 0x68: case 0x6c:
+      fsub_rr (reg, src);
+      break;
+    case 0x38: /* FCMP */
+      fmov_rr (FP_RESULT, reg);
+      fsub_rr (FP_RESULT, src);
+      mov_l_mi ((uintptr)&regs.fpsr, 0);
+      return;
+    case 0x3a: /* FTST */
+      fmov_rr (FP_RESULT, src);
+      mov_l_mi ((uintptr)&regs.fpsr, 0);
+      return;
+  }
+  if ((extra & 0x44) == 0x40)
+    fround_s_r (reg);
+  fmov_rr (FP_RESULT, reg);
+#else
+  FAIL (1);
+#endif
 }
 #endif
@@ -1995,6 +1995,160 @@ MIDFUNC(1,f_forget_about,(FW r))
 	live.fate[r].status=UNDEF;
 }
 MENDFUNC(1,f_forget_about,(FW r))
+
+MIDFUNC(2,fmov_rr,(FW d, FR s))
+{
+	if (d==s) /* How pointless! */
+	return;
+	/* Just let d share the native register of s */
+	f_disassociate(d);
+	s=f_readreg(s);
+	live.fate[d].realreg=s;
+	live.fate[d].realind=live.fat[s].nholds;
+	live.fate[d].status=DIRTY;
+	live.fat[s].holds[live.fat[s].nholds]=d;
+	live.fat[s].nholds++;
+	f_unlock(s);
+}
+MENDFUNC(2,fmov_rr,(FW d, FR s))
+
+MIDFUNC(2,fmovi_rr,(FW d, RR4 s))
+{
+	s=readreg(s,4);
+	d=f_writereg(d);
+	raw_fmovi_rr(d,s);
+	unlock2(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fmovi_rr,(FW d, RR4 s))
+
+MIDFUNC(2,fmovs_rr,(FW d, RR4 s))
+{
+	s=readreg(s,4);
+	d=f_writereg(d);
+	raw_fmovs_rr(d,s);
+	unlock2(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fmovs_rr,(FW d, RR4 s))
+
+MIDFUNC(3,fmovd_rrr,(FW d, RR4 hi, RR4 lo))
+{
+	hi=readreg(hi,4);
+	lo=readreg(lo,4);
+	d=f_writereg(d);
+	raw_fmovd_rrr(d,hi,lo);
+	unlock2(hi);
+	unlock2(lo);
+	f_unlock(d);
+}
+MENDFUNC(3,fmovd_rrr,(FW d, RR4 hi, RR4 lo))
+
+MIDFUNC(2,fmovs_to_rr,(W4 d, FR s))
+{
+	s=f_readreg(s);
+	d=writereg(d,4);
+	raw_fmovs_to_rr(d,s);
+	unlock2(d);
+	f_unlock(s);
+}
+MENDFUNC(2,fmovs_to_rr,(W4 d, FR s))
+
+MIDFUNC(3,fmovd_to_rrr,(W4 hi, W4 lo, FR s))
+{
+	s=f_readreg(s);
+	hi=writereg(hi,4);
+	lo=writereg(lo,4);
+	raw_fmovd_to_rrr(hi,lo,s);
+	unlock2(hi);
+	unlock2(lo);
+	f_unlock(s);
+}
+MENDFUNC(3,fmovd_to_rrr,(W4 hi, W4 lo, FR s))
+
+MIDFUNC(1,fround_s_r,(FRW r))
+{
+	r=f_rmw(r);
+	raw_fround_s_r(r);
+	f_unlock(r);
+}
+MENDFUNC(1,fround_s_r,(FRW r))
+
+MIDFUNC(2,fadd_rr,(FRW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_rmw(d);
+	raw_fadd_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fadd_rr,(FRW d, FR s))
+
+MIDFUNC(2,fsub_rr,(FRW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_rmw(d);
+	raw_fsub_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fsub_rr,(FRW d, FR s))
+
+MIDFUNC(2,fmul_rr,(FRW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_rmw(d);
+	raw_fmul_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fmul_rr,(FRW d, FR s))
+
+MIDFUNC(2,fdiv_rr,(FRW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_rmw(d);
+	raw_fdiv_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fdiv_rr,(FRW d, FR s))
+
+MIDFUNC(2,fsqrt_rr,(FW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_writereg(d);
+	raw_fsqrt_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fsqrt_rr,(FW d, FR s))
+
+MIDFUNC(2,fabs_rr,(FW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_writereg(d);
+	raw_fabs_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fabs_rr,(FW d, FR s))
+
+MIDFUNC(2,fneg_rr,(FW d, FR s))
+{
+	s=f_readreg(s);
+	d=f_writereg(d);
+	raw_fneg_rr(d,s);
+	f_unlock(s);
+	f_unlock(d);
+}
+MENDFUNC(2,fneg_rr,(FW d, FR s))
+
+MIDFUNC(1,fflags_into_flags,(W2 tmp))
+{
+	fflags_into_flags_internal(tmp);
+}
+MENDFUNC(1,fflags_into_flags,(W2 tmp))
 #endif
 
 // ARM optimized functions
@@ -2202,6 +2356,9 @@ MENDFUNC(2,arm_ROR_l_ri8,(RW4 r, IMM i))
 // Other
 static inline void flush_cpu_icache(void *start, void *stop)
 {
+#if defined(CPU_AARCH64)
+	__builtin___clear_cache((char *)start, (char *)stop);
+#else
 
 	register void *_beg __asm ("a1") = start;
 	register void *_end __asm ("a2") = stop;
@@ -2216,10 +2373,11 @@ static inline void flush_cpu_icache(void *start, void *stop)
 		   		    : "=r" (_beg)
 		   		    : "0" (_beg), "r" (_end), "r" (_flg));
 	#endif
+#endif
 }
 
 static inline void write_jmp_target(uae_u32* jmpaddr, cpuop_func* a) {
-	*(jmpaddr) = (uae_u32)a;
+	*(jmpaddr) = (uae_u32)(uintptr)a;
     flush_cpu_icache((void *)jmpaddr, (void *)&jmpaddr[1]);
 }
 
@@ -184,6 +184,21 @@ DECLARE_MIDFUNC(make_flags_live(void));
 DECLARE_MIDFUNC(forget_about(W4 r));
 
 DECLARE_MIDFUNC(f_forget_about(FW r));
+DECLARE_MIDFUNC(fmov_rr(FW d, FR s));
+DECLARE_MIDFUNC(fmovi_rr(FW d, RR4 s));
+DECLARE_MIDFUNC(fmovs_rr(FW d, RR4 s));
+DECLARE_MIDFUNC(fmovd_rrr(FW d, RR4 hi, RR4 lo));
+DECLARE_MIDFUNC(fmovs_to_rr(W4 d, FR s));
+DECLARE_MIDFUNC(fmovd_to_rrr(W4 hi, W4 lo, FR s));
+DECLARE_MIDFUNC(fround_s_r(FRW r));
+DECLARE_MIDFUNC(fadd_rr(FRW d, FR s));
+DECLARE_MIDFUNC(fsub_rr(FRW d, FR s));
+DECLARE_MIDFUNC(fmul_rr(FRW d, FR s));
+DECLARE_MIDFUNC(fdiv_rr(FRW d, FR s));
+DECLARE_MIDFUNC(fsqrt_rr(FW d, FR s));
+DECLARE_MIDFUNC(fabs_rr(FW d, FR s));
+DECLARE_MIDFUNC(fneg_rr(FW d, FR s));
+DECLARE_MIDFUNC(fflags_into_flags(W2 tmp));
 
 
 
@@ -45,6 +45,7 @@
 #include "comptbl.h"
 #include "compemu.h"
 #include <SDL.h>
+#include <stddef.h>
 
 #define DEBUG 0
 #include "debug.h"
@@ -52,6 +53,7 @@
 #if DEBUG
 #define PROFILE_COMPILE_TIME		1
 #define PROFILE_UNTRANSLATED_INSNS	1
+#define PROFILE_BLOCK_LOOKUP		1
 #endif
 
 #ifdef JIT_DEBUG
@@ -72,6 +74,14 @@ static clock_t emul_start_time	= 0;
 static clock_t emul_end_time	= 0;
 #endif
 
+#ifdef PROFILE_BLOCK_LOOKUP
+static uae_u32 lookup_predict_hits = 0;
+static uae_u32 lookup_predict_misses = 0;
+static uae_u32 lookup_cache_misses = 0;
+static uae_u32 lookup_checksums = 0;
+static uae_u32 lookup_retstack_hits = 0;
+#endif
+
 #ifdef PROFILE_UNTRANSLATED_INSNS
 static const int untranslated_top_ten = 20;
 static uae_u32 raw_cputbl_count[65536] = { 0, };
@@ -84,7 +94,7 @@ static int untranslated_compfn(const void *e1, const void *e2)
 }
 #endif
 
-#define NATMEM_OFFSETX (uae_u32)natmem_offset
+#define NATMEM_OFFSETX (uintptr)natmem_offset
 
 // %%% BRIAN KING WAS HERE %%%
 #include <sys/mman.h>
@@ -167,10 +177,45 @@ static void* popall_check_checksum=NULL;
  lists that we maintain for each hash result. */
 static cacheline cache_tags[TAGSIZE];
 static int letit=0;
+
+/* Shadow return stack. Compiled JSR/BSR push the host pc of the return
+   address and the handler slot of its block; a compiled RTS pops an entry
+   and jumps straight through it if the pc matches. */
+#define RETSTACK_SIZE 256
+typedef struct {
+  uae_u32 pc_p; /* the generated code reads and writes 32 bit slots */
+  uae_u32 handler;
+} retstack_entry;
+static retstack_entry jit_retstack[RETSTACK_SIZE];
+static uae_u32 jit_retsp;
 static blockinfo* hold_bi[MAX_HOLD_BI];
 static blockinfo* active;
 static blockinfo* dormant;
 
+/* Maps memory below 2 GB, where the 64-bit code generators can reach it
+   with 32 bit addresses. Returns NULL on failure. */
+void *jit_mmap_low(size_t size, int prot)
+{
+#if defined(CPU_x86_64)
+  void *p = mmap(0, size, prot, MAP_PRIVATE | MAP_ANON | MAP_32BIT, -1, 0);
+  return p == MAP_FAILED ? NULL : p;
+#elif defined(CPU_AARCH64)
+  /* No MAP_32BIT here, try hints until the kernel gives a low range */
+  for (uintptr hint = 0x10000000; hint + size <= 0x80000000; hint += 0x4000000) {
+    void *p = mmap((void *)hint, size, prot, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if (p == MAP_FAILED)
+      continue;
+    if ((uintptr)p + size <= 0x80000000)
+      return p;
+    munmap(p, size);
+  }
+  return NULL;
+#else
+  void *p = mmap(0, size, prot, MAP_PRIVATE | MAP_ANON, -1, 0);
+  return p == MAP_FAILED ? NULL : p;
+#endif
+}
+
 #ifdef PANDORA
 
 void cache_free (void *cache, int size)
@@ -182,7 +227,12 @@ void *cache_alloc (int size)
 {
   size = size < getpagesize() ? getpagesize() : size;
 
+#if SIZEOF_VOID_P == 8
+  /* The generated code addresses the cache with 32 bit addresses */
+  void *cache = jit_mmap_low(size, PROT_READ | PROT_WRITE | PROT_EXEC);
+#else
   void *cache = mmap(0, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, -1, 0);
+#endif
   if (!cache) {
     printf ("Cache_Alloc of %d failed. ERR=%d\n", size, errno);
   }
@@ -215,6 +265,7 @@ extern const struct cputbl op_smalltbl_5_nf[];
 static void flush_icache_hard(uaecptr ptr, int n);
 static void flush_icache_lazy(uaecptr ptr, int n);
 static void flush_icache_none(uaecptr ptr, int n);
+static void free_page_table(void);
 void (*flush_icache)(uaecptr ptr, int n) = flush_icache_none;
 
 static bigstate live;
@@ -557,7 +608,11 @@ LazyBlockAllocator<T>::~LazyBlockAllocator()
 	while (currentPool) {
 		Pool * deadPool = currentPool;
 		currentPool = currentPool->next;
+#if SIZEOF_VOID_P == 8
+		munmap(deadPool, sizeof(Pool));
+#else
 		free(deadPool);
+#endif
 	}
 }
 
@@ -567,7 +622,12 @@ T * LazyBlockAllocator<T>::acquire()
 	if (!mChunks) {
 		// There is no chunk left, allocate a new pool and link the
 		// chunks into the free list
+#if SIZEOF_VOID_P == 8
+		/* Blockinfo fields are addressed with 32 bit addresses */
+		Pool * newPool = (Pool *)jit_mmap_low(sizeof(Pool), PROT_READ | PROT_WRITE);
+#else
 		Pool * newPool = (Pool *)malloc(sizeof(Pool));
+#endif
 		if (newPool == NULL) {
 	    jit_abort(_T("FATAL: Could not allocate block pool!\n"));
     }
@@ -679,6 +739,11 @@ bool check_prefs_changed_comp (void)
 	  alloc_cache();
 	  changed = 1;
   }
+  if (currprefs.compfpu!=changed_prefs.compfpu) {
+	  currprefs.compfpu = changed_prefs.compfpu;
+	  flush_icache_hard(0, 3);
+	  changed = 1;
+  }
   return changed;
 }
 
@@ -821,8 +886,12 @@ STATIC_INLINE void reset_data_buffer(void)
 
 #if defined(CPU_arm) 
 #include "codegen_arm.cpp"
+#elif defined(CPU_AARCH64)
+#include "codegen_arm64.cpp"
+#elif defined(CPU_x86_64)
+#include "codegen_x86.cpp"
 #else
-#include "compemu_raw_x86.cpp"
+#error "No JIT code generator for this CPU"
 #endif
 
 
@@ -1937,16 +2006,19 @@ static void fflags_into_flags_internal(uae_u32 tmp)
 	else
     raw_fflags_into_flags(r);
   f_unlock(r);
-  live_flags();
+  /* The native flags now hold the FPU condition for a following jcc or
+     setcc; the 68k flags stay safe on the stack */
 }
 
 #endif //USE_JIT_FPU
 
 
-#if defined(CPU_arm)
+#if defined(CPU_arm) || defined(CPU_AARCH64)
 #include "compemu_midfunc_arm.cpp"
+#elif defined(CPU_x86_64)
+#include "compemu_midfunc_x86.cpp"
 #else
-#include "compemu_midfunc_x86.c"
+#error "No JIT midfuncs for this CPU"
 #endif
 
 
@@ -2014,7 +2086,7 @@ void compiler_init(void)
 
 #ifdef USE_JIT_FPU
 	// Use JIT compiler for FPU instructions ?
-	avoid_fpu = !bx_options.jit.jitfpu;
+	avoid_fpu = !currprefs.compfpu;
 #else
 	// JIT FPU is always disabled
 	avoid_fpu = 1;
@@ -2073,6 +2145,9 @@ void compiler_exit(void)
 		popallspace = 0;
 	}
 
+	// Drop the code page protection
+	free_page_table();
+
 #ifdef PROFILE_COMPILE_TIME
 	bug("### Compile Block statistics");
 	bug("Number of calls to compile_block : %d", compile_count);
@@ -2081,6 +2156,17 @@ void compiler_exit(void)
 	bug("Total compilation time : %.1f sec (%.1f%%)", double(compile_time)/double(CLOCKS_PER_SEC), 100.0*double(compile_time)/double(emul_time));
 #endif
 
+#ifdef PROFILE_BLOCK_LOOKUP
+	bug("### Block lookup statistics");
+	bug("Predicted successor hits   : %u", lookup_predict_hits);
+	bug("Predicted successor misses : %u", lookup_predict_misses);
+	bug("Cache tag misses           : %u", lookup_cache_misses);
+	bug("Checksum checks            : %u", lookup_checksums);
+	bug("Return stack hits          : %u", lookup_retstack_hits);
+	if (lookup_predict_hits + lookup_predict_misses)
+		bug("Prediction hit rate        : %.1f%%", 100.0*double(lookup_predict_hits)/double(lookup_predict_hits + lookup_predict_misses));
+#endif
+
 #ifdef PROFILE_UNTRANSLATED_INSNS
 	uae_u64 untranslated_count = 0;
 	for (int i = 0; i < 65536; i++) {
@@ -2148,7 +2234,7 @@ void init_comp(void)
   live.state[FLAGX].needflush=NF_TOMEM;
   set_status(FLAGX,INMEM);
 
-#if defined(CPU_arm)
+#if defined(CPU_arm) || defined(CPU_AARCH64)
   live.state[FLAGTMP].mem=(uae_u32*)&(regs.ccrflags.nzcv);
 #else
   live.state[FLAGTMP].mem=(uae_u32*)&(regs.ccrflags.cznv);
@@ -2172,7 +2258,7 @@ void init_comp(void)
 	    live.fate[i].status=INMEM;
   	}
   	else
-	    live.fate[i].mem=(uae_u32*)(&scratch.fregs[i]);
+	    live.fate[i].mem=(uae_u32*)(&scratch.fscratch[i]);
   }
 #endif
 
@@ -2205,7 +2291,9 @@ void init_comp(void)
   live.flags_on_stack=VALID;
   live.flags_are_important=1;
 
+#ifdef USE_JIT_FPU
   raw_fp_init();
+#endif
 }
 
 /* Only do this if you really mean it! The next call should be to init!*/
@@ -2271,6 +2359,10 @@ void freescratch(void)
   for (i=0;i<N_REGS;i++)
 #if defined(CPU_arm)
   	if (live.nat[i].locked && i != 2 && i != 3) {
+#elif defined(CPU_AARCH64)
+  	if (live.nat[i].locked && i != REG_WORK1 && i != REG_WORK2 && i < 11) {
+#elif defined(CPU_x86_64)
+  	if (live.nat[i].locked && i != 4 && i != REG_WORK1 && i != REG_WORK2) {
 #else
   	if (live.nat[i].locked && i!=4) {
 #endif
@@ -2314,8 +2406,8 @@ static void align_target(uae_u32 a)
 extern uae_u8* kickmemory;
 STATIC_INLINE int isinrom(uintptr addr)
 {
-  return (addr>=(uae_u32)kickmemory &&
-    addr<(uae_u32)kickmemory+8*65536);
+  return (addr>=(uintptr)kickmemory &&
+    addr<(uintptr)kickmemory+8*65536);
 }
 
 static void flush_all(void)
@@ -2418,7 +2510,7 @@ STATIC_INLINE void writemem(int address, int source, int offset, int size, int t
 
   mov_l_rr(f,address);
   shrl_l_ri(f,16);   /* The index into the mem bank table */
-  mov_l_rm_indexed(f,(uae_u32)mem_banks,f,4);
+  mov_l_rm_indexed(f,(uintptr)mem_banks,f,SIZEOF_VOID_P);
   /* Now f holds a pointer to the actual membank */
   mov_l_rR(f,f,offset);
   /* Now f holds the address of the b/w/lput function */
@@ -2429,7 +2521,7 @@ STATIC_INLINE void writemem(int address, int source, int offset, int size, int t
 void writebyte(int address, int source, int tmp)
 {
   if (special_mem&S_WRITE)
-  	writemem_special(address,source,20,1,tmp);
+  	writemem_special(address,source,offsetof(addrbank,bput),1,tmp);
   else
   	writemem_real(address,source,1,tmp);
 }
@@ -2437,7 +2529,7 @@ void writebyte(int address, int source, int tmp)
 void writeword(int address, int source, int tmp)
 {
   if (special_mem&S_WRITE)
-  	writemem_special(address,source,16,2,tmp);
+  	writemem_special(address,source,offsetof(addrbank,wput),2,tmp);
   else
   	writemem_real(address,source,2,tmp);
 }
@@ -2445,7 +2537,7 @@ void writeword(int address, int source, int tmp)
 void writelong(int address, int source, int tmp)
 {
   if (special_mem&S_WRITE)
-  	writemem_special(address,source,12,4,tmp);
+  	writemem_special(address,source,offsetof(addrbank,lput),4,tmp);
   else
   	writemem_real(address,source,4,tmp);
 }
@@ -2478,7 +2570,7 @@ STATIC_INLINE void writemem_real_clobber(int address, int source,int size, int t
 void writelong_clobber(int address, int source, int tmp)
 {
   if (special_mem&S_WRITE)
-  	writemem_special(address,source,12,4,tmp);
+  	writemem_special(address,source,offsetof(addrbank,lput),4,tmp);
   else
   	writemem_real_clobber(address,source,4,tmp);
 }
@@ -2514,7 +2606,7 @@ STATIC_INLINE void readmem(int address, int dest, int offset, int size, int tmp)
   int f=tmp;
   mov_l_rr(f,address);
   shrl_l_ri(f,16);   /* The index into the mem bank table */
-  mov_l_rm_indexed(f,(uae_u32)mem_banks,f,4);
+  mov_l_rm_indexed(f,(uintptr)mem_banks,f,SIZEOF_VOID_P);
   /* Now f holds a pointer to the actual membank */
   mov_l_rR(f,f,offset);
   /* Now f holds the address of the b/w/lget function */
@@ -2525,7 +2617,7 @@ STATIC_INLINE void readmem(int address, int dest, int offset, int size, int tmp)
 void readbyte(int address, int dest, int tmp)
 {
   if (special_mem&S_READ)
-  	readmem_special(address,dest,8,1,tmp);
+  	readmem_special(address,dest,offsetof(addrbank,bget),1,tmp);
   else
   	readmem_real(address,dest,1,tmp);
 }
@@ -2533,7 +2625,7 @@ void readbyte(int address, int dest, int tmp)
 void readword(int address, int dest, int tmp)
 {
   if (special_mem&S_READ)
-  	readmem_special(address,dest,4,2,tmp);
+  	readmem_special(address,dest,offsetof(addrbank,wget),2,tmp);
   else
   	readmem_real(address,dest,2,tmp);
 }
@@ -2541,7 +2633,7 @@ void readword(int address, int dest, int tmp)
 void readlong(int address, int dest, int tmp)
 {
   if (special_mem&S_READ)
-  	readmem_special(address,dest,0,4,tmp);
+  	readmem_special(address,dest,offsetof(addrbank,lget),4,tmp);
   else
   	readmem_real(address,dest,4,tmp);
 }
@@ -2549,7 +2641,7 @@ void readlong(int address, int dest, int tmp)
 /* This one might appear a bit odd... */
 STATIC_INLINE void get_n_addr_old(int address, int dest, int tmp)
 {
-  readmem(address,dest,24,4,tmp);
+  readmem(address,dest,offsetof(addrbank,xlateaddr),4,tmp);
 }
 
 STATIC_INLINE void get_n_addr_real(int address, int dest, int tmp)
@@ -2770,6 +2862,9 @@ static void cache_miss(void)
   blockinfo*  bi2=get_blockinfo(cl);
 #endif
 
+#ifdef PROFILE_BLOCK_LOOKUP
+  lookup_cache_misses++;
+#endif
   if (!bi) {
 	  execute_normal(); /* Compile this block now */
 	  return;
@@ -2848,6 +2943,10 @@ static void check_checksum(void)
   uae_u32     cl=cacheline(regs.pc_p);
   blockinfo*  bi2=get_blockinfo(cl);
 
+#ifdef PROFILE_BLOCK_LOOKUP
+  lookup_checksums++;
+#endif
+
   /* These are not the droids you are looking for...  */
   if (!bi) {
 	  /* Whoever is the primary target is in a dormant state, but
@@ -3077,6 +3176,11 @@ void build_comp(void)
     : op_smalltbl_5_nf);
 #endif
 
+#ifdef USE_JIT_FPU
+  /* The 68060 can switch its FPU off at runtime through the PCR */
+  avoid_fpu = !currprefs.compfpu || currprefs.fpu_model <= 0 || currprefs.cpu_model >= 68060;
+#endif
+
   for (opcode = 0; opcode < 65536; opcode++) {
 		reset_compop(opcode);
 	  prop[opcode].use_flags = 0x1f;
@@ -3100,7 +3204,7 @@ void build_comp(void)
   }
 
   for (i = 0; nftbl[i].opcode < 65536; i++) {
-		int uses_fpu = tbl[i].specific & 32;
+		int uses_fpu = nftbl[i].specific & 32;
 		if (uses_fpu && avoid_fpu)
 			nfcompfunctbl[nftbl[i].opcode] = NULL;
 		else
@@ -3196,6 +3300,286 @@ void build_comp(void)
   default_ss=empty_ss;
 }
 
+/* Self-modifying code tracking. Pages of natmem holding 68k code of an
+   active block are write protected; the first write to one of them faults,
+   marks the page dirty and drops the protection again. A lazy flush then
+   only has to check the blocks on dirty pages.
+   The filesys, bsdsocket and hardfile threads and the SIGSEGV handler
+   change the page state too, so all of it is done under jit_pages_lock, a
+   spinlock because the signal handler can't wait on a mutex. Pages a host
+   system call is writing to count as in use and are not protected again
+   until jit_unprotect_done. */
+#define JIT_PAGE_SHIFT 12
+#define JPAGE_CODE   1	/* code of a block was translated from this page */
+#define JPAGE_PROT   2	/* currently write protected */
+#define JPAGE_DIRTY  4	/* written since the last flush */
+#define MAX_DIRTY_PAGES 256
+
+static uae_u8* jit_pages=NULL;
+static uae_u16* jit_pages_io=NULL;	/* host writes in flight per page */
+static uae_u32 jit_npages=0;
+static uae_u32 dirty_pages[MAX_DIRTY_PAGES];
+static uae_u32 dirty_count=0;	/* above MAX_DIRTY_PAGES: scan them all */
+static volatile int jit_pages_lock=0;
+
+STATIC_INLINE void lock_pages(void)
+{
+  while (__sync_lock_test_and_set(&jit_pages_lock, 1)) {
+    while (jit_pages_lock)
+      ;
+  }
+}
+
+STATIC_INLINE void unlock_pages(void)
+{
+  __sync_lock_release(&jit_pages_lock);
+}
+
+static void alloc_page_table(void)
+{
+  uae_u8* pages;
+  uae_u16* io;
+
+  if (jit_pages || !natmem_offset || getpagesize() != (1 << JIT_PAGE_SHIFT))
+    return;
+  io = xcalloc(uae_u16, natmem_size >> JIT_PAGE_SHIFT);
+  pages = xcalloc(uae_u8, natmem_size >> JIT_PAGE_SHIFT);
+  lock_pages();
+  jit_npages = natmem_size >> JIT_PAGE_SHIFT;
+  jit_pages_io = io;
+  jit_pages = pages;
+  unlock_pages();
+}
+
+static void set_pages_prot(uae_u32 first, uae_u32 n, int prot)
+{
+  mprotect(natmem_offset + (first << JIT_PAGE_SHIFT), n << JIT_PAGE_SHIFT, prot);
+}
+
+/* Map a host range to natmem pages. False if it is not tracked at all. */
+STATIC_INLINE bool range_pages(uintptr start, uae_u32 len, uae_u32* first, uae_u32* last)
+{
+  uintptr offs = start - (uintptr)natmem_offset;
+
+  if (!jit_pages || start < (uintptr)natmem_offset || offs + len > natmem_size)
+    return false;
+  *first = offs >> JIT_PAGE_SHIFT;
+  *last = (offs + len - 1) >> JIT_PAGE_SHIFT;
+  return true;
+}
+
+static bool range_dirty(uintptr start, uae_u32 len)
+{
+  uae_u32 first, last, p;
+
+  if (isinrom(start) && isinrom(start + len - 1))
+    return false;
+  if (!range_pages(start, len, &first, &last))
+    return true;
+  for (p = first; p <= last; p++) {
+    if ((jit_pages[p] & (JPAGE_PROT | JPAGE_DIRTY)) != JPAGE_PROT)
+      return true;
+  }
+  return false;
+}
+
+static void protect_range(uintptr start, uae_u32 len)
+{
+  uae_u32 first, last, p, run = 0;
+
+  if (isinrom(start) && isinrom(start + len - 1))
+    return;
+  if (!range_pages(start, len, &first, &last))
+    return;
+  lock_pages();
+  for (p = first; p <= last + 1; p++) {
+    if (p <= last && jit_pages_io[p]) {
+      /* a host write is under way, the page stays dirty and unprotected */
+      jit_pages[p] |= JPAGE_CODE;
+    } else if (p <= last && !(jit_pages[p] & JPAGE_PROT)) {
+      jit_pages[p] |= JPAGE_CODE | JPAGE_PROT;
+      run++;
+      continue;
+    }
+    if (run) {
+      set_pages_prot(p - run, run, PROT_READ);
+      run = 0;
+    }
+  }
+  unlock_pages();
+}
+
+static bool block_pages_dirty(blockinfo* bi)
+{
+#if USE_CHECKSUM_INFO
+  checksum_info *csi = bi->csi;
+
+  if (!csi)
+    return true;
+  for (; csi; csi = csi->next) {
+    if (range_dirty((uintptr)csi->start_p, csi->length))
+      return true;
+  }
+  return false;
+#else
+  return range_dirty(bi->min_pcp, bi->len);
+#endif
+}
+
+static void protect_block_pages(blockinfo* bi)
+{
+  alloc_page_table();
+#if USE_CHECKSUM_INFO
+  for (checksum_info *csi = bi->csi; csi; csi = csi->next)
+    protect_range((uintptr)csi->start_p, csi->length);
+#else
+  protect_range(bi->min_pcp, bi->len);
+#endif
+}
+
+/* With jit_pages_lock held */
+static void queue_dirty_page(uae_u32 p)
+{
+  if (dirty_count < MAX_DIRTY_PAGES)
+    dirty_pages[dirty_count] = p;
+  dirty_count++;
+}
+
+/* With jit_pages_lock held */
+static void unprotect_page(uae_u32 p)
+{
+  jit_pages[p] = (jit_pages[p] & ~JPAGE_PROT) | JPAGE_DIRTY;
+  set_pages_prot(p, 1, PROT_READ | PROT_WRITE);
+  queue_dirty_page(p);
+}
+
+/* Called from the SIGSEGV handler with the faulting natmem offset */
+bool jit_page_fault(uintptr addr)
+{
+  uae_u32 p = addr >> JIT_PAGE_SHIFT;
+  bool ours = false;
+
+  lock_pages();
+  if (jit_pages && addr < natmem_size && (jit_pages[p] & JPAGE_PROT)) {
+    unprotect_page(p);
+    ours = true;
+  }
+  unlock_pages();
+  return ours;
+}
+
+/* Host code is about to write to Amiga memory with a system call, which
+   can't be restarted through the fault handler. The pages are handled as
+   if the write had faulted, and stay writable until jit_unprotect_done. */
+void jit_unprotect_range(uae_u8* p, uae_u32 len)
+{
+  uae_u32 first, last, i;
+
+  if (!len)
+    return;
+  lock_pages();
+  if (range_pages((uintptr)p, len, &first, &last)) {
+    for (i = first; i <= last; i++) {
+      jit_pages_io[i]++;
+      if (jit_pages[i] & JPAGE_PROT)
+        unprotect_page(i);
+    }
+  }
+  unlock_pages();
+}
+
+/* The system call that jit_unprotect_range was made for has returned, the
+   next flush may watch the pages again */
+void jit_unprotect_done(uae_u8* p, uae_u32 len)
+{
+  uae_u32 first, last, i;
+
+  if (!len)
+    return;
+  lock_pages();
+  if (range_pages((uintptr)p, len, &first, &last)) {
+    for (i = first; i <= last; i++) {
+      if (jit_pages_io[i])
+        jit_pages_io[i]--;
+    }
+  }
+  unlock_pages();
+}
+
+/* Code on the pages written since the last flush has been marked for a
+   check, so watch them again. Pages a host write is still going to stay
+   dirty and queued for the next flush. With jit_pages_lock held, from the
+   start of the flush, so no page can turn dirty between the check of its
+   blocks and this. */
+static void reprotect_dirty_pages(void)
+{
+  uae_u32 i, n;
+
+  if (!jit_pages)
+    return;
+  n = dirty_count;
+  dirty_count = 0;
+  if (n > MAX_DIRTY_PAGES) {
+    for (i = 0; i < jit_npages; i++) {
+      if (!(jit_pages[i] & JPAGE_DIRTY))
+        continue;
+      if (jit_pages_io[i]) {
+        queue_dirty_page(i);
+        continue;
+      }
+      jit_pages[i] = JPAGE_CODE | JPAGE_PROT;
+      set_pages_prot(i, 1, PROT_READ);
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      uae_u32 p = dirty_pages[i];
+      if (!(jit_pages[p] & JPAGE_DIRTY))
+        continue;
+      if (jit_pages_io[p]) {
+        queue_dirty_page(p);
+        continue;
+      }
+      jit_pages[p] = JPAGE_CODE | JPAGE_PROT;
+      set_pages_prot(p, 1, PROT_READ);
+    }
+  }
+}
+
+static void unprotect_all_pages(void)
+{
+  uae_u32 i;
+
+  lock_pages();
+  if (jit_pages) {
+    for (i = 0; i < jit_npages; i++) {
+      if (jit_pages[i] & JPAGE_PROT)
+        set_pages_prot(i, 1, PROT_READ | PROT_WRITE);
+      jit_pages[i] = 0;
+    }
+  }
+  dirty_count = 0;
+  unlock_pages();
+}
+
+static void free_page_table(void)
+{
+  uae_u8* pages;
+  uae_u16* io;
+
+  unprotect_all_pages();
+  lock_pages();
+  pages = jit_pages;
+  io = jit_pages_io;
+  jit_pages = NULL;
+  jit_pages_io = NULL;
+  jit_npages = 0;
+  unlock_pages();
+  if (pages)
+    xfree(pages);
+  if (io)
+    xfree(io);
+}
+
 static void flush_icache_none(uaecptr ptr, int n)
 {
 	/* Nothing to do.  */
@@ -3225,6 +3609,9 @@ static void flush_icache_hard(uaecptr ptr, int n)
   }
 
   reset_lists();
+  /* The handler slots in there belonged to the blockinfos just freed */
+  memset(jit_retstack, 0, sizeof(jit_retstack));
+  unprotect_all_pages();
   if (!compiled_code)
   	return;
 
@@ -3250,9 +3637,11 @@ STATIC_INLINE void flush_icache_lazy(uaecptr ptr, int n)
   if (!active)
 	  return;
 
+  lock_pages();
   bi=active;
   while (bi) {
   	uae_u32 cl=cacheline(bi->pc_p);
+	  bi2=bi->next;
 		if (bi->status==BI_INVALID ||
 			bi->status==BI_NEED_RECOMP) { 
   	    if (bi==cache_tags[cl+1].bi)
@@ -3260,6 +3649,10 @@ STATIC_INLINE void flush_icache_lazy(uaecptr ptr, int n)
   	    bi->handler_to_use = (cpuop_func *)popall_execute_normal;
   	    set_dhtu(bi,bi->direct_pen);
   	    bi->status=BI_INVALID;
+	  }	else if (!block_pages_dirty(bi)) {
+	    /* None of its pages were written, so it stays active */
+	    bi=bi2;
+	    continue;
 	  }	else {
 	    if (bi==cache_tags[cl+1].bi)
 		    cache_tags[cl].handler = (cpuop_func *)popall_check_checksum;
@@ -3267,17 +3660,12 @@ STATIC_INLINE void flush_icache_lazy(uaecptr ptr, int n)
 	    set_dhtu(bi,bi->direct_pcc);
 		  bi->status=BI_NEED_CHECK;
 	  }
-	  bi2=bi;
-	  bi=bi->next;
+	  remove_from_list(bi);
+	  add_to_dormant(bi);
+	  bi=bi2;
   }
-  /* bi2 is now the last entry in the active list */
-  bi2->next=dormant;
-  if (dormant)
-  	dormant->prev_p=&(bi2->next);
-
-  dormant=active;
-  active->prev_p=&dormant;
-  active=NULL;
+  reprotect_dirty_pages();
+  unlock_pages();
 }
 
 int failure;
@@ -3315,6 +3703,195 @@ void compiler_dumpstate(void)
 }
 #endif
 
+/* Called after a conditional branch inside a trace. The trace goes on
+   where the branch went while it was recorded, with all registers still
+   allocated; the other direction becomes a side exit that flushes and
+   leaves through the cache tags, charging the cycles up to the branch. */
+static void trace_side_exit(uae_u16* trace_pc, int cycles)
+{
+  uintptr exit_pc;
+  int cc;
+  int r,r2;
+  uae_u32* branchadd;
+  bigstate tmp;
+
+  if ((uintptr)trace_pc==taken_pc_p) {
+	  exit_pc=next_pc_p;
+	  cc=branch_cc;
+  }
+  else {
+	  exit_pc=taken_pc_p;
+	  cc=branch_cc^1;
+  }
+
+  tmp=live;
+#if defined(USE_DATA_BUFFER)
+  data_check_end(32, 128); // just a pessimistic guess...
+#endif
+  compemu_raw_jcc_l_oponly(cc);
+  branchadd=(uae_u32*)get_target();
+  emit_long(0);
+
+  flush(1);
+  compemu_raw_mov_l_mi((uintptr)&regs.pc_p,exit_pc);
+  r=REG_PC_TMP;
+  compemu_raw_mov_l_ri(r,exit_pc & TAGMASK);
+  r2 = (r==0) ? 1 : 0;
+  compemu_raw_mov_l_ri(r2,(uintptr)popall_do_nothing);
+  compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(cycles));
+  compemu_raw_cmov_l_rm_indexed(r2,(uintptr)cache_tags,r,SIZEOF_VOID_P,NATIVE_CC_PL);
+  compemu_raw_jmp_r(r2);
+
+  write_jmp_target(branchadd, (cpuop_func*)get_target());
+  live=tmp;
+
+  comp_pc_p=(uae_u8*)trace_pc;
+  mov_l_ri(PC_P,(uintptr)trace_pc);
+  next_pc_p=0;
+  taken_pc_p=0;
+  branch_cc=0;
+}
+
+/* Called after a branch inside a trace that computed PC_P instead of
+   registering both directions (DBcc, RTS, JMP (An), ...). Unless PC_P is
+   known to be where the trace goes, it is compared, and a mismatch leaves
+   like a side exit through the cache tags. */
+static void trace_pc_guard(uae_u16* trace_pc, int cycles)
+{
+  int r,r2;
+  uae_u32* branchadd;
+  bigstate tmp;
+
+  if (isconst(PC_P) && live.state[PC_P].val==(uintptr)trace_pc)
+	  return;
+
+  clobber_flags();
+  r=readreg(PC_P,4);
+  compemu_raw_mov_l_mr((uintptr)&regs.pc_p,r);
+  unlock2(r);
+
+  tmp=live;
+#if defined(USE_DATA_BUFFER)
+  data_check_end(32, 128); // just a pessimistic guess...
+#endif
+  compemu_raw_cmp_l_mi((uintptr)&regs.pc_p,(uintptr)trace_pc);
+  compemu_raw_jcc_l_oponly(NATIVE_CC_EQ);
+  branchadd=(uae_u32*)get_target();
+  emit_long(0);
+
+  flush(1);
+  r=REG_PC_TMP;
+  compemu_raw_mov_l_rm(r,(uintptr)&regs.pc_p);
+  compemu_raw_and_l_ri(r,TAGMASK);
+  r2 = (r==0) ? 1 : 0;
+  compemu_raw_mov_l_ri(r2,(uintptr)popall_do_nothing);
+  compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(cycles));
+  compemu_raw_cmov_l_rm_indexed(r2,(uintptr)cache_tags,r,SIZEOF_VOID_P,NATIVE_CC_PL);
+  compemu_raw_jmp_r(r2);
+
+  write_jmp_target(branchadd, (cpuop_func*)get_target());
+  live=tmp;
+
+  comp_pc_p=(uae_u8*)trace_pc;
+  mov_l_ri(PC_P,(uintptr)trace_pc);
+}
+
+/* Push the return address of a just compiled JSR/BSR. Blockinfos can't
+   be allocated in the middle of a block, so this only happens once the
+   return block is known, i.e. usually when the caller is recompiled. */
+static void push_retstack(uintptr ret_p)
+{
+  blockinfo* rbi=get_blockinfo_addr((void*)ret_p);
+  int t=S1;
+  int u=S2;
+
+  if (!rbi)
+	  return;
+  mov_l_rm(t,(uintptr)&jit_retsp);
+  lea_l_brr(t,t,1);
+  zero_extend_8_rr(t,t);
+  mov_l_mr((uintptr)&jit_retsp,t);
+  mov_l_ri(u,(uintptr)jit_retstack);
+  lea_l_rr_indexed(t,u,t,sizeof(retstack_entry));
+  mov_l_Ri(t,ret_p,0);
+  mov_l_Ri(t,(uintptr)&rbi->direct_handler_to_use,4);
+  freescratch();
+}
+
+/* Pop the shadow return stack at the end of a block ending in RTS, with
+   the new host pc in native register r. Falls through on a mismatch. */
+static void pop_retstack(int r, int totcycles)
+{
+  int x=(r==0) ? 1 : 0;
+  int y=(r==5) ? 6 : 5;
+  uae_u32* branchadd;
+
+#if defined(USE_DATA_BUFFER)
+  data_check_end(32, 128); // just a pessimistic guess...
+#endif
+  compemu_raw_mov_l_rm(x,(uintptr)&jit_retsp);
+  compemu_raw_mov_l_ri(y,(uintptr)jit_retstack);
+  compemu_raw_lea_l_rr_indexed(y,y,x,sizeof(retstack_entry));
+  compemu_raw_lea_l_brr(x,x,-1);
+  compemu_raw_and_l_ri(x,RETSTACK_SIZE-1);
+  compemu_raw_mov_l_mr((uintptr)&jit_retsp,x);
+  compemu_raw_mov_l_rR(x,y,0);
+  compemu_raw_cmp_l_rr(x,r);
+  compemu_raw_jcc_l_oponly(NATIVE_CC_NE);
+  branchadd=(uae_u32*)get_target();
+  emit_long(0);
+
+#ifdef PROFILE_BLOCK_LOOKUP
+  compemu_raw_add_l_mi((uintptr)&lookup_retstack_hits,1);
+#endif
+  compemu_raw_mov_l_rR(y,y,4);
+  compemu_raw_mov_l_rR(y,y,0);
+  compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
+  compemu_raw_jcc_l_oponly(NATIVE_CC_MI);
+  emit_jmp_target((uintptr)popall_do_nothing);
+  compemu_raw_jmp_r(y);
+
+  write_jmp_target(branchadd, (cpuop_func*)get_target());
+}
+
+/* Blocks that end in an indirect jump (RTS, JMP (An), ...) first try the
+   successor seen while the block was recorded, chained like a direct
+   branch. Only a mismatch goes through the cache tags. */
+static void predict_successor(blockinfo* bi, uintptr succ, int totcycles)
+{
+  uae_u32* branchadd;
+  uae_u32* tba;
+  blockinfo* tbi;
+  bigstate tmp;
+
+  tmp=live;
+#if defined(USE_DATA_BUFFER)
+  data_check_end(32, 128); // just a pessimistic guess...
+#endif
+  compemu_raw_cmp_l_mi((uintptr)&regs.pc_p,succ);
+  compemu_raw_jcc_l_oponly(NATIVE_CC_NE);
+  branchadd=(uae_u32*)get_target();
+  emit_long(0);
+
+#ifdef PROFILE_BLOCK_LOOKUP
+  compemu_raw_add_l_mi((uintptr)&lookup_predict_hits,1);
+#endif
+  tbi=get_blockinfo_addr_new((void*)succ,1);
+  match_states(tbi);
+  compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
+  compemu_raw_jcc_l_oponly(NATIVE_CC_PL);
+  tba=(uae_u32*)get_target();
+  emit_jmp_target(get_handler(succ));
+  compemu_raw_jmp((uintptr)popall_do_nothing);
+  create_jmpdep(bi,0,tba,succ);
+
+  write_jmp_target(branchadd, (cpuop_func*)get_target());
+  live=tmp;
+#ifdef PROFILE_BLOCK_LOOKUP
+  compemu_raw_add_l_mi((uintptr)&lookup_predict_misses,1);
+#endif
+}
+
 void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 {
   if (letit && compiled_code && currprefs.cpu_model>=68020) {
@@ -3344,6 +3921,8 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 	  blockinfo* bi=NULL;
 	  blockinfo* bi2;
 	  int extra_len=0;
+	  /* Where the 68k went after the recorded block */
+	  uintptr succ_pc_p=(uintptr)regs.pc_p;
 
 	  redo_current_block=0;
 	  if (current_compile_p>=MAX_COMPILE_PTR)
@@ -3386,15 +3965,28 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 	  bi->csi = NULL;
 #endif
 
+	  /* A trace only runs through conditional branches we can translate;
+	     otherwise it ends at the first one */
+	  for (i=0;i<blocklen-1;i++) {
+	    int op=cft_map(*pc_hist[i].location);
+	    if (end_block(op) && (optlev<=1 || !compfunctbl[op] || !nfcompfunctbl[op])) {
+		    succ_pc_p=(uintptr)pc_hist[i+1].location;
+		    blocklen=i+1;
+		    break;
+	    }
+	  }
+
 	  liveflags[blocklen]=0x1f; /* All flags needed afterwards */
 	  i=blocklen;
 	  while (i--) {
 	    uae_u16* currpcp=pc_hist[i].location;
 	    int op=cft_map(*currpcp);
+	    /* A branch inside a trace may leave it, so everything is live */
+	    uae_u8 after=(i<blocklen-1 && end_block(op)) ? 0x1f : liveflags[i+1];
 
 #if USE_CHECKSUM_INFO
 		trace_in_rom = trace_in_rom && isinrom((uintptr)currpcp);
-		if (follow_const_jumps && is_const_jump(op)) {
+		if ((follow_const_jumps && is_const_jump(op)) || (i<blocklen-1 && end_block(op))) {
 			checksum_info *csi = alloc_checksum_info();
 			csi->start_p = (uae_u8 *)min_pcp;
 			csi->length = max_pcp - min_pcp + LONGEST_68K_INST;
@@ -3410,10 +4002,10 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 		  max_pcp=(uintptr)currpcp;
 #endif
 
-		  liveflags[i]=((liveflags[i+1]&
+		  liveflags[i]=((after&
 		    (~prop[op].set_flags))|
 		    prop[op].use_flags);
-		  if (prop[op].is_addx && (liveflags[i+1]&FLAG_Z)==0)
+		  if (prop[op].is_addx && (after&FLAG_Z)==0)
 		    liveflags[i]&= ~FLAG_Z;
 	  }
 
@@ -3501,6 +4093,14 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 
 		    comptbl[opcode](opcode);
 		    freescratch();
+		    if (pc_hist[i].retlen)
+		      push_retstack((uintptr)pc_hist[i].location+pc_hist[i].retlen);
+		    if (i<blocklen-1 && end_block(opcode)) {
+		      if (next_pc_p)
+			      trace_side_exit(pc_hist[i+1].location,pc_hist[i].cycles);
+		      else
+			      trace_pc_guard(pc_hist[i+1].location,pc_hist[i].cycles);
+		    }
 		    if (!(liveflags[i+1] & FLAG_CZNV)) {
 			    /* We can forget about flags */
 			    dont_care_flags();
@@ -3518,7 +4118,7 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 			    was_comp=0;
 		    }
 		    compemu_raw_mov_l_ri(REG_PAR1,(uae_u32)opcode);
-		    compemu_raw_mov_l_ri(REG_PAR2,(uae_u32)&regs);
+		    compemu_raw_mov_l_ri(REG_PAR2,(uintptr)&regs);
 
 		    compemu_raw_mov_l_mi((uintptr)&regs.pc_p, (uintptr)pc_hist[i].location);
 		    compemu_raw_call((uintptr)cputbl[opcode]);
@@ -3526,6 +4126,11 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 			  // raw_cputbl_count[] is indexed with plain opcode (in m68k order)
 		    compemu_raw_add_l_mi((uintptr)&raw_cputbl_count[opcode],1);
 #endif
+		    if (i<blocklen-1 && end_block(opcode)) {
+			    /* Should not happen: leave the trace if the branch went the other way */
+			    compemu_raw_cmp_l_mi((uintptr)&regs.pc_p,(uintptr)pc_hist[i+1].location);
+			    compemu_raw_jnz((uintptr)popall_do_nothing);
+		    }
 
 		    if (i<blocklen-1) {
     			uae_s8* branchadd;
@@ -3604,7 +4209,7 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 		  /* predicted outcome */
 		  tbi=get_blockinfo_addr_new((void*)t1,1);
 		  match_states(tbi);
-		  compemu_raw_sub_l_mi((uae_u32)&countdown,scaled_cycles(totcycles));
+		  compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
 		  compemu_raw_jcc_l_oponly(NATIVE_CC_PL);
 		  tba=(uae_u32*)get_target();
       D(bug("  emit_jmp_target at 0x%08x to 0x%08x\n", get_target(), get_handler(t1)));
@@ -3624,7 +4229,7 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 		  match_states(tbi);
 
 		  //flush(1); /* Can only get here if was_comp==1 */
-		  compemu_raw_sub_l_mi((uae_u32)&countdown,scaled_cycles(totcycles));
+		  compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
 		  compemu_raw_jcc_l_oponly(NATIVE_CC_PL);
 		  tba=(uae_u32*)get_target();
       D(bug("  emit_jmp_target at 0x%08x to 0x%08x\n", get_target(), get_handler(t2)));
@@ -3643,10 +4248,14 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 		  if (was_comp && isinreg(PC_P)) {
 				int r2;
 		    r=live.state[PC_P].realreg;
+		    /* a return stack miss falls through to the successor seen last */
+		    if (table68k[do_get_mem_word(pc_hist[blocklen-1].location)].mnemo == i_RTS)
+		      pop_retstack(r,totcycles);
+		    predict_successor(bi,succ_pc_p,totcycles);
 		    compemu_raw_and_l_ri(r,TAGMASK);
 				r2 = (r==0) ? 1 : 0;
 		    compemu_raw_mov_l_ri(r2,(uintptr)popall_do_nothing);
-		    compemu_raw_sub_l_mi((uae_u32)&countdown,scaled_cycles(totcycles));
+		    compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
 		    compemu_raw_cmov_l_rm_indexed(r2,(uintptr)cache_tags,r,SIZEOF_VOID_P,NATIVE_CC_PL);
 		    compemu_raw_jmp_r(r2);
   		}
@@ -3658,7 +4267,7 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 		    tbi=get_blockinfo_addr_new((void*)v,1);
 		    match_states(tbi);
 
-		    compemu_raw_sub_l_mi((uae_u32)&countdown,scaled_cycles(totcycles));
+		    compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
 		    compemu_raw_jcc_l_oponly(NATIVE_CC_PL);
 		    tba=(uae_u32*)get_target();
         D(bug("  emit_jmp_target at 0x%08x to 0x%08x\n", get_target(), get_handler(v)));
@@ -3670,12 +4279,13 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
   		else {
 		    int r2;
 
+		    predict_successor(bi,succ_pc_p,totcycles);
 		    r=REG_PC_TMP;
 		    compemu_raw_mov_l_rm(r,(uintptr)&regs.pc_p);
 		    compemu_raw_and_l_ri(r,TAGMASK);
 			  r2 = (r==0) ? 1 : 0;
 		    compemu_raw_mov_l_ri(r2,(uintptr)popall_do_nothing);
-		    compemu_raw_sub_l_mi((uae_u32)&countdown,scaled_cycles(totcycles));
+		    compemu_raw_sub_l_mi((uintptr)&countdown,scaled_cycles(totcycles));
 		    compemu_raw_cmov_l_rm_indexed(r2,(uintptr)cache_tags,r,SIZEOF_VOID_P,NATIVE_CC_PL);
 		    compemu_raw_jmp_r(r2);
 		  }
@@ -3693,6 +4303,7 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 	else {
 		calc_checksum(bi,&(bi->c1),&(bi->c2));
 		add_to_active(bi);
+		protect_block_pages(bi);
 	}
 #else
 	if (next_pc_p+extra_len>=max_pcp &&
@@ -3713,6 +4324,7 @@ void compile_block(cpu_history* pc_hist, int blocklen, int totcycles)
 	else {
     calc_checksum(bi,&(bi->c1),&(bi->c2));
     add_to_active(bi);
+    protect_block_pages(bi);
 	}
 #endif
 
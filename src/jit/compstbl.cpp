@@ -5,6 +5,7 @@
 #include "memory.h"
 #include "newcpu.h"
 #include "custom.h"
+#include "events.h"
 #include "comptbl.h"
 #include "debug.h"
 extern const struct comptbl op_smalltbl_0_comp_ff[] = {
@@ -62,8 +63,6 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { op_170_0_comp_ff, 0x00000002, 368 }, /* BCHG */
 { op_178_0_comp_ff, 0x00000002, 376 }, /* BCHG */
 { op_179_0_comp_ff, 0x00000002, 377 }, /* BCHG */
-{ op_17a_0_comp_ff, 0x00000002, 378 }, /* BCHG */
-{ op_17b_0_comp_ff, 0x00000002, 379 }, /* BCHG */
 { op_180_0_comp_ff, 0x00000000, 384 }, /* BCLR */
 { NULL, 0x00000001, 392 }, /* MVPRM */
 { op_190_0_comp_ff, 0x00000000, 400 }, /* BCLR */
@@ -73,8 +72,6 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { op_1b0_0_comp_ff, 0x00000002, 432 }, /* BCLR */
 { op_1b8_0_comp_ff, 0x00000002, 440 }, /* BCLR */
 { op_1b9_0_comp_ff, 0x00000002, 441 }, /* BCLR */
-{ op_1ba_0_comp_ff, 0x00000002, 442 }, /* BCLR */
-{ op_1bb_0_comp_ff, 0x00000002, 443 }, /* BCLR */
 { op_1c0_0_comp_ff, 0x00000000, 448 }, /* BSET */
 { NULL, 0x00000001, 456 }, /* MVPRM */
 { op_1d0_0_comp_ff, 0x00000000, 464 }, /* BSET */
@@ -84,8 +81,6 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { op_1f0_0_comp_ff, 0x00000002, 496 }, /* BSET */
 { op_1f8_0_comp_ff, 0x00000002, 504 }, /* BSET */
 { op_1f9_0_comp_ff, 0x00000002, 505 }, /* BSET */
-{ op_1fa_0_comp_ff, 0x00000002, 506 }, /* BSET */
-{ op_1fb_0_comp_ff, 0x00000002, 507 }, /* BSET */
 { op_200_0_comp_ff, 0x00000002, 512 }, /* AND */
 { op_210_0_comp_ff, 0x00000002, 528 }, /* AND */
 { op_218_0_comp_ff, 0x00000002, 536 }, /* AND */
@@ -202,8 +197,6 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { op_870_0_comp_ff, 0x00000002, 2160 }, /* BCHG */
 { op_878_0_comp_ff, 0x00000002, 2168 }, /* BCHG */
 { op_879_0_comp_ff, 0x00000002, 2169 }, /* BCHG */
-{ op_87a_0_comp_ff, 0x00000002, 2170 }, /* BCHG */
-{ op_87b_0_comp_ff, 0x00000002, 2171 }, /* BCHG */
 { op_880_0_comp_ff, 0x00000002, 2176 }, /* BCLR */
 { op_890_0_comp_ff, 0x00000002, 2192 }, /* BCLR */
 { op_898_0_comp_ff, 0x00000002, 2200 }, /* BCLR */
@@ -212,8 +205,6 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { op_8b0_0_comp_ff, 0x00000002, 2224 }, /* BCLR */
 { op_8b8_0_comp_ff, 0x00000002, 2232 }, /* BCLR */
 { op_8b9_0_comp_ff, 0x00000002, 2233 }, /* BCLR */
-{ op_8ba_0_comp_ff, 0x00000002, 2234 }, /* BCLR */
-{ op_8bb_0_comp_ff, 0x00000002, 2235 }, /* BCLR */
 { op_8c0_0_comp_ff, 0x00000002, 2240 }, /* BSET */
 { op_8d0_0_comp_ff, 0x00000002, 2256 }, /* BSET */
 { op_8d8_0_comp_ff, 0x00000002, 2264 }, /* BSET */
@@ -222,8 +213,6 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { op_8f0_0_comp_ff, 0x00000002, 2288 }, /* BSET */
 { op_8f8_0_comp_ff, 0x00000002, 2296 }, /* BSET */
 { op_8f9_0_comp_ff, 0x00000002, 2297 }, /* BSET */
-{ op_8fa_0_comp_ff, 0x00000002, 2298 }, /* BSET */
-{ op_8fb_0_comp_ff, 0x00000002, 2299 }, /* BSET */
 { op_a00_0_comp_ff, 0x00000002, 2560 }, /* EOR */
 { op_a10_0_comp_ff, 0x00000002, 2576 }, /* EOR */
 { op_a18_0_comp_ff, 0x00000002, 2584 }, /* EOR */
@@ -1808,43 +1797,37 @@ extern const struct comptbl op_smalltbl_0_comp_ff[] = {
 { NULL, 0x00000000, 61424 }, /* BFINS */
 { NULL, 0x00000000, 61432 }, /* BFINS */
 { NULL, 0x00000000, 61433 }, /* BFINS */
-{ NULL, 0x00000001, 61440 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61448 }, /* MMUOP030 */
 { NULL, 0x00000001, 61456 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61464 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61472 }, /* MMUOP030 */
 { NULL, 0x00000001, 61480 }, /* MMUOP030 */
 { NULL, 0x00000001, 61488 }, /* MMUOP030 */
 { NULL, 0x00000001, 61496 }, /* MMUOP030 */
 { NULL, 0x00000001, 61497 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61498 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61499 }, /* MMUOP030 */
-{ NULL, 0x00000020, 61952 }, /* FPP */
-{ NULL, 0x00000020, 61960 }, /* FPP */
-{ NULL, 0x00000020, 61968 }, /* FPP */
-{ NULL, 0x00000020, 61976 }, /* FPP */
-{ NULL, 0x00000020, 61984 }, /* FPP */
-{ NULL, 0x00000020, 61992 }, /* FPP */
-{ NULL, 0x00000020, 62000 }, /* FPP */
-{ NULL, 0x00000020, 62008 }, /* FPP */
-{ NULL, 0x00000020, 62009 }, /* FPP */
-{ NULL, 0x00000020, 62010 }, /* FPP */
-{ NULL, 0x00000020, 62011 }, /* FPP */
-{ NULL, 0x00000020, 62012 }, /* FPP */
-{ NULL, 0x00000020, 62016 }, /* FScc */
+{ op_f200_0_comp_ff, 0x00000022, 61952 }, /* FPP */
+{ op_f208_0_comp_ff, 0x00000022, 61960 }, /* FPP */
+{ op_f210_0_comp_ff, 0x00000022, 61968 }, /* FPP */
+{ op_f218_0_comp_ff, 0x00000022, 61976 }, /* FPP */
+{ op_f220_0_comp_ff, 0x00000022, 61984 }, /* FPP */
+{ op_f228_0_comp_ff, 0x00000022, 61992 }, /* FPP */
+{ op_f230_0_comp_ff, 0x00000022, 62000 }, /* FPP */
+{ op_f238_0_comp_ff, 0x00000022, 62008 }, /* FPP */
+{ op_f239_0_comp_ff, 0x00000022, 62009 }, /* FPP */
+{ op_f23a_0_comp_ff, 0x00000022, 62010 }, /* FPP */
+{ op_f23b_0_comp_ff, 0x00000022, 62011 }, /* FPP */
+{ op_f23c_0_comp_ff, 0x00000022, 62012 }, /* FPP */
+{ op_f240_0_comp_ff, 0x00000026, 62016 }, /* FScc */
 { NULL, 0x00000021, 62024 }, /* FDBcc */
-{ NULL, 0x00000020, 62032 }, /* FScc */
-{ NULL, 0x00000020, 62040 }, /* FScc */
-{ NULL, 0x00000020, 62048 }, /* FScc */
-{ NULL, 0x00000020, 62056 }, /* FScc */
-{ NULL, 0x00000020, 62064 }, /* FScc */
-{ NULL, 0x00000020, 62072 }, /* FScc */
-{ NULL, 0x00000020, 62073 }, /* FScc */
+{ op_f250_0_comp_ff, 0x00000026, 62032 }, /* FScc */
+{ op_f258_0_comp_ff, 0x00000026, 62040 }, /* FScc */
+{ op_f260_0_comp_ff, 0x00000026, 62048 }, /* FScc */
+{ op_f268_0_comp_ff, 0x00000026, 62056 }, /* FScc */
+{ op_f270_0_comp_ff, 0x00000026, 62064 }, /* FScc */
+{ op_f278_0_comp_ff, 0x00000026, 62072 }, /* FScc */
+{ op_f279_0_comp_ff, 0x00000026, 62073 }, /* FScc */
 { NULL, 0x00000021, 62074 }, /* FTRAPcc */
 { NULL, 0x00000021, 62075 }, /* FTRAPcc */
 { NULL, 0x00000021, 62076 }, /* FTRAPcc */
-{ NULL, 0x00000021, 62080 }, /* FBcc */
-{ NULL, 0x00000021, 62144 }, /* FBcc */
+{ op_f280_0_comp_ff, 0x00000025, 62080 }, /* FBcc */
+{ op_f2c0_0_comp_ff, 0x00000025, 62144 }, /* FBcc */
 { NULL, 0x00000020, 62224 }, /* FSAVE */
 { NULL, 0x00000020, 62240 }, /* FSAVE */
 { NULL, 0x00000020, 62248 }, /* FSAVE */
@@ -1949,8 +1932,6 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { op_170_0_comp_nf, 0x00000002, 368 }, /* BCHG */
 { op_178_0_comp_nf, 0x00000002, 376 }, /* BCHG */
 { op_179_0_comp_nf, 0x00000002, 377 }, /* BCHG */
-{ op_17a_0_comp_nf, 0x00000002, 378 }, /* BCHG */
-{ op_17b_0_comp_nf, 0x00000002, 379 }, /* BCHG */
 { op_180_0_comp_nf, 0x00000000, 384 }, /* BCLR */
 { NULL, 0x00000001, 392 }, /* MVPRM */
 { op_190_0_comp_nf, 0x00000000, 400 }, /* BCLR */
@@ -1960,8 +1941,6 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { op_1b0_0_comp_nf, 0x00000002, 432 }, /* BCLR */
 { op_1b8_0_comp_nf, 0x00000002, 440 }, /* BCLR */
 { op_1b9_0_comp_nf, 0x00000002, 441 }, /* BCLR */
-{ op_1ba_0_comp_nf, 0x00000002, 442 }, /* BCLR */
-{ op_1bb_0_comp_nf, 0x00000002, 443 }, /* BCLR */
 { op_1c0_0_comp_nf, 0x00000000, 448 }, /* BSET */
 { NULL, 0x00000001, 456 }, /* MVPRM */
 { op_1d0_0_comp_nf, 0x00000000, 464 }, /* BSET */
@@ -1971,8 +1950,6 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { op_1f0_0_comp_nf, 0x00000002, 496 }, /* BSET */
 { op_1f8_0_comp_nf, 0x00000002, 504 }, /* BSET */
 { op_1f9_0_comp_nf, 0x00000002, 505 }, /* BSET */
-{ op_1fa_0_comp_nf, 0x00000002, 506 }, /* BSET */
-{ op_1fb_0_comp_nf, 0x00000002, 507 }, /* BSET */
 { op_200_0_comp_nf, 0x00000002, 512 }, /* AND */
 { op_210_0_comp_nf, 0x00000002, 528 }, /* AND */
 { op_218_0_comp_nf, 0x00000002, 536 }, /* AND */
@@ -2089,8 +2066,6 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { op_870_0_comp_nf, 0x00000002, 2160 }, /* BCHG */
 { op_878_0_comp_nf, 0x00000002, 2168 }, /* BCHG */
 { op_879_0_comp_nf, 0x00000002, 2169 }, /* BCHG */
-{ op_87a_0_comp_nf, 0x00000002, 2170 }, /* BCHG */
-{ op_87b_0_comp_nf, 0x00000002, 2171 }, /* BCHG */
 { op_880_0_comp_nf, 0x00000002, 2176 }, /* BCLR */
 { op_890_0_comp_nf, 0x00000002, 2192 }, /* BCLR */
 { op_898_0_comp_nf, 0x00000002, 2200 }, /* BCLR */
@@ -2099,8 +2074,6 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { op_8b0_0_comp_nf, 0x00000002, 2224 }, /* BCLR */
 { op_8b8_0_comp_nf, 0x00000002, 2232 }, /* BCLR */
 { op_8b9_0_comp_nf, 0x00000002, 2233 }, /* BCLR */
-{ op_8ba_0_comp_nf, 0x00000002, 2234 }, /* BCLR */
-{ op_8bb_0_comp_nf, 0x00000002, 2235 }, /* BCLR */
 { op_8c0_0_comp_nf, 0x00000002, 2240 }, /* BSET */
 { op_8d0_0_comp_nf, 0x00000002, 2256 }, /* BSET */
 { op_8d8_0_comp_nf, 0x00000002, 2264 }, /* BSET */
@@ -2109,8 +2082,6 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { op_8f0_0_comp_nf, 0x00000002, 2288 }, /* BSET */
 { op_8f8_0_comp_nf, 0x00000002, 2296 }, /* BSET */
 { op_8f9_0_comp_nf, 0x00000002, 2297 }, /* BSET */
-{ op_8fa_0_comp_nf, 0x00000002, 2298 }, /* BSET */
-{ op_8fb_0_comp_nf, 0x00000002, 2299 }, /* BSET */
 { op_a00_0_comp_nf, 0x00000002, 2560 }, /* EOR */
 { op_a10_0_comp_nf, 0x00000002, 2576 }, /* EOR */
 { op_a18_0_comp_nf, 0x00000002, 2584 }, /* EOR */
@@ -3695,43 +3666,37 @@ extern const struct comptbl op_smalltbl_0_comp_nf[] = {
 { NULL, 0x00000000, 61424 }, /* BFINS */
 { NULL, 0x00000000, 61432 }, /* BFINS */
 { NULL, 0x00000000, 61433 }, /* BFINS */
-{ NULL, 0x00000001, 61440 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61448 }, /* MMUOP030 */
 { NULL, 0x00000001, 61456 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61464 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61472 }, /* MMUOP030 */
 { NULL, 0x00000001, 61480 }, /* MMUOP030 */
 { NULL, 0x00000001, 61488 }, /* MMUOP030 */
 { NULL, 0x00000001, 61496 }, /* MMUOP030 */
 { NULL, 0x00000001, 61497 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61498 }, /* MMUOP030 */
-{ NULL, 0x00000001, 61499 }, /* MMUOP030 */
-{ NULL, 0x00000020, 61952 }, /* FPP */
-{ NULL, 0x00000020, 61960 }, /* FPP */
-{ NULL, 0x00000020, 61968 }, /* FPP */
-{ NULL, 0x00000020, 61976 }, /* FPP */
-{ NULL, 0x00000020, 61984 }, /* FPP */
-{ NULL, 0x00000020, 61992 }, /* FPP */
-{ NULL, 0x00000020, 62000 }, /* FPP */
-{ NULL, 0x00000020, 62008 }, /* FPP */
-{ NULL, 0x00000020, 62009 }, /* FPP */
-{ NULL, 0x00000020, 62010 }, /* FPP */
-{ NULL, 0x00000020, 62011 }, /* FPP */
-{ NULL, 0x00000020, 62012 }, /* FPP */
-{ NULL, 0x00000020, 62016 }, /* FScc */
+{ op_f200_0_comp_nf, 0x00000022, 61952 }, /* FPP */
+{ op_f208_0_comp_nf, 0x00000022, 61960 }, /* FPP */
+{ op_f210_0_comp_nf, 0x00000022, 61968 }, /* FPP */
+{ op_f218_0_comp_nf, 0x00000022, 61976 }, /* FPP */
+{ op_f220_0_comp_nf, 0x00000022, 61984 }, /* FPP */
+{ op_f228_0_comp_nf, 0x00000022, 61992 }, /* FPP */
+{ op_f230_0_comp_nf, 0x00000022, 62000 }, /* FPP */
+{ op_f238_0_comp_nf, 0x00000022, 62008 }, /* FPP */
+{ op_f239_0_comp_nf, 0x00000022, 62009 }, /* FPP */
+{ op_f23a_0_comp_nf, 0x00000022, 62010 }, /* FPP */
+{ op_f23b_0_comp_nf, 0x00000022, 62011 }, /* FPP */
+{ op_f23c_0_comp_nf, 0x00000022, 62012 }, /* FPP */
+{ op_f240_0_comp_nf, 0x00000026, 62016 }, /* FScc */
 { NULL, 0x00000021, 62024 }, /* FDBcc */
-{ NULL, 0x00000020, 62032 }, /* FScc */
-{ NULL, 0x00000020, 62040 }, /* FScc */
-{ NULL, 0x00000020, 62048 }, /* FScc */
-{ NULL, 0x00000020, 62056 }, /* FScc */
-{ NULL, 0x00000020, 62064 }, /* FScc */
-{ NULL, 0x00000020, 62072 }, /* FScc */
-{ NULL, 0x00000020, 62073 }, /* FScc */
+{ op_f250_0_comp_nf, 0x00000026, 62032 }, /* FScc */
+{ op_f258_0_comp_nf, 0x00000026, 62040 }, /* FScc */
+{ op_f260_0_comp_nf, 0x00000026, 62048 }, /* FScc */
+{ op_f268_0_comp_nf, 0x00000026, 62056 }, /* FScc */
+{ op_f270_0_comp_nf, 0x00000026, 62064 }, /* FScc */
+{ op_f278_0_comp_nf, 0x00000026, 62072 }, /* FScc */
+{ op_f279_0_comp_nf, 0x00000026, 62073 }, /* FScc */
 { NULL, 0x00000021, 62074 }, /* FTRAPcc */
 { NULL, 0x00000021, 62075 }, /* FTRAPcc */
 { NULL, 0x00000021, 62076 }, /* FTRAPcc */
-{ NULL, 0x00000021, 62080 }, /* FBcc */
-{ NULL, 0x00000021, 62144 }, /* FBcc */
+{ op_f280_0_comp_nf, 0x00000025, 62080 }, /* FBcc */
+{ op_f2c0_0_comp_nf, 0x00000025, 62144 }, /* FBcc */
 { NULL, 0x00000020, 62224 }, /* FSAVE */
 { NULL, 0x00000020, 62240 }, /* FSAVE */
 { NULL, 0x00000020, 62248 }, /* FSAVE */
@@ -41,8 +41,6 @@ extern compop_func op_168_0_comp_ff;
 extern compop_func op_170_0_comp_ff;
 extern compop_func op_178_0_comp_ff;
 extern compop_func op_179_0_comp_ff;
-extern compop_func op_17a_0_comp_ff;
-extern compop_func op_17b_0_comp_ff;
 extern compop_func op_180_0_comp_ff;
 extern compop_func op_190_0_comp_ff;
 extern compop_func op_198_0_comp_ff;
@@ -51,8 +49,6 @@ extern compop_func op_1a8_0_comp_ff;
 extern compop_func op_1b0_0_comp_ff;
 extern compop_func op_1b8_0_comp_ff;
 extern compop_func op_1b9_0_comp_ff;
-extern compop_func op_1ba_0_comp_ff;
-extern compop_func op_1bb_0_comp_ff;
 extern compop_func op_1c0_0_comp_ff;
 extern compop_func op_1d0_0_comp_ff;
 extern compop_func op_1d8_0_comp_ff;
@@ -61,8 +57,6 @@ extern compop_func op_1e8_0_comp_ff;
 extern compop_func op_1f0_0_comp_ff;
 extern compop_func op_1f8_0_comp_ff;
 extern compop_func op_1f9_0_comp_ff;
-extern compop_func op_1fa_0_comp_ff;
-extern compop_func op_1fb_0_comp_ff;
 extern compop_func op_200_0_comp_ff;
 extern compop_func op_210_0_comp_ff;
 extern compop_func op_218_0_comp_ff;
@@ -154,8 +148,6 @@ extern compop_func op_868_0_comp_ff;
 extern compop_func op_870_0_comp_ff;
 extern compop_func op_878_0_comp_ff;
 extern compop_func op_879_0_comp_ff;
-extern compop_func op_87a_0_comp_ff;
-extern compop_func op_87b_0_comp_ff;
 extern compop_func op_880_0_comp_ff;
 extern compop_func op_890_0_comp_ff;
 extern compop_func op_898_0_comp_ff;
@@ -164,8 +156,6 @@ extern compop_func op_8a8_0_comp_ff;
 extern compop_func op_8b0_0_comp_ff;
 extern compop_func op_8b8_0_comp_ff;
 extern compop_func op_8b9_0_comp_ff;
-extern compop_func op_8ba_0_comp_ff;
-extern compop_func op_8bb_0_comp_ff;
 extern compop_func op_8c0_0_comp_ff;
 extern compop_func op_8d0_0_comp_ff;
 extern compop_func op_8d8_0_comp_ff;
@@ -174,8 +164,6 @@ extern compop_func op_8e8_0_comp_ff;
 extern compop_func op_8f0_0_comp_ff;
 extern compop_func op_8f8_0_comp_ff;
 extern compop_func op_8f9_0_comp_ff;
-extern compop_func op_8fa_0_comp_ff;
-extern compop_func op_8fb_0_comp_ff;
 extern compop_func op_a00_0_comp_ff;
 extern compop_func op_a10_0_comp_ff;
 extern compop_func op_a18_0_comp_ff;
@@ -1378,6 +1366,28 @@ extern compop_func op_e198_0_comp_ff;
 extern compop_func op_e1a0_0_comp_ff;
 extern compop_func op_e1a8_0_comp_ff;
 extern compop_func op_e1b8_0_comp_ff;
+extern compop_func op_f200_0_comp_ff;
+extern compop_func op_f208_0_comp_ff;
+extern compop_func op_f210_0_comp_ff;
+extern compop_func op_f218_0_comp_ff;
+extern compop_func op_f220_0_comp_ff;
+extern compop_func op_f228_0_comp_ff;
+extern compop_func op_f230_0_comp_ff;
+extern compop_func op_f238_0_comp_ff;
+extern compop_func op_f239_0_comp_ff;
+extern compop_func op_f23a_0_comp_ff;
+extern compop_func op_f23b_0_comp_ff;
+extern compop_func op_f23c_0_comp_ff;
+extern compop_func op_f240_0_comp_ff;
+extern compop_func op_f250_0_comp_ff;
+extern compop_func op_f258_0_comp_ff;
+extern compop_func op_f260_0_comp_ff;
+extern compop_func op_f268_0_comp_ff;
+extern compop_func op_f270_0_comp_ff;
+extern compop_func op_f278_0_comp_ff;
+extern compop_func op_f279_0_comp_ff;
+extern compop_func op_f280_0_comp_ff;
+extern compop_func op_f2c0_0_comp_ff;
 extern compop_func op_f600_0_comp_ff;
 extern compop_func op_f608_0_comp_ff;
 extern compop_func op_f610_0_comp_ff;
@@ -1426,8 +1436,6 @@ extern compop_func op_168_0_comp_nf;
 extern compop_func op_170_0_comp_nf;
 extern compop_func op_178_0_comp_nf;
 extern compop_func op_179_0_comp_nf;
-extern compop_func op_17a_0_comp_nf;
-extern compop_func op_17b_0_comp_nf;
 extern compop_func op_180_0_comp_nf;
 extern compop_func op_190_0_comp_nf;
 extern compop_func op_198_0_comp_nf;
@@ -1436,8 +1444,6 @@ extern compop_func op_1a8_0_comp_nf;
 extern compop_func op_1b0_0_comp_nf;
 extern compop_func op_1b8_0_comp_nf;
 extern compop_func op_1b9_0_comp_nf;
-extern compop_func op_1ba_0_comp_nf;
-extern compop_func op_1bb_0_comp_nf;
 extern compop_func op_1c0_0_comp_nf;
 extern compop_func op_1d0_0_comp_nf;
 extern compop_func op_1d8_0_comp_nf;
@@ -1446,8 +1452,6 @@ extern compop_func op_1e8_0_comp_nf;
 extern compop_func op_1f0_0_comp_nf;
 extern compop_func op_1f8_0_comp_nf;
 extern compop_func op_1f9_0_comp_nf;
-extern compop_func op_1fa_0_comp_nf;
-extern compop_func op_1fb_0_comp_nf;
 extern compop_func op_200_0_comp_nf;
 extern compop_func op_210_0_comp_nf;
 extern compop_func op_218_0_comp_nf;
@@ -1539,8 +1543,6 @@ extern compop_func op_868_0_comp_nf;
 extern compop_func op_870_0_comp_nf;
 extern compop_func op_878_0_comp_nf;
 extern compop_func op_879_0_comp_nf;
-extern compop_func op_87a_0_comp_nf;
-extern compop_func op_87b_0_comp_nf;
 extern compop_func op_880_0_comp_nf;
 extern compop_func op_890_0_comp_nf;
 extern compop_func op_898_0_comp_nf;
@@ -1549,8 +1551,6 @@ extern compop_func op_8a8_0_comp_nf;
 extern compop_func op_8b0_0_comp_nf;
 extern compop_func op_8b8_0_comp_nf;
 extern compop_func op_8b9_0_comp_nf;
-extern compop_func op_8ba_0_comp_nf;
-extern compop_func op_8bb_0_comp_nf;
 extern compop_func op_8c0_0_comp_nf;
 extern compop_func op_8d0_0_comp_nf;
 extern compop_func op_8d8_0_comp_nf;
@@ -1559,8 +1559,6 @@ extern compop_func op_8e8_0_comp_nf;
 extern compop_func op_8f0_0_comp_nf;
 extern compop_func op_8f8_0_comp_nf;
 extern compop_func op_8f9_0_comp_nf;
-extern compop_func op_8fa_0_comp_nf;
-extern compop_func op_8fb_0_comp_nf;
 extern compop_func op_a00_0_comp_nf;
 extern compop_func op_a10_0_comp_nf;
 extern compop_func op_a18_0_comp_nf;
@@ -2774,6 +2772,28 @@ extern compop_func op_e198_0_comp_nf;
 extern compop_func op_e1a0_0_comp_nf;
 extern compop_func op_e1a8_0_comp_nf;
 extern compop_func op_e1b8_0_comp_nf;
+extern compop_func op_f200_0_comp_nf;
+extern compop_func op_f208_0_comp_nf;
+extern compop_func op_f210_0_comp_nf;
+extern compop_func op_f218_0_comp_nf;
+extern compop_func op_f220_0_comp_nf;
+extern compop_func op_f228_0_comp_nf;
+extern compop_func op_f230_0_comp_nf;
+extern compop_func op_f238_0_comp_nf;
+extern compop_func op_f239_0_comp_nf;
+extern compop_func op_f23a_0_comp_nf;
+extern compop_func op_f23b_0_comp_nf;
+extern compop_func op_f23c_0_comp_nf;
+extern compop_func op_f240_0_comp_nf;
+extern compop_func op_f250_0_comp_nf;
+extern compop_func op_f258_0_comp_nf;
+extern compop_func op_f260_0_comp_nf;
+extern compop_func op_f268_0_comp_nf;
+extern compop_func op_f270_0_comp_nf;
+extern compop_func op_f278_0_comp_nf;
+extern compop_func op_f279_0_comp_nf;
+extern compop_func op_f280_0_comp_nf;
+extern compop_func op_f2c0_0_comp_nf;
 extern compop_func op_f600_0_comp_nf;
 extern compop_func op_f608_0_comp_nf;
 extern compop_func op_f610_0_comp_nf;
@@ -37,6 +37,7 @@
 #include "sysconfig.h"
 #include "sysdeps.h"
 #include <ctype.h>
+#include <SDL.h>
 
 #include "readcpu.h"
 
@@ -68,16 +69,16 @@ static char endstr[1000];
 static char lines[100000];
 static int comp_index=0;
 
-#include "flags_arm.h"
-
-static int cond_codes[]={-1,-1,
-		NATIVE_CC_HI,NATIVE_CC_LS,
-		NATIVE_CC_CC,NATIVE_CC_CS,
-		NATIVE_CC_NE,NATIVE_CC_EQ,
-		-1,-1,
-		NATIVE_CC_PL,NATIVE_CC_MI,
-		NATIVE_CC_GE,NATIVE_CC_LT,
-		NATIVE_CC_GT,NATIVE_CC_LE
+/* The native conditions are written by name, so the generated code
+   builds against the flags header of whichever backend includes it */
+static const char *cond_codes[]={NULL,NULL,
+		"NATIVE_CC_HI","NATIVE_CC_LS",
+		"NATIVE_CC_CC","NATIVE_CC_CS",
+		"NATIVE_CC_NE","NATIVE_CC_EQ",
+		NULL,NULL,
+		"NATIVE_CC_PL","NATIVE_CC_MI",
+		"NATIVE_CC_GE","NATIVE_CC_LT",
+		"NATIVE_CC_GT","NATIVE_CC_LE"
 		};
 
 static void comprintf(const char* format, ...)
@@ -1178,8 +1179,8 @@ genflags (flagtypes type, wordsizes size, char *value, char *src, char *dst)
 		      "\tmov_l_ri(zero,0);\n"
 		      "\tmov_l_ri(one,-1);\n"
 		      "\tmake_flags_live();\n"
-		      "\tcmov_l_rr(zero,one,%d);\n"
-		      "\t}\n",NATIVE_CC_NE);
+		      "\tcmov_l_rr(zero,one,NATIVE_CC_NE);\n"
+		      "\t}\n");
 	    comprintf("\trestore_carry();\n"); /* Reload the X flag into C */
 	    switch (size)
 	    {
@@ -1198,10 +1199,10 @@ genflags (flagtypes type, wordsizes size, char *value, char *src, char *dst)
 	    }
 	    comprintf("\tlive_flags();\n");
 	    comprintf("\tif (needed_flags&FLAG_Z) {\n"
-		      "\tcmov_l_rr(zero,one,%d);\n"
+		      "\tcmov_l_rr(zero,one,NATIVE_CC_NE);\n"
 		      "\tset_zero(zero, one);\n" /* No longer need one */
 		      "\tlive_flags();\n"
-		      "\t}\n",NATIVE_CC_NE);
+		      "\t}\n");
 	    comprintf("\tend_needflags();\n");
 	    duplicate_carry();
 	    comprintf("if (!(needed_flags & FLAG_CZNV)) dont_care_flags();\n");
@@ -1664,7 +1665,7 @@ gen_opcode (unsigned long int opcode)
 	comprintf("\tarm_ADD_l_ri(src,m68k_pc_offset_thisinst+2);\n");
 	comprintf("\tm68k_pc_offset=0;\n");
 	comprintf("\tarm_ADD_l(PC_P,src);\n");
-	comprintf("\tcomp_pc_p=(uae_u8*)get_const(PC_P);\n");
+	comprintf("\tcomp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);\n");
 	break;
      case i_Bcc:
 	comprintf("\tuae_u32 v1,v2;\n");
@@ -1688,7 +1689,7 @@ gen_opcode (unsigned long int opcode)
 	if (curi->cc>=2) {
 	    comprintf("\tv1=get_const(PC_P);\n"
 		      "\tv2=get_const(src);\n"
-		      "\tregister_branch(v1,v2,%d);\n",
+		      "\tregister_branch(v1,v2,%s);\n",
 		      cond_codes[curi->cc]);
 	    comprintf("\tmake_flags_live();\n"); /* Load the flags */
 	    isjump;
@@ -1700,7 +1701,7 @@ gen_opcode (unsigned long int opcode)
 	switch(curi->cc) {
 	 case 0:  /* Unconditional jump */
 	    comprintf("\tmov_l_rr(PC_P,src);\n");
-	    comprintf("\tcomp_pc_p=(uae_u8*)get_const(PC_P);\n");
+	    comprintf("\tcomp_pc_p=(uae_u8*)(uintptr)get_const(PC_P);\n");
 	    break;
 	 case 1: break; /* This is silly! */
 	 case 8: failure; break;  /* Work out details! FIXME */
@@ -1784,7 +1785,7 @@ gen_opcode (unsigned long int opcode)
 	    comprintf("\tuae_u32 v2;\n"
 		      "\tuae_u32 v1=get_const(PC_P);\n");
 	    comprintf("\tv2=get_const(offs);\n"
-		      "\tregister_branch(v1,v2,%d);\n", NATIVE_CC_CC);
+		      "\tregister_branch(v1,v2,NATIVE_CC_CC);\n");
 	    break;
 
 	 case 8: failure; break;  /* Work out details! FIXME */
@@ -1805,9 +1806,9 @@ gen_opcode (unsigned long int opcode)
 	    comprintf("\tmov_l_rr(nsrc,src);\n");
 	    comprintf("\tlea_l_brr(scratchie,src,(uae_s32)-1);\n"
 		      "\tmov_w_rr(src,scratchie);\n");
-	    comprintf("\tcmov_l_rr(offs,PC_P,%d);\n",
+	    comprintf("\tcmov_l_rr(offs,PC_P,%s);\n",
 		      cond_codes[curi->cc]);
-	    comprintf("\tcmov_l_rr(src,nsrc,%d);\n",
+	    comprintf("\tcmov_l_rr(src,nsrc,%s);\n",
 		      cond_codes[curi->cc]);
 	    /* OK, now for cc=true, we have src==nsrc and offs==PC_P,
 	       so whether we move them around doesn't matter. However,
@@ -1816,7 +1817,7 @@ gen_opcode (unsigned long int opcode)
 	    comprintf("\t start_needflags();\n");
 	    comprintf("\ttest_w_rr(nsrc,nsrc);\n");
 	    comprintf("\t end_needflags();\n");
-	    comprintf("\tcmov_l_rr(PC_P,offs,%d);\n", NATIVE_CC_NE);
+	    comprintf("\tcmov_l_rr(PC_P,offs,NATIVE_CC_NE);\n");
 	    break;
 	 default: abort();
 	}
@@ -1855,8 +1856,8 @@ gen_opcode (unsigned long int opcode)
 	 case 15:
 	    comprintf("\tmake_flags_live();\n"); /* Load the flags */
 	    /* All condition codes can be inverted by changing the LSB */
-	    comprintf("\tsetcc(val,%d);\n",
-		      cond_codes[curi->cc]^1); break;
+	    comprintf("\tsetcc(val,%s);\n",
+		      cond_codes[curi->cc^1]); break;
 	 default: abort();
 	}
 	comprintf("\tsub_b_ri(val,1);\n");
@@ -1929,7 +1930,7 @@ gen_opcode (unsigned long int opcode)
 		comprintf("\tmov_l_rr(tmpcnt,cnt);\n"
 			  "\tand_l_ri(tmpcnt,63);\n"
 			  "\tmov_l_ri(cdata,0);\n"
-			  "\tcmov_l_rr(cdata,data,%d);\n", NATIVE_CC_NE);
+			  "\tcmov_l_rr(cdata,data,NATIVE_CC_NE);\n");
 		/* cdata is now either data (for shift count!=0) or
 		   0 (for shift count==0) */
 		switch(curi->size) {
@@ -1950,7 +1951,7 @@ gen_opcode (unsigned long int opcode)
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(highshift,0);\n"
 			  "mov_l_ri(scratchie,width/2);\n"
-			  "cmov_l_rr(highshift,scratchie,%d);\n", NATIVE_CC_NE);
+			  "cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);\n");
 		/* The x86 masks out bits, so we now make sure that things
 		   really get shifted as much as planned */
 		switch(curi->size) {
@@ -1979,7 +1980,7 @@ gen_opcode (unsigned long int opcode)
 		/* If the shift count was higher than the width, we need
 		   to pick up the sign from data */
 		comprintf("test_l_ri(tmpcnt,highmask);\n"
-			  "cmov_l_rr(cdata,data,%d);\n", NATIVE_CC_NE);
+			  "cmov_l_rr(cdata,data,NATIVE_CC_NE);\n");
 		/* And create the flags */
 		comprintf("\tstart_needflags();\n");
 		comprintf("\tif (needed_flags & FLAG_ZNV)\n");
@@ -2019,7 +2020,7 @@ gen_opcode (unsigned long int opcode)
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(highshift,0);\n"
 			  "mov_l_ri(scratchie,width/2);\n"
-			  "cmov_l_rr(highshift,scratchie,%d);\n",NATIVE_CC_NE);
+			  "cmov_l_rr(highshift,scratchie,NATIVE_CC_NE);\n");
 		/* The x86 masks out bits, so we now make sure that things
 		   really get shifted as much as planned */
 		switch(curi->size) {
@@ -2102,7 +2103,7 @@ gen_opcode (unsigned long int opcode)
 		comprintf("\tmov_l_rr(tmpcnt,cnt);\n"
 			  "\tand_l_ri(tmpcnt,63);\n"
 			  "\tmov_l_ri(cdata,0);\n"
-			  "\tcmov_l_rr(cdata,data,%d);\n",NATIVE_CC_NE);
+			  "\tcmov_l_rr(cdata,data,NATIVE_CC_NE);\n");
 		/* cdata is now either data (for shift count!=0) or
 		   0 (for shift count==0) */
 		switch(curi->size) {
@@ -2119,7 +2120,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(scratchie,data,%d);\n",NATIVE_CC_EQ);
+			  "cmov_l_rr(scratchie,data,NATIVE_CC_EQ);\n");
 		switch(curi->size) {
 		 case sz_byte: comprintf("\tmov_b_rr(data,scratchie);\n");break;
 		 case sz_word: comprintf("\tmov_w_rr(data,scratchie);\n");break;
@@ -2137,7 +2138,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(tmpcnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(cdata,scratchie,%d);\n",NATIVE_CC_NE);
+			  "cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);\n");
 		/* And create the flags */
 		comprintf("\tstart_needflags();\n");
 
@@ -2174,7 +2175,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(scratchie,data,%d);\n",NATIVE_CC_EQ);
+			  "cmov_l_rr(scratchie,data,NATIVE_CC_EQ);\n");
 		switch(curi->size) {
 		 case sz_byte: comprintf("\tmov_b_rr(data,scratchie);\n");break;
 		 case sz_word: comprintf("\tmov_w_rr(data,scratchie);\n");break;
@@ -2240,7 +2241,7 @@ gen_opcode (unsigned long int opcode)
 		comprintf("\tmov_l_rr(tmpcnt,cnt);\n"
 			  "\tand_l_ri(tmpcnt,63);\n"
 			  "\tmov_l_ri(cdata,0);\n"
-			  "\tcmov_l_rr(cdata,data,%d);\n",NATIVE_CC_NE);
+			  "\tcmov_l_rr(cdata,data,NATIVE_CC_NE);\n");
 		/* cdata is now either data (for shift count!=0) or
 		   0 (for shift count==0) */
 		switch(curi->size) {
@@ -2257,7 +2258,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(scratchie,data,%d);\n",NATIVE_CC_EQ);
+			  "cmov_l_rr(scratchie,data,NATIVE_CC_EQ);\n");
 		switch(curi->size) {
 		 case sz_byte: comprintf("\tmov_b_rr(data,scratchie);\n");break;
 		 case sz_word: comprintf("\tmov_w_rr(data,scratchie);\n");break;
@@ -2275,7 +2276,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(tmpcnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(cdata,scratchie,%d);\n",NATIVE_CC_NE);
+			  "cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);\n");
 		/* And create the flags */
 		comprintf("\tstart_needflags();\n");
 		comprintf("\tif (needed_flags & FLAG_ZNV)\n");
@@ -2309,7 +2310,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(scratchie,data,%d);\n",NATIVE_CC_EQ);
+			  "cmov_l_rr(scratchie,data,NATIVE_CC_EQ);\n");
 		switch(curi->size) {
 		 case sz_byte: comprintf("\tmov_b_rr(data,scratchie);\n");break;
 		 case sz_word: comprintf("\tmov_w_rr(data,scratchie);\n");break;
@@ -2375,7 +2376,7 @@ gen_opcode (unsigned long int opcode)
 		comprintf("\tmov_l_rr(tmpcnt,cnt);\n"
 			  "\tand_l_ri(tmpcnt,63);\n"
 			  "\tmov_l_ri(cdata,0);\n"
-			  "\tcmov_l_rr(cdata,data,%d);\n",NATIVE_CC_NE);
+			  "\tcmov_l_rr(cdata,data,NATIVE_CC_NE);\n");
 		/* cdata is now either data (for shift count!=0) or
 		   0 (for shift count==0) */
 		switch(curi->size) {
@@ -2392,7 +2393,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(scratchie,data,%d);\n",NATIVE_CC_EQ);
+			  "cmov_l_rr(scratchie,data,NATIVE_CC_EQ);\n");
 		switch(curi->size) {
 		 case sz_byte: comprintf("\tmov_b_rr(data,scratchie);\n");break;
 		 case sz_word: comprintf("\tmov_w_rr(data,scratchie);\n");break;
@@ -2410,7 +2411,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(tmpcnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(cdata,scratchie,%d);\n",NATIVE_CC_NE);
+			  "cmov_l_rr(cdata,scratchie,NATIVE_CC_NE);\n");
 		/* And create the flags */
 		comprintf("\tstart_needflags();\n");
 		comprintf("\tif (needed_flags & FLAG_ZNV)\n");
@@ -2446,7 +2447,7 @@ gen_opcode (unsigned long int opcode)
 		}
 		comprintf("test_l_ri(cnt,highmask);\n"
 			  "mov_l_ri(scratchie,0);\n"
-			  "cmov_l_rr(scratchie,data,%d);\n",NATIVE_CC_EQ);
+			  "cmov_l_rr(scratchie,data,NATIVE_CC_EQ);\n");
 		switch(curi->size) {
 		 case sz_byte: comprintf("\tmov_b_rr(data,scratchie);\n");break;
 		 case sz_word: comprintf("\tmov_w_rr(data,scratchie);\n");break;
@@ -2784,9 +2785,9 @@ generate_includes (FILE * f)
     fprintf (f, "#include \"sysdeps.h\"\n");
     fprintf (f, "#include \"options.h\"\n");
     fprintf (f, "#include \"memory.h\"\n");
+    fprintf (f, "#include \"newcpu.h\"\n");
     fprintf (f, "#include \"custom.h\"\n");
     fprintf (f, "#include \"events.h\"\n");
-    fprintf (f, "#include \"newcpu.h\"\n");
     fprintf (f, "#include \"comptbl.h\"\n");
     fprintf (f, "#include \"debug.h\"\n");
 }
@@ -0,0 +1,498 @@
+/*
+ * jit/tests/blocks.cpp - JIT block tests
+ *
+ * Runs short 68020 programs once through the interpreter and then through
+ * the JIT, and compares the registers, the condition codes and the memory
+ * they leave behind. Each program ends in STOP #$2700, which also ends the
+ * run. The JIT run is repeated, so the last one goes through the blocks
+ * compiled during the first.
+ *
+ * newcpu.cpp is included rather than linked: m68k_run_2 and m68k_run_jit
+ * are static there. The rest of the emulator is replaced by the stubs
+ * below and a flat 16 MB of RAM at natmem_offset, with one I/O bank at
+ * $DF0000 that only the bank handlers can reach.
+ *
+ * Build with "make jit-test" (x86-64 or AArch64 host, or AArch64 under
+ * qemu-user, see the Makefile).
+ */
+
+#include "../../newcpu.cpp"
+#include <sys/mman.h>
+
+struct uae_prefs currprefs, changed_prefs;
+int quit_program, savestate_state;
+TCHAR savestate_fname[MAX_DPATH];
+bool cloanto_rom, uae_boot_rom;
+uaecptr rtarea_base;
+unsigned long int hsync_counter;
+uae_u16 dmacon;
+volatile int bsd_int_requested;
+volatile int uae_int_requested;
+struct ev eventtab[ev_max];
+addrbank *mem_banks[MEMORY_BANKS];
+uae_u8 *mem_banks_ram[MEMORY_BANKS];
+do_cycles_func do_cycles;
+int64_t g_uae_epoch;
+uae_u8 *natmem_offset;
+uae_u32 natmem_size;
+uae_u8 *kickmemory;
+int special_mem;
+
+#define RAM_SIZE	0x1000000
+#define CODE_BASE	0x00100000	/* one 4K page per test, never rewritten */
+#define DATA_BASE	0x00010000
+#define DATA_SIZE	0x400
+#define STACK_TOP	0x00020000
+#define IO_BANK		0xdf
+
+void do_cycles_cpu_norm (unsigned long c)
+{
+  currcycle += c;
+  nextevent = currcycle + 1000 * CYCLE_UNIT;
+  if (regs.spcflags & SPCFLAG_STOP)
+    set_special (regs, SPCFLAG_BRK);
+}
+void do_cycles_cpu_fastest (unsigned long c) { do_cycles_cpu_norm (c); }
+int intlev (void) { return -1; }
+void INTREQ_f (uae_u16 v) {}
+
+/* I/O bank: a 256 byte register file behind the bank handlers */
+static uae_u8 io_regs[256];
+static uae_u32 REGPARAM2 io_bget (uaecptr a) { special_mem |= S_READ; return io_regs[a & 0xff]; }
+static uae_u32 REGPARAM2 io_wget (uaecptr a) { return (io_bget (a) << 8) | io_bget (a + 1); }
+static uae_u32 REGPARAM2 io_lget (uaecptr a) { return (io_wget (a) << 16) | io_wget (a + 2); }
+static void REGPARAM2 io_bput (uaecptr a, uae_u32 v) { special_mem |= S_WRITE; io_regs[a & 0xff] = v; }
+static void REGPARAM2 io_wput (uaecptr a, uae_u32 v) { io_bput (a, v >> 8); io_bput (a + 1, v); }
+static void REGPARAM2 io_lput (uaecptr a, uae_u32 v) { io_wput (a, v >> 16); io_wput (a + 2, v); }
+static uae_u8 *REGPARAM2 io_xlate (uaecptr a) { return io_regs + (a & 0xff); }
+static int REGPARAM2 io_check (uaecptr a, uae_u32 s) { return 0; }
+static addrbank io_bank = { io_lget, io_wget, io_bget, io_lput, io_wput, io_bput, io_xlate, io_check, NULL, _T("io"), io_lget, io_wget, ABFLAG_IO };
+
+static uae_u8 *ram_base (uaecptr a) { return natmem_offset + (a & (RAM_SIZE - 1)); }
+static uae_u32 REGPARAM2 ram_lget (uaecptr a) { return do_get_mem_long ((uae_u32 *)ram_base (a)); }
+static uae_u32 REGPARAM2 ram_wget (uaecptr a) { return do_get_mem_word ((uae_u16 *)ram_base (a)); }
+static uae_u32 REGPARAM2 ram_bget (uaecptr a) { return *ram_base (a); }
+static void REGPARAM2 ram_lput (uaecptr a, uae_u32 v) { do_put_mem_long ((uae_u32 *)ram_base (a), v); }
+static void REGPARAM2 ram_wput (uaecptr a, uae_u32 v) { do_put_mem_word ((uae_u16 *)ram_base (a), v); }
+static void REGPARAM2 ram_bput (uaecptr a, uae_u32 v) { *ram_base (a) = v; }
+static uae_u8 *REGPARAM2 ram_xlate (uaecptr a) { return ram_base (a); }
+static int REGPARAM2 ram_check (uaecptr a, uae_u32 s) { return 1; }
+static addrbank ram_bank = { ram_lget, ram_wget, ram_bget, ram_lput, ram_wput, ram_bput, ram_xlate, ram_check, NULL, _T("ram"), ram_lget, ram_wget, ABFLAG_RAM };
+
+static void map_memory (void)
+{
+  for (int i = 0; i < MEMORY_BANKS; i++) {
+    mem_banks[i] = &io_bank;
+    mem_banks_ram[i] = NULL;
+  }
+  for (int i = 0; i < (RAM_SIZE >> 16); i++) {
+    if (i == IO_BANK)
+      continue;
+    mem_banks[i] = &ram_bank;
+    mem_banks_ram[i] = natmem_offset + (i << 16);
+  }
+}
+
+/* stubs for what newcpu.cpp pulls in */
+void fixup_prefs (struct uae_prefs *) {}
+void fixup_cpu (struct uae_prefs *) {}
+void map_overlay (int) {}
+void notify_user (int) {}
+void uae_restart (int, TCHAR *) {}
+void custom_reset (int) {}
+void reinit_amiga (void) {}
+void restore_state (const TCHAR *) {}
+void save_u16_func (uae_u8 **, uae_u16) {}
+void save_u32_func (uae_u8 **, uae_u32) {}
+void save_u64_func (uae_u8 **, uae_u64) {}
+uae_u16 restore_u16_func (uae_u8 **) { return 0; }
+uae_u32 restore_u32_func (uae_u8 **) { return 0; }
+uae_u64 restore_u64_func (uae_u8 **) { return 0; }
+void update_copper (int) {}
+void custom_prepare (void) {}
+void events_schedule (void) {}
+bool savestate_check (void) { return false; }
+void m68k_handle_trap (unsigned int) {}
+void memory_hardreset (void) {}
+void reset_frame_rate_hack (void) {}
+void savestate_runahead_step (void) {}
+void bsdsock_fake_int_handler (void) {}
+void savestate_restore_finish (void) {}
+void check_prefs_changed_audio (void) {}
+int blitnasty (void) { return 0; }
+void fpu_reset (void) {}
+void uae_reset (int) {}
+void fpuop_arithmetic (uae_u32, struct regstruct &, uae_u16) { op_illg (0xf200, regs); }
+void fpuop_dbcc (uae_u32, struct regstruct &, uae_u16) { op_illg (0xf200, regs); }
+void fpuop_scc (uae_u32, struct regstruct &, uae_u16) { op_illg (0xf200, regs); }
+void fpuop_trapcc (uae_u32, struct regstruct &, uaecptr, uae_u16) { op_illg (0xf200, regs); }
+void fpuop_bcc (uae_u32, struct regstruct &, uaecptr, uae_u32) { op_illg (0xf200, regs); }
+void fpuop_save (uae_u32, struct regstruct &) { op_illg (0xf200, regs); }
+void fpuop_restore (uae_u32, struct regstruct &) { op_illg (0xf200, regs); }
+void SDL_Quit (void) {}
+void jit_abort (const TCHAR *format, ...)
+{
+  va_list parms;
+  va_start (parms, format);
+  vfprintf (stderr, format, parms);
+  va_end (parms);
+  abort ();
+}
+
+/* The programs. All of them end in STOP #$2700. */
+#define STOP	0x4e72, 0x2700
+
+struct block_test {
+  const char *name;
+  uae_u16 code[64];
+};
+
+static const struct block_test tests[] = {
+  { "add/sub/cmp flags", {
+    0x203c, 0x7fff, 0xffff,	/* move.l #$7fffffff,d0 */
+    0x7201,			/* moveq #1,d1 */
+    0xd081,			/* add.l d1,d0 */
+    0x57c2,			/* seq d2 */
+    0x59c3,			/* svs d3 */
+    0x9280,			/* sub.l d0,d1 */
+    0x55c4,			/* scs d4 */
+    0xb081,			/* cmp.l d1,d0 */
+    0x5ec5,			/* sgt d5 */
+    0xd041,			/* add.w d1,d0 */
+    0xd001,			/* add.b d1,d0 */
+    0x5bc6,			/* smi d6 */
+    STOP } },
+  { "logic", {
+    0x203c, 0x1234, 0x5678,	/* move.l #$12345678,d0 */
+    0x223c, 0x0f0f, 0xf0f0,	/* move.l #$0f0ff0f0,d1 */
+    0x2400,			/* move.l d0,d2 */
+    0xc481,			/* and.l d1,d2 */
+    0x2600,			/* move.l d0,d3 */
+    0x8681,			/* or.l d1,d3 */
+    0x2800,			/* move.l d0,d4 */
+    0xb384,			/* eor.l d1,d4 */
+    0x4685,			/* not.l d5 */
+    0x0240, 0x00ff,		/* andi.w #$ff,d0 */
+    0x0006, 0x0080,		/* ori.b #$80,d6 */
+    0x0a87, 0x8000, 0x0001,	/* eori.l #$80000001,d7 */
+    0x56c0,			/* sne d0 */
+    STOP } },
+  { "shifts by immediate", {
+    0x203c, 0x8000, 0x0001,	/* move.l #$80000001,d0 */
+    0x2200,			/* move.l d0,d1 */
+    0x2400,			/* move.l d0,d2 */
+    0x2600,			/* move.l d0,d3 */
+    0x2800,			/* move.l d0,d4 */
+    0x2a00,			/* move.l d0,d5 */
+    0xe388,			/* lsl.l #1,d0 */
+    0xe089,			/* lsr.l #8,d1 */
+    0xe682,			/* asr.l #3,d2 */
+    0xe59b,			/* rol.l #2,d3 */
+    0xe09c,			/* ror.l #8,d4 */
+    0xe345,			/* asl.w #1,d5 */
+    0x59c6,			/* svs d6 */
+    0xe30f,			/* lsl.b #1,d7 */
+    STOP } },
+  { "shifts by register", {
+    0x203c, 0xc000, 0x0003,	/* move.l #$c0000003,d0 */
+    0x7220,			/* moveq #32,d1 */
+    0x7400,			/* moveq #0,d2 */
+    0x7621,			/* moveq #33,d3 */
+    0x2800,			/* move.l d0,d4 */
+    0xe3ac,			/* lsl.l d1,d4 */
+    0x55c5,			/* scs d5 */
+    0x2c00,			/* move.l d0,d6 */
+    0xe4a6,			/* asr.l d2,d6 */
+    0x2e00,			/* move.l d0,d7 */
+    0xe6af,			/* lsr.l d3,d7 */
+    0x2a00,			/* move.l d0,d5 */
+    0xe3bd,			/* rol.l d1,d5 */
+    0x7405,			/* moveq #5,d2 */
+    0xe4b8,			/* ror.l d2,d0 */
+    0x57c1,			/* seq d1 */
+    STOP } },
+  { "addx/subx/negx chain", {
+    0x203c, 0xffff, 0xffff,	/* move.l #$ffffffff,d0 */
+    0x7201,			/* moveq #1,d1 */
+    0x7400,			/* moveq #0,d2 */
+    0x7600,			/* moveq #0,d3 */
+    0xd081,			/* add.l d1,d0 */
+    0xd582,			/* addx.l d2,d2 */
+    0x44fc, 0x0010,		/* move #$10,ccr */
+    0x9783,			/* subx.l d3,d3 */
+    0x4084,			/* negx.l d4 */
+    0x44fc, 0x0004,		/* move #4,ccr */
+    0xd385,			/* addx.l d5,d1 */
+    0x57c6,			/* seq d6 */
+    STOP } },
+  { "mul/div", {
+    0x203c, 0x0001, 0x2345,	/* move.l #$12345,d0 */
+    0x7207,			/* moveq #7,d1 */
+    0x2400,			/* move.l d0,d2 */
+    0xc4c1,			/* mulu.w d1,d2 */
+    0x76f9,			/* moveq #-7,d3 */
+    0x2800,			/* move.l d0,d4 */
+    0xc9c3,			/* muls.w d3,d4 */
+    0x2a00,			/* move.l d0,d5 */
+    0x8ac1,			/* divu.w d1,d5 */
+    0x2c00,			/* move.l d0,d6 */
+    0x4c01, 0x6000,		/* mulu.l d1,d6 */
+    0x2e00,			/* move.l d0,d7 */
+    0x4c03, 0x7800,		/* muls.l d3,d7 */
+    STOP } },
+  { "ext/swap/exg", {
+    0x203c, 0x1234, 0x80fe,	/* move.l #$123480fe,d0 */
+    0x2200,			/* move.l d0,d1 */
+    0x4881,			/* ext.w d1 */
+    0x2400,			/* move.l d0,d2 */
+    0x48c2,			/* ext.l d2 */
+    0x2600,			/* move.l d0,d3 */
+    0x49c3,			/* extb.l d3 */
+    0x2800,			/* move.l d0,d4 */
+    0x4844,			/* swap d4 */
+    0xcb48,			/* exg a5,a0 */
+    0xcd40,			/* exg d6,d0 */
+    STOP } },
+  { "bit operations", {
+    0x7000,			/* moveq #0,d0 */
+    0x08c0, 0x001f,		/* bset #31,d0 */
+    0x7203,			/* moveq #3,d1 */
+    0x03c0,			/* bset d1,d0 */
+    0x0840, 0x0000,		/* bchg #0,d0 */
+    0x0880, 0x001f,		/* bclr #31,d0 */
+    0x57c2,			/* seq d2 */
+    0x0300,			/* btst d1,d0 */
+    0x57c3,			/* seq d3 */
+    0x03d0,			/* bset d1,(a0) */
+    0x0868, 0x0007, 0x0004,	/* bchg #7,4(a0) */
+    STOP } },
+  { "memory moves", {
+    0x22d8,			/* move.l (a0)+,(a1)+ */
+    0x22d8,			/* move.l (a0)+,(a1)+ */
+    0x372a, 0x0010,		/* move.w 16(a2),-(a3) */
+    0x1410,			/* move.b (a0),d2 */
+    0x2280,			/* move.l d0,(a1) */
+    0x2141, 0x0020,		/* move.l d1,32(a0) */
+    0x7202,			/* moveq #2,d1 */
+    0x2430, 0x1a08,		/* move.l 8(a0,d1.l*4),d2 */
+    0x49e8, 0x0100,		/* lea 256(a0),a4 */
+    0x4bf0, 0x1000,		/* lea 0(a0,d1.w),a5 */
+    0xd698,			/* add.l (a0)+,d3 */
+    0xd791,			/* add.l d3,(a1) */
+    0x4a10,			/* tst.b (a0) */
+    0x5bc7,			/* smi d7 */
+    STOP } },
+  { "stack: movem/link/pea", {
+    0x48e7, 0xf000,		/* movem.l d0-d3,-(a7) */
+    0x4e56, 0xfff8,		/* link a6,#-8 */
+    0x2d40, 0xfffc,		/* move.l d0,-4(a6) */
+    0x4850,			/* pea (a0) */
+    0x281f,			/* move.l (a7)+,d4 */
+    0x4e5e,			/* unlk a6 */
+    0x4cdf, 0x00f0,		/* movem.l (a7)+,d4-d7 */
+    0xd1c0,			/* adda.l d0,a0 */
+    0x94c1,			/* suba.w d1,a2 */
+    0xb3c8,			/* cmpa.l a0,a1 */
+    0x55c0,			/* scs d0 */
+    STOP } },
+  { "dbf loop", {
+    0x7000,			/* moveq #0,d0 */
+    0x7263,			/* moveq #99,d1 */
+    0x7400,			/* moveq #0,d2 */
+    0x5282,			/* l: addq.l #1,d2 */
+    0xd082,			/* add.l d2,d0 */
+    0x51c9, 0xfffa,		/* dbf d1,l */
+    0x2080,			/* move.l d0,(a0) */
+    STOP } },
+  { "nested loops and branches", {
+    0x7000,			/* moveq #0,d0 */
+    0x7209,			/* moveq #9,d1 */
+    0x7407,			/* o: moveq #7,d2 */
+    0x2602,			/* i: move.l d2,d3 */
+    0xc681,			/* and.l d1,d3 */
+    0x6702,			/* beq.s s */
+    0xd083,			/* add.l d3,d0 */
+    0x0800, 0x0000,		/* s: btst #0,d0 */
+    0x6604,			/* bne.s o2 */
+    0x5180,			/* subq.l #8,d0 */
+    0x6002,			/* bra.s n */
+    0x5880,			/* o2: addq.l #4,d0 */
+    0x51ca, 0xffea,		/* n: dbf d2,i */
+    0x51c9, 0xffe4,		/* dbf d1,o */
+    STOP } },
+  { "bsr/rts", {
+    0x7000,			/* moveq #0,d0 */
+    0x7204,			/* moveq #4,d1 */
+    0x6108,			/* l: bsr.s f */
+    0x51c9, 0xfffc,		/* dbf d1,l */
+    0x2080,			/* move.l d0,(a0) */
+    0x6006,			/* bra.s e */
+    0xd081,			/* f: add.l d1,d0 */
+    0xe388,			/* lsl.l #1,d0 */
+    0x4e75,			/* rts */
+    STOP } },
+  { "I/O bank", {
+    0x207c, 0x00df, 0x0010,	/* movea.l #$df0010,a0 */
+    0x20bc, 0x1234, 0x5678,	/* move.l #$12345678,(a0) */
+    0x3028, 0x0002,		/* move.w 2(a0),d0 */
+    0x1228, 0x0001,		/* move.b 1(a0),d1 */
+    0x5290,			/* addq.l #1,(a0) */
+    0x2410,			/* move.l (a0),d2 */
+    STOP } },
+  { "conditional branches", {
+    0x7e07,			/* moveq #7,d7 */
+    0x2019,			/* l: move.l (a1)+,d0 */
+    0x2219,			/* move.l (a1)+,d1 */
+    0x7400,			/* moveq #0,d2 */
+    0xb081,			/* cmp.l d1,d0 */
+    0x6204, 0x08c2, 0x0002,	/* bhi.s *+6 ; bset #2,d2 */
+    0x6304, 0x08c2, 0x0003,	/* bls.s *+6 ; bset #3,d2 */
+    0x6404, 0x08c2, 0x0004,	/* bcc.s *+6 ; bset #4,d2 */
+    0x6504, 0x08c2, 0x0005,	/* bcs.s *+6 ; bset #5,d2 */
+    0x6604, 0x08c2, 0x0006,	/* bne.s *+6 ; bset #6,d2 */
+    0x6704, 0x08c2, 0x0007,	/* beq.s *+6 ; bset #7,d2 */
+    0x6804, 0x08c2, 0x0008,	/* bvc.s *+6 ; bset #8,d2 */
+    0x6904, 0x08c2, 0x0009,	/* bvs.s *+6 ; bset #9,d2 */
+    0x6a04, 0x08c2, 0x000a,	/* bpl.s *+6 ; bset #10,d2 */
+    0x6b04, 0x08c2, 0x000b,	/* bmi.s *+6 ; bset #11,d2 */
+    0x6c04, 0x08c2, 0x000c,	/* bge.s *+6 ; bset #12,d2 */
+    0x6d04, 0x08c2, 0x000d,	/* blt.s *+6 ; bset #13,d2 */
+    0x6e04, 0x08c2, 0x000e,	/* bgt.s *+6 ; bset #14,d2 */
+    0x6f04, 0x08c2, 0x000f,	/* ble.s *+6 ; bset #15,d2 */
+    0x30c2,			/* move.w d2,(a0)+ */
+    0x51cf, 0xffa0,		/* dbf d7,l */
+    STOP } },
+  { NULL }
+};
+
+struct cpu_result {
+  uae_u32 regs[16];
+  uae_u32 pc;
+  uae_u16 sr;
+  uae_u8 data[DATA_SIZE];
+  uae_u8 io[256];
+};
+
+static void setup (int n)
+{
+  memset (&regs, 0, sizeof regs);
+  for (int i = 0; i < 8; i++)
+    m68k_dreg (regs, i) = 0x11111111u * (i + 1) ^ 0x80402010;
+  for (int i = 0; i < 7; i++)
+    m68k_areg (regs, i) = DATA_BASE + 0x40 * (i + 1);
+  m68k_areg (regs, 7) = STACK_TOP;
+  for (int i = 0; i < DATA_SIZE; i++)
+    natmem_offset[DATA_BASE + i] = i * 7 + 3;
+  memset (natmem_offset + STACK_TOP - 0x100, 0, 0x100);
+  memset (io_regs, 0, sizeof io_regs);
+  regs.s = 1;
+  regs.intmask = 7;
+  regs.sr = 0x2700;
+  MakeFromSR (regs);
+  regs.spcflags = 0;
+  m68k_setpc (regs, CODE_BASE + n * 0x1000);
+}
+
+static void collect (struct cpu_result *r)
+{
+  MakeSR (regs);
+  memcpy (r->regs, regs.regs, sizeof r->regs);
+  r->pc = m68k_getpc (regs);
+  r->sr = regs.sr;
+  memcpy (r->data, natmem_offset + DATA_BASE, DATA_SIZE);
+  memcpy (r->io, io_regs, sizeof r->io);
+}
+
+static int compare (const char *name, struct cpu_result *a, struct cpu_result *b)
+{
+  int bad = 0;
+
+  for (int i = 0; i < 16; i++) {
+    if (a->regs[i] != b->regs[i]) {
+      printf ("%s: %c%d %08x, JIT %08x\n", name, i < 8 ? 'D' : 'A', i & 7, a->regs[i], b->regs[i]);
+      bad = 1;
+    }
+  }
+  if (a->sr != b->sr) {
+    printf ("%s: SR %04x, JIT %04x\n", name, a->sr, b->sr);
+    bad = 1;
+  }
+  if (a->pc != b->pc) {
+    printf ("%s: PC %08x, JIT %08x\n", name, a->pc, b->pc);
+    bad = 1;
+  }
+  for (int i = 0; i < DATA_SIZE; i++) {
+    if (a->data[i] != b->data[i]) {
+      printf ("%s: byte at %08x %02x, JIT %02x\n", name, DATA_BASE + i, a->data[i], b->data[i]);
+      bad = 1;
+      break;
+    }
+  }
+  if (memcmp (a->io, b->io, sizeof a->io)) {
+    printf ("%s: I/O registers differ\n", name);
+    bad = 1;
+  }
+  return bad;
+}
+
+int main (int argc, char **argv)
+{
+  int failed = 0, n;
+
+  /* the generated code addresses natmem with 32 bit values */
+  natmem_offset = (uae_u8 *)jit_mmap_low (RAM_SIZE, PROT_READ | PROT_WRITE);
+  if (natmem_offset == NULL) {
+    printf ("can't map memory\n");
+    return 1;
+  }
+  natmem_size = RAM_SIZE;
+  kickmemory = natmem_offset + 0xf80000;
+  map_memory ();
+
+  currprefs.cpu_model = changed_prefs.cpu_model = 68020;
+  currprefs.address_space_24 = changed_prefs.address_space_24 = false;
+  currprefs.m68k_speed = changed_prefs.m68k_speed = -1;
+  currprefs.cachesize = changed_prefs.cachesize = 1024;
+  currprefs.compfpu = changed_prefs.compfpu = false;
+  for (int i = 0; i < 10; i++)
+    currprefs.optcount[i] = changed_prefs.optcount[i] = -1;
+  /* translate a block the first time it is seen */
+  currprefs.optcount[0] = changed_prefs.optcount[0] = 0;
+  for (int i = 1; i < 6; i++)
+    currprefs.optcount[i] = changed_prefs.optcount[i] = 0;
+  init_m68k ();
+  set_cache_state (1);
+
+  for (n = 0; tests[n].name; n++) {
+    const struct block_test *t = &tests[n];
+    struct cpu_result interp, jit;
+    uae_u32 size;
+
+    for (int i = 0; i < 64; i++)
+      do_put_mem_word ((uae_u16 *)(natmem_offset + CODE_BASE + n * 0x1000 + 2 * i), t->code[i]);
+
+    setup (n);
+    m68k_run_2 ();
+    collect (&interp);
+
+    size = get_jitted_size ();
+    for (int pass = 0; pass < 3; pass++) {
+      setup (n);
+      m68k_run_jit ();
+    }
+    collect (&jit);
+
+    if (compare (t->name, &interp, &jit)) {
+      failed++;
+      printf ("FAIL %s\n", t->name);
+    }
+    else if (get_jitted_size () == size) {
+      failed++;
+      printf ("FAIL %s: nothing was compiled\n", t->name);
+    }
+    else
+      printf ("ok   %s\n", t->name);
+  }
+  printf ("%d of %d block tests failed\n", failed, n);
+  return failed ? 1 : 0;
+}
@@ -77,3 +77,24 @@ void keybuf_init (void)
   kpb_first = kpb_last = 0;
   inputdevice_updateconfig (&currprefs);
 }
+
+/* Keys read by frames that are run ahead must still reach the real frame,
+ * so only the read position goes back, keys typed since are kept. */
+uae_u8 *restore_keybuf_runahead (uae_u8 *src)
+{
+  restore_raw (kpb_last);
+  return src;
+}
+
+uae_u8 *save_keybuf_runahead (int *len, uae_u8 *dstptr)
+{
+  uae_u8 *dstbak, *dst;
+
+  if (dstptr)
+    dstbak = dst = dstptr;
+  else
+    dstbak = dst = xmalloc (uae_u8, sizeof kpb_last);
+  save_raw (kpb_last);
+  *len = dst - dstbak;
+  return dstbak;
+}
@@ -2,8 +2,12 @@
  *    xcolors[] contains 16-bit color information in both words
  *    colors_for_drawing.acolors (non AGA) contains 16-bit color information in both words
  *    colors_for_drawing.acolors (AGA) contains 16-bit color information in one word
+ *
+ *    With USE_RGB32, xcolors[] and acolors hold one 32-bit pixel and the
+ *    linetoscr_32 variants at the end of this file are used instead.
  */
  
+#ifndef USE_RGB32
 static int NOINLINE linetoscr_16 (int spix, int dpix, int stoppos)
 {
     uae_u16 *buf = (uae_u16 *) xlinebuffer;
@@ -937,3 +941,169 @@ static int NOINLINE linetoscr_16_shrink1_aga (int spix, int dpix, int stoppos)
     return spix;
 }
 #endif
+
+#else /* USE_RGB32 */
+
+/* One uae_u32 per pixel, so no alignment fixups or pixel packing are needed.
+ * sstep/dstep are constants after inlining: 1/1 native, 1/2 stretch, 2/1 shrink. */
+
+STATIC_INLINE uae_u32 ehb_pixel_32 (uae_u32 spix_val)
+{
+    if (spix_val <= 31)
+        return colors_for_drawing.acolors[spix_val];
+    return xcolors[(colors_for_drawing.color_regs_ecs[spix_val - 32] >> 1) & 0x777];
+}
+
+STATIC_INLINE int linetoscr_32_any (int spix, int dpix, int stoppos, const int sstep, const int dstep)
+{
+    uae_u32 *buf = (uae_u32 *) xlinebuffer;
+    uae_u32 out_val;
+
+    if (dp_for_drawing->ham_seen) {
+        while (dpix < stoppos) {
+            out_val = xcolors[ham_linebuf[spix]];
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    } else if (bpldualpf) {
+        int *lookup = bpldualpfpri ? dblpf_ind2 : dblpf_ind1;
+        while (dpix < stoppos) {
+            out_val = colors_for_drawing.acolors[lookup[pixdata.apixels[spix]]];
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    } else if (bplehb) {
+        while (dpix < stoppos) {
+            out_val = ehb_pixel_32 (pixdata.apixels[spix]);
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    } else {
+        while (dpix < stoppos) {
+            out_val = colors_for_drawing.acolors[pixdata.apixels[spix]];
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    }
+
+    return spix;
+}
+
+static int NOINLINE linetoscr_32 (int spix, int dpix, int stoppos)
+{
+    return linetoscr_32_any (spix, dpix, stoppos, 1, 1);
+}
+
+static int NOINLINE linetoscr_32_stretch1 (int spix, int dpix, int stoppos)
+{
+    return linetoscr_32_any (spix, dpix, stoppos, 1, 2);
+}
+
+static int NOINLINE linetoscr_32_shrink1 (int spix, int dpix, int stoppos)
+{
+    return linetoscr_32_any (spix, dpix, stoppos, 2, 1);
+}
+
+#ifdef AGA
+STATIC_INLINE uae_u32 dpf_pixel_aga_32 (int spix, int *lookup, int *lookup_no, uae_u8 xor_val)
+{
+    uae_u32 spix_val;
+    unsigned int val;
+
+    if (spritepixels[spix])
+        return colors_for_drawing.acolors[spritepixels[spix]];
+    spix_val = pixdata.apixels[spix];
+    val = lookup[spix_val];
+    if (lookup_no[spix_val] == 2)
+        val += dblpfofs[bpldualpf2of];
+    val ^= xor_val;
+    return colors_for_drawing.acolors[val];
+}
+
+STATIC_INLINE uae_u32 ehb_pixel_aga_32 (uae_u32 spix_val)
+{
+    if (spix_val >= 32 && spix_val < 64) {
+        unsigned int c = (colors_for_drawing.color_regs_aga[spix_val - 32] >> 1) & 0x7F7F7F;
+        return CONVERT_RGB (c);
+    }
+    return colors_for_drawing.acolors[spix_val];
+}
+
+STATIC_INLINE int linetoscr_32_aga_any (int spix, int dpix, int stoppos, const int sstep, const int dstep)
+{
+    uae_u32 *buf = (uae_u32 *) xlinebuffer;
+    uae_u8 xor_val = bplxor;
+    uae_u32 out_val;
+
+    if (dp_for_drawing->ham_seen) {
+        while (dpix < stoppos) {
+            out_val = CONVERT_RGB (ham_linebuf[spix]);
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    } else if (bpldualpf) {
+        int *lookup    = bpldualpfpri ? dblpf_ind2_aga : dblpf_ind1_aga;
+        int *lookup_no = bpldualpfpri ? dblpf_2nd2     : dblpf_2nd1;
+        while (dpix < stoppos) {
+            out_val = dpf_pixel_aga_32 (spix, lookup, lookup_no, xor_val);
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    } else if (bplehb) {
+        while (dpix < stoppos) {
+            out_val = ehb_pixel_aga_32 (pixdata.apixels[spix] ^ xor_val);
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    } else {
+        while (dpix < stoppos) {
+            out_val = colors_for_drawing.acolors[pixdata.apixels[spix] ^ xor_val];
+            buf[dpix] = out_val;
+            if (dstep == 2)
+                buf[dpix + 1] = out_val;
+            spix += sstep;
+            dpix += dstep;
+        }
+    }
+
+    return spix;
+}
+
+static int NOINLINE linetoscr_32_aga (int spix, int dpix, int stoppos)
+{
+    return linetoscr_32_aga_any (spix, dpix, stoppos, 1, 1);
+}
+
+static int NOINLINE linetoscr_32_stretch1_aga (int spix, int dpix, int stoppos)
+{
+    return linetoscr_32_aga_any (spix, dpix, stoppos, 1, 2);
+}
+
+static int NOINLINE linetoscr_32_shrink1_aga (int spix, int dpix, int stoppos)
+{
+    return linetoscr_32_aga_any (spix, dpix, stoppos, 2, 1);
+}
+#endif
+
+#endif /* USE_RGB32 */
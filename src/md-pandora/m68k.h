@@ -118,7 +118,9 @@ STATIC_INLINE int cctrue (struct flag_struct &flags, int cc)
     return 0;
 }
 
-#elif defined(CPU_arm) && defined(ARMV6_ASSEMBLY)
+#elif (defined(CPU_arm) && defined(ARMV6_ASSEMBLY)) || defined(CPU_AARCH64)
+
+/* AArch64 keeps NZCV in the same bit positions as ARM */
 
 struct flag_struct {
 	uae_u32 nzcv;
@@ -46,6 +46,7 @@ static bool need_hardreset;
 static bool last_address_space_24;
 
 addrbank *mem_banks[MEMORY_BANKS];
+uae_u8 *mem_banks_ram[MEMORY_BANKS];
 
 
 int addr_valid(const TCHAR *txt, uaecptr addr, uae_u32 len)
@@ -921,9 +922,23 @@ static void init_mem_banks (void)
   int i;
   for (i = 0; i < MEMORY_BANKS; i++) {
     mem_banks[i] = &dummy_bank;
+    mem_banks_ram[i] = NULL;
   }
 }
 
+/* Only banks backed by memory over the whole 64 KB get a direct pointer,
+   anything with side effects keeps going through the bank functions. */
+static void set_mem_bank (int bnr, addrbank *bank)
+{
+  uaecptr addr = (uaecptr)bnr << 16;
+
+  mem_banks[bnr] = bank;
+  if ((bank->flags & ABFLAG_RAM) && !(bank->flags & ABFLAG_IO) && bank->check (addr, 65536))
+    mem_banks_ram[bnr] = bank->xlateaddr (addr);
+  else
+    mem_banks_ram[bnr] = NULL;
+}
+
 static void allocate_memory (void)
 {
   if (allocated_chipmem != currprefs.chipmem_size) {
@@ -1248,7 +1263,7 @@ void map_banks (addrbank *bank, int start, int size, int realsize)
 #ifndef ADDRESS_SPACE_24BIT
   if (start >= 0x100) {
     for (bnr = start; bnr < start + size; bnr++) {
-      mem_banks[bnr] = bank;
+      set_mem_bank (bnr, bank);
     }
     return;
   }
@@ -1260,7 +1275,7 @@ void map_banks (addrbank *bank, int start, int size, int realsize)
 #endif
   for (hioffs = 0; hioffs < endhioffs; hioffs += 0x100) {
     for (bnr = start; bnr < start + size; bnr++) {
-      mem_banks[bnr + hioffs] = bank;
+      set_mem_bank (bnr + hioffs, bank);
     }
   }
 }
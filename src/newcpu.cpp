@@ -80,6 +80,38 @@ int movem_next[256];
 
 cpuop_func *cpufunctbl[65536];
 
+/* Pre-decoded blocks for m68k_run_predecoded: the handler of every
+   instruction of a block is looked up once and kept with its opcode, so
+   the block is replayed without going through cpufunctbl. */
+#define PREDECODE_BLOCKS 4096
+#define PREDECODE_MAXLEN 16
+
+struct predecoded_insn {
+  uae_u8 *pc_p;
+  cpuop_func *handler;
+  uae_u32 opcode;
+};
+
+struct predecoded_block {
+  uae_u8 *pc_p;
+  uae_u32 gen;
+  int count;
+  struct predecoded_insn insn[PREDECODE_MAXLEN];
+};
+
+static struct predecoded_block *predecode_cache;
+static uae_u32 predecode_gen = 1;
+
+/* Handlers changed: forget every block, as flush_icache does for the JIT */
+static void predecode_flush (void)
+{
+  if (++predecode_gen == 0) {
+    if (predecode_cache)
+      memset (predecode_cache, 0, PREDECODE_BLOCKS * sizeof (struct predecoded_block));
+    predecode_gen = 1;
+  }
+}
+
 extern uae_u32 get_fpsr(void);
 
 #define MC68060_PCR   0x04300000
@@ -146,11 +178,32 @@ STATIC_INLINE uae_u32 op_illg_1 (uae_u32 opcode, struct regstruct &regs)
 	return 4;
 }
 
+#ifndef CPU_PAIR_STATS
+/* Install the fused handlers of a pair table for every opcode that shares
+   the handler of the pair's first instruction. */
+static void set_pair_handlers (const struct cputbl *ptbl)
+{
+  int i;
+  unsigned long opcode;
+
+  for (i = 0; ptbl[i].handler != NULL; i++) {
+    cpuop_func *f = cpufunctbl[ptbl[i].opcode];
+    if (f == op_illg_1)
+      continue;
+    for (opcode = 0; opcode < 65536; opcode++) {
+      if (cpufunctbl[opcode] == f)
+        cpufunctbl[opcode] = ptbl[i].handler;
+    }
+  }
+}
+#endif
+
 static void build_cpufunctbl (void)
 {
   int i;
   unsigned long opcode;
   const struct cputbl *tbl = 0;
+  const struct cputbl *ptbl = 0;
   int lvl;
 
   switch (currprefs.cpu_model)
@@ -160,18 +213,22 @@ static void build_cpufunctbl (void)
 	case 68040:
   	lvl = 4;
   	tbl = op_smalltbl_1_ff;
+  	ptbl = op_pairtbl_1_ff;
   	break;
 	case 68030:
   	lvl = 3;
   	tbl = op_smalltbl_2_ff;
+  	ptbl = op_pairtbl_2_ff;
   	break;
 	case 68020:
   	lvl = 2;
   	tbl = op_smalltbl_3_ff;
+  	ptbl = op_pairtbl_3_ff;
   	break;
 	case 68010:
   	lvl = 1;
   	tbl = op_smalltbl_4_ff;
+  	ptbl = op_pairtbl_4_ff;
   	break;
 #endif
 #endif
@@ -180,6 +237,7 @@ static void build_cpufunctbl (void)
   	case 68000:
   	lvl = 0;
   	tbl = op_smalltbl_5_ff;
+  	ptbl = op_pairtbl_5_ff;
 #ifdef CPUEMU_11
   	if (currprefs.cpu_compatible)
 	    tbl = op_smalltbl_11_ff; /* prefetch */
@@ -228,6 +286,19 @@ static void build_cpufunctbl (void)
 	    cpufunctbl[opcode] = f;
   	}
   }
+
+  /* Superinstructions only fit the plain m68k_run_2 loop. They are off
+     unless cpu_pairs is set: the only measurement so far (x86-64, one
+     AROS boot) had them slower than plain dispatch. */
+#ifndef CPU_PAIR_STATS
+  if (currprefs.cpu_pairs && !currprefs.cpu_compatible
+#ifdef JIT
+    && !(currprefs.cpu_model >= 68020 && currprefs.cachesize)
+#endif
+    )
+    set_pair_handlers (ptbl);
+#endif
+  predecode_flush ();
 #ifdef JIT
   compiler_init ();
   build_comp ();
@@ -276,6 +347,116 @@ STATIC_INLINE unsigned long adjust_cycles(unsigned long cycles)
     return res;
 }
 
+/* The interpreter loops call do_cycles once per instruction, but almost
+   always no event is due yet. Handle that case inline and only take the
+   indirect call when do_cycles has real work to do. */
+STATIC_INLINE void do_cycles_inline(unsigned long cycles_to_add)
+{
+  if (do_cycles == do_cycles_cpu_norm) {
+    if ((nextevent - currcycle) > cycles_to_add) {
+      currcycle += cycles_to_add;
+      return;
+    }
+  } else if (regs.pissoff > (signed long)cycles_to_add) {
+    regs.pissoff -= cycles_to_add;
+    return;
+  }
+  do_cycles (cycles_to_add);
+}
+
+/* Called by the fused handlers of cpuemu_pair.cpp between the two
+   instructions; does what m68k_run_2 does between two opcodes. */
+void cpu_pair_step (uae_u32 cycles)
+{
+  regs.instruction_pc = m68k_getpc (regs);
+  do_cycles_inline (adjust_cycles (cycles));
+}
+
+#ifdef CPU_PAIR_STATS
+/* Count executed opcode pairs, reduced to the opcode of their handler,
+   and write the most frequent ones to frequent_pairs.68k for gencpu. */
+#define PAIR_HASH_SIZE 65536
+#define PAIR_HASH_PROBES 16
+#define PAIR_DUMP_MAX 256
+static uae_u32 pair_key[PAIR_HASH_SIZE];
+static uae_u32 pair_count[PAIR_HASH_SIZE];
+static uae_u32 pair_total;
+static uae_u32 pair_last;
+
+static void count_pair (uae_u32 opcode)
+{
+  uae_u32 key, h;
+  int i;
+
+  if (table68k[opcode].handler != -1)
+    opcode = table68k[opcode].handler;
+  key = (pair_last << 16) | opcode;
+  pair_last = opcode;
+  pair_total++;
+  h = (key * 2654435761u) >> 16;
+  for (i = 0; i < PAIR_HASH_PROBES; i++, h = (h + 1) & (PAIR_HASH_SIZE - 1)) {
+    if (pair_count[h] == 0)
+      pair_key[h] = key;
+    if (pair_key[h] == key) {
+      pair_count[h]++;
+      return;
+    }
+  }
+}
+
+static int pair_cmp (const void *a, const void *b)
+{
+  uae_u32 ca = pair_count[*(const int *)a];
+  uae_u32 cb = pair_count[*(const int *)b];
+  return ca < cb ? 1 : ca > cb ? -1 : 0;
+}
+
+static void dump_pair_counts (void)
+{
+  FILE *f;
+  int *idx;
+  int i, n = 0;
+
+  idx = xmalloc (int, PAIR_HASH_SIZE);
+  for (i = 0; i < PAIR_HASH_SIZE; i++) {
+    if (pair_count[i])
+      idx[n++] = i;
+  }
+  qsort (idx, n, sizeof (int), pair_cmp);
+  f = fopen ("frequent_pairs.68k", "w");
+  if (f) {
+    fprintf (f, "Total: %u\n", pair_total);
+    for (i = 0; i < n && i < PAIR_DUMP_MAX; i++)
+      fprintf (f, "%x %x: %u\n", pair_key[idx[i]] >> 16, pair_key[idx[i]] & 0xffff, pair_count[idx[i]]);
+    fclose (f);
+    write_log (_T("wrote %d opcode pairs to frequent_pairs.68k\n"), n < PAIR_DUMP_MAX ? n : PAIR_DUMP_MAX);
+  }
+  xfree (idx);
+}
+#endif
+
+#ifdef CPU_RATE_STATS
+/* Log the time per interpreted instruction, chipset work included, to
+   compare changes to the interpreter loops on the real hardware. */
+#define RATE_INSNS (1 << 24)
+static uae_u32 rate_count;
+static int64_t rate_start;
+
+STATIC_INLINE void count_rate (void)
+{
+  int64_t now;
+
+  if (++rate_count < RATE_INSNS)
+    return;
+  now = read_processor_time_ns ();
+  if (rate_start)
+    write_log (_T("CPU: %d.%02d ns per instruction\n"),
+      (int)((now - rate_start) / RATE_INSNS), (int)((now - rate_start) * 100 / RATE_INSNS % 100));
+  rate_start = now;
+  rate_count = 0;
+}
+#endif
+
 
 void check_prefs_changed_adr24 (void)
 {
@@ -298,6 +479,8 @@ static void prefs_changed_cpu (void)
   currprefs.cpu_model = changed_prefs.cpu_model;
   currprefs.fpu_model = changed_prefs.fpu_model;
   currprefs.cpu_compatible = changed_prefs.cpu_compatible;
+  currprefs.cpu_pairs = changed_prefs.cpu_pairs;
+  currprefs.cpu_predecode = changed_prefs.cpu_predecode;
 }
 
 void check_prefs_changed_cpu (void)
@@ -310,7 +493,9 @@ void check_prefs_changed_cpu (void)
   if (changed
 	|| currprefs.cpu_model != changed_prefs.cpu_model
 	|| currprefs.fpu_model != changed_prefs.fpu_model
-	|| currprefs.cpu_compatible != changed_prefs.cpu_compatible) {
+	|| currprefs.cpu_compatible != changed_prefs.cpu_compatible
+	|| currprefs.cpu_pairs != changed_prefs.cpu_pairs
+	|| currprefs.cpu_predecode != changed_prefs.cpu_predecode) {
 
   	prefs_changed_cpu ();
   	if (!currprefs.cpu_compatible && changed_prefs.cpu_compatible)
@@ -1561,6 +1746,15 @@ STATIC_INLINE int do_specialties (int cycles, struct regstruct &regs)
 		     do_interrupt (intr, regs);
     }
 
+#ifdef SAVESTATE
+    // run-ahead keeps the CPU stopped unless it went back in time
+    if (regs.spcflags & SPCFLAG_RUNAHEAD) {
+      unset_special (regs, SPCFLAG_RUNAHEAD);
+      savestate_runahead_step ();
+      if (!regs.stopped)
+        return 1;
+    }
+#endif
     if ((regs.spcflags & (SPCFLAG_BRK | SPCFLAG_MODE_CHANGE))) {
       unset_special (regs, SPCFLAG_BRK | SPCFLAG_MODE_CHANGE);
 		  // SPCFLAG_BRK breaks STOP condition, need to prefetch
@@ -1585,6 +1779,14 @@ STATIC_INLINE int do_specialties (int cycles, struct regstruct &regs)
     set_special (regs, SPCFLAG_INT);
   }
 
+#ifdef SAVESTATE
+  if (regs.spcflags & SPCFLAG_RUNAHEAD) {
+    unset_special (regs, SPCFLAG_RUNAHEAD);
+    savestate_runahead_step ();
+    return 1;
+  }
+#endif
+
   if ((regs.spcflags & (SPCFLAG_BRK | SPCFLAG_MODE_CHANGE))) {
     unset_special (regs, SPCFLAG_BRK | SPCFLAG_MODE_CHANGE);
     return 1;
@@ -1610,7 +1812,10 @@ static void m68k_run_1 (void)
       : : [radr] "r" (cpufunctbl[opcode]) : );
 #endif
 
-  	do_cycles (cpu_cycles);
+  	do_cycles_inline (cpu_cycles);
+#ifdef CPU_RATE_STATS
+  	count_rate ();
+#endif
   	cpu_cycles = (*cpufunctbl[opcode])(opcode, r);
   	cpu_cycles = adjust_cycles(cpu_cycles);
   	if (r.spcflags) {
@@ -1647,6 +1852,21 @@ void exec_nostats(void)
   }
 }
 
+/* Traces run through conditional branches along the path actually taken,
+   until they would loop back into themselves. */
+static bool trace_continues (uae_u16 opcode, cpu_history *pc_hist, int blocklen)
+{
+  int i;
+
+  if (table68k[opcode].mnemo != i_Bcc && table68k[opcode].mnemo != i_DBcc)
+    return false;
+  for (i = 0; i < blocklen; i++) {
+    if (pc_hist[i].location == (uae_u16*)regs.pc_p)
+      return false;
+  }
+  return true;
+}
+
 void execute_normal(void)
 {
   struct regstruct &r = regs;
@@ -1667,14 +1887,25 @@ void execute_normal(void)
 
   	special_mem = DISTRUST_CONSISTENT_MEM;
   	pc_hist[blocklen].location = (uae_u16*)r.pc_p;
+  	pc_hist[blocklen].retlen = 0;
+  	bool call = table68k[opcode].mnemo == i_JSR || table68k[opcode].mnemo == i_BSR;
+  	uaecptr call_pc = call ? m68k_getpc (r) : 0;
 
   	cpu_cycles = (*cpufunctbl[opcode])(opcode, r);
   	cpu_cycles = adjust_cycles(cpu_cycles);
   	do_cycles (cpu_cycles);
   	total_cycles += cpu_cycles;
+  	pc_hist[blocklen].cycles = total_cycles;
   	pc_hist[blocklen].specmem = special_mem;
+  	if (call && !r.spcflags) {
+  	  /* Note where the call returns to, for the JIT's shadow return stack */
+  	  uae_u32 len = get_long (m68k_areg (r, 7)) - call_pc;
+  	  if (len >= 2 && len <= 10)
+  	    pc_hist[blocklen].retlen = len;
+  	}
   	blocklen++;
-  	if (end_block(opcode) || blocklen >= MAXRUN || r.spcflags || uae_int_requested) {
+  	if ((end_block(opcode) && !trace_continues(opcode, pc_hist, blocklen))
+        || blocklen >= MAXRUN || r.spcflags || uae_int_requested) {
 	    compile_block(pc_hist,blocklen,total_cycles);
 	    return; /* We will deal with the spcflags in the caller */
   	}
@@ -1717,7 +1948,10 @@ static void m68k_run_2p (void)
 
   	r.instruction_pc = pc;
 
-  	do_cycles (cpu_cycles);
+  	do_cycles_inline (cpu_cycles);
+#ifdef CPU_RATE_STATS
+  	count_rate ();
+#endif
 
   	if (pc == prefetch_pc) {
 	    opcode = prefetch >> 16;
@@ -1754,7 +1988,13 @@ static void m68k_run_2 (void)
        : : [radr] "r" (cpufunctbl[opcode]) : );
 #endif
 
-	  do_cycles (cpu_cycles);
+	  do_cycles_inline (cpu_cycles);
+#ifdef CPU_PAIR_STATS
+	  count_pair (opcode);
+#endif
+#ifdef CPU_RATE_STATS
+	  count_rate ();
+#endif
 	  cpu_cycles = (*cpufunctbl[opcode])(opcode, r);
 	  cpu_cycles = adjust_cycles(cpu_cycles);
 	  if (r.spcflags) {
@@ -1764,6 +2004,82 @@ static void m68k_run_2 (void)
   }
 }
 
+/* m68k_run_2 through pre-decoded blocks. A block is recorded while it
+   runs the first time and ends at the first jump. On a replay, a record
+   only runs if the CPU really got to its address and the opcode there is
+   still the same, so code written by the CPU, DMA or the host is picked
+   up as it is by m68k_run_2. Extension words are read by the handlers
+   from memory as usual. */
+static void m68k_run_predecoded (void)
+{
+  struct regstruct &r = regs;
+
+  if (!predecode_cache) {
+    predecode_cache = xcalloc (struct predecoded_block, PREDECODE_BLOCKS);
+    if (!predecode_cache) {
+      m68k_run_2 ();
+      return;
+    }
+  }
+  for (;;) {
+    struct predecoded_block *b = &predecode_cache[((unsigned long)r.pc_p >> 1) & (PREDECODE_BLOCKS - 1)];
+    struct predecoded_insn *in, *end;
+
+    if (b->pc_p == r.pc_p && b->gen == predecode_gen) {
+      for (in = b->insn, end = in + b->count; in < end; in++) {
+        if (r.pc_p != in->pc_p)
+          break;
+        if (get_iword2 (r, 0) != in->opcode) {
+          /* overwritten, record it again */
+          b->gen = 0;
+          break;
+        }
+        r.instruction_pc = m68k_getpc (r);
+        do_cycles_inline (cpu_cycles);
+#ifdef CPU_RATE_STATS
+        count_rate ();
+#endif
+        cpu_cycles = (*in->handler)(in->opcode, r);
+        cpu_cycles = adjust_cycles(cpu_cycles);
+        if (r.spcflags) {
+          if (do_specialties (cpu_cycles, r))
+            return;
+          break;
+        }
+      }
+      continue;
+    }
+
+    b->pc_p = r.pc_p;
+    b->gen = predecode_gen;
+    b->count = 0;
+    for (;;) {
+      uae_u8 *pc_p = r.pc_p;
+      uae_u16 opcode = get_iword2 (r, 0);
+
+      in = &b->insn[b->count++];
+      in->pc_p = pc_p;
+      in->handler = cpufunctbl[opcode];
+      in->opcode = opcode;
+      r.instruction_pc = m68k_getpc (r);
+      do_cycles_inline (cpu_cycles);
+#ifdef CPU_RATE_STATS
+      count_rate ();
+#endif
+      cpu_cycles = (*in->handler)(opcode, r);
+      cpu_cycles = adjust_cycles(cpu_cycles);
+      if (r.spcflags) {
+        if (do_specialties (cpu_cycles, r))
+          return;
+        break;
+      }
+      /* a fused pair is up to two instructions of 10 bytes */
+      if (r.pc_p <= pc_p || r.pc_p - pc_p > 20 || b->count == PREDECODE_MAXLEN)
+        break;
+    }
+  }
+}
+
 int in_m68k_go = 0;
 
 static void exception2_handle (uaecptr addr, uaecptr fault)
@@ -1860,10 +2176,14 @@ void m68k_go (int may_quit)
 #ifdef JIT
       currprefs.cpu_model >= 68020 && currprefs.cachesize ? m68k_run_jit :
 #endif
-      currprefs.cpu_compatible ? m68k_run_2p : m68k_run_2;
+      currprefs.cpu_compatible ? m68k_run_2p :
+      currprefs.cpu_predecode ? m68k_run_predecoded : m68k_run_2;
 	  run_func ();
   }
   in_m68k_go--;
+#ifdef CPU_PAIR_STATS
+  dump_pair_counts ();
+#endif
 }
 
 #ifdef SAVESTATE
@@ -1996,6 +2316,33 @@ uae_u8 *save_cpu_extra (int *len, uae_u8 *dstptr)
 	return dstbak;
 }
 
+/* Run-ahead takes the register file as it is: going through restore_cpu
+ * would rebuild the CPU tables and reset the cycle counter every frame. */
+uae_u8 *restore_cpu_runahead (uae_u8 *src)
+{
+  uae_u32 keep = regs.spcflags & (SPCFLAG_BRK | SPCFLAG_MODE_CHANGE);
+
+  restore_raw (regs);
+  restore_raw (cpu_cycles);
+  /* requests from outside the emulation are not taken back */
+  regs.spcflags |= keep;
+  return src;
+}
+
+uae_u8 *save_cpu_runahead (int *len, uae_u8 *dstptr)
+{
+  uae_u8 *dstbak, *dst;
+
+  if (dstptr)
+    dstbak = dst = dstptr;
+  else
+    dstbak = dst = xmalloc (uae_u8, sizeof regs + sizeof cpu_cycles);
+  save_raw (regs);
+  save_raw (cpu_cycles);
+  *len = dst - dstbak;
+  return dstbak;
+}
+
 uae_u8 *save_cpu (int *len, uae_u8 *dstptr)
 {
   uae_u8 *dstbak,*dst;
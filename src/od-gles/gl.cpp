@@ -6,6 +6,17 @@
 #include "gl_platform.h"
 #include "gl.h"
 
+/* texture layout of the emulator framebuffer, see DISPLAY_BPP in xwin.h */
+#ifdef USE_RGB32
+#define GL_FB_FORMAT GL_RGBA
+#define GL_FB_TYPE GL_UNSIGNED_BYTE
+#define GL_FB_PIXBYTES 4
+#else
+#define GL_FB_FORMAT GL_RGB
+#define GL_FB_TYPE GL_UNSIGNED_SHORT_5_6_5
+#define GL_FB_PIXBYTES 2
+#endif
+
 static EGLDisplay edpy;
 static EGLSurface esfc;
 static EGLContext ectxt;
@@ -53,7 +64,7 @@ int gl_init(void *display, void *window, int *quirks)
 		goto out;
 	}
 
-	tmp_texture_mem = calloc(1, 1024 * 512 * 2);
+	tmp_texture_mem = calloc(1, 1024 * 512 * GL_FB_PIXBYTES);
 	if (tmp_texture_mem == NULL) {
 		printf("OOM\n");
 		goto out;
@@ -103,8 +114,8 @@ int gl_init(void *display, void *window, int *quirks)
 
 	glBindTexture(GL_TEXTURE_2D, texture_name);
 
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1024, 512, 0, GL_RGB,
-		GL_UNSIGNED_SHORT_5_6_5, tmp_texture_mem);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_FB_FORMAT, 1024, 512, 0, GL_FB_FORMAT,
+		GL_FB_TYPE, tmp_texture_mem);
 	if (gl_have_error("glTexImage2D"))
 		goto out;
 
@@ -145,25 +156,37 @@ static float texture[] = {
 	1.0f, 1.0f, //  +-->
 };
 
-int gl_flip(const void *fb, int w, int h)
+/* upload rows y..y+rows-1 of a w*h framebuffer to the texture */
+int gl_update_rows(const void *fb, int w, int h, int y, int rows)
 {
 	static int old_w, old_h;
 
+	if (w != old_w || h != old_h) {
+		float f_w = (float)w / 1024.0f;
+		float f_h = (float)h / 512.0f;
+		texture[1*2 + 0] = f_w;
+		texture[2*2 + 1] = f_h;
+		texture[3*2 + 0] = f_w;
+		texture[3*2 + 1] = f_h;
+		old_w = w;
+		old_h = h;
+	}
+
+	if (y + rows > h)
+		rows = h - y;
+	if (rows <= 0)
+		return 0;
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, w, rows,
+		GL_FB_FORMAT, GL_FB_TYPE, (const unsigned char *)fb + y * w * GL_FB_PIXBYTES);
+	if (gl_have_error("glTexSubImage2D"))
+		return -1;
+	return 0;
+}
+
+int gl_flip(const void *fb, int w, int h)
+{
 	if (fb != NULL) {
-		if (w != old_w || h != old_h) {
-			float f_w = (float)w / 1024.0f;
-			float f_h = (float)h / 512.0f;
-			texture[1*2 + 0] = f_w;
-			texture[2*2 + 1] = f_h;
-			texture[3*2 + 0] = f_w;
-			texture[3*2 + 1] = f_h;
-			old_w = w;
-			old_h = h;
-		}
-
-		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h,
-			GL_RGB, GL_UNSIGNED_SHORT_5_6_5, fb);
-		if (gl_have_error("glTexSubImage2D"))
+		if (gl_update_rows(fb, w, h, 0, h))
 			return -1;
 	}
 
@@ -4,6 +4,7 @@
 #ifdef HAVE_GLES
 
 int gl_init(void *display, void *window, int *quirks);
+int gl_update_rows(const void *fb, int w, int h, int y, int rows);
 int gl_flip(const void *fb, int w, int h);
 void gl_finish(void);
 
@@ -17,6 +18,10 @@ static __inline int gl_init(void *display, void *window, int *quirks)
 {
   return -1;
 }
+static __inline int gl_update_rows(const void *fb, int w, int h, int y, int rows)
+{
+  return -1;
+}
 static __inline int gl_flip(const void *fb, int w, int h)
 {
   return -1;
@@ -62,10 +62,6 @@ int mouseMoving = 0;
 int fcounter = 0;
 int doStylusRightClick = 0;
 
-static unsigned long previous_synctime = 0;
-static unsigned long next_synctime = 0;
-
-
 unsigned char current_resource_amigafb = 0;
 
 
@@ -83,7 +79,7 @@ int graphics_setup (void)
 void InitAmigaVidMode(struct uae_prefs *p)
 {
   /* Initialize structure for Amiga video modes */
-  gfxvidinfo.pixbytes = 2;
+  gfxvidinfo.pixbytes = DISPLAY_PIXBYTES;
   gfxvidinfo.bufmem = (uae_u8 *)prSDLScreen->pixels;
   gfxvidinfo.outwidth = p->gfx_size.width;
   gfxvidinfo.outheight = p->gfx_size.height;
@@ -151,11 +147,16 @@ static void open_screen(struct uae_prefs *p)
   SDL_ShowCursor(SDL_DISABLE);
 
   printf("Emulation resolution: Width %i Height: %i\n",width,height);
+#ifdef USE_RGB32
+  prSDLScreen = SDL_CreateRGBSurface(SDL_SWSURFACE,width,height,DISPLAY_BPP,
+    DISPLAY_RMASK, DISPLAY_GMASK, DISPLAY_BMASK, 0);
+#else
   prSDLScreen = SDL_CreateRGBSurface(SDL_SWSURFACE,width,height,16,
     Dummy_prSDLScreen->format->Rmask,
     Dummy_prSDLScreen->format->Gmask,
     Dummy_prSDLScreen->format->Bmask,
     Dummy_prSDLScreen->format->Amask);
+#endif
 
 
   // get x11 display/window for GL
@@ -190,6 +191,7 @@ static void open_screen(struct uae_prefs *p)
 void update_display(struct uae_prefs *p)
 {
   open_screen(p);
+  notice_screen_contents_lost();
     
   SDL_ShowCursor(SDL_DISABLE);
 
@@ -252,6 +254,7 @@ void flush_screen ()
     if (show_inputmode)
     {
         inputmode_redraw();	
+        notice_screen_contents_lost();
     }
 
 
@@ -267,24 +270,25 @@ void flush_screen ()
     }
   }
 
-  unsigned long start = read_processor_time();
-  //if(start < next_synctime && next_synctime - start > time_per_frame - 1000)
-  //  usleep((next_synctime - start) - 1000);
-
-  gl_flip(gfxvidinfo.bufmem, currprefs.gfx_size.width, currprefs.gfx_size.height);
-
+#ifdef PICASSO96
+  /* RTG frame in host format: upload straight from board memory */
+  if (screen_is_picasso && picasso_vidinfo.direct_mem)
+    gl_flip(picasso_vidinfo.direct_mem, picasso_vidinfo.width, picasso_vidinfo.height);
+  else
+#endif
+  {
+    /* The texture holds the previous frame, send only what changed */
+    struct row_range ranges[MAX_ROW_RANGES];
+    int i, n = get_dirty_row_ranges(ranges, currprefs.gfx_size.height, NULL);
+    for (i = 0; i < n; i++)
+      gl_update_rows(gfxvidinfo.bufmem, currprefs.gfx_size.width, currprefs.gfx_size.height, ranges[i].first, ranges[i].count);
+    gl_flip(NULL, currprefs.gfx_size.width, currprefs.gfx_size.height);
+  }
 
   last_synctime = read_processor_time();
-  
-  if(last_synctime - next_synctime > time_per_frame - 1000)
-    adjust_idletime(0);
-  else
-    adjust_idletime(next_synctime - start);
-  
-  if(last_synctime - next_synctime > time_per_frame - 5000)
-    next_synctime = last_synctime + time_per_frame * (1 + currprefs.gfx_framerate);
-  else
-    next_synctime = next_synctime + time_per_frame * (1 + currprefs.gfx_framerate);
+  /* the swap returns at the vsync that shows the frame */
+  frame_pace_vsync(last_synctime);
+  frame_pace_submitted();
 
 	init_row_map();
 
@@ -354,8 +358,10 @@ static int init_colors (void)
 	blue_shift = maskShift(prSDLScreen->format->Bmask);
 	alloc_colors64k (red_bits, green_bits, blue_bits, red_shift, green_shift, blue_shift, 0);
 	notice_new_xcolors();
+#ifndef USE_RGB32
 	for (i = 0; i < 4096; i++)
 		xcolors[i] = xcolors[i] * 0x00010001;
+#endif
 
 	return 1;
 }
@@ -474,18 +480,27 @@ static int save_png(SDL_Surface* surface, char *path)
   int y;
   int x;
 
+#ifdef USE_RGB32
+  unsigned int *p = (unsigned int *)pix;
+#else
   unsigned short *p = (unsigned short *)pix;
+#endif
   for(y = 0; y < sizeY; y++) 
   {
      for(x = 0; x < sizeX; x++) 
      {
+#ifdef USE_RGB32
+       SDL_GetRGB(p[x], surface->format, &b[0], &b[1], &b[2]);
+       b += 3;
+#else
        unsigned short v = p[x];
   
        *b++ = ((v & systemRedMask  ) >> systemRedShift  ) << 3; // R
        *b++ = ((v & systemGreenMask) >> systemGreenShift) << 2; // G 
        *b++ = ((v & systemBlueMask ) >> systemBlueShift ) << 3; // B
+#endif
      }
-     p += surface->pitch / 2;
+     p += surface->pitch / sizeof (*p);
      png_write_row(png_ptr,writeBuffer);
      b = writeBuffer;
   }
@@ -644,14 +659,25 @@ void gfx_set_picasso_modeinfo (uae_u32 w, uae_u32 h, uae_u32 depth, RGBFTYPE rgb
   picasso_vidinfo.selected_rgbformat = rgbfmt;
   picasso_vidinfo.width = w;
   picasso_vidinfo.height = h;
+#ifdef USE_RGB32
+  picasso_vidinfo.depth = DISPLAY_PIXBYTES; // Native depth
+#else
   picasso_vidinfo.depth = depth;
+#endif
   picasso_vidinfo.extra_mem = 1;
 
-  picasso_vidinfo.pixbytes = depth;
+  picasso_vidinfo.pixbytes = picasso_vidinfo.depth;
+  picasso_vidinfo.direct_ok = 1;
+  picasso_vidinfo.direct_mem = NULL;
   if (screen_is_picasso)
   {
   	open_screen(&currprefs);
     picasso_vidinfo.rowbytes	= prSDLScreen->pitch;
+#ifdef USE_RGB32
+    picasso_vidinfo.rgbformat = RGBFB_R8G8B8A8;
+#else
+    picasso_vidinfo.rgbformat = RGBFB_R5G6B5PC;
+#endif
   }
 }
 
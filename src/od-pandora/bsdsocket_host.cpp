@@ -760,6 +760,7 @@ uae_u32 bsdthr_Recv_2 (SB)
 {
   int foo;
   int l, i;
+  jit_unprotect_range ((uae_u8 *)sb->buf, sb->len);
   if (sb->from == 0) {
   	foo = recv (sb->s, sb->buf, sb->len, sb->flags /*| MSG_NOSIGNAL*/);
 	  DEBUG_LOG ("recv2, recv returns %d, errno is %d\n", foo, errno);
@@ -775,6 +776,7 @@ uae_u32 bsdthr_Recv_2 (SB)
 	    put_long (sb->fromlen, l);
   	}
   }
+  jit_unprotect_done ((uae_u8 *)sb->buf, sb->len);
   return foo;
 }
 
@@ -1698,7 +1700,9 @@ void host_closesocketquick (int s)
 
 uae_u32 host_gethostname (uae_u32 name, uae_u32 namelen)
 {
+  jit_unprotect_range (get_real_address (name), namelen);
   uae_u32 r = gethostname ((char *)get_real_address (name), namelen);
+  jit_unprotect_done (get_real_address (name), namelen);
   return r;
 }
 
@@ -83,7 +83,7 @@ class SavestateActionListener : public gcn::ActionListener
         //------------------------------------------
       	if(emulating)
     	  {
-          savestate_initsave(savestate_fname, 2, 0, false);
+          savestate_initsave(savestate_fname, currprefs.pandora_savestate_incremental ? 5 : 2, 0, false);
     			save_state (savestate_fname, "...");
           savestate_state = STATE_DOSAVE; // Just to create the screenshot
           delay_savestate_frame = 1;          
@@ -3,6 +3,8 @@
 
 #include "td-sdl/thread.h"
 #include "options.h"
+#include "memory.h"
+#include "newcpu.h"
 #include "filesys.h"
 #include "zfile.h"
 
@@ -283,7 +285,9 @@ int hdf_read_target (struct hardfiledata *hfd, void *buffer, uae_u64 offset, int
 				ret = fread (hfd->cache, 1, len, hfd->handle->f);
 				memcpy (buffer, hfd->cache, ret);
 			} else if (hfd->handle_valid == HDF_HANDLE_ZFILE) {
+				jit_unprotect_range ((uae_u8*)buffer, len);
 				ret = zfile_fread (buffer, 1, len, hfd->handle->zf);
+				jit_unprotect_done ((uae_u8*)buffer, len);
 			}
 			maxlen = len;
 		} else {
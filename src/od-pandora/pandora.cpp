@@ -298,7 +298,7 @@ void target_fixup_options (struct uae_prefs *p)
   if (p->z3fastmem_start != z3_start_adr)
   	p->z3fastmem_start = z3_start_adr;
 
-	p->picasso96_modeflags = RGBFF_CLUT | RGBFF_R5G6B5 | RGBFF_R8G8B8A8;
+	p->picasso96_modeflags = RGBFF_CLUT | RGBFF_R5G6B5 | RGBFF_R5G6B5PC | RGBFF_R8G8B8A8;
   p->gfx_resolution = p->gfx_size.width > 600 ? 1 : 0;
 }
 
@@ -312,6 +312,12 @@ void target_default_options (struct uae_prefs *p, int type)
   p->pandora_joyConf = 0;
   p->pandora_joyPort = 2;
   p->pandora_tapDelay = 10;
+  p->pandora_savestate_incremental = 0;
+  p->pandora_rewind_interval = 0;
+  p->pandora_rewind_memory = 64;
+  p->pandora_rewind_budget = 500;
+  p->pandora_vsync_margin = 1000;
+  p->pandora_runahead = 0;
   
   p->pandora_customControls = 0;
 #ifdef RASPBERRY
@@ -335,7 +341,7 @@ void target_default_options (struct uae_prefs *p, int type)
   p->pandora_autofireButton1 = GP2X_BUTTON_B;
   p->pandora_jump = -1;
 	
-  p->picasso96_modeflags = RGBFF_CLUT | RGBFF_R5G6B5 | RGBFF_R8G8B8A8;
+  p->picasso96_modeflags = RGBFF_CLUT | RGBFF_R5G6B5 | RGBFF_R5G6B5PC | RGBFF_R8G8B8A8;
 }
 
 
@@ -345,6 +351,12 @@ void target_save_options (struct zfile *f, struct uae_prefs *p)
   cfgfile_write (f, "pandora.joy_conf", "%d", p->pandora_joyConf);
   cfgfile_write (f, "pandora.joy_port", "%d", p->pandora_joyPort);
   cfgfile_write (f, "pandora.tap_delay", "%d", p->pandora_tapDelay);
+  cfgfile_write (f, "pandora.savestate_incremental", "%d", p->pandora_savestate_incremental);
+  cfgfile_write (f, "pandora.rewind_interval", "%d", p->pandora_rewind_interval);
+  cfgfile_write (f, "pandora.rewind_memory", "%d", p->pandora_rewind_memory);
+  cfgfile_write (f, "pandora.rewind_budget", "%d", p->pandora_rewind_budget);
+  cfgfile_write (f, "pandora.vsync_margin", "%d", p->pandora_vsync_margin);
+  cfgfile_write (f, "pandora.runahead", "%d", p->pandora_runahead);
   cfgfile_write (f, "pandora.custom_controls", "%d", p->pandora_customControls);
   cfgfile_write (f, "pandora.custom_dpad", "%d", p->pandora_custom_dpad);
   cfgfile_write (f, "pandora.custom_up", "%d", p->pandora_custom_up);
@@ -377,6 +389,12 @@ int target_parse_option (struct uae_prefs *p, const char *option, const char *va
     || cfgfile_intval (option, value, "joy_conf", &p->pandora_joyConf, 1)
     || cfgfile_intval (option, value, "joy_port", &p->pandora_joyPort, 1)
     || cfgfile_intval (option, value, "tap_delay", &p->pandora_tapDelay, 1)
+    || cfgfile_intval (option, value, "savestate_incremental", &p->pandora_savestate_incremental, 1)
+    || cfgfile_intval (option, value, "rewind_interval", &p->pandora_rewind_interval, 1)
+    || cfgfile_intval (option, value, "rewind_memory", &p->pandora_rewind_memory, 1)
+    || cfgfile_intval (option, value, "rewind_budget", &p->pandora_rewind_budget, 1)
+    || cfgfile_intval (option, value, "vsync_margin", &p->pandora_vsync_margin, 1)
+    || cfgfile_intval (option, value, "runahead", &p->pandora_runahead, 1)
     || cfgfile_intval (option, value, "custom_controls", &p->pandora_customControls, 1)
     || cfgfile_intval (option, value, "custom_dpad", &p->pandora_custom_dpad, 1)
     || cfgfile_intval (option, value, "custom_up", &p->pandora_custom_up, 1)
@@ -864,6 +882,8 @@ void handle_events (void)
   int i, j;
   int iIsHotKey = 0;
 
+  frame_pace_input ();
+
   /* Handle GUI events */
   gui_handle_events ();
 #ifdef PANDORA_SPECIFIC
@@ -5,6 +5,7 @@
 #include "sysdeps.h"
 #include "config.h"
 #include "zfile.h"
+#include "fsdb.h"
 
 
 int my_mkdir (const char*name)
@@ -75,6 +76,58 @@ int my_readdir (struct my_opendir_s *mod, char* name)
 }
 
 
+/* Read a whole directory in one pass, stat()ing each entry relative to
+ * the open directory so the kernel need not resolve the path again.
+ * Returns the number of entries or -1 if the directory can't be opened. */
+int my_readdir_all (const char *name, struct my_dirsnap_entry **entries)
+{
+  DIR *dir;
+  struct dirent *de;
+  struct my_dirsnap_entry *list = NULL;
+  int count = 0, alloc = 0;
+  int fd;
+
+  *entries = NULL;
+  dir = opendir (name);
+  if (dir == NULL)
+    return -1;
+  fd = dirfd (dir);
+  while ((de = readdir (dir)) != NULL) {
+    if (de->d_name[0] == '.' && (de->d_name[1] == 0 || (de->d_name[1] == '.' && de->d_name[2] == 0)))
+      continue;
+    if (count == alloc) {
+      struct my_dirsnap_entry *tmp;
+      alloc = alloc ? alloc * 2 : 64;
+      tmp = xrealloc (struct my_dirsnap_entry, list, alloc);
+      if (!tmp)
+        break;
+      list = tmp;
+    }
+    if (fstatat64 (fd, de->d_name, &list[count].statbuf, 0) == -1
+      && fstatat64 (fd, de->d_name, &list[count].statbuf, AT_SYMLINK_NOFOLLOW) == -1) {
+      /* Still list it, typed from the directory entry.  */
+      memset (&list[count].statbuf, 0, sizeof (list[count].statbuf));
+      list[count].statbuf.st_mode = (de->d_type == DT_DIR ? S_IFDIR : S_IFREG) | 0644;
+    }
+    list[count].name = my_strdup (de->d_name);
+    count++;
+  }
+  closedir (dir);
+  *entries = list;
+  return count;
+}
+
+
+void my_freedir_all (struct my_dirsnap_entry *entries, int count)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+    xfree (entries[i].name);
+  xfree (entries);
+}
+
+
 struct my_openfile_s {
 	void *h;
 };
@@ -83,35 +136,35 @@ struct my_openfile_s {
 void my_close (struct my_openfile_s *mos)
 {
   if(mos)
-    close((int) mos->h);
+    close((int)(intptr_t) mos->h);
   xfree (mos);
 }
 
 
 uae_s64 int my_lseek (struct my_openfile_s *mos, uae_s64 int offset, int pos)
 {
-  return lseek((int) mos->h, offset, pos);
+  return lseek((int)(intptr_t) mos->h, offset, pos);
 }
 
 
 uae_s64 int my_fsize (struct my_openfile_s *mos)
 {
-  uae_s64 pos = lseek((int) mos->h, 0, SEEK_CUR);
-  uae_s64 size = lseek((int) mos->h, 0, SEEK_END);
-  lseek((int) mos->h, pos, SEEK_SET);
+  uae_s64 pos = lseek((int)(intptr_t) mos->h, 0, SEEK_CUR);
+  uae_s64 size = lseek((int)(intptr_t) mos->h, 0, SEEK_END);
+  lseek((int)(intptr_t) mos->h, pos, SEEK_SET);
 	return size;
 }
 
 
 unsigned int my_read (struct my_openfile_s *mos, void *b, unsigned int size)
 {
-  return read((int) mos->h, b, size);
+  return read((int)(intptr_t) mos->h, b, size);
 }
 
 
 unsigned int my_write (struct my_openfile_s *mos, void *b, unsigned int size)
 {
-  return write((int) mos->h, b, size);
+  return write((int)(intptr_t) mos->h, b, size);
 }
 
 
@@ -149,7 +202,7 @@ struct my_openfile_s *my_open (const TCHAR *name, int flags)
 	mos = xmalloc (struct my_openfile_s, 1);
 	if (!mos)
 		return NULL;
-  mos->h = (void *) open(name, flags);
+  mos->h = (void *)(intptr_t) open(name, flags);
 	if (!mos->h) {
 		xfree (mos);
 		mos = NULL;
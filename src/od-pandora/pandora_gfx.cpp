@@ -68,10 +68,6 @@ int mouseMoving = 0;
 int fcounter = 0;
 int doStylusRightClick = 0;
 
-static unsigned long previous_synctime = 0;
-static unsigned long next_synctime = 0;
-
-
 int graphics_setup (void)
 {
 #ifdef PICASSO96
@@ -132,7 +128,7 @@ void RefreshLiveInfo()
 void InitAmigaVidMode(struct uae_prefs *p)
 {
 	/* Initialize structure for Amiga video modes */
-	gfxvidinfo.pixbytes = 2;
+	gfxvidinfo.pixbytes = DISPLAY_PIXBYTES;
 	gfxvidinfo.bufmem = (uae_u8 *)prSDLScreen->pixels;
   gfxvidinfo.outwidth = p->gfx_size.width;
   gfxvidinfo.outheight = p->gfx_size.height;
@@ -217,18 +213,18 @@ static void open_screen(struct uae_prefs *p)
     if(prSDLScreen == NULL || prSDLScreen->w != p->gfx_size.width || prSDLScreen->h != p->gfx_size.height)
     {
 #if defined(PANDORA) && !defined(WIN32)
-  	  prSDLScreen = SDL_SetVideoMode(p->gfx_size.width, p->gfx_size.height, 16, SDL_HWSURFACE|SDL_FULLSCREEN|SDL_DOUBLEBUF);
+  	  prSDLScreen = SDL_SetVideoMode(p->gfx_size.width, p->gfx_size.height, DISPLAY_BPP, SDL_HWSURFACE|SDL_FULLSCREEN|SDL_DOUBLEBUF);
 #elif defined(PANDORA) && defined(WIN32)
-  	  prSDLScreen = SDL_SetVideoMode(p->gfx_size.width, p->gfx_size.height, 16, SDL_SWSURFACE|SDL_DOUBLEBUF);
+  	  prSDLScreen = SDL_SetVideoMode(p->gfx_size.width, p->gfx_size.height, DISPLAY_BPP, SDL_SWSURFACE|SDL_DOUBLEBUF);
 #else
-  	  prSDLScreen = SDL_SetVideoMode(p->gfx_size.width, p->gfx_size.height, 16, SDL_HWSURFACE|SDL_FULLSCREEN);
+  	  prSDLScreen = SDL_SetVideoMode(p->gfx_size.width, p->gfx_size.height, DISPLAY_BPP, SDL_HWSURFACE|SDL_FULLSCREEN);
 #endif
     }
   }
   else
   {
 #ifdef PICASSO96
-  	prSDLScreen = SDL_SetVideoMode(picasso_vidinfo.width, picasso_vidinfo.height, 16, SDL_HWSURFACE|SDL_FULLSCREEN|SDL_DOUBLEBUF);
+  	prSDLScreen = SDL_SetVideoMode(picasso_vidinfo.width, picasso_vidinfo.height, DISPLAY_BPP, SDL_HWSURFACE|SDL_FULLSCREEN|SDL_DOUBLEBUF);
 #endif
   }
   if(prSDLScreen != NULL)
@@ -244,6 +240,7 @@ static void open_screen(struct uae_prefs *p)
 void update_display(struct uae_prefs *p)
 {
   open_screen(p);
+  notice_screen_contents_lost();
     
   SDL_ShowCursor(SDL_DISABLE);
 
@@ -300,8 +297,10 @@ void unlockscr (void)
 
 void flush_screen ()
 {
-	if (show_inputmode)
+	if (show_inputmode) {
 		inputmode_redraw();	
+		notice_screen_contents_lost();
+	}
 
 	if (savestate_state == STATE_DOSAVE)
 	{
@@ -315,29 +314,30 @@ void flush_screen ()
     }
   }
 
-  unsigned long start = read_processor_time();
-  if(start < next_synctime && next_synctime - start > time_per_frame - 1000)
-    usleep((next_synctime - start) - 750);
-
 #ifdef WITH_LOGGING
   RefreshLiveInfo();
 #endif
   
-  SDL_Flip(prSDLScreen);
+  if (prSDLScreen->flags & SDL_HWSURFACE) {
+    SDL_Flip(prSDLScreen);
+  } else {
+    /* Software surface: only copy the rows that changed */
+    struct row_range ranges[MAX_ROW_RANGES];
+    SDL_Rect rects[MAX_ROW_RANGES];
+    int i, n = get_dirty_row_ranges(ranges, prSDLScreen->h, NULL);
+    for (i = 0; i < n; i++) {
+      rects[i].x = 0;
+      rects[i].y = ranges[i].first;
+      rects[i].w = prSDLScreen->w;
+      rects[i].h = ranges[i].count;
+    }
+    SDL_UpdateRects(prSDLScreen, n, rects);
+  }
   last_synctime = read_processor_time();
+  frame_pace_submitted();
 
   if(!screen_is_picasso)
   	gfxvidinfo.bufmem = (uae_u8 *)prSDLScreen->pixels;
-  
-  if(last_synctime - next_synctime > time_per_frame - 1000)
-    adjust_idletime(0);
-  else
-    adjust_idletime(next_synctime - start);
-  
-  if(last_synctime - next_synctime > time_per_frame - 5000)
-    next_synctime = last_synctime + time_per_frame * (1 + currprefs.gfx_framerate);
-  else
-    next_synctime = next_synctime + time_per_frame * (1 + currprefs.gfx_framerate);
 
 	init_row_map();
 
@@ -441,8 +441,10 @@ static int init_colors (void)
 	blue_shift = maskShift(prSDLScreen->format->Bmask);
 	alloc_colors64k (red_bits, green_bits, blue_bits, red_shift, green_shift, blue_shift, 0);
 	notice_new_xcolors();
+#ifndef USE_RGB32
 	for (i = 0; i < 4096; i++)
 		xcolors[i] = xcolors[i] * 0x00010001;
+#endif
 
 	return 1;
 }
@@ -558,18 +560,27 @@ static int save_png(SDL_Surface* surface, char *path)
   int y;
   int x;
 
+#ifdef USE_RGB32
+  unsigned int *p = (unsigned int *)pix;
+#else
   unsigned short *p = (unsigned short *)pix;
+#endif
   for(y = 0; y < sizeY; y++) 
   {
      for(x = 0; x < sizeX; x++) 
      {
+#ifdef USE_RGB32
+       SDL_GetRGB(p[x], surface->format, &b[0], &b[1], &b[2]);
+       b += 3;
+#else
        unsigned short v = p[x];
   
        *b++ = ((v & systemRedMask  ) >> systemRedShift  ) << 3; // R
        *b++ = ((v & systemGreenMask) >> systemGreenShift) << 2; // G 
        *b++ = ((v & systemBlueMask ) >> systemBlueShift ) << 3; // B
+#endif
      }
-     p += surface->pitch / 2;
+     p += surface->pitch / sizeof (*p);
      png_write_row(png_ptr,writeBuffer);
      b = writeBuffer;
   }
@@ -711,7 +722,7 @@ void picasso_InitResolutions (void)
       int pixelFormat = 1 << rgbFormat;
   	  pixelFormat |= RGBFF_CHUNKY;
       
-  	  if (SDL_VideoModeOK (x_size_table[i], y_size_table[i], 16, SDL_SWSURFACE))
+  	  if (SDL_VideoModeOK (x_size_table[i], y_size_table[i], DISPLAY_BPP, SDL_SWSURFACE))
   	  {
   	    DisplayModes[count].res.width = x_size_table[i];
   	    DisplayModes[count].res.height = y_size_table[i];
@@ -755,15 +766,19 @@ void gfx_set_picasso_modeinfo (uae_u32 w, uae_u32 h, uae_u32 depth, RGBFTYPE rgb
   picasso_vidinfo.selected_rgbformat = rgbfmt;
   picasso_vidinfo.width = w;
   picasso_vidinfo.height = h;
-  picasso_vidinfo.depth = 2; // Native depth
+  picasso_vidinfo.depth = DISPLAY_PIXBYTES; // Native depth
   picasso_vidinfo.extra_mem = 1;
 
-  picasso_vidinfo.pixbytes = 2; // Native bytes
+  picasso_vidinfo.pixbytes = DISPLAY_PIXBYTES; // Native bytes
   if (screen_is_picasso)
   {
   	open_screen(&currprefs);
     picasso_vidinfo.rowbytes	= prSDLScreen->pitch;
-    picasso_vidinfo.rgbformat = RGBFB_R5G6B5;
+#ifdef USE_RGB32
+    picasso_vidinfo.rgbformat = prSDLScreen->format->Rmask == 0x000000ff ? RGBFB_R8G8B8A8 : RGBFB_B8G8R8A8;
+#else
+    picasso_vidinfo.rgbformat = RGBFB_R5G6B5PC;
+#endif
   }
 }
 
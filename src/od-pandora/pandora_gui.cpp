@@ -708,6 +708,12 @@ void gui_handle_events (void)
   			fclose(f);
   			savestate_state = STATE_DORESTORE;
   		}
+  	}
+	  else if(keystate[SDLK_r])
+  	{
+  		keystate[SDLK_r]=0;
+  		if(currprefs.pandora_rewind_interval)
+  			savestate_state = STATE_DOREWIND;
   	}
 	}
 
@@ -8,6 +8,10 @@
 #include "memory.h"
 #include "newcpu.h"
 #include "custom.h"
+#ifdef JIT
+#include "jit/comptbl.h"
+#include "jit/compemu.h"
+#endif
 #include <sys/mman.h>
 #include <SDL.h>
 
@@ -24,11 +28,32 @@ int z3_start_adr = 0;
 int rtg_start_adr = 0;
 
 
+/* The 64-bit JITs encode natmem_offset as a sign extended 32 bit value,
+   so there the memory has to come from the low 2 GB */
+static uae_u8 *natmem_alloc(uae_u32 size)
+{
+#if defined(JIT) && SIZEOF_VOID_P == 8
+  return (uae_u8*) jit_mmap_low(size, PROT_READ | PROT_WRITE);
+#else
+  return (uae_u8*) valloc(size);
+#endif
+}
+
+static void natmem_free(uae_u8 *p, uae_u32 size)
+{
+#if defined(JIT) && SIZEOF_VOID_P == 8
+  munmap(p, size);
+#else
+  free(p);
+#endif
+}
+
+
 void free_AmigaMem(void)
 {
   if(natmem_offset != 0)
   {
-    free(natmem_offset);
+    natmem_free(natmem_offset, natmem_size);
     natmem_offset = 0;
   }
   if(additional_mem != MAP_FAILED)
@@ -50,7 +75,7 @@ void alloc_AmigaMem(void)
   // First attempt: allocate 16 MB for all memory in 24-bit area 
   // and additional mem for Z3 and RTG at correct offset
   natmem_size = 16 * 1024 * 1024;
-  natmem_offset = (uae_u8*)valloc (natmem_size);
+  natmem_offset = natmem_alloc(natmem_size);
   max_z3fastmem = ADDITIONAL_MEMSIZE - (16 * 1024 * 1024);
 	if (!natmem_offset) {
 		write_log("Can't allocate 16M of virtual address space!?\n");
@@ -66,11 +91,11 @@ void alloc_AmigaMem(void)
     write_log("Allocated 16 MB for 24-bit area and %d MB for Z3 and RTG\n", ADDITIONAL_MEMSIZE / (1024 * 1024));
     return;
   }
-  free(natmem_offset);
+  natmem_free(natmem_offset, natmem_size);
   
   // Second attempt: allocate huge memory block for entire area
   natmem_size = ADDITIONAL_MEMSIZE + 256 * 1024 * 1024;
-  natmem_offset = (uae_u8*)valloc (natmem_size);
+  natmem_offset = natmem_alloc(natmem_size);
   if(natmem_offset)
   {
     // Allocation successful
@@ -95,11 +120,11 @@ void alloc_AmigaMem(void)
 		natmem_size = 16 * 1024 * 1024;
 
 	write_log("Total physical RAM %lluM. Attempting to reserve: %uM.\n", total >> 20, natmem_size >> 20);
-	natmem_offset = (uae_u8*)valloc (natmem_size);
+	natmem_offset = natmem_alloc(natmem_size);
 
 	if (!natmem_offset) {
 		for (;;) {
-			natmem_offset = (uae_u8*)valloc (natmem_size);
+			natmem_offset = natmem_alloc(natmem_size);
 			if (natmem_offset)
 				break;
 			natmem_size -= 16 * 1024 * 1024;
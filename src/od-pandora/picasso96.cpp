@@ -57,6 +57,8 @@
 #include "native2amiga.h"
 
 #include "picasso96.h"
+#include "od-pandora/inputmode.h"
+#include "p2c.h"
 #include <SDL.h>
 
 #define NOBLITTER 0
@@ -166,7 +168,6 @@ static void checkrtglibrary(void)
   }
 }
 
-static uae_u32 p2ctab[256][2];
 static int set_gc_called = 0, init_picasso_screen_called = 0;
 //fastscreen
 static uaecptr oldscr = 0;
@@ -456,53 +457,53 @@ static void AmigaListAddTail (uaecptr l, uaecptr n)
   put_long (l + 8, n); // l->lh_TailPred = n;
 }
 
+/* 16 byte vectors for the blit loops; GCC keeps them in NEON registers.
+ * Byte alignment, so rows at any address load directly. */
+typedef uae_u32 p96_vec __attribute__ ((vector_size (16), aligned (1)));
+typedef uae_u16 p96_vec16 __attribute__ ((vector_size (16), aligned (1)));
+typedef uae_u8 p96_vec8 __attribute__ ((vector_size (8), aligned (1)));
+typedef uae_u8 p96_vec8x16 __attribute__ ((vector_size (16), aligned (1)));
+typedef uae_u32 p96_long __attribute__ ((aligned (1)));
+
 /*
 * Fill a rectangle in the screen.
  */
 static void do_fillrect_frame_buffer (struct RenderInfo *ri, int X, int Y,
 				    int Width, int Height, uae_u32 Pen, int Bpp)
 {
-  int cols;
+  int i;
   uae_u8 *dst;
   int lines;
   int bpr = ri->BytesPerRow;
+  int bytes = Width * Bpp;
+  union {
+    p96_vec v[3];
+    uae_u8 b[48];
+  } pat;
 
   dst = ri->Memory + X * Bpp + Y * ri->BytesPerRow;
   endianswap (&Pen, Bpp);
-  switch (Bpp)
-  {
-	case 1:
+  if (Bpp == 1) {
     for (lines = 0; lines < Height; lines++, dst += bpr) {
   		memset (dst, Pen, Width);
     }
-  	break;
-	case 2:
-    Pen |= Pen << 16;
-    for (lines = 0; lines < Height; lines++, dst += bpr) {
-  		uae_u32 *p = (uae_u32*)dst;
-  		for (cols = 0; cols < Width / 2; cols++)
-		    *p++ = Pen;
-  		if (Width & 1)
-		    ((uae_u16*)p)[0] = Pen;
-    }
-    break;
-	case 3:
-    for (lines = 0; lines < Height; lines++, dst += bpr) {
-  		uae_u8 *p = (uae_u8*)dst;
-  		for (cols = 0; cols < Width; cols++) {
-		    *p++ = Pen >> 0;
-		    *p++ = Pen >> 8;
-		    *p++ = Pen >> 16;
-  		}
-    }
-  	break;
-	case 4:
-    for (lines = 0; lines < Height; lines++, dst += bpr) {
-  		uae_u32 *p = (uae_u32*)dst;
-  		for (cols = 0; cols < Width; cols++)
-		    *p++ = Pen;
+    return;
+  }
+
+  /* 48 bytes hold a whole number of 2, 3 and 4 byte pixels */
+  for (i = 0; i < 48; i++)
+    pat.b[i] = Pen >> (8 * (i % Bpp));
+  for (lines = 0; lines < Height; lines++, dst += bpr) {
+    p96_vec *p = (p96_vec*)dst;
+    int n = bytes;
+    while (n >= 48) {
+      p[0] = pat.v[0];
+      p[1] = pat.v[1];
+      p[2] = pat.v[2];
+      p += 3;
+      n -= 48;
     }
-  	break;
+    memcpy (p, pat.b, n);
   }
 }
 
@@ -706,211 +707,53 @@ void picasso_refresh (void)
   }
 }
 
-#define BLT_SIZE 4
-#define BLT_MULT 1
-#define BLT_NAME BLIT_FALSE_32
-#define BLT_FUNC(s,d) *d = 0
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOR_32
-#define BLT_FUNC(s,d) *d = ~(*s | * d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_ONLYDST_32
-#define BLT_FUNC(s,d) *d = (*d) & ~(*s)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTSRC_32
-#define BLT_FUNC(s,d) *d = ~(*s)
-#include "p96_blit.cpp" 
-#define BLT_NAME BLIT_ONLYSRC_32
-#define BLT_FUNC(s,d) *d = (*s) & ~(*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTDST_32
-#define BLT_FUNC(s,d) *d = ~(*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_EOR_32
-#define BLT_FUNC(s,d) *d = (*s) ^ (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NAND_32
-#define BLT_FUNC(s,d) *d = ~((*s) & (*d))
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_AND_32
-#define BLT_FUNC(s,d) *d = (*s) & (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NEOR_32
-#define BLT_FUNC(s,d) *d = ~((*s) ^ (*d))
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYSRC_32
-#define BLT_FUNC(s,d) *d = ~(*s) | (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYDST_32
-#define BLT_FUNC(s,d) *d = ~(*d) | (*s)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_OR_32
-#define BLT_FUNC(s,d) *d = (*s) | (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_TRUE_32
-#define BLT_FUNC(s,d) *d = 0xffffffff
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_SWAP_32
-#define BLT_FUNC(s,d) tmp = *d ; *d = *s; *s = tmp;
-#define BLT_TEMP
-#include "p96_blit.cpp"
-#undef BLT_SIZE
-#undef BLT_MULT
-
-#define BLT_SIZE 3
-#define BLT_MULT 1
-#define BLT_NAME BLIT_FALSE_24
-#define BLT_FUNC(s,d) *d = 0
+#define BLT_NAME BLIT_FALSE_ANY
+#define BLT_FUNC(s,d) *d = (*d) & 0
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOR_24
+#define BLT_NAME BLIT_NOR_ANY
 #define BLT_FUNC(s,d) *d = ~(*s | * d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_ONLYDST_24
+#define BLT_NAME BLIT_ONLYDST_ANY
 #define BLT_FUNC(s,d) *d = (*d) & ~(*s)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTSRC_24
+#define BLT_NAME BLIT_NOTSRC_ANY
 #define BLT_FUNC(s,d) *d = ~(*s)
-#include "p96_blit.cpp" 
-#define BLT_NAME BLIT_ONLYSRC_24
-#define BLT_FUNC(s,d) *d = (*s) & ~(*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTDST_24
-#define BLT_FUNC(s,d) *d = ~(*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_EOR_24
-#define BLT_FUNC(s,d) *d = (*s) ^ (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NAND_24
-#define BLT_FUNC(s,d) *d = ~((*s) & (*d))
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_AND_24
-#define BLT_FUNC(s,d) *d = (*s) & (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NEOR_24
-#define BLT_FUNC(s,d) *d = ~((*s) ^ (*d))
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYSRC_24
-#define BLT_FUNC(s,d) *d = ~(*s) | (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYDST_24
-#define BLT_FUNC(s,d) *d = ~(*d) | (*s)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_OR_24
-#define BLT_FUNC(s,d) *d = (*s) | (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_TRUE_24
-#define BLT_FUNC(s,d) *d = 0xffffffff
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_SWAP_24
-#define BLT_FUNC(s,d) tmp = *d ; *d = *s; *s = tmp;
-#define BLT_TEMP
-#include "p96_blit.cpp"
-#undef BLT_SIZE
-#undef BLT_MULT
-
-#define BLT_SIZE 2
-#define BLT_MULT 2
-#define BLT_NAME BLIT_FALSE_16
-#define BLT_FUNC(s,d) *d = 0
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOR_16
-#define BLT_FUNC(s,d) *d = ~(*s | * d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_ONLYDST_16
-#define BLT_FUNC(s,d) *d = (*d) & ~(*s)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTSRC_16
-#define BLT_FUNC(s,d) *d = ~(*s)
-#include "p96_blit.cpp" 
-#define BLT_NAME BLIT_ONLYSRC_16
-#define BLT_FUNC(s,d) *d = (*s) & ~(*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTDST_16
-#define BLT_FUNC(s,d) *d = ~(*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_EOR_16
-#define BLT_FUNC(s,d) *d = (*s) ^ (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NAND_16
-#define BLT_FUNC(s,d) *d = ~((*s) & (*d))
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_AND_16
-#define BLT_FUNC(s,d) *d = (*s) & (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NEOR_16
-#define BLT_FUNC(s,d) *d = ~((*s) ^ (*d))
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYSRC_16
-#define BLT_FUNC(s,d) *d = ~(*s) | (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYDST_16
-#define BLT_FUNC(s,d) *d = ~(*d) | (*s)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_OR_16
-#define BLT_FUNC(s,d) *d = (*s) | (*d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_TRUE_16
-#define BLT_FUNC(s,d) *d = 0xffffffff
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_SWAP_16
-#define BLT_FUNC(s,d) tmp = *d ; *d = *s; *s = tmp;
-#define BLT_TEMP
-#include "p96_blit.cpp"
-#undef BLT_SIZE
-#undef BLT_MULT
-
-#define BLT_SIZE 1
-#define BLT_MULT 4
-#define BLT_NAME BLIT_FALSE_8
-#define BLT_FUNC(s,d) *d = 0
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOR_8
-#define BLT_FUNC(s,d) *d = ~(*s | * d)
-#include "p96_blit.cpp"
-#define BLT_NAME BLIT_ONLYDST_8
-#define BLT_FUNC(s,d) *d = (*d) & ~(*s)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTSRC_8
-#define BLT_FUNC(s,d) *d = ~(*s)
-#include "p96_blit.cpp" 
-#define BLT_NAME BLIT_ONLYSRC_8
+#define BLT_NAME BLIT_ONLYSRC_ANY
 #define BLT_FUNC(s,d) *d = (*s) & ~(*d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTDST_8
+#define BLT_NAME BLIT_NOTDST_ANY
 #define BLT_FUNC(s,d) *d = ~(*d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_EOR_8
+#define BLT_NAME BLIT_EOR_ANY
 #define BLT_FUNC(s,d) *d = (*s) ^ (*d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NAND_8
+#define BLT_NAME BLIT_NAND_ANY
 #define BLT_FUNC(s,d) *d = ~((*s) & (*d))
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_AND_8
+#define BLT_NAME BLIT_AND_ANY
 #define BLT_FUNC(s,d) *d = (*s) & (*d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NEOR_8
+#define BLT_NAME BLIT_NEOR_ANY
 #define BLT_FUNC(s,d) *d = ~((*s) ^ (*d))
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYSRC_8
+#define BLT_NAME BLIT_NOTONLYSRC_ANY
 #define BLT_FUNC(s,d) *d = ~(*s) | (*d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_NOTONLYDST_8
+#define BLT_NAME BLIT_NOTONLYDST_ANY
 #define BLT_FUNC(s,d) *d = ~(*d) | (*s)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_OR_8
+#define BLT_NAME BLIT_OR_ANY
 #define BLT_FUNC(s,d) *d = (*s) | (*d)
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_TRUE_8
-#define BLT_FUNC(s,d) *d = 0xffffffff
+#define BLT_NAME BLIT_TRUE_ANY
+#define BLT_FUNC(s,d) *d = (*d) | 0xffffffff
 #include "p96_blit.cpp"
-#define BLT_NAME BLIT_SWAP_8
-#define BLT_FUNC(s,d) tmp = *d ; *d = *s; *s = tmp;
-#define BLT_TEMP
+#define BLT_NAME BLIT_SWAP_ANY
+#define BLT_FUNC(s,d) { __typeof__ (*d) tmp = *d; *d = *s; *s = tmp; }
 #include "p96_blit.cpp"
-#undef BLT_SIZE
-#undef BLT_MULT
 
-#define PARMS width, height, src, dst, ri->BytesPerRow, dstri->BytesPerRow
+#define PARMS total_width, height, src, dst, ri->BytesPerRow, dstri->BytesPerRow
 
 /*
 * Functions to perform an action on the frame-buffer
@@ -953,93 +796,27 @@ static int do_blitrect_frame_buffer (struct RenderInfo *ri, struct
 	    }
 	    return 1;
 
-  	} else if (Bpp == 4) {
+  	} else {
 
-      /* 32-bit optimized */
+      /* raster ops are bitwise, the pixel size only sets the row length */
       switch (opcode)
       {
-      case BLIT_FALSE: BLIT_FALSE_32 (PARMS); break;
-      case BLIT_NOR: BLIT_NOR_32 (PARMS); break;
-      case BLIT_ONLYDST: BLIT_ONLYDST_32 (PARMS); break;
-      case BLIT_NOTSRC: BLIT_NOTSRC_32 (PARMS); break;
-      case BLIT_ONLYSRC: BLIT_ONLYSRC_32 (PARMS); break;
-      case BLIT_NOTDST: BLIT_NOTDST_32 (PARMS); break;
-      case BLIT_EOR: BLIT_EOR_32 (PARMS); break;
-      case BLIT_NAND: BLIT_NAND_32 (PARMS); break;
-      case BLIT_AND: BLIT_AND_32 (PARMS); break;
-      case BLIT_NEOR: BLIT_NEOR_32 (PARMS); break;
-      case BLIT_NOTONLYSRC: BLIT_NOTONLYSRC_32 (PARMS); break;
-      case BLIT_NOTONLYDST: BLIT_NOTONLYDST_32 (PARMS); break;
-      case BLIT_OR: BLIT_OR_32 (PARMS); break;
-      case BLIT_TRUE: BLIT_TRUE_32 (PARMS); break;
-			case BLIT_SWAP: BLIT_SWAP_32 (PARMS); break;
-	    } 
-  	} else if (Bpp == 3) {
-
-	    /* 24-bit (not very) optimized */
-	    switch (opcode)
-	    {
-      case BLIT_FALSE: BLIT_FALSE_24 (PARMS); break;
-      case BLIT_NOR: BLIT_NOR_24 (PARMS); break;
-      case BLIT_ONLYDST: BLIT_ONLYDST_24 (PARMS); break;
-      case BLIT_NOTSRC: BLIT_NOTSRC_24 (PARMS); break;
-      case BLIT_ONLYSRC: BLIT_ONLYSRC_24 (PARMS); break;
-      case BLIT_NOTDST: BLIT_NOTDST_24 (PARMS); break;
-      case BLIT_EOR: BLIT_EOR_24 (PARMS); break;
-      case BLIT_NAND: BLIT_NAND_24 (PARMS); break;
-      case BLIT_AND: BLIT_AND_24 (PARMS); break;
-      case BLIT_NEOR: BLIT_NEOR_24 (PARMS); break;
-      case BLIT_NOTONLYSRC: BLIT_NOTONLYSRC_24 (PARMS); break;
-      case BLIT_NOTONLYDST: BLIT_NOTONLYDST_24 (PARMS); break;
-      case BLIT_OR: BLIT_OR_24 (PARMS); break;
-      case BLIT_TRUE: BLIT_TRUE_24 (PARMS); break;
-			case BLIT_SWAP: BLIT_SWAP_24 (PARMS); break;
-	    }
-	
-  	} else if (Bpp == 2) {
-
-	    /* 16-bit optimized */
-	    switch (opcode)
-	    {
-      case BLIT_FALSE: BLIT_FALSE_16 (PARMS); break;
-      case BLIT_NOR: BLIT_NOR_16 (PARMS); break;
-      case BLIT_ONLYDST: BLIT_ONLYDST_16 (PARMS); break;
-      case BLIT_NOTSRC: BLIT_NOTSRC_16 (PARMS); break;
-      case BLIT_ONLYSRC: BLIT_ONLYSRC_16 (PARMS); break;
-      case BLIT_NOTDST: BLIT_NOTDST_16 (PARMS); break;
-      case BLIT_EOR: BLIT_EOR_16 (PARMS); break;
-      case BLIT_NAND: BLIT_NAND_16 (PARMS); break;
-      case BLIT_AND: BLIT_AND_16 (PARMS); break;
-      case BLIT_NEOR: BLIT_NEOR_16 (PARMS); break;
-      case BLIT_NOTONLYSRC: BLIT_NOTONLYSRC_16 (PARMS); break;
-      case BLIT_NOTONLYDST: BLIT_NOTONLYDST_16 (PARMS); break;
-      case BLIT_OR: BLIT_OR_16 (PARMS); break;
-      case BLIT_TRUE: BLIT_TRUE_16 (PARMS); break;
-			case BLIT_SWAP: BLIT_SWAP_16 (PARMS); break;
-	    }
-
-  	} else if (Bpp == 1) {
-
-	    /* 8-bit optimized */
-	    switch (opcode)
-	    {
-      case BLIT_FALSE: BLIT_FALSE_8 (PARMS); break;
-      case BLIT_NOR: BLIT_NOR_8 (PARMS); break;
-      case BLIT_ONLYDST: BLIT_ONLYDST_8 (PARMS); break;
-      case BLIT_NOTSRC: BLIT_NOTSRC_8 (PARMS); break;
-      case BLIT_ONLYSRC: BLIT_ONLYSRC_8 (PARMS); break;
-      case BLIT_NOTDST: BLIT_NOTDST_8 (PARMS); break;
-      case BLIT_EOR: BLIT_EOR_8 (PARMS); break;
-      case BLIT_NAND: BLIT_NAND_8 (PARMS); break;
-      case BLIT_AND: BLIT_AND_8 (PARMS); break;
-      case BLIT_NEOR: BLIT_NEOR_8 (PARMS); break;
-      case BLIT_NOTONLYSRC: BLIT_NOTONLYSRC_8 (PARMS); break;
-      case BLIT_NOTONLYDST: BLIT_NOTONLYDST_8 (PARMS); break;
-      case BLIT_OR: BLIT_OR_8 (PARMS); break;
-      case BLIT_TRUE: BLIT_TRUE_8 (PARMS); break;
-			case BLIT_SWAP: BLIT_SWAP_8 (PARMS); break;
+      case BLIT_FALSE: BLIT_FALSE_ANY (PARMS); break;
+      case BLIT_NOR: BLIT_NOR_ANY (PARMS); break;
+      case BLIT_ONLYDST: BLIT_ONLYDST_ANY (PARMS); break;
+      case BLIT_NOTSRC: BLIT_NOTSRC_ANY (PARMS); break;
+      case BLIT_ONLYSRC: BLIT_ONLYSRC_ANY (PARMS); break;
+      case BLIT_NOTDST: BLIT_NOTDST_ANY (PARMS); break;
+      case BLIT_EOR: BLIT_EOR_ANY (PARMS); break;
+      case BLIT_NAND: BLIT_NAND_ANY (PARMS); break;
+      case BLIT_AND: BLIT_AND_ANY (PARMS); break;
+      case BLIT_NEOR: BLIT_NEOR_ANY (PARMS); break;
+      case BLIT_NOTONLYSRC: BLIT_NOTONLYSRC_ANY (PARMS); break;
+      case BLIT_NOTONLYDST: BLIT_NOTONLYDST_ANY (PARMS); break;
+      case BLIT_OR: BLIT_OR_ANY (PARMS); break;
+      case BLIT_TRUE: BLIT_TRUE_ANY (PARMS); break;
+      case BLIT_SWAP: BLIT_SWAP_ANY (PARMS); break;
 	    }
-
   	}
   	return 1;
   }
@@ -1852,17 +1629,24 @@ static uae_u32 REGPARAM2 picasso_SetPanning (TrapContext *ctx)
 
 static void do_xor8 (uae_u8 *p, int w, uae_u32 v)
 {
+  p96_vec vv = { v, v, v, v };
+
   while (ALIGN_POINTER_TO32 (p) != 3 && w) {
   	*p ^= v;
   	p++;
   	w--;
   }
-  while (w >= 2 * 4) {
-  	*((uae_u32*)p) ^= v;
-  	p += 4;
+  while (w >= 2 * 16) {
+  	*((p96_vec*)p) ^= vv;
+  	p += 16;
+  	*((p96_vec*)p) ^= vv;
+  	p += 16;
+  	w -= 2 * 16;
+  }
+  while (w >= 4) {
   	*((uae_u32*)p) ^= v;
   	p += 4;
-  	w -= 2 * 4;
+  	w -= 4;
   }
   while (w) {
   	*p ^= v;
@@ -2195,6 +1979,96 @@ STATIC_INLINE void PixelWrite (uae_u8 *mem, int bits, uae_u32 fgpen, int Bpp, ua
   }
 }
 
+/* Expand the 8 bits of byte (MSB first) into 8 pixels with vector selects
+ * instead of a test per pixel. 24 bit pixels are done byte-wise, three
+ * lanes per pixel.
+ * NOTE: fgpen and bgpen MUST be in host byte order */
+static void ExpandByte (uae_u8 *mem, unsigned int byte, int mode, uae_u32 fgpen, uae_u32 bgpen, int Bpp, uae_u8 mask)
+{
+  switch (Bpp)
+  {
+    case 1:
+    {
+      static const p96_vec8 bit = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+      p96_vec8 *d = (p96_vec8 *)mem;
+      p96_vec8 m = (p96_vec8)((bit & (uae_u8)byte) != 0);
+      uae_u8 fg = fgpen, bg = bgpen;
+      if (mode == COMP)
+        *d ^= m & mask;
+      else if (mode == JAM1)
+        *d = (*d & ~(m & mask)) | (m & mask & fg);
+      else
+        *d = (*d & (uae_u8)~mask) | (((m & fg) | (~m & bg)) & mask);
+      break;
+    }
+    case 2:
+    {
+      static const p96_vec16 bit = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+      p96_vec16 *d = (p96_vec16 *)mem;
+      p96_vec16 m = (p96_vec16)((bit & (uae_u16)byte) != 0);
+      uae_u16 fg = fgpen, bg = bgpen;
+      if (mode == COMP)
+        *d ^= m;
+      else if (mode == JAM1)
+        *d = (*d & ~m) | (m & fg);
+      else
+        *d = (m & fg) | (~m & bg);
+      break;
+    }
+    case 3:
+    {
+      /* 24 bytes: pixels 0-5 and the first byte of 6 in a 16 byte vector, the rest in 8 */
+      static const p96_vec8x16 bit = {
+        0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x04 };
+      static const p96_vec8 bit2 = { 0x04, 0x04, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01 };
+      /* repeat the 3 pen bytes with one shuffle each */
+      static const p96_vec8x16 rep = { 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0 };
+      static const p96_vec8x16 rep2 = { 1, 2, 0, 1, 2, 0, 1, 2, 1, 2, 0, 1, 2, 0, 1, 2 };
+      p96_vec fv = { fgpen, fgpen, fgpen, fgpen };
+      p96_vec bv = { bgpen, bgpen, bgpen, bgpen };
+      p96_vec8x16 fg = __builtin_shuffle ((p96_vec8x16)fv, rep);
+      p96_vec8x16 bg = __builtin_shuffle ((p96_vec8x16)bv, rep);
+      union {
+        p96_vec8x16 v;
+        p96_vec8 h[2];
+      } fg2, bg2;
+      fg2.v = __builtin_shuffle ((p96_vec8x16)fv, rep2);
+      bg2.v = __builtin_shuffle ((p96_vec8x16)bv, rep2);
+      p96_vec8x16 *d = (p96_vec8x16 *)mem;
+      p96_vec8 *d2 = (p96_vec8 *)(mem + 16);
+      p96_vec8x16 m = (p96_vec8x16)((bit & (uae_u8)byte) != 0);
+      p96_vec8 m2 = (p96_vec8)((bit2 & (uae_u8)byte) != 0);
+      if (mode == COMP) {
+        *d ^= m;
+        *d2 ^= m2;
+      } else if (mode == JAM1) {
+        *d = (*d & ~m) | (m & fg);
+        *d2 = (*d2 & ~m2) | (m2 & fg2.h[0]);
+      } else {
+        *d = (m & fg) | (~m & bg);
+        *d2 = (m2 & fg2.h[0]) | (~m2 & bg2.h[0]);
+      }
+      break;
+    }
+    case 4:
+    {
+      static const p96_vec bit[2] = { { 0x80, 0x40, 0x20, 0x10 }, { 0x08, 0x04, 0x02, 0x01 } };
+      p96_vec *d = (p96_vec *)mem;
+      int i;
+      for (i = 0; i < 2; i++) {
+        p96_vec m = (p96_vec)((bit[i] & byte) != 0);
+        if (mode == COMP)
+          d[i] ^= m;
+        else if (mode == JAM1)
+          d[i] = (d[i] & ~m) | (m & fgpen);
+        else
+          d[i] = (m & fgpen) | (~m & bgpen);
+      }
+      break;
+    }
+  }
+}
+
 /*
  * BlitPattern:
  *
@@ -2289,6 +2163,14 @@ static uae_u32 REGPARAM2 picasso_BlitPattern (TrapContext *ctx)
   		    if (max > 16)
       			max = 16;
 
+  		    if (max == 16) {
+      			if (inversion && pattern.DrawMode != COMP)
+    			    data = ~data;
+      			ExpandByte (uae_mem2, (data >> 8) & 0xff, pattern.DrawMode, fgpen, bgpen, Bpp, Mask);
+      			ExpandByte (uae_mem2 + Bpp * 8, data & 0xff, pattern.DrawMode, fgpen, bgpen, Bpp, Mask);
+      			continue;
+  		    }
+
   		    switch (pattern.DrawMode)
   		    {
     			case JAM1:
@@ -2335,8 +2217,10 @@ static uae_u32 REGPARAM2 picasso_BlitPattern (TrapContext *ctx)
           					break;
         					case 3:
           					{
-        					    uae_u32 *addr = (uae_u32 *)(uae_mem2 + bits * 3);
-        					    do_put_mem_long (addr, do_get_mem_long (addr) ^ 0x00ffffff);
+        					    uae_u8 *addr = uae_mem2 + bits * 3;
+        					    addr[0] ^= 0xff;
+        					    addr[1] ^= 0xff;
+        					    addr[2] ^= 0xff;
           					}
           					break;
         					case 4:
@@ -2461,6 +2345,13 @@ static uae_u32 REGPARAM2 picasso_BlitTemplate (TrapContext *ctx)
   
   		    byte = data >> (8 - bitoffset);
 
+  		    if (max == 8) {
+      			if (inversion && tmp.DrawMode != COMP)
+    			    byte = ~byte;
+      			ExpandByte (uae_mem2, byte & 0xff, tmp.DrawMode, fgpen, bgpen, Bpp, tmp.DrawMode == COMP ? 0xff : Mask);
+      			continue;
+  		    }
+
   		    switch (tmp.DrawMode)
 	  	    {
 	    		case JAM1:
@@ -2508,8 +2399,10 @@ static uae_u32 REGPARAM2 picasso_BlitTemplate (TrapContext *ctx)
           					break;
         					case 3:
           					{
-        					    uae_u32 *addr = (uae_u32 *)(uae_mem2 + bits * 3);
-        					    do_put_mem_long (addr, do_get_mem_long (addr) ^ 0x00FFFFFF);
+        					    uae_u8 *addr = uae_mem2 + bits * 3;
+        					    addr[0] ^= 0xff;
+        					    addr[1] ^= 0xff;
+        					    addr[2] ^= 0xff;
           					}
           					break;
         					case 4:
@@ -2570,6 +2463,44 @@ void init_hz_p96 (void)
   p96vblank = currprefs.ntscmode ? 60 : 50;
 }
 
+/* Fetch 32 pixels of a plane starting offset bytes and bitoffset bits in,
+ * leftmost pixel in bit 31. Only the bytes covering the pixels are read. */
+STATIC_INLINE uae_u32 get_plane_long (uae_u8 *p, unsigned long offset, unsigned int bitoffset, unsigned int pixels)
+{
+  uae_u64 v;
+  unsigned int i, bytes;
+
+  if (p == &all_zeros_bitmap)
+    return 0;
+  if (p == &all_ones_bitmap)
+    return 0xffffffff;
+  p += offset;
+  if (pixels == 32) {
+    v = (uae_u64)do_get_mem_long ((uae_u32 *)p) << 32;
+    if (bitoffset)
+      v |= (uae_u64)p[4] << 24;
+  } else {
+    v = 0;
+    bytes = (bitoffset + pixels + 7) >> 3;
+    for (i = 0; i < bytes; i++)
+      v |= (uae_u64)p[i] << (56 - 8 * i);
+  }
+  return (uae_u32)(v >> (32 - bitoffset));
+}
+
+/* Convert 32 pixels (pixels of them valid) starting at column cols of the
+ * current plane rows into 32 chunky bytes, with the chipset's transpose. */
+STATIC_INLINE void PlanarToChunky32 (uae_u8 *chunky, uae_u8 **PLANAR, int Depth,
+  unsigned long cols, unsigned int bitoffset, unsigned int pixels)
+{
+  uae_u32 pl[8] = { 0 };
+  int k;
+
+  for (k = 0; k < Depth; k++)
+    pl[k] = get_plane_long (PLANAR[k], cols >> 3, bitoffset, pixels);
+  p2c_32 (pl, chunky);
+}
+
 /* NOTE: Watch for those planeptrs of 0x00000000 and 0xFFFFFFFF for all zero / all one bitmaps !!!! */
 static void PlanarToChunky (struct RenderInfo *ri, struct BitMap *bm,
   unsigned long srcx, unsigned long srcy,
@@ -2582,7 +2513,6 @@ static void PlanarToChunky (struct RenderInfo *ri, struct BitMap *bm,
   uae_u8 *PLANAR[8], *image = ri->Memory + dstx * GetBytesPerPixel (ri->RGBFormat) + dsty * ri->BytesPerRow;
   int Depth = bm->Depth;
   unsigned long rows, bitoffset = srcx & 7;
-  long eol_offset;
 
   /* Set up our bm->Planes[] pointers to the right horizontal offset */
   for (j = 0; j < Depth; j++) {
@@ -2593,45 +2523,21 @@ static void PlanarToChunky (struct RenderInfo *ri, struct BitMap *bm,
 	  if ((mask & (1 << j)) == 0)
 	    PLANAR[j] = &all_zeros_bitmap;
   }
-  eol_offset = (long) bm->BytesPerRow - (long) ((width + 7) >> 3);
   for (rows = 0; rows < height; rows++, image += ri->BytesPerRow) {
 	  unsigned long cols;
 
-	  for (cols = 0; cols < width; cols += 8) {
-	    int k;
-	    uae_u32 a = 0, b = 0;
-	    unsigned int msk = 0xFF;
-	    long tmp = cols + 8 - width;
-	    if (tmp > 0) {
-		    msk <<= tmp;
-		    b = do_get_mem_long ((uae_u32 *) (image + cols + 4));
-		    if (tmp < 4)
-		      b &= 0xFFFFFFFF >> (32 - tmp * 8);
-		    else if (tmp > 4) {
-		      a = do_get_mem_long ((uae_u32 *) (image + cols));
-		      a &= 0xFFFFFFFF >> (64 - tmp * 8);
-		    }
-	    }
-	    for (k = 0; k < Depth; k++) {
-		    unsigned int data;
-		    if (PLANAR[k] == &all_zeros_bitmap)
-		      data = 0;
-		    else if (PLANAR[k] == &all_ones_bitmap)
-		      data = 0xFF;
-		    else {
-		      data = (uae_u8) (do_get_mem_word ((uae_u16 *) PLANAR[k]) >> (8 - bitoffset));
-		      PLANAR[k]++;
-		    }
-		    data &= msk;
-		    a |= p2ctab[data][0] << k;
-		    b |= p2ctab[data][1] << k;
+	  for (cols = 0; cols < width; cols += 32) {
+	    if (width - cols >= 32) {
+		    PlanarToChunky32 (image + cols, PLANAR, Depth, cols, bitoffset, 32);
+	    } else {
+		    uae_u8 tmp[32];
+		    PlanarToChunky32 (tmp, PLANAR, Depth, cols, bitoffset, width - cols);
+		    memcpy (image + cols, tmp, width - cols);
 	    }
-	    do_put_mem_long ((uae_u32 *) (image + cols), a);
-	    do_put_mem_long ((uae_u32 *) (image + cols + 4), b);
 	  }
 	  for (j = 0; j < Depth; j++) {
 	    if (PLANAR[j] != &all_zeros_bitmap && PLANAR[j] != &all_ones_bitmap) {
-		    PLANAR[j] += eol_offset;
+		    PLANAR[j] += bm->BytesPerRow;
 	    }
 	  }
   }
@@ -2698,8 +2604,7 @@ static void PlanarToDirect (struct RenderInfo *ri, struct BitMap *bm,
   uae_u8 *PLANAR[8];
   uae_u8 *image = ri->Memory + dstx * bpp + dsty * ri->BytesPerRow;
   int Depth = bm->Depth;
-  unsigned long rows;
-  long eol_offset;
+  unsigned long rows, bitoffset = srcx & 7;
 
   if( !bpp )
   	return;
@@ -2714,54 +2619,41 @@ static void PlanarToDirect (struct RenderInfo *ri, struct BitMap *bm,
 	    PLANAR[j] = &all_zeros_bitmap;
   }
 
-  eol_offset = (long) bm->BytesPerRow - (long) ((width + (srcx & 7)) >> 3);
   for (rows = 0; rows < height; rows++, image += ri->BytesPerRow) {
   	unsigned long cols;
 	  uae_u8 *image2 = image;
-	  unsigned int bitoffs = 7 - (srcx & 7);
-	  int i;
-
-	  for (cols = 0; cols < width; cols++) {
-	    int v = 0, k;
-	    for (k = 0; k < Depth; k++) {
-		    if (PLANAR[k] == &all_ones_bitmap)
-		      v |= 1 << k;
-		    else if (PLANAR[k] != &all_zeros_bitmap) {
-		      v |= ((*PLANAR[k] >> bitoffs) & 1) << k;
-		    }
-	    }
+
+	  /* convert to chunky indices 32 pixels at a time, then look them up */
+	  for (cols = 0; cols < width; cols += 32) {
+	    uae_u8 tmp[32];
+	    unsigned int i, n = width - cols >= 32 ? 32 : width - cols;
+
+	    PlanarToChunky32 (tmp, PLANAR, Depth, cols, bitoffset, n);
 	    switch (bpp) 
       {
   	    case 2:
-		      ((uae_u16 *)image2)[0] = (uae_u16)(cim->Colors[v]);
-		      image2 += 2;
+		      for (i = 0; i < n; i++)
+		        ((uae_u16 *)image2)[i] = (uae_u16)(cim->Colors[tmp[i]]);
 		      break;
 	      case 3:
-		      image2[0] = cim->Colors[v] >> 0;
-		      image2[1] = cim->Colors[v] >> 8;
-		      image2[2] = cim->Colors[v] >> 16;
-		      image2 += 3;
+		      for (i = 0; i < n; i++) {
+		        uae_u32 c = cim->Colors[tmp[i]];
+		        image2[i * 3 + 0] = c >> 0;
+		        image2[i * 3 + 1] = c >> 8;
+		        image2[i * 3 + 2] = c >> 16;
+		      }
       		break;
   	    case 4:
-		      ((uae_u32 *)image2)[0] = cim->Colors[v];
-      		image2 += 4;
+		      for (i = 0; i < n; i++)
+		        ((uae_u32 *)image2)[i] = cim->Colors[tmp[i]];
       		break;
 	    }
-	    bitoffs--;
-	    bitoffs &= 7;
-	    if (bitoffs == 7) {
-    		int k;
-		    for (k = 0; k < Depth; k++) {
-		      if (PLANAR[k] != &all_zeros_bitmap && PLANAR[k] != &all_ones_bitmap) {
-			      PLANAR[k]++;
-		      }
-		    }
-	    }
+	    image2 += n * bpp;
   	}
 
-  	for (i = 0; i < Depth; i++) {
-	    if (PLANAR[i] != &all_zeros_bitmap && PLANAR[i] != &all_ones_bitmap) {
-	    	PLANAR[i] += eol_offset;
+  	for (j = 0; j < Depth; j++) {
+	    if (PLANAR[j] != &all_zeros_bitmap && PLANAR[j] != &all_ones_bitmap) {
+	    	PLANAR[j] += bm->BytesPerRow;
 	    }
 	  }
   }
@@ -2830,9 +2722,40 @@ static uae_u32 REGPARAM2 picasso_BlitPlanar2Direct (TrapContext *ctx)
   return result;
 }
 
+#ifdef USE_RGB32
+static void copyall (uae_u8 *src, uae_u8 *dst)
+{
+  int pixels = picasso96_state.Width * picasso96_state.Height;
+  uae_u32 *d = (uae_u32 *)dst;
+  int i;
+
+  if (picasso96_state.RGBFormat == picasso_vidinfo.rgbformat)
+    memcpy(dst, src, pixels * 4);
+  else if (picasso96_state.RGBFormat == RGBFB_CLUT) {
+    for (i = 0; i < pixels; i++)
+      d[i] = picasso_vidinfo.clut[src[i]];
+  } else if (picasso96_state.RGBFormat == RGBFB_R5G6B5) {
+    for (i = 0; i < pixels; i++, src += 2) {
+      uae_u32 v = (src[0] << 8) | src[1];
+      d[i] = xredcolors[(v >> 8) & 0xf8] | xgreencolors[(v >> 3) & 0xfc] | xbluecolors[(v << 3) & 0xf8];
+    }
+  } else if (picasso96_state.RGBFormat == RGBFB_R5G6B5PC) {
+    for (i = 0; i < pixels; i++, src += 2) {
+      uae_u32 v = src[0] | (src[1] << 8);
+      d[i] = xredcolors[(v >> 8) & 0xf8] | xgreencolors[(v >> 3) & 0xfc] | xbluecolors[(v << 3) & 0xf8];
+    }
+  } else {
+    /* RGBFB_R8G8B8A8 on a host surface with red in the high bits */
+    for (i = 0; i < pixels; i++, src += 4)
+      d[i] = xredcolors[src[0]] | xgreencolors[src[1]] | xbluecolors[src[2]];
+  }
+}
+#else
 static void copyall (uae_u8 *src, uae_u8 *dst)
 {
-  if (picasso96_state.RGBFormat == RGBFB_R5G6B5)
+  if (picasso96_state.RGBFormat == RGBFB_R5G6B5PC)
+    memcpy(dst, src, picasso96_state.Width * picasso96_state.Height * 2);
+  else if (picasso96_state.RGBFormat == RGBFB_R5G6B5)
     copy_screen_16bit_swap(dst, src, picasso96_state.Width * picasso96_state.Height * 2);
   else if(picasso96_state.RGBFormat == RGBFB_CLUT)
   {
@@ -2842,6 +2765,18 @@ static void copyall (uae_u8 *src, uae_u8 *dst)
   else
     copy_screen_32bit_to_16bit_neon(dst, src, picasso96_state.Width * picasso96_state.Height * 4);
 }
+#endif
+
+/* The board memory already holds the frame in host format, so the backend
+ * can upload it as is. Anything drawn on top of the host surface (leds,
+ * input mode overlay, savestate screenshot) needs the copy. */
+static bool can_display_direct (void)
+{
+  return picasso_vidinfo.direct_ok
+    && picasso96_state.RGBFormat == picasso_vidinfo.rgbformat
+    && picasso96_state.BytesPerRow == picasso96_state.Width * picasso_vidinfo.pixbytes
+    && !currprefs.leds_on_screen && !show_inputmode && savestate_state != STATE_DOSAVE;
+}
 
 static void flushpixels (void)
 {
@@ -2857,6 +2792,14 @@ static void flushpixels (void)
 	if (doskip () && p96skipmode == 1)
     return;
 
+  /* Panning between two screens just moves src_start, so the backend
+   * flips between the two regions of board memory. */
+  if (can_display_direct ()) {
+    picasso_vidinfo.direct_mem = src_start;
+    return;
+  }
+  picasso_vidinfo.direct_mem = NULL;
+
   if(picasso96_state.RGBFormat == RGBFB_CLUT)  
     picasso_palette ();
 
@@ -2940,28 +2883,140 @@ addrbank gfxmem_bank = {
   dummy_lgeti, dummy_wgeti, ABFLAG_RAM
 };
 
+#ifdef P96_P2C_BENCH
+/* Log the planar blit throughput for common depths and widths */
+static void p2c_benchmark (void)
+{
+  static const int depths[] = { 1, 4, 5, 8 };
+  static const int widths[] = { 320, 640, 1280 };
+  const int rows = 256, loops = 20;
+  struct RenderInfo ri;
+  struct BitMap bm;
+  struct ColorIndexMapping cim;
+  unsigned int d, w, i;
+
+  for (i = 0; i < 256; i++)
+    cim.Colors[i] = i * 0x010101;
+  for (w = 0; w < sizeof widths / sizeof *widths; w++) {
+    int width = widths[w];
+    int size = (width / 8 + 2) * rows * 8;
+    uae_u8 *planes = xmalloc (uae_u8, size);
+    uae_u8 *dst = xmalloc (uae_u8, width * 4 * rows);
+
+    for (i = 0; i < size; i++)
+      planes[i] = i * 0x9d;
+    bm.BytesPerRow = width / 8 + 2;
+    bm.Rows = rows;
+    for (i = 0; i < 8; i++)
+      bm.Planes[i] = planes + i * bm.BytesPerRow * rows;
+    ri.Memory = dst;
+    for (d = 0; d < sizeof depths / sizeof *depths; d++) {
+      frame_time_t start, chunky, direct;
+      int l;
+
+      bm.Depth = depths[d];
+      ri.RGBFormat = RGBFB_CLUT;
+      ri.BytesPerRow = width;
+      start = read_processor_time ();
+      for (l = 0; l < loops; l++)
+        PlanarToChunky (&ri, &bm, 3, 0, 0, 0, width, rows, 0xff);
+      chunky = read_processor_time () - start;
+      ri.RGBFormat = RGBFB_R5G6B5PC;
+      ri.BytesPerRow = width * 2;
+      start = read_processor_time ();
+      for (l = 0; l < loops; l++)
+        PlanarToDirect (&ri, &bm, 3, 0, 0, 0, width, rows, 0xff, &cim);
+      direct = read_processor_time () - start;
+      write_log (_T("P2C %4d x %d planes: chunky %d us, direct %d us per %d rows\n"),
+        width, bm.Depth, (int)(chunky / loops), (int)(direct / loops), rows);
+    }
+    xfree (dst);
+    xfree (planes);
+  }
+}
+#endif
+
+#ifdef P96_BLIT_BENCH
+/* Log the throughput of the RTG blit ops for each pixel size. The
+ * destination starts one byte past an aligned address, like a window
+ * at an odd x on a 8 bit screen. */
+static void blit_benchmark (void)
+{
+  static const uae_u32 formats[] = { RGBFB_CLUT, RGBFB_R5G6B5PC, RGBFB_R8G8B8, RGBFB_A8R8G8B8 };
+  const int width = 640, rows = 256, loops = 20;
+  const int size = (width * 4 + 8) * rows + 16;
+  struct RenderInfo ri;
+  uae_u8 *src = xmalloc (uae_u8, size);
+  uae_u8 *dst = xmalloc (uae_u8, size);
+  unsigned int f, i;
+
+  for (i = 0; i < size; i++)
+    src[i] = dst[i] = i * 0x9d;
+  for (f = 0; f < sizeof formats / sizeof *formats; f++) {
+    int Bpp = GetBytesPerPixel (formats[f]);
+    int bpr = width * Bpp + 8;
+    frame_time_t start, fill, eor, swap, invert, expand[3];
+    int l, m;
+
+    ri.Memory = dst + 1;
+    ri.BytesPerRow = bpr;
+    ri.RGBFormat = formats[f];
+    start = read_processor_time ();
+    for (l = 0; l < loops; l++)
+      do_fillrect_frame_buffer (&ri, 0, 0, width, rows, 0x123456, Bpp);
+    fill = read_processor_time () - start;
+    start = read_processor_time ();
+    for (l = 0; l < loops; l++)
+      BLIT_EOR_ANY (width * Bpp, rows, src, dst + 1, bpr, bpr);
+    eor = read_processor_time () - start;
+    start = read_processor_time ();
+    for (l = 0; l < loops; l++)
+      BLIT_SWAP_ANY (width * Bpp, rows, src, dst + 1, bpr, bpr);
+    swap = read_processor_time () - start;
+    start = read_processor_time ();
+    for (l = 0; l < loops; l++) {
+      for (i = 0; i < rows; i++)
+        do_xor8 (dst + 1 + i * bpr, width * Bpp, 0xffffffff);
+    }
+    invert = read_processor_time () - start;
+    /* BlitTemplate/BlitPattern inner loop: one mask byte per 8 pixels */
+    for (m = 0; m < 3; m++) {
+      static const int modes[] = { JAM1, JAM2, COMP };
+      start = read_processor_time ();
+      for (l = 0; l < loops; l++) {
+        for (i = 0; i < rows; i++) {
+          uae_u8 *p = dst + 1 + i * bpr;
+          int x;
+          for (x = 0; x < width; x += 8, p += Bpp * 8)
+            ExpandByte (p, src[i * width / 8 + x / 8], modes[m], 0x123456, 0x654321, Bpp, 0xff);
+        }
+      }
+      expand[m] = read_processor_time () - start;
+    }
+    write_log (_T("P96 %d x %d x %d bytes: fill %d, eor %d, swap %d, invert %d, template jam1 %d jam2 %d comp %d us\n"),
+      width, rows, Bpp, (int)(fill / loops), (int)(eor / loops), (int)(swap / loops), (int)(invert / loops),
+      (int)(expand[0] / loops), (int)(expand[1] / loops), (int)(expand[2] / loops));
+  }
+  xfree (dst);
+  xfree (src);
+}
+#endif
+
 /* Call this function first, near the beginning of code flow
 * Place in InitGraphics() which seems reasonable...
 * Also put it in reset_drawing() for safe-keeping.  */
 void InitPicasso96 (void)
 {
-	int i;
-
   //fastscreen
   oldscr = 0;
   //fastscreen
 	memset (&picasso96_state, 0, sizeof (struct picasso96_state_struct));
-
-	for (i = 0; i < 256; i++) {
-  	p2ctab[i][0] = (((i & 128) ? 0x01000000 : 0)
-  		| ((i & 64) ? 0x010000 : 0)
-  		| ((i & 32) ? 0x0100 : 0)
-  		| ((i & 16) ? 0x01 : 0));
-  	p2ctab[i][1] = (((i & 8) ? 0x01000000 : 0)
-  		| ((i & 4) ? 0x010000 : 0)
-  		| ((i & 2) ? 0x0100 : 0)
-  		| ((i & 1) ? 0x01 : 0));
-  }
+#ifdef P96_P2C_BENCH
+  p2c_benchmark ();
+#endif
+#ifdef P96_BLIT_BENCH
+  blit_benchmark ();
+#endif
 }
 
 #endif
@@ -30,10 +30,14 @@
 #include "include/memory.h"
 #include "newcpu.h"
 #include "custom.h"
+#ifdef JIT
 #include "jit/comptbl.h"
 #include "jit/compemu.h"
+#endif
 
+#ifndef CPU_x86_64
 #include <asm/sigcontext.h>
+#endif
 #include <signal.h>
 #include <dlfcn.h>
 #include <execinfo.h>
@@ -43,6 +47,9 @@
 #include "debug.h"
 
 
+/* The direct memory accesses of the JIT are decoded per code generator */
+#if defined(CPU_arm) || defined(CPU_x86_64) || defined(CPU_AARCH64)
+
 enum transfer_type_t {
 	TYPE_UNKNOWN,
 	TYPE_LOAD,
@@ -58,6 +65,10 @@ enum type_size_t {
 
 static int in_handler=0;
 
+#endif
+
+#if defined(CPU_arm)
+
 enum {
   ARM_REG_PC = 15,
   ARM_REG_CPSR = 16
@@ -205,6 +216,210 @@ buserr:
 //  BUS_ERROR(addr);
 	return false;
 } 
+#endif /* CPU_arm */
+
+#if defined(CPU_x86_64)
+
+/* x86 register number -> index into the gregs of the signal context */
+static const int x86_greg[16] = {
+  REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+  REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15
+};
+
+/* Decodes the MOV r/m forms emitted by codegen_x86.cpp for natmem
+   accesses: an optional 66 prefix and REX byte, opcode 88, 89, 8A or 8B,
+   ModRM with an optional SIB byte and displacement. */
+static bool handle_x86_instruction(greg_t *pregs, uintptr addr)
+{
+  uae_u8 *pc = (uae_u8 *)pregs[REG_RIP];
+  uae_u8 *p = pc;
+  int transfer_size = SIZE_INT;
+  transfer_type_t transfer_type;
+  int rex = 0;
+
+	panicbug("IP: %p [%02x %02x %02x %02x] %p\n", pc, pc[0], pc[1], pc[2], pc[3], addr);
+	if (pc == 0) return false;
+
+	if (in_handler > 0)
+	{
+    panicbug("Segmentation fault in handler :-(\n");
+    return false;
+  }
+
+  if (*p == 0x66) {
+    transfer_size = SIZE_WORD;
+    p++;
+  }
+  if ((*p & 0xf0) == 0x40)
+    rex = *p++;
+  switch (*p++) {
+    case 0x88: transfer_size = SIZE_BYTE; transfer_type = TYPE_STORE; break;
+    case 0x89: transfer_type = TYPE_STORE; break;
+    case 0x8a: transfer_size = SIZE_BYTE; transfer_type = TYPE_LOAD; break;
+    case 0x8b: transfer_type = TYPE_LOAD; break;
+    default:
+      panicbug("FIXME: not a MOV\n");
+      return false;
+  }
+
+  in_handler += 1;
+
+  int modrm = *p++;
+  int mod = modrm >> 6;
+  int reg = ((modrm >> 3) & 7) | ((rex & 4) << 1);
+  if ((modrm & 7) == 4) {
+    /* SIB, base 101 without a base register has a disp32 */
+    if (mod == 0 && (*p & 7) == 5)
+      mod = 2;
+    p++;
+  }
+  else if (mod == 0 && (modrm & 7) == 5)
+    mod = 2;
+  if (mod == 1)
+    p += 1;
+  else if (mod == 2)
+    p += 4;
+
+  /* Without a REX byte, byte registers 4 to 7 are AH, CH, DH and BH */
+  greg_t *r;
+  int shift = 0;
+  if (transfer_size == SIZE_BYTE && !rex && reg >= 4) {
+    r = &pregs[x86_greg[reg - 4]];
+    shift = 8;
+  }
+  else
+    r = &pregs[x86_greg[reg]];
+
+	if (transfer_type == TYPE_LOAD) {
+		switch(transfer_size) {
+		  case SIZE_BYTE: {
+		    *r = (*r & ~(0xffL << shift)) | ((greg_t)(uae_u8)get_byte(addr) << shift);
+		    break;
+		  }
+		  case SIZE_WORD: {
+		    *r = (*r & ~0xffffL) | do_byteswap_16((uae_u16)get_word(addr));
+		    break;
+		  }
+		  case SIZE_INT: {
+		    /* a 32 bit load clears the upper half */
+		    *r = do_byteswap_32(get_long(addr));
+		    break;
+		  }
+		}
+	} else {
+		switch(transfer_size) {
+		  case SIZE_BYTE: {
+		    put_byte(addr, *r >> shift);
+		    break;
+		  }
+		  case SIZE_WORD: {
+		    put_word(addr, do_byteswap_16(*r));
+		    break;
+		  }
+		  case SIZE_INT: {
+		    put_long(addr, do_byteswap_32(*r));
+		    break;
+		  }
+		}
+	}
+
+ 	pregs[REG_RIP] += p - pc;
+	panicbug("processed: %p \n", pregs[REG_RIP]);
+
+  in_handler--;
+
+	return true;
+}
+#endif /* CPU_x86_64 */
+
+#if defined(CPU_AARCH64)
+
+/* Decodes the register offset LDR/STR forms emitted by codegen_arm64.cpp
+   for natmem accesses: size in bits 31:30, opc in 23:22, Rt in 4:0. */
+static bool handle_aarch64_instruction(mcontext_t *context, uintptr addr)
+{
+  uae_u32 *pc = (uae_u32 *)context->pc;
+  int transfer_size;
+  transfer_type_t transfer_type;
+
+	panicbug("IP: %p [%08x] %p\n", pc, pc ? pc[0] : 0, addr);
+	if (pc == 0) return false;
+
+	if (in_handler > 0)
+	{
+    panicbug("Segmentation fault in handler :-(\n");
+    return false;
+  }
+
+  uae_u32 opcode = pc[0];
+  if ((opcode & 0x3f200c00) != 0x38200800) {
+    panicbug("FIXME: not a register offset LDR/STR\n");
+    return false;
+  }
+  switch (opcode >> 30) {
+    case 0: transfer_size = SIZE_BYTE; break;
+    case 1: transfer_size = SIZE_WORD; break;
+    case 2: transfer_size = SIZE_INT; break;
+    default:
+      panicbug("FIXME: 64 bit access\n");
+      return false;
+  }
+  switch ((opcode >> 22) & 3) {
+    case 0: transfer_type = TYPE_STORE; break;
+    case 1: transfer_type = TYPE_LOAD; break;
+    default:
+      panicbug("FIXME: sign extending load\n");
+      return false;
+  }
+
+  in_handler += 1;
+
+  /* Register 31 is the zero register here */
+  int rt = opcode & 31;
+  uae_u64 dummy = 0;
+  uae_u64 *r = (rt == 31) ? &dummy : (uae_u64 *)&context->regs[rt];
+
+	if (transfer_type == TYPE_LOAD) {
+		/* loads into a W register clear the upper half */
+		switch(transfer_size) {
+		  case SIZE_BYTE: {
+		    *r = (uae_u8)get_byte(addr);
+		    break;
+		  }
+		  case SIZE_WORD: {
+		    *r = do_byteswap_16((uae_u16)get_word(addr));
+		    break;
+		  }
+		  case SIZE_INT: {
+		    *r = do_byteswap_32(get_long(addr));
+		    break;
+		  }
+		}
+	} else {
+		switch(transfer_size) {
+		  case SIZE_BYTE: {
+		    put_byte(addr, *r);
+		    break;
+		  }
+		  case SIZE_WORD: {
+		    put_word(addr, do_byteswap_16(*r));
+		    break;
+		  }
+		  case SIZE_INT: {
+		    put_long(addr, do_byteswap_32(*r));
+		    break;
+		  }
+		}
+	}
+
+	context->pc += 4;
+	panicbug("processed: %p \n", context->pc);
+
+  in_handler--;
+
+	return true;
+}
+#endif /* CPU_AARCH64 */
 
 
 #define SIG_READ 1
@@ -222,12 +437,36 @@ void signal_segv(int signum, siginfo_t* info, void*ptr)
   void **bp = 0;
   void *ip = 0;
 
+#if defined(CPU_arm)
 	mcontext_t *context = &(ucontext->uc_mcontext);
 	unsigned long *regs = &context->arm_r0;
 	uintptr addr = (uintptr)info->si_addr;
   addr = (uae_u32) addr - (uae_u32) natmem_offset;
+#ifdef JIT
+	/* Write to a page holding translated code, just note it */
+	if (jit_page_fault(addr))
+	  return;
+#endif
 	if (handle_arm_instruction(regs, addr))
 	  return;
+#elif defined(CPU_x86_64)
+	greg_t *regs = ucontext->uc_mcontext.gregs;
+	uintptr addr = (uintptr)info->si_addr - (uintptr)natmem_offset;
+#ifdef JIT
+	if (jit_page_fault(addr))
+	  return;
+#endif
+	if (handle_x86_instruction(regs, addr))
+	  return;
+#elif defined(CPU_AARCH64)
+	uintptr addr = (uintptr)info->si_addr - (uintptr)natmem_offset;
+#ifdef JIT
+	if (jit_page_fault(addr))
+	  return;
+#endif
+	if (handle_aarch64_instruction(&ucontext->uc_mcontext, addr))
+	  return;
+#endif
 	  
   if(signum == 4)
     printf("Illegal Instruction!\n");
@@ -240,6 +479,27 @@ void signal_segv(int signum, siginfo_t* info, void*ptr)
   printf("info.si_addr = %p\n", info->si_addr);
   if(signum == 4)
     printf("       value = 0x%08x\n", *((uae_u32*)(info->si_addr)));
+#if defined(CPU_x86_64)
+  static const char *greg_names[] = {
+    "R8", "R9", "R10", "R11", "R12", "R13", "R14", "R15",
+    "RDI", "RSI", "RBP", "RBX", "RDX", "RAX", "RCX", "RSP", "RIP"
+  };
+  for (i = 0; i <= REG_RIP; i++)
+    printf("%s = 0x%016llx\n", greg_names[i], (unsigned long long)ucontext->uc_mcontext.gregs[i]);
+#ifdef JIT
+  dump_compiler((uae_u32*)ucontext->uc_mcontext.gregs[REG_RIP]);
+#endif
+#elif defined(CPU_AARCH64)
+  for (i = 0; i < 31; i++)
+    printf("x%02d = 0x%016llx\n", i, (unsigned long long)ucontext->uc_mcontext.regs[i]);
+  printf("SP = 0x%016llx\n", (unsigned long long)ucontext->uc_mcontext.sp);
+  printf("PC = 0x%016llx\n", (unsigned long long)ucontext->uc_mcontext.pc);
+  printf("PSTATE = 0x%016llx\n", (unsigned long long)ucontext->uc_mcontext.pstate);
+  printf("Fault Address = 0x%016llx\n", (unsigned long long)ucontext->uc_mcontext.fault_address);
+#ifdef JIT
+  dump_compiler((uae_u32*)ucontext->uc_mcontext.pc);
+#endif
+#elif defined(CPU_arm)
   printf("reg[%02d] = 0x%08x\n",0 , ucontext->uc_mcontext.arm_r0);
   printf("reg[%02d] = 0x%08x\n",1 , ucontext->uc_mcontext.arm_r1);
   printf("reg[%02d] = 0x%08x\n",2 , ucontext->uc_mcontext.arm_r2);
@@ -262,7 +522,10 @@ void signal_segv(int signum, siginfo_t* info, void*ptr)
   printf("Err Code = 0x%08x\n", ucontext->uc_mcontext.error_code);
   printf("Old Mask = 0x%08x\n", ucontext->uc_mcontext.oldmask);
 
+#ifdef JIT
   dump_compiler((uae_u32*)ucontext->uc_mcontext.arm_pc);
+#endif
+#endif
   
 //	printf("Stack trace:\n");
 //  ip = (void*)ucontext->uc_mcontext.arm_r10;
@@ -9,7 +9,12 @@
 #define FILESYS /* filesys emulation */
 #define UAE_FILESYS_THREADS
 #define AUTOCONFIG /* autoconfig support, fast ram, harddrives etc.. */
+#if defined(CPU_arm)
 #define JIT /* JIT compiler support */
+#define USE_JIT_FPU /* JIT compiler support for FPU instructions */
+#elif defined(CPU_x86_64) || defined(CPU_AARCH64)
+#define JIT /* JIT compiler support, FPU instructions run in the interpreter */
+#endif
 /* #define NATMEM_OFFSET natmem_offset */
 /* #define CATWEASEL */ /* Catweasel MK2/3 support */
 /* #define AHI */ /* AHI sound emulation */
@@ -28,6 +33,7 @@
 /* #define FULLMMU Aranym 68040 MMU */
 #define CPUEMU_0 /* generic 680x0 emulation */
 #define CPUEMU_11 /* 68000+prefetch emulation */
+/* #define CPU_PAIR_STATS */ /* write frequent_pairs.68k for gencpu superinstructions */
 /* #define CPUEMU_12 */ /* cycle-exact cpu&blitter */
 /* #define ACTION_REPLAY */ /* Action Replay 1/2/3 support */
 /* #define PICASSO96 */ /* Picasso96 display card emulation */
@@ -53,7 +59,11 @@
 /* #define CPUEMU_68000_ONLY */ /* drop 68010+ commands from CPUEMU_0 */
 /* #define ADDRESS_SPACE_24BIT */
 
+#if defined(CPU_x86_64) || defined(CPU_AARCH64)
+#define SIZEOF_VOID_P 8
+#else
 #define SIZEOF_VOID_P 4
+#endif
 
 #if !defined(AHI)
 #undef ENFORCER
@@ -24,6 +24,11 @@
 #include "td-sdl/thread.h"
 #include "bcm_host.h"
 
+#ifdef USE_RGB32
+#define AMIGAFB_IMAGE_TYPE VC_IMAGE_RGBX32
+#else
+#define AMIGAFB_IMAGE_TYPE VC_IMAGE_RGB565
+#endif
 
 /* SDL surface variable for output of emulation */
 SDL_Surface *prSDLScreen = NULL;
@@ -61,10 +66,6 @@ int doStylusRightClick = 0;
 
 int DispManXElementpresent = 0;
 
-static unsigned long previous_synctime = 0;
-static unsigned long next_synctime = 0;
-
-
 uae_sem_t vsync_wait_sem;
 
 
@@ -80,6 +81,47 @@ VC_RECT_T       blit_rect;
 
 unsigned char current_resource_amigafb = 0;
 
+/* Both resources alternate, so each one misses the rows of the frame in
+   between. Fresh resources get written in full twice. */
+static uae_u8 prev_row_dirty[MAX_VIDHEIGHT];
+static int full_resource_writes = 0;
+
+static void write_amigafb(DISPMANX_RESOURCE_HANDLE_T resource)
+{
+	struct row_range ranges[MAX_ROW_RANGES];
+	VC_RECT_T rect;
+	int i, n;
+
+#ifdef PICASSO96
+	/* RTG frame in host format: upload straight from board memory */
+	if (screen_is_picasso && picasso_vidinfo.direct_mem) {
+		vc_dispmanx_resource_write_data(  resource,
+	                                    AMIGAFB_IMAGE_TYPE,
+	                                    picasso_vidinfo.width * picasso_vidinfo.pixbytes,
+	                                    picasso_vidinfo.direct_mem,
+	                                    &blit_rect );
+		return;
+	}
+#endif
+
+	n = get_dirty_row_ranges(ranges, blit_rect.height, prev_row_dirty);
+	memcpy(prev_row_dirty, row_dirty, sizeof prev_row_dirty);
+	if (full_resource_writes > 0) {
+		full_resource_writes--;
+		n = 1;
+		ranges[0].first = 0;
+		ranges[0].count = blit_rect.height;
+	}
+	for (i = 0; i < n; i++) {
+		vc_dispmanx_rect_set(&rect, 0, ranges[i].first, blit_rect.width, ranges[i].count);
+		vc_dispmanx_resource_write_data(  resource,
+	                                    AMIGAFB_IMAGE_TYPE,
+	                                    gfxvidinfo.outwidth * DISPLAY_PIXBYTES,
+	                                    gfxvidinfo.bufmem,
+	                                    &rect );
+	}
+}
+
 void vsync_callback(unsigned int a, void* b)
 {
 	//vsync_timing=SDL_GetTicks();
@@ -87,6 +129,7 @@ void vsync_callback(unsigned int a, void* b)
 	//old_time = vsync_timing;
 	//need_frameskip =  ( vsync_frequency > 31 ) ? (need_frameskip+1) : need_frameskip;
 	//printf("d: %i", vsync_frequency     );
+	frame_pace_vsync (read_processor_time ());
 	uae_sem_post (&vsync_wait_sem);
 }
 
@@ -105,7 +148,7 @@ int graphics_setup (void)
 void InitAmigaVidMode(struct uae_prefs *p)
 {
   /* Initialize structure for Amiga video modes */
-  gfxvidinfo.pixbytes = 2;
+  gfxvidinfo.pixbytes = DISPLAY_PIXBYTES;
   gfxvidinfo.bufmem = (uae_u8 *)prSDLScreen->pixels;
   gfxvidinfo.outwidth = p->gfx_size.width;
   gfxvidinfo.outheight = p->gfx_size.height;
@@ -117,7 +160,7 @@ void InitAmigaVidMode(struct uae_prefs *p)
   }
 #endif
   //gfxvidinfo.rowbytes = prSDLScreen->pitch;
-  gfxvidinfo.rowbytes = blit_rect.width * 2;
+  gfxvidinfo.rowbytes = blit_rect.width * DISPLAY_PIXBYTES;
 }
 
 void graphics_dispmanshutdown (void)
@@ -210,21 +253,27 @@ static void open_screen(struct uae_prefs *p)
 	printf("Emulation resolution: Width %i Height: %i\n",width,height);
 	currprefs.gfx_correct_aspect = changed_prefs.gfx_correct_aspect;
 	currprefs.gfx_fullscreen_ratio = changed_prefs.gfx_fullscreen_ratio;
+#ifdef USE_RGB32
+	prSDLScreen = SDL_CreateRGBSurface(SDL_SWSURFACE,width,height,DISPLAY_BPP,
+		DISPLAY_RMASK, DISPLAY_GMASK, DISPLAY_BMASK, 0);
+#else
 	prSDLScreen = SDL_CreateRGBSurface(SDL_SWSURFACE,width,height,16,
 		Dummy_prSDLScreen->format->Rmask,
 		Dummy_prSDLScreen->format->Gmask,
 		Dummy_prSDLScreen->format->Bmask,
 		Dummy_prSDLScreen->format->Amask);
+#endif
 
 	dispmanxdisplay = vc_dispmanx_display_open( 0 );
 	vc_dispmanx_display_get_info( dispmanxdisplay, &dispmanxdinfo);
 
-	dispmanxresource_amigafb_1 = vc_dispmanx_resource_create( VC_IMAGE_RGB565,  width,   height,  &vc_image_ptr);
-	dispmanxresource_amigafb_2 = vc_dispmanx_resource_create( VC_IMAGE_RGB565,  width,   height,  &vc_image_ptr);
+	dispmanxresource_amigafb_1 = vc_dispmanx_resource_create( AMIGAFB_IMAGE_TYPE,  width,   height,  &vc_image_ptr);
+	dispmanxresource_amigafb_2 = vc_dispmanx_resource_create( AMIGAFB_IMAGE_TYPE,  width,   height,  &vc_image_ptr);
 	vc_dispmanx_rect_set( &blit_rect, 0, 0, width,height);
+	full_resource_writes = 2;
 	vc_dispmanx_resource_write_data(  dispmanxresource_amigafb_1,
-                                    VC_IMAGE_RGB565,
-                                    width *2,
+                                    AMIGAFB_IMAGE_TYPE,
+                                    width * DISPLAY_PIXBYTES,
                                     prSDLScreen->pixels,
                                     &blit_rect );
 	vc_dispmanx_rect_set( &src_rect, 0, 0, width << 16, height << 16 );
@@ -292,6 +341,7 @@ static void open_screen(struct uae_prefs *p)
 void update_display(struct uae_prefs *p)
 {
   open_screen(p);
+  notice_screen_contents_lost();
     
   SDL_ShowCursor(SDL_DISABLE);
 
@@ -354,6 +404,7 @@ void flush_screen ()
     if (show_inputmode)
     {
         inputmode_redraw();	
+        notice_screen_contents_lost();
     }
 
 
@@ -369,20 +420,13 @@ void flush_screen ()
     }
   }
 
-  unsigned long start = read_processor_time();
-  //if(start < next_synctime && next_synctime - start > time_per_frame - 1000)
-  //  usleep((next_synctime - start) - 1000);
   //SDL_Flip(prSDLScreen);
 
 
 	if (current_resource_amigafb == 1)
 	{
 		current_resource_amigafb = 0;
-		vc_dispmanx_resource_write_data(  dispmanxresource_amigafb_1,
-	                                    VC_IMAGE_RGB565,
-	                                    gfxvidinfo.outwidth * 2,
-	                                    gfxvidinfo.bufmem,
-	                                    &blit_rect );
+		write_amigafb(dispmanxresource_amigafb_1);
 		dispmanxupdate = vc_dispmanx_update_start( 10 );
 		vc_dispmanx_element_change_source(dispmanxupdate,dispmanxelement,dispmanxresource_amigafb_1);
 
@@ -393,11 +437,7 @@ void flush_screen ()
 	else
 	{
 		current_resource_amigafb = 1;
-		vc_dispmanx_resource_write_data(  dispmanxresource_amigafb_2,
-	                                    VC_IMAGE_RGB565,
-	                                    gfxvidinfo.outwidth * 2,
-	                                    gfxvidinfo.bufmem,
-	                                    &blit_rect );
+		write_amigafb(dispmanxresource_amigafb_2);
 		dispmanxupdate = vc_dispmanx_update_start( 10 );
 		vc_dispmanx_element_change_source(dispmanxupdate,dispmanxelement,dispmanxresource_amigafb_2);
 
@@ -405,16 +445,7 @@ void flush_screen ()
 	}
 
   last_synctime = read_processor_time();
-  
-  if(last_synctime - next_synctime > time_per_frame - 1000)
-    adjust_idletime(0);
-  else
-    adjust_idletime(next_synctime - start);
-  
-  if(last_synctime - next_synctime > time_per_frame - 5000)
-    next_synctime = last_synctime + time_per_frame * (1 + currprefs.gfx_framerate);
-  else
-    next_synctime = next_synctime + time_per_frame * (1 + currprefs.gfx_framerate);
+  frame_pace_submitted();
 
 	init_row_map();
 
@@ -484,8 +515,10 @@ static int init_colors (void)
 	blue_shift = maskShift(prSDLScreen->format->Bmask);
 	alloc_colors64k (red_bits, green_bits, blue_bits, red_shift, green_shift, blue_shift, 0);
 	notice_new_xcolors();
+#ifndef USE_RGB32
 	for (i = 0; i < 4096; i++)
 		xcolors[i] = xcolors[i] * 0x00010001;
+#endif
 
 	return 1;
 }
@@ -605,18 +638,27 @@ static int save_png(SDL_Surface* surface, char *path)
   int y;
   int x;
 
+#ifdef USE_RGB32
+  unsigned int *p = (unsigned int *)pix;
+#else
   unsigned short *p = (unsigned short *)pix;
+#endif
   for(y = 0; y < sizeY; y++) 
   {
      for(x = 0; x < sizeX; x++) 
      {
+#ifdef USE_RGB32
+       SDL_GetRGB(p[x], surface->format, &b[0], &b[1], &b[2]);
+       b += 3;
+#else
        unsigned short v = p[x];
   
        *b++ = ((v & systemRedMask  ) >> systemRedShift  ) << 3; // R
        *b++ = ((v & systemGreenMask) >> systemGreenShift) << 2; // G 
        *b++ = ((v & systemBlueMask ) >> systemBlueShift ) << 3; // B
+#endif
      }
-     p += surface->pitch / 2;
+     p += surface->pitch / sizeof (*p);
      png_write_row(png_ptr,writeBuffer);
      b = writeBuffer;
   }
@@ -803,15 +845,21 @@ void gfx_set_picasso_modeinfo (uae_u32 w, uae_u32 h, uae_u32 depth, RGBFTYPE rgb
   picasso_vidinfo.selected_rgbformat = rgbfmt;
   picasso_vidinfo.width = w;
   picasso_vidinfo.height = h;
-  picasso_vidinfo.depth = 2; // Native depth
+  picasso_vidinfo.depth = DISPLAY_PIXBYTES; // Native depth
   picasso_vidinfo.extra_mem = 1;
 
-  picasso_vidinfo.pixbytes = 2; // Native bytes
+  picasso_vidinfo.pixbytes = DISPLAY_PIXBYTES; // Native bytes
+  picasso_vidinfo.direct_ok = 1;
+  picasso_vidinfo.direct_mem = NULL;
   if (screen_is_picasso)
   {
   	open_screen(&currprefs);
     picasso_vidinfo.rowbytes	= prSDLScreen->pitch;
-    picasso_vidinfo.rgbformat = RGBFB_R5G6B5;
+#ifdef USE_RGB32
+    picasso_vidinfo.rgbformat = RGBFB_R8G8B8A8;
+#else
+    picasso_vidinfo.rgbformat = RGBFB_R5G6B5PC;
+#endif
   }
 }
 
@@ -59,6 +59,10 @@
 #include "audio.h"
 #include "filesys.h"
 #include "disk.h"
+#include "blitter.h"
+#include "xwin.h"
+#include "drawing.h"
+#include "td-sdl/thread.h"
 
 int savestate_state = 0;
 
@@ -66,6 +70,10 @@ static bool new_blitter = false;
 
 struct zfile *savestate_file;
 static int savestate_docompress, savestate_specialdump, savestate_nodialogs;
+static int savestate_incremental;
+static int savestate_rewinding, rewind_restoring, rewind_frames;
+static struct zfile *rewind_restore_file;
+static bool rewind_ram (int bank, uae_u8 *memory, int len);
 
 TCHAR savestate_fname[MAX_DPATH];
 
@@ -191,6 +199,90 @@ TCHAR *restore_path_func (uae_u8 **dstp, int type)
 
 /* read and write IFF-style hunks */
 
+/* chunk flags: bit 0 = zlib compressed, bit 1 = delta against a base state,
+ * bit 2 = RAM lives in the in-memory rewind buffer (never written to disk),
+ * bit 3 = RAM pages compressed one by one with the fast codec */
+#define CHUNK_DELTA 2
+#define CHUNK_REWIND 4
+#define CHUNK_PAGES 8
+
+/* Pages for the fast codec are independent, so they are compressed and
+ * decompressed on all host cores at once. */
+#define MAX_PAGE_THREADS 8
+
+struct state_page_job {
+  uae_u8 *dst;
+  const uae_u8 *src;
+  int len;        /* page length */
+  int complen;    /* compressed length, len if stored as it is */
+};
+
+struct state_page_worker {
+  struct state_page_job *jobs;
+  int count;
+  bool compress;
+  bool ok;
+};
+
+static void *state_page_thread (void *arg)
+{
+  struct state_page_worker *w = (struct state_page_worker *)arg;
+  int i;
+
+  for (i = 0; i < w->count; i++) {
+    struct state_page_job *j = &w->jobs[i];
+    if (w->compress) {
+      j->complen = zfile_lzcompress (j->dst, j->src, j->len);
+      if (j->complen >= j->len) {
+        memcpy (j->dst, j->src, j->len);
+        j->complen = j->len;
+      }
+    } else if (j->complen == j->len) {
+      memcpy (j->dst, j->src, j->len);
+    } else if (zfile_lzuncompress (j->dst, j->len, j->src, j->complen) != j->len) {
+      w->ok = false;
+    }
+  }
+  return NULL;
+}
+
+static bool state_pages_run (struct state_page_job *jobs, int count, bool compress)
+{
+  struct state_page_worker w[MAX_PAGE_THREADS];
+  uae_thread_id tid[MAX_PAGE_THREADS];
+  long cpus = sysconf (_SC_NPROCESSORS_ONLN);
+  int n, i, per, first = 0;
+  bool ok = true;
+
+  n = cpus < 1 ? 1 : (cpus > MAX_PAGE_THREADS ? MAX_PAGE_THREADS : cpus);
+  if (n > count)
+    n = count;
+  if (n < 1)
+    return true;
+  per = (count + n - 1) / n;
+  for (i = 0; i < n; i++) {
+    w[i].jobs = jobs + first;
+    w[i].count = count - first < per ? count - first : per;
+    w[i].compress = compress;
+    w[i].ok = true;
+    first += w[i].count;
+  }
+  for (i = 1; i < n; i++) {
+    tid[i] = BAD_THREAD;
+    uae_start_thread (_T("statepages"), state_page_thread, &w[i], &tid[i]);
+    if (tid[i] == BAD_THREAD)
+      state_page_thread (&w[i]);
+  }
+  state_page_thread (&w[0]);
+  for (i = 0; i < n; i++) {
+    if (i > 0 && tid[i] != BAD_THREAD)
+      uae_wait_thread (tid[i]);
+    if (!w[i].ok)
+      ok = false;
+  }
+  return ok;
+}
+
 static void save_chunk (struct zfile *f, uae_u8 *chunk, size_t len, TCHAR *name, int compress)
 {
   uae_u8 tmp[8], *dst;
@@ -250,7 +342,8 @@ static void save_chunk (struct zfile *f, uae_u8 *chunk, size_t len, TCHAR *name,
   if (len2)
   	zfile_fwrite (zero, 1, len2, f);
 
-  write_log (_T("Chunk '%s' chunk size %d (%d)\n"), name, chunklen, len);
+  if (!savestate_rewinding)
+    write_log (_T("Chunk '%s' chunk size %d (%d)\n"), name, chunklen, len);
 }
 
 static uae_u8 *restore_chunk (struct zfile *f, TCHAR *name, size_t *len, size_t *totallen, size_t *filepos)
@@ -280,7 +373,7 @@ static uae_u8 *restore_chunk (struct zfile *f, TCHAR *name, size_t *len, size_t
   src = tmp;
   flags = restore_u32 ();
   *totallen = *len;
-  if (flags & 1) {
+  if (flags & (1 | CHUNK_DELTA | CHUNK_REWIND | CHUNK_PAGES)) {
   	zfile_fread (tmp, 1, 4, f);
   	src = tmp;
   	*totallen = restore_u32();
@@ -321,31 +414,164 @@ static uae_u8 *restore_chunk (struct zfile *f, TCHAR *name, size_t *len, size_t
   return mem;
 }
 
-void restore_ram (size_t filepos, uae_u8 *memory)
+static void restore_ram_file (struct zfile *f, size_t filepos, uae_u8 *memory, int depth);
+
+/* Paged data at SRC: a compressed length per page, then the pages. PAGE
+ * lists the page numbers, NULL for all pages in order. */
+static bool restore_pages (uae_u8 *src, uae_u8 *end, uae_u8 *memory, int fullsize, int pagesize, const int *page, int count)
+{
+  struct state_page_job *jobs;
+  uae_u8 *data;
+  int i;
+  bool ok;
+
+  if (pagesize <= 0 || count < 0 || count > (end - src) / 4)
+    return false;
+  jobs = xmalloc (struct state_page_job, count + 1);
+  if (!jobs)
+    return false;
+  data = src + count * 4;
+  for (i = 0; i < count; i++) {
+    int p = page ? page[i] : i;
+    int off, plen, complen = restore_u32 ();
+    if (p < 0 || p >= (fullsize + pagesize - 1) / pagesize)
+      break;
+    off = p * pagesize;
+    plen = fullsize - off < pagesize ? fullsize - off : pagesize;
+    if (complen <= 0 || complen > plen || complen > end - data)
+      break;
+    jobs[i].dst = memory + off;
+    jobs[i].src = data;
+    jobs[i].len = plen;
+    jobs[i].complen = complen;
+    data += complen;
+  }
+  ok = i == count;
+  if (!state_pages_run (jobs, i, false))
+    ok = false;
+  xfree (jobs);
+  return ok;
+}
+
+/* chunk of all pages: page size and count, then the paged data */
+static void restore_ram_pages (struct zfile *f, int size, int fullsize, uae_u8 *memory)
+{
+  uae_u8 *data, *src;
+  int pagesize, count;
+
+  if (size < 8)
+    return;
+  data = xmalloc (uae_u8, size);
+  if (!data)
+    return;
+  zfile_fread (data, 1, size, f);
+  src = data;
+  pagesize = restore_u32 ();
+  count = restore_u32 ();
+  if (!restore_pages (src, data + size, memory, fullsize, pagesize, NULL, count))
+		write_log (_T("RAM chunk corrupt, not fully restored\n"));
+  xfree (data);
+}
+
+/* delta chunk: base file and chunk position, then the changed pages */
+static void restore_ram_delta (struct zfile *f, int size, int fullsize, uae_u8 *memory, int depth, bool paged)
+{
+  uae_u8 *data, *src;
+  TCHAR *basename;
+  struct zfile *fb;
+  size_t basepos;
+  int pagesize, count, i;
+
+  data = xmalloc (uae_u8, size + 1);
+  if (!data)
+    return;
+  zfile_fread (data, 1, size, f);
+  data[size] = 0;
+  src = data;
+  basepos = restore_u32 ();
+  pagesize = restore_u32 ();
+  basename = restore_string ();
+  count = restore_u32 ();
+  fb = zfile_fopen (basename, _T("rb"), ZFD_NORMAL);
+  if (!fb || depth > 0) {
+		write_log (_T("Delta base '%s' missing, RAM not restored\n"), basename);
+  } else {
+    restore_ram_file (fb, basepos, memory, depth + 1);
+    if (paged) {
+      int *list = NULL;
+      if (count >= 0 && count <= (data + size - src) / 4)
+        list = xmalloc (int, count + 1);
+      if (list) {
+        for (i = 0; i < count; i++)
+          list[i] = restore_u32 ();
+      }
+      if (!list || !restore_pages (src, data + size, memory, fullsize, pagesize, list, count))
+		    write_log (_T("Delta of '%s' corrupt, RAM not fully restored\n"), basename);
+      xfree (list);
+    } else {
+      /* pages stored as they are */
+      uae_u8 *pages = src + count * 4;
+      for (i = 0; i < count; i++) {
+        int page = restore_u32 ();
+        int off = page * pagesize;
+        int plen = fullsize - off < pagesize ? fullsize - off : pagesize;
+        if (off < 0 || plen <= 0 || pages + plen > data + size)
+          break;
+        memcpy (memory + off, pages, plen);
+        pages += plen;
+      }
+    }
+  }
+  if (fb)
+    zfile_fclose (fb);
+  xfree (basename);
+  xfree (data);
+}
+
+static void restore_ram_file (struct zfile *f, size_t filepos, uae_u8 *memory, int depth)
 {
   uae_u8 tmp[8];
   uae_u8 *src = tmp;
   int size, fullsize;
   uae_u32 flags;
     
-  if (filepos == 0 || memory == NULL)
-  	return;
-  zfile_fseek (savestate_file, filepos, SEEK_SET);
-  zfile_fread (tmp, 1, sizeof tmp, savestate_file);
+  zfile_fseek (f, filepos, SEEK_SET);
+  zfile_fread (tmp, 1, sizeof tmp, f);
   size = restore_u32();
   flags = restore_u32();
   size -= 4 + 4 + 4;
-  if (flags & 1) {
-    zfile_fread (tmp, 1, 4, savestate_file);
+  if (flags & (1 | CHUNK_DELTA | CHUNK_REWIND | CHUNK_PAGES)) {
+    zfile_fread (tmp, 1, 4, f);
     src = tmp;
     fullsize = restore_u32();
     size -= 4;
-    zfile_zuncompress (memory, fullsize, savestate_file, size);
+    /* Pages the JIT protected would make read() fail with EFAULT */
+    jit_unprotect_range (memory, fullsize);
+    if (flags & CHUNK_REWIND) {
+      zfile_fread (tmp, 1, 4, f);
+      src = tmp;
+      rewind_ram (restore_u32 (), memory, fullsize);
+    } else if (flags & CHUNK_DELTA)
+      restore_ram_delta (f, size, fullsize, memory, depth, (flags & CHUNK_PAGES) != 0);
+    else if (flags & CHUNK_PAGES)
+      restore_ram_pages (f, size, fullsize, memory);
+    else
+      zfile_zuncompress (memory, fullsize, f, size);
+    jit_unprotect_done (memory, fullsize);
   } else {
-    zfile_fread (memory, 1, size, savestate_file);
+    jit_unprotect_range (memory, size);
+    zfile_fread (memory, 1, size, f);
+    jit_unprotect_done (memory, size);
   }
 }
 
+void restore_ram (size_t filepos, uae_u8 *memory)
+{
+  if (filepos == 0 || memory == NULL)
+  	return;
+  restore_ram_file (savestate_file, filepos, memory, 0);
+}
+
 static void restore_header (uae_u8 *src)
 {
   TCHAR *emuname, *emuversion, *description;
@@ -373,7 +599,12 @@ void restore_state (const TCHAR *filename)
   int z3num;
 
   chunk = 0;
-	f = zfile_fopen (filename, _T("rb"), ZFD_NORMAL);
+  if (rewind_restore_file) {
+    f = rewind_restore_file;
+    rewind_restore_file = NULL;
+  } else {
+	  f = zfile_fopen (filename, _T("rb"), ZFD_NORMAL);
+  }
   if (!f)
   	goto error;
   zfile_fseek (f, 0, SEEK_END);
@@ -533,6 +764,10 @@ void savestate_restore_finish (void)
   	return;
   zfile_fclose (savestate_file);
   savestate_file = 0;
+  if (rewind_restoring) {
+    rewind_restoring = 0;
+    rewind_frames = 0;
+  }
   restore_cpu_finish();
 	restore_audio_finish ();
 	restore_disk_finish ();
@@ -545,7 +780,7 @@ void savestate_restore_finish (void)
 	audio_activate ();
 }
 
-/* 1=compressed,2=not compressed,3=ram dump,4=audio dump */
+/* 1=compressed,2=not compressed,3=ram dump,4=audio dump,5=incremental */
 void savestate_initsave (const TCHAR *filename, int mode, int nodialogs, bool save)
 {
   if (filename == NULL) {
@@ -553,36 +788,363 @@ void savestate_initsave (const TCHAR *filename, int mode, int nodialogs, bool sa
 	  savestate_docompress = 0;
 	  savestate_specialdump = 0;
 	  savestate_nodialogs = 0;
+	  savestate_incremental = 0;
 	  return;
   }
   _tcscpy (savestate_fname, filename);
   savestate_docompress = (mode == 1) ? 1 : 0;
   savestate_specialdump = (mode == 3) ? 1 : (mode == 4) ? 2 : 0;
+  savestate_incremental = (mode == 5) ? 1 : 0;
   savestate_nodialogs = nodialogs;
 	new_blitter = false;
 }
 
-static void save_rams (struct zfile *f, int comp)
-{
-  uae_u8 *dst;
+struct state_ram {
+  const TCHAR *name;
+  uae_u8 *mem;
   int len;
+};
 
-  dst = save_cram (&len);
-	save_chunk (f, dst, len, _T("CRAM"), comp);
-  dst = save_bram (&len);
-  save_chunk (f, dst, len, _T("BRAM"), comp);
+static int get_rams (struct state_ram *rams)
+{
+  int n = 0;
+
+  rams[n].mem = save_cram (&rams[n].len);
+  rams[n++].name = _T("CRAM");
+  rams[n].mem = save_bram (&rams[n].len);
+  rams[n++].name = _T("BRAM");
 #ifdef AUTOCONFIG
-  dst = save_fram (&len);
-	save_chunk (f, dst, len, _T("FRAM"), comp);
-  dst = save_zram (&len, 0);
-  save_chunk (f, dst, len, _T("ZRAM"), comp);
-  dst = save_bootrom (&len);
-	save_chunk (f, dst, len, _T("BORO"), comp);
+  rams[n].mem = save_fram (&rams[n].len);
+  rams[n++].name = _T("FRAM");
+  rams[n].mem = save_zram (&rams[n].len, 0);
+  rams[n++].name = _T("ZRAM");
+  rams[n].mem = save_bootrom (&rams[n].len);
+  rams[n++].name = _T("BORO");
 #endif
 #ifdef PICASSO96
-  dst = save_pram (&len);
-	save_chunk (f, dst, len, _T("PRAM"), comp);
+  rams[n].mem = save_pram (&rams[n].len);
+  rams[n++].name = _T("PRAM");
 #endif
+  return n;
+}
+
+/* Incremental states: the first save writes a full uncompressed state to
+ * "<name>.base" and remembers a hash of every RAM page. Later saves only
+ * store the pages whose hash changed, plus where to find the rest. Each
+ * state file keeps its own base, so alternating slots do not rebase. */
+
+#define STATE_PAGE_SIZE 4096
+#define MAX_STATE_RAMS 8
+#define MAX_STATE_BASES 8
+
+struct state_base_ram {
+  const TCHAR *name;
+  int len;
+  size_t filepos;
+  uae_u64 *hashes;
+  uae_u64 *current;
+  int changed;
+};
+
+struct state_base {
+  TCHAR fname[MAX_DPATH];
+  int count;
+  int lastuse;
+  struct state_base_ram rams[MAX_STATE_RAMS];
+};
+
+static struct state_base state_bases[MAX_STATE_BASES];
+static struct state_base *state_base;
+static int state_base_use;
+static int state_base_write, state_delta_write;
+
+static uae_u64 state_page_hash (const uae_u8 *p, int len)
+{
+  const uae_u32 *w = (const uae_u32 *)p;
+  uae_u32 h1 = 0x811c9dc5, h2 = 0x9e3779b9;
+  int i, n = len / 8;
+
+  /* every word goes into both lanes, two at a time */
+  for (i = 0; i < n; i++) {
+    uae_u32 a = w[i * 2 + 0], b = w[i * 2 + 1];
+    h1 = (h1 ^ a) * 0x01000193;
+    h2 = (h2 ^ a) * 0x85ebca6b;
+    h2 ^= h2 >> 15;
+    h1 = (h1 ^ b) * 0x01000193;
+    h2 = (h2 ^ b) * 0x85ebca6b;
+    h2 ^= h2 >> 15;
+  }
+  for (i = n * 8; i < len; i++) {
+    h1 = (h1 ^ p[i]) * 0x01000193;
+    h2 = (h2 ^ p[i]) * 0x85ebca6b;
+  }
+  return ((uae_u64)h1 << 32) | h2;
+}
+
+static void state_base_free (struct state_base *sb)
+{
+  int i;
+
+  for (i = 0; i < sb->count; i++) {
+    xfree (sb->rams[i].hashes);
+    xfree (sb->rams[i].current);
+  }
+  memset (sb, 0, sizeof *sb);
+}
+
+/* base belonging to BASENAME, else the least recently used one, emptied */
+static struct state_base *state_base_get (const TCHAR *basename)
+{
+  struct state_base *sb = NULL;
+  int i;
+
+  for (i = 0; i < MAX_STATE_BASES; i++) {
+    if (!_tcscmp (state_bases[i].fname, basename)) {
+      sb = &state_bases[i];
+      break;
+    }
+    if (!sb || state_bases[i].lastuse < sb->lastuse)
+      sb = &state_bases[i];
+  }
+  if (_tcscmp (sb->fname, basename))
+    state_base_free (sb);
+  sb->lastuse = ++state_base_use;
+  return sb;
+}
+
+/* hash current RAM, returns false if a new base is needed */
+static bool state_delta_prepare (const TCHAR *basename)
+{
+  struct state_ram rams[MAX_STATE_RAMS];
+  int n, i, j, pages, changed = 0, total = 0;
+  bool valid;
+
+  n = get_rams (rams);
+  state_base = state_base_get (basename);
+  valid = state_base->count == n && zfile_exists (basename);
+  for (i = 0; valid && i < n; i++) {
+    if (state_base->rams[i].len != (rams[i].mem ? rams[i].len : 0))
+      valid = false;
+  }
+  if (!valid) {
+    state_base_free (state_base);
+    state_base->count = n;
+    state_base->lastuse = state_base_use;
+  }
+  for (i = 0; i < n; i++) {
+    struct state_base_ram *b = &state_base->rams[i];
+    b->name = rams[i].name;
+    b->len = rams[i].mem ? rams[i].len : 0;
+    pages = (b->len + STATE_PAGE_SIZE - 1) / STATE_PAGE_SIZE;
+    if (!b->current && pages)
+      b->current = xmalloc (uae_u64, pages);
+    b->changed = 0;
+    for (j = 0; j < pages; j++) {
+      int off = j * STATE_PAGE_SIZE;
+      int plen = b->len - off < STATE_PAGE_SIZE ? b->len - off : STATE_PAGE_SIZE;
+      b->current[j] = state_page_hash (rams[i].mem + off, plen);
+      if (valid && b->current[j] != b->hashes[j])
+        b->changed++;
+    }
+    changed += b->changed;
+    total += pages;
+  }
+  /* rebase once the delta holds more than half of the memory */
+  if (valid && changed * 2 > total)
+    valid = false;
+  if (!valid) {
+    for (i = 0; i < n; i++) {
+      struct state_base_ram *b = &state_base->rams[i];
+      xfree (b->hashes);
+      b->hashes = b->current;
+      b->current = NULL;
+      pages = (b->len + STATE_PAGE_SIZE - 1) / STATE_PAGE_SIZE;
+      if (pages) {
+        b->current = xmalloc (uae_u64, pages);
+        memcpy (b->current, b->hashes, pages * sizeof (uae_u64));
+      }
+      b->changed = 0;
+    }
+  }
+  return valid;
+}
+
+#define STATE_PAGE_BATCH 256
+
+/* Writes the pages PAGE[0..count) of MEM, all of them in order if PAGE is
+ * NULL, with the fast codec: a compressed length per page, then the pages.
+ * Compresses a batch at a time on all cores. Returns the bytes written,
+ * -1 when out of memory. */
+static int save_pages (struct zfile *f, uae_u8 *mem, int len, const int *page, int count)
+{
+  struct state_page_job jobs[STATE_PAGE_BATCH];
+  int bound = zfile_lzbound (STATE_PAGE_SIZE);
+  uae_u8 *table, *buf, *dst;
+  size_t tablepos;
+  int i, j, n, total = count * 4;
+
+  table = xmalloc (uae_u8, count * 4 + 4);
+  buf = xmalloc (uae_u8, STATE_PAGE_BATCH * bound);
+  if (!table || !buf) {
+    xfree (table);
+    xfree (buf);
+    return -1;
+  }
+  /* lengths are known after compressing, the table is written again then */
+  tablepos = zfile_ftell (f);
+  memset (table, 0, count * 4);
+  zfile_fwrite (table, 1, count * 4, f);
+  dst = table;
+  for (i = 0; i < count; i += n) {
+    n = count - i < STATE_PAGE_BATCH ? count - i : STATE_PAGE_BATCH;
+    for (j = 0; j < n; j++) {
+      int off = (page ? page[i + j] : i + j) * STATE_PAGE_SIZE;
+      jobs[j].src = mem + off;
+      jobs[j].len = len - off < STATE_PAGE_SIZE ? len - off : STATE_PAGE_SIZE;
+      jobs[j].dst = buf + j * bound;
+    }
+    state_pages_run (jobs, n, true);
+    for (j = 0; j < n; j++) {
+      zfile_fwrite (jobs[j].dst, 1, jobs[j].complen, f);
+      save_u32 (jobs[j].complen);
+      total += jobs[j].complen;
+    }
+  }
+  zfile_fseek (f, tablepos, SEEK_SET);
+  zfile_fwrite (table, 1, count * 4, f);
+  zfile_fseek (f, 0, SEEK_END);
+  xfree (buf);
+  xfree (table);
+  return total;
+}
+
+/* Chunk of NAME at POS is LEN bytes long after its flags: patch the size
+ * and align */
+static void save_chunk_end (struct zfile *f, size_t pos, int len)
+{
+  uae_u8 tmp[4], *dst = tmp;
+  uae_u8 zero[4] = { 0, 0, 0, 0 };
+
+  zfile_fseek (f, pos, SEEK_SET);
+  save_u32 (4 + 4 + 4 + len);
+  zfile_fwrite (tmp, 1, 4, f);
+  zfile_fseek (f, 0, SEEK_END);
+  /* same alignment rule as save_chunk, which excludes the size field */
+  zfile_fwrite (zero, 1, 4 - ((len - 4) & 3), f);
+}
+
+/* whole RAM bank, every page compressed on its own */
+static void save_chunk_pages (struct zfile *f, struct state_ram *ram)
+{
+  uae_u8 tmp[16], *dst;
+  size_t pos;
+  int pages = (ram->len + STATE_PAGE_SIZE - 1) / STATE_PAGE_SIZE, len;
+
+  zfile_fwrite ((void*)ram->name, 1, 4, f);
+  pos = zfile_ftell (f);
+  dst = tmp;
+  save_u32 (0);
+  save_u32 (CHUNK_PAGES);
+  save_u32 (ram->len);
+  save_u32 (STATE_PAGE_SIZE);
+  zfile_fwrite (tmp, 1, 16, f);
+  dst = tmp;
+  save_u32 (pages);
+  zfile_fwrite (tmp, 1, 4, f);
+  len = save_pages (f, ram->mem, ram->len, NULL, pages);
+  if (len < 0)
+    len = 0;
+  save_chunk_end (f, pos, 4 + 4 + 4 + len);
+  write_log (_T("Chunk '%s' %d pages, %d bytes\n"), ram->name, pages, len);
+}
+
+static void save_chunk_delta (struct zfile *f, struct state_ram *ram, struct state_base_ram *b)
+{
+  uae_u8 tmp[8], *dst, *hdr;
+  int *list;
+  size_t pos;
+  int pages, i, n = 0, hdrlen, datalen;
+
+  pages = (b->len + STATE_PAGE_SIZE - 1) / STATE_PAGE_SIZE;
+  hdr = xmalloc (uae_u8, 4 * 4 + _tcslen (state_base->fname) + 1 + b->changed * 4);
+  list = xmalloc (int, b->changed + 1);
+  if (!hdr || !list) {
+    xfree (hdr);
+    xfree (list);
+    return;
+  }
+  dst = hdr;
+  save_u32 (b->len);
+  save_u32 (b->filepos);
+  save_u32 (STATE_PAGE_SIZE);
+  save_string (state_base->fname);
+  save_u32 (b->changed);
+  for (i = 0; i < pages; i++) {
+    if (b->current[i] != b->hashes[i]) {
+      save_u32 (i);
+      list[n++] = i;
+    }
+  }
+  hdrlen = dst - hdr;
+
+  /* chunk name, size and flags, same layout as a compressed chunk */
+  zfile_fwrite ((void*)ram->name, 1, 4, f);
+  pos = zfile_ftell (f);
+  dst = tmp;
+  save_u32 (0);
+  save_u32 (CHUNK_DELTA | CHUNK_PAGES);
+  zfile_fwrite (tmp, 1, 8, f);
+  zfile_fwrite (hdr, 1, hdrlen, f);
+  datalen = save_pages (f, ram->mem, b->len, list, n);
+  if (datalen < 0)
+    datalen = 0;
+  save_chunk_end (f, pos, hdrlen + datalen);
+  xfree (list);
+  xfree (hdr);
+
+  write_log (_T("Chunk '%s' delta %d of %d pages, %d bytes\n"), ram->name, b->changed, pages, datalen);
+}
+
+/* placeholder for RAM held by the rewind buffer */
+static void save_chunk_rewind (struct zfile *f, struct state_ram *ram, int bank)
+{
+  uae_u8 tmp[16], *dst;
+
+  zfile_fwrite ((void*)ram->name, 1, 4, f);
+  dst = tmp;
+  save_u32 (4 + 4 + 4 + 4 + 4);
+  save_u32 (CHUNK_REWIND);
+  save_u32 (ram->len);
+  /* bank number, then alignment */
+  save_u32 (bank);
+  zfile_fwrite (tmp, 1, 16, f);
+  dst = tmp;
+  save_u32 (0);
+  zfile_fwrite (tmp, 1, 4, f);
+}
+
+static void save_rams (struct zfile *f, int comp)
+{
+  struct state_ram rams[MAX_STATE_RAMS];
+  int i, n;
+
+  n = get_rams (rams);
+  for (i = 0; i < n; i++) {
+    if (savestate_rewinding && rams[i].mem) {
+      save_chunk_rewind (f, &rams[i], i);
+      continue;
+    }
+    if (state_delta_write && rams[i].mem) {
+      save_chunk_delta (f, &rams[i], &state_base->rams[i]);
+      continue;
+    }
+    if (state_base_write && rams[i].mem) {
+      state_base->rams[i].filepos = zfile_ftell (f) + 4;
+      save_chunk_pages (f, &rams[i]);
+      continue;
+    }
+    save_chunk (f, rams[i].mem, rams[i].len, (TCHAR*)rams[i].name, comp);
+  }
 }
 
 /* Save all subsystems  */
@@ -596,7 +1158,8 @@ static int save_state_internal (struct zfile *f, const TCHAR *description, int c
   TCHAR name[5];
 	int i, len;
 
-	write_log (_T("STATESAVE (%s):\n"), f ? zfile_getname (f) : _T("<internal>"));
+  if (!savestate_rewinding)
+	  write_log (_T("STATESAVE (%s):\n"), f ? zfile_getname (f) : _T("<internal>"));
   dst = header;
   save_u32 (0);
   save_string(_T("UAE"));
@@ -695,6 +1258,7 @@ static int save_state_internal (struct zfile *f, const TCHAR *description, int c
 #ifdef PICASSO96
 	dst = save_p96 (&len, 0);
 	save_chunk (f, dst, len, _T("P96 "), 0);
+  xfree (dst);
 #endif
   save_rams (f, comp);
 
@@ -740,9 +1304,28 @@ int save_state (const TCHAR *filename, const TCHAR *description)
 	new_blitter = false;
   savestate_nodialogs = 0;
   custom_prepare_savestate ();
+  if (savestate_incremental && !savestate_specialdump) {
+    TCHAR basename[MAX_DPATH];
+    _stprintf (basename, _T("%s.base"), filename);
+    if (!state_delta_prepare (basename)) {
+      struct zfile *fb = zfile_fopen (basename, _T("w+b"), 0);
+      if (!fb) {
+        state_base_free (state_base);
+        return 0;
+      }
+      state_base_write = 1;
+      save_state_internal (fb, description, 0, true);
+      state_base_write = 0;
+      zfile_fclose (fb);
+      _tcscpy (state_base->fname, basename);
+    }
+    state_delta_write = 1;
+  }
 	f = zfile_fopen (filename, _T("w+b"), 0);
-  if (!f)
+  if (!f) {
+    state_delta_write = 0;
   	return 0;
+  }
   if (savestate_specialdump) {
     size_t pos;
     pos = zfile_ftell(f);
@@ -751,6 +1334,7 @@ int save_state (const TCHAR *filename, const TCHAR *description)
     return 1;
   }
 	int v = save_state_internal (f, description, comp, true);
+  state_delta_write = 0;
 	if (v)
     write_log (_T("Save of '%s' complete\n"), filename);
   zfile_fclose (f);
@@ -758,15 +1342,571 @@ int save_state (const TCHAR *filename, const TCHAR *description)
 	return v;
 }
 
+/* Rewind: every few frames the state without RAM is saved into memory and
+ * RAM is compared page by page against a shadow copy. Changed pages are
+ * copied into the shadow and their old contents kept with the snapshot,
+ * so stepping back just puts those pages back in reverse order. */
+
+#define MAX_REWIND_SNAPS 1024
+
+struct rewind_snap {
+  uae_u8 *state;
+  int statelen;
+  uae_u32 *undoidx;
+  uae_u8 *undodata;
+  int undocount, undoalloc;
+  size_t size;
+};
+
+struct rewind_bank {
+  uae_u8 *copy;
+  int len;
+};
+
+static struct rewind_snap *rewind_snaps[MAX_REWIND_SNAPS];
+static int rewind_first, rewind_count;
+static struct rewind_bank rewind_banks[MAX_STATE_RAMS];
+static int rewind_bank_count;
+static size_t rewind_size;
+static bool rewind_over_budget;
+
+static void rewind_free_snap (struct rewind_snap *rs)
+{
+  rewind_size -= rs->size;
+  xfree (rs->state);
+  xfree (rs->undoidx);
+  xfree (rs->undodata);
+  xfree (rs);
+}
+
+static void rewind_drop_oldest (void)
+{
+  rewind_free_snap (rewind_snaps[rewind_first]);
+  rewind_snaps[rewind_first] = NULL;
+  rewind_first = (rewind_first + 1) % MAX_REWIND_SNAPS;
+  rewind_count--;
+}
+
+/* put the shadow pages changed by RS back */
+static void rewind_undo (struct rewind_snap *rs)
+{
+  int i;
+
+  for (i = rs->undocount - 1; i >= 0; i--) {
+    struct rewind_bank *rb = &rewind_banks[rs->undoidx[i] >> 24];
+    int off = (rs->undoidx[i] & 0xffffff) * STATE_PAGE_SIZE;
+    int plen = rb->len - off < STATE_PAGE_SIZE ? rb->len - off : STATE_PAGE_SIZE;
+    memcpy (rb->copy + off, rs->undodata + i * STATE_PAGE_SIZE, plen);
+  }
+}
+
+/* go back from the newest snapshot to the one before it */
+static void rewind_pop (void)
+{
+  int idx = (rewind_first + rewind_count - 1) % MAX_REWIND_SNAPS;
+  struct rewind_snap *rs = rewind_snaps[idx];
+
+  rewind_undo (rs);
+  rewind_free_snap (rs);
+  rewind_snaps[idx] = NULL;
+  rewind_count--;
+}
+
+void savestate_rewind_reset (void)
+{
+  int i;
+
+  while (rewind_count > 0)
+    rewind_drop_oldest ();
+  for (i = 0; i < rewind_bank_count; i++)
+    xfree (rewind_banks[i].copy);
+  memset (rewind_banks, 0, sizeof rewind_banks);
+  rewind_bank_count = 0;
+  rewind_first = 0;
+  rewind_size = 0;
+  rewind_frames = 0;
+}
+
+static bool rewind_ram (int bank, uae_u8 *memory, int len)
+{
+  if (bank < 0 || bank >= rewind_bank_count || rewind_banks[bank].len != len || !rewind_banks[bank].copy)
+    return false;
+  memcpy (memory, rewind_banks[bank].copy, len);
+  return true;
+}
+
+static bool rewind_add_undo (struct rewind_snap *rs, int bank, int page, const uae_u8 *old, int len)
+{
+  if (rs->undocount >= rs->undoalloc) {
+    int n = rs->undoalloc ? rs->undoalloc * 2 : 64;
+    uae_u32 *idx = xrealloc (uae_u32, rs->undoidx, n);
+    if (!idx)
+      return false;
+    rs->undoidx = idx;
+    uae_u8 *data = xrealloc (uae_u8, rs->undodata, n * STATE_PAGE_SIZE);
+    if (!data)
+      return false;
+    rs->undodata = data;
+    rs->undoalloc = n;
+  }
+  rs->undoidx[rs->undocount] = (bank << 24) | page;
+  memcpy (rs->undodata + rs->undocount * STATE_PAGE_SIZE, old, len);
+  rs->undocount++;
+  return true;
+}
+
+/* Returns 0 when out of memory, -1 when the compare ran past BUDGET
+ * microseconds after START (the shadow is left as it was), 1 when done. */
+static int rewind_capture_ram (struct rewind_snap *rs, frame_time_t start, int budget)
+{
+  struct state_ram rams[MAX_STATE_RAMS];
+  int n, i, j;
+  bool same;
+
+  n = get_rams (rams);
+  same = n == rewind_bank_count;
+  for (i = 0; same && i < n; i++) {
+    if (rewind_banks[i].len != (rams[i].mem ? rams[i].len : 0))
+      same = false;
+  }
+  if (!same) {
+    /* memory layout changed, older snapshots are useless */
+    savestate_rewind_reset ();
+    rewind_bank_count = n;
+    for (i = 0; i < n; i++) {
+      struct rewind_bank *rb = &rewind_banks[i];
+      rb->len = rams[i].mem ? rams[i].len : 0;
+      if (!rb->len)
+        continue;
+      rb->copy = xmalloc (uae_u8, rb->len);
+      if (!rb->copy)
+        return 0;
+      memcpy (rb->copy, rams[i].mem, rb->len);
+      rewind_size += rb->len;
+    }
+    return 1;
+  }
+  for (i = 0; i < n; i++) {
+    struct rewind_bank *rb = &rewind_banks[i];
+    for (j = 0; j * STATE_PAGE_SIZE < rb->len; j++) {
+      int off = j * STATE_PAGE_SIZE;
+      int plen = rb->len - off < STATE_PAGE_SIZE ? rb->len - off : STATE_PAGE_SIZE;
+      /* check the clock every 64k */
+      if (budget > 0 && (j & 15) == 15 && (int)(read_processor_time () - start) > budget) {
+        rewind_undo (rs);
+        return -1;
+      }
+      if (!memcmp (rams[i].mem + off, rb->copy + off, plen))
+        continue;
+      if (!rewind_add_undo (rs, i, j, rb->copy + off, plen))
+        return 0;
+      memcpy (rb->copy + off, rams[i].mem + off, plen);
+    }
+  }
+  return 1;
+}
+
+/* called every frame */
+void savestate_capture (void)
+{
+  struct rewind_snap *rs;
+  struct zfile *f;
+  frame_time_t start;
+  size_t maxsize;
+  int ok;
+
+  if (!currprefs.pandora_rewind_interval) {
+    if (rewind_bank_count)
+      savestate_rewind_reset ();
+    return;
+  }
+  if (savestate_state || quit_program || runahead_phase)
+    return;
+  if (++rewind_frames < currprefs.pandora_rewind_interval)
+    return;
+  if (!save_filesys_cando ())
+    return;
+  rewind_frames = 0;
+  start = read_processor_time ();
+
+  rs = xcalloc (struct rewind_snap, 1);
+  if (!rs)
+    return;
+  f = zfile_fopen_empty (NULL, _T("rewind"));
+  if (!f) {
+    xfree (rs);
+    return;
+  }
+  savestate_rewinding = 1;
+  custom_prepare_savestate ();
+  save_state_internal (f, _T("rewind"), 0, true);
+  savestate_rewinding = 0;
+  rs->statelen = zfile_ftell (f);
+  rs->state = zfile_getdata (f, 0, rs->statelen);
+  zfile_fclose (f);
+  ok = rs->state ? rewind_capture_ram (rs, start, currprefs.pandora_rewind_budget) : 0;
+  if (!ok) {
+		write_log (_T("Rewind: out of memory, buffer cleared\n"));
+    rewind_free_snap (rs);
+    savestate_rewind_reset ();
+    return;
+  }
+  /* a capture never costs more than the budget: drop this one and try
+   * again after the next interval */
+  if (ok < 0) {
+    if (!rewind_over_budget)
+      write_log (_T("Rewind: capture over %d us budget, skipped\n"), currprefs.pandora_rewind_budget);
+    rewind_over_budget = true;
+    rewind_free_snap (rs);
+    return;
+  }
+  rewind_over_budget = false;
+  rs->size = sizeof (struct rewind_snap) + rs->statelen + rs->undoalloc * (sizeof (uae_u32) + STATE_PAGE_SIZE);
+  rewind_size += rs->size;
+  if (rewind_count == MAX_REWIND_SNAPS)
+    rewind_drop_oldest ();
+  rewind_snaps[(rewind_first + rewind_count) % MAX_REWIND_SNAPS] = rs;
+  rewind_count++;
+  maxsize = (size_t)currprefs.pandora_rewind_memory * 1024 * 1024;
+  while (rewind_count > 1 && rewind_size > maxsize)
+    rewind_drop_oldest ();
+}
+
+static bool rewind_prepare (void)
+{
+  struct rewind_snap *rs;
+
+  if (!rewind_count)
+    return false;
+  /* a snapshot taken a moment ago is not worth going back to */
+  if (rewind_count > 1 && rewind_frames < currprefs.pandora_rewind_interval / 2)
+    rewind_pop ();
+  rs = rewind_snaps[(rewind_first + rewind_count - 1) % MAX_REWIND_SNAPS];
+  rewind_restore_file = zfile_fopen_data (_T("rewind"), rs->statelen, rs->state);
+  if (!rewind_restore_file)
+    return false;
+  rewind_restoring = 1;
+  return true;
+}
+
 bool savestate_check (void)
 {
 	if (savestate_state == STATE_DORESTORE) {
 		savestate_state = STATE_RESTORE;
 		return true;
 	}
+	if (savestate_state == STATE_DOREWIND) {
+		savestate_state = 0;
+		if (!rewind_prepare ())
+			return false;
+		savestate_state = STATE_RESTORE;
+		return true;
+	}
 	return false;
 }
 
+/* Run-ahead: in the last lines of a real frame the machine is snapshotted
+ * and then runs pandora_runahead frames further, silent and with the live
+ * input. The last of those is drawn and shown as soon as it is done, then
+ * the snapshot is put back and the real timeline goes on with sound. The
+ * frame shown is as many frames ahead as configured, and as snapshot and
+ * restore both happen before a vsync, that vsync paces and reads the input
+ * for the real frame; a real frame that could not be snapshotted is shown
+ * like any other. Chip registers go through the usual chunk functions, CPU,
+ * event and audio timing are copied as they are, and RAM sits in a shadow
+ * copy of which only differing pages are copied. */
+
+/* all of RAM is compared twice per real frame, that is about 0.1 ms per MB
+   on a desktop and several times that on the handhelds */
+#define RUNAHEAD_MAX_RAM (16 * 1024 * 1024)
+/* lines before the vsync in which the snapshot is tried and the restore done */
+#define RUNAHEAD_SNAPSHOT_LINES 16
+#define RUNAHEAD_RESTORE_LINES 2
+/* snapshots and restores that are timed before the cost is judged */
+#define RUNAHEAD_COST_FRAMES 50
+#define RUNAHEAD_SNAPSHOT 1
+#define RUNAHEAD_RESTORE 2
+
+int runahead_phase, runahead_next, runahead_frames;
+int runahead_pending, runahead_restoring;
+static uae_u8 *runahead_state;
+static int runahead_state_size;
+static struct rewind_bank runahead_banks[MAX_STATE_RAMS];
+static int runahead_bank_count;
+static bool runahead_off;
+static frame_time_t runahead_cost;
+static int runahead_cost_frames;
+
+void savestate_runahead_reset (void)
+{
+  int i;
+
+  for (i = 0; i < runahead_bank_count; i++)
+    xfree (runahead_banks[i].copy);
+  memset (runahead_banks, 0, sizeof runahead_banks);
+  runahead_bank_count = 0;
+  runahead_off = false;
+  runahead_cost = 0;
+  runahead_cost_frames = 0;
+  runahead_phase = runahead_next = runahead_frames = 0;
+  runahead_pending = 0;
+}
+
+/* anything that talks to the host or to disks can not be taken back */
+static bool runahead_allowed (void)
+{
+  int i;
+
+  if (currprefs.pandora_runahead <= 0 || runahead_off)
+    return false;
+  if (savestate_state || quit_program || picasso_on)
+    return false;
+  for (i = 0; i < 4; i++) {
+    if (gui_data.drive_motor[i])
+      return false;
+  }
+  if (gui_data.hd || !save_filesys_cando ())
+    return false;
+  return true;
+}
+
+/* snapshot and restore must leave most of the frame to the frames ahead */
+static void runahead_account (frame_time_t start, bool restore)
+{
+  unsigned long avg;
+
+  runahead_cost += read_processor_time () - start;
+  if (!restore || ++runahead_cost_frames < RUNAHEAD_COST_FRAMES)
+    return;
+  avg = runahead_cost / runahead_cost_frames;
+  if (avg > time_per_frame / 4) {
+		write_log (_T("Run-ahead: snapshot and restore take %lu us per frame, switched off\n"), avg);
+    runahead_off = true;
+  }
+  runahead_cost = 0;
+  runahead_cost_frames = 0;
+}
+
+static bool runahead_capture_ram (void)
+{
+  struct state_ram rams[MAX_STATE_RAMS];
+  int n, i, j, total;
+  bool same;
+
+  n = get_rams (rams);
+  same = n == runahead_bank_count;
+  total = 0;
+  for (i = 0; i < n; i++) {
+    int len = rams[i].mem ? rams[i].len : 0;
+    if (runahead_banks[i].len != len)
+      same = false;
+    total += len;
+  }
+  if (total > RUNAHEAD_MAX_RAM) {
+		write_log (_T("Run-ahead: %d KB of RAM is too much to snapshot every frame\n"), total / 1024);
+    runahead_off = true;
+    return false;
+  }
+  if (!same) {
+    for (i = 0; i < runahead_bank_count; i++)
+      xfree (runahead_banks[i].copy);
+    memset (runahead_banks, 0, sizeof runahead_banks);
+    runahead_bank_count = n;
+    for (i = 0; i < n; i++) {
+      struct rewind_bank *rb = &runahead_banks[i];
+      rb->len = rams[i].mem ? rams[i].len : 0;
+      if (!rb->len)
+        continue;
+      rb->copy = xmalloc (uae_u8, rb->len);
+      if (!rb->copy) {
+        runahead_bank_count = i;
+        return false;
+      }
+      memcpy (rb->copy, rams[i].mem, rb->len);
+    }
+    return true;
+  }
+  for (i = 0; i < n; i++) {
+    struct rewind_bank *rb = &runahead_banks[i];
+    for (j = 0; j < rb->len; j += STATE_PAGE_SIZE) {
+      int plen = rb->len - j < STATE_PAGE_SIZE ? rb->len - j : STATE_PAGE_SIZE;
+      if (memcmp (rams[i].mem + j, rb->copy + j, plen))
+        memcpy (rb->copy + j, rams[i].mem + j, plen);
+    }
+  }
+  return true;
+}
+
+static void runahead_restore_ram (void)
+{
+  struct state_ram rams[MAX_STATE_RAMS];
+  int n, i, j;
+
+  n = get_rams (rams);
+  for (i = 0; i < n && i < runahead_bank_count; i++) {
+    struct rewind_bank *rb = &runahead_banks[i];
+    if (!rb->len || !rams[i].mem || rams[i].len != rb->len)
+      continue;
+    for (j = 0; j < rb->len; j += STATE_PAGE_SIZE) {
+      int plen = rb->len - j < STATE_PAGE_SIZE ? rb->len - j : STATE_PAGE_SIZE;
+      if (memcmp (rams[i].mem + j, rb->copy + j, plen))
+        memcpy (rams[i].mem + j, rb->copy + j, plen);
+    }
+  }
+}
+
+/* Every chunk is saved into a buffer of its own, sized by the chunk, and
+ * appended to the snapshot, which grows to the real chunk lengths. Returns
+ * the new end of the snapshot, NULL if memory ran out. */
+static uae_u8 *runahead_add (uae_u8 *dst, uae_u8 *chunk, int len)
+{
+  int pos;
+
+  if (!dst || !chunk) {
+    xfree (chunk);
+    return NULL;
+  }
+  pos = dst - runahead_state;
+  if (pos + len > runahead_state_size) {
+    uae_u8 *p = xrealloc (uae_u8, runahead_state, pos + len);
+    if (!p) {
+      xfree (chunk);
+      return NULL;
+    }
+    runahead_state = p;
+    runahead_state_size = pos + len;
+    dst = p + pos;
+  }
+  memcpy (dst, chunk, len);
+  xfree (chunk);
+  return dst + len;
+}
+
+static bool runahead_save (void)
+{
+  uae_u8 *dst, *chunk;
+  int i, len;
+
+  if (!runahead_state) {
+    runahead_state = xmalloc (uae_u8, 1);
+    if (!runahead_state)
+      return false;
+    runahead_state_size = 0;
+  }
+  if (!runahead_capture_ram ())
+    return false;
+  /* CIAs first, saving them brings the CIA event up to date */
+  dst = runahead_state;
+  chunk = save_cia (0, &len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_cia (1, &len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_cpu_runahead (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_custom_runahead (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_custom (&len, NULL, 0);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_blitter_new (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_custom_agacolors (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  for (i = 0; i < 8; i++) {
+    chunk = save_custom_sprite (i, &len, NULL);
+    dst = runahead_add (dst, chunk, len);
+  }
+  chunk = save_audio_runahead (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_keyboard (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  chunk = save_keybuf_runahead (&len, NULL);
+  dst = runahead_add (dst, chunk, len);
+  return dst != NULL;
+}
+
+static void runahead_restore (void)
+{
+  uae_u8 *src;
+  int i;
+
+  runahead_restoring = 1;
+  runahead_restore_ram ();
+  src = runahead_state;
+  src = restore_cia (0, src);
+  src = restore_cia (1, src);
+  src = restore_cpu_runahead (src);
+  src = restore_custom_runahead (src);
+  src = restore_custom (src);
+  src = restore_blitter_new (src);
+  src = restore_custom_agacolors (src);
+  for (i = 0; i < 8; i++)
+    src = restore_custom_sprite (i, src);
+  src = restore_audio_runahead (src);
+  src = restore_keyboard (src);
+  restore_keybuf_runahead (src);
+  restore_custom_runahead_finish ();
+  restore_cia_finish ();
+  runahead_restoring = 0;
+}
+
+/* called at the start of every vsync, before the frame that ended is shown
+ * and the next one paced. runahead_next tells what the next frame is: 0 for
+ * a real frame, then the frames ahead up to runahead_frames, which is drawn */
+void savestate_runahead_vsync (void)
+{
+  if (!runahead_phase) {
+    runahead_next = 0;
+    runahead_frames = runahead_allowed () ? currprefs.pandora_runahead : 0;
+    runahead_pending = runahead_frames ? RUNAHEAD_SNAPSHOT : 0;
+    return;
+  }
+  if (runahead_next < runahead_frames) {
+    runahead_next++;
+    if (runahead_next == runahead_frames)
+      runahead_pending = RUNAHEAD_RESTORE;
+  } else {
+    /* the restore missed the end of the frame shown, go on unseen until it happens */
+    runahead_next = runahead_frames + 1;
+  }
+}
+
+/* the CPU is stopped at the next instruction boundary for the work: the
+ * snapshot is tried in the last lines of a real frame, the restore waits
+ * for the end of the frame ahead that is shown */
+void savestate_runahead_hsync (int lines_left)
+{
+  if (runahead_pending == RUNAHEAD_SNAPSHOT && lines_left > RUNAHEAD_SNAPSHOT_LINES)
+    return;
+  if (runahead_pending == RUNAHEAD_RESTORE && runahead_next == runahead_frames && lines_left > RUNAHEAD_RESTORE_LINES)
+    return;
+  set_special (regs, SPCFLAG_RUNAHEAD);
+}
+
+void savestate_runahead_step (void)
+{
+  frame_time_t start;
+
+  if (runahead_pending == RUNAHEAD_RESTORE) {
+    runahead_pending = 0;
+    runahead_show_frame ();
+    start = read_processor_time ();
+    runahead_restore ();
+    runahead_phase = 0;
+    runahead_account (start, true);
+    return;
+  }
+  /* chunks only hold an idle blitter, the next line tries again */
+  if (bltstate != BLT_done)
+    return;
+  runahead_pending = 0;
+  start = read_processor_time ();
+  if (!runahead_save ()) {
+    runahead_frames = 0;
+    return;
+  }
+  runahead_account (start, false);
+  runahead_phase = 1;
+}
 
 /*
 
@@ -788,6 +1928,13 @@ HUNK HEADER (beginning of every hunk)
         hunk flags             
 
         bit 0 = chunk contents are compressed with zlib (maybe RAM chunks only?)
+        bit 1 = RAM chunk only holds pages changed since a base statefile:
+                uncompressed size, chunk position in base file, page size,
+                base file name, page count, page numbers, page data
+        bit 3 = RAM pages compressed one by one in the LZ4 block format:
+                uncompressed size, page size, page count (only without
+                bit 1), compressed length of each page, page data. A page
+                whose length equals the page size is stored raw.
 
 HEADER
 